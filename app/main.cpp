@@ -127,7 +127,9 @@ int main(int argc, char* argv[])
 {
 	qtwebapp::LoggerWithFile *logger = new qtwebapp::LoggerWithFile(qApp);
     logger->installMsgHandler();
+    logger->startAsync();
 	int res = runQtApplication(argc, argv, logger);
 	qWarning("SDRangel quit.");
+	logger->stopAsync();
 	return res;
 }
@@ -0,0 +1,206 @@
+/**
+  @file
+  @author Stefan Frings
+*/
+
+#include "httpconnection.h"
+#include "httpresponse.h"
+
+using namespace qtwebapp;
+
+HttpConnection::HttpConnection(tSocketDescriptor socketDescriptor, const HttpListenerSettings* settings, HttpRequestHandler* requestHandler, QObject* parent)
+    : QObject(parent)
+{
+    Q_ASSERT(settings != 0);
+    Q_ASSERT(requestHandler != 0);
+    this->listenerSettings = settings;
+    this->requestHandler = requestHandler;
+    currentRequest = 0;
+    requestCount = 0;
+    closing = false;
+
+    socket = new QTcpSocket(this);
+    valid = socket->setSocketDescriptor(socketDescriptor);
+
+    if (!valid)
+    {
+        qCritical("HttpConnection (%p): cannot initialize socket: %s", this, qPrintable(socket->errorString()));
+        deleteLater();
+        return;
+    }
+
+    // Small responses are sent as soon as they are written
+    socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+
+    // Reading is resumed when output that was holding it back has been sent
+    connect(socket, SIGNAL(readyRead()), SLOT(read()));
+    connect(socket, SIGNAL(bytesWritten(qint64)), SLOT(read()));
+    connect(socket, SIGNAL(disconnected()), SLOT(disconnected()));
+    connect(&readTimer, SIGNAL(timeout()), SLOT(readTimeout()));
+    readTimer.setSingleShot(true);
+    readTimer.start(listenerSettings->readTimeout);
+
+#ifdef SUPERVERBOSE
+    qDebug("HttpConnection (%p): new connection from %s", this, qPrintable(socket->peerAddress().toString()));
+#endif
+}
+
+
+HttpConnection::~HttpConnection()
+{
+    delete currentRequest;
+#ifdef SUPERVERBOSE
+    qDebug("HttpConnection (%p): destroyed", this);
+#endif
+}
+
+
+void HttpConnection::readTimeout()
+{
+#ifdef SUPERVERBOSE
+    qDebug("HttpConnection (%p): read timeout occured", this);
+#endif
+    closeGracefully();
+}
+
+
+void HttpConnection::disconnected()
+{
+    readTimer.stop();
+    socket->disconnect(this);
+    emit closed();
+    deleteLater();
+}
+
+
+void HttpConnection::closeGracefully()
+{
+    if (closing) {
+        return;
+    }
+
+    closing = true;
+    readTimer.stop();
+    delete currentRequest;
+    currentRequest = 0;
+
+    // Pending output is sent before the connection is actually closed
+    if (socket->state() == QAbstractSocket::UnconnectedState) {
+        disconnected();
+    } else {
+        socket->disconnectFromHost();
+    }
+}
+
+
+void HttpConnection::read()
+{
+    // The loop adds support for HTTP pipelining. It stops when the client does not read its responses.
+    while (!closing && socket->bytesAvailable() && (socket->bytesToWrite() < maxPendingOutput))
+    {
+        // Create new HttpRequest object if necessary
+        if (!currentRequest)
+        {
+            currentRequest = new HttpRequest(listenerSettings);
+        }
+
+        // Collect data for the request object
+        while (socket->bytesAvailable() && currentRequest->getStatus()!=HttpRequest::complete && currentRequest->getStatus()!=HttpRequest::abort)
+        {
+            currentRequest->readFromSocket(socket);
+            if (currentRequest->getStatus()==HttpRequest::waitForBody)
+            {
+                // Restart timer for read timeout, otherwise it would
+                // expire during large uploads.
+                readTimer.start(listenerSettings->readTimeout);
+            }
+        }
+
+        // If the request is aborted, return error message and close the connection
+        if (currentRequest->getStatus()==HttpRequest::abort)
+        {
+            socket->write("HTTP/1.1 413 entity too large\r\nConnection: close\r\nContent-Length: 21\r\n\r\n413 Entity too large\n");
+            closeGracefully();
+            return;
+        }
+
+        // If the request is complete, let the request handler process it
+        if (currentRequest->getStatus()==HttpRequest::complete)
+        {
+            bool keepAlive = processRequest();
+            delete currentRequest;
+            currentRequest = 0;
+
+            if (!keepAlive)
+            {
+                closeGracefully();
+                return;
+            }
+        }
+    }
+}
+
+
+bool HttpConnection::processRequest()
+{
+    readTimer.stop();
+    requestCount++;
+
+    HttpResponse response(socket, false);
+    bool closeConnection = QString::compare(currentRequest->getHeader("Connection"),"close",Qt::CaseInsensitive)==0;
+
+    // HTTP/1.0 clients must ask explicitly to keep the connection alive.
+    // Without it add the Connection:close header so that the HttpResponse does not activate chunked mode.
+    if (!closeConnection && QString::compare(currentRequest->getVersion(),"HTTP/1.0",Qt::CaseInsensitive)==0)
+    {
+        closeConnection = QString::compare(currentRequest->getHeader("Connection"),"keep-alive",Qt::CaseInsensitive)!=0;
+    }
+
+    // Limit the number of requests served on one connection
+    if (!closeConnection && (listenerSettings->maxKeepAliveRequests > 0) && (requestCount >= listenerSettings->maxKeepAliveRequests))
+    {
+        closeConnection = true;
+    }
+
+    if (closeConnection) {
+        response.setHeader("Connection","close");
+    }
+
+    try
+    {
+        requestHandler->service(*currentRequest, response);
+    }
+    catch (...)
+    {
+        qCritical("HttpConnection (%p): An uncatched exception occured in the request handler",this);
+    }
+
+    // Finalize sending the response if not already done
+    if (!response.hasSentLastPart())
+    {
+        response.write(QByteArray(),true);
+    }
+
+    if (!closeConnection)
+    {
+        // Maybe the request handler added a Connection:close header in the meantime
+        if (QString::compare(response.getHeaders().value("Connection"),"close",Qt::CaseInsensitive)==0)
+        {
+            closeConnection = true;
+        }
+        // Without Content-Length header nor chunked mode the end of the response is signalled by closing the connection
+        else if (!response.getHeaders().contains("Content-Length")
+            && QString::compare(response.getHeaders().value("Transfer-Encoding"),"chunked",Qt::CaseInsensitive)!=0)
+        {
+            closeConnection = true;
+        }
+    }
+
+    if (!closeConnection)
+    {
+        // Start timer for next request (keep-alive timeout)
+        readTimer.start(listenerSettings->readTimeout);
+    }
+
+    return !closeConnection;
+}
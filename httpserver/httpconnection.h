@@ -0,0 +1,112 @@
+/**
+  @file
+  @author Stefan Frings
+*/
+
+#ifndef HTTPCONNECTION_H
+#define HTTPCONNECTION_H
+
+#include <QTcpSocket>
+#include <QTimer>
+#include "httpglobal.h"
+#include "httprequest.h"
+#include "httprequesthandler.h"
+#include "httplistenersettings.h"
+#include "httpconnectionhandler.h"
+
+namespace qtwebapp {
+
+/**
+  One HTTP connection served by the event loop of a HttpWorker. Unlike HttpConnectionHandler,
+  it does not own a thread: a worker thread serves many connections and the connection never
+  blocks on the socket. Incoming data is parsed as it arrives. When several requests have been
+  received (HTTP pipelining) they are processed in order and the responses are queued in the
+  socket output buffer. Reading stops while the output buffer is above maxPendingOutput so that
+  a client that does not read its responses cannot make the server buffer without limit.
+  <p>
+  The connection is kept alive between requests (HTTP/1.1 keep-alive) until:
+  <ul>
+  <li>the client asks for it to be closed or uses HTTP/1.0 without keep-alive,</li>
+  <li>no complete request has been received within readTimeout,</li>
+  <li>maxKeepAliveRequests requests have been served,</li>
+  <li>the request is larger than maxRequestSize (413 is returned then).</li>
+  </ul>
+  The connection deletes itself after the socket is disconnected.
+*/
+class DECLSPEC HttpConnection : public QObject {
+    Q_OBJECT
+    Q_DISABLE_COPY(HttpConnection)
+
+public:
+
+    /**
+      Constructor. Must be called in the thread of the worker that serves the connection.
+      @param socketDescriptor references the accepted connection.
+      @param settings Configuration settings of the HTTP webserver as a structure
+      @param requestHandler Handler that will process each incoming HTTP request
+      @param parent Parent object, normally the worker
+    */
+    HttpConnection(tSocketDescriptor socketDescriptor, const HttpListenerSettings* settings, HttpRequestHandler* requestHandler, QObject* parent = NULL);
+
+    /** Destructor */
+    virtual ~HttpConnection();
+
+    /** Returns false if the socket could not be initialized. The connection is then deleted later. */
+    bool isValid() const { return valid; }
+
+    /** Size of the socket output buffer above which no more requests are read. */
+    static const qint64 maxPendingOutput = 262144;
+
+signals:
+
+    /** Emitted once when the connection is closed, just before it is deleted. */
+    void closed();
+
+private:
+
+    /** Configuration settings */
+    const HttpListenerSettings* listenerSettings;
+
+    /** TCP socket of the connection */
+    QTcpSocket* socket;
+
+    /** Time for read and keep-alive timeout detection */
+    QTimer readTimer;
+
+    /** Storage for the current incoming HTTP request */
+    HttpRequest* currentRequest;
+
+    /** Dispatches received requests to services */
+    HttpRequestHandler* requestHandler;
+
+    /** Number of requests served on this connection */
+    int requestCount;
+
+    /** Socket initialized */
+    bool valid;
+
+    /** The connection will be closed once the pending output is sent */
+    bool closing;
+
+    /** Process one complete request. Returns false if the connection must be closed. */
+    bool processRequest();
+
+    /** Send the output buffer then disconnect */
+    void closeGracefully();
+
+private slots:
+
+    /** Received from the timer when a read or keep-alive timeout occured */
+    void readTimeout();
+
+    /** Received from the socket when incoming data can be read or when output has been written */
+    void read();
+
+    /** Received from the socket when the connection has been closed */
+    void disconnected();
+
+};
+
+} // end of namespace
+
+#endif // HTTPCONNECTION_H
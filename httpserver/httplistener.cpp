@@ -17,6 +17,7 @@ HttpListener::HttpListener(QSettings* settings, HttpRequestHandler* requestHandl
     Q_ASSERT(settings != 0);
     Q_ASSERT(requestHandler != 0);
     pool = 0;
+    workerPool = 0;
     this->settings = settings;
     this->requestHandler = requestHandler;
     // Reqister type of socketDescriptor for signal/slot handling
@@ -30,6 +31,7 @@ HttpListener::HttpListener(const HttpListenerSettings& settings, HttpRequestHand
 {
     Q_ASSERT(requestHandler != 0);
     pool = 0;
+    workerPool = 0;
     this->settings = 0;
     listenerSettings = settings;
     this->requestHandler = requestHandler;
@@ -49,7 +51,13 @@ HttpListener::~HttpListener()
 
 void HttpListener::listen()
 {
-    if (!pool)
+    if (!useQtSettings && (listenerSettings.workerThreads > 0))
+    {
+        if (!workerPool) {
+            workerPool = new HttpWorkerPool(&listenerSettings, requestHandler);
+        }
+    }
+    else if (!pool)
     {
         if (useQtSettings) {
             pool = new HttpConnectionHandlerPool(settings, requestHandler);
@@ -77,6 +85,10 @@ void HttpListener::close() {
         delete pool;
         pool=NULL;
     }
+    if (workerPool) {
+        delete workerPool;
+        workerPool=NULL;
+    }
 }
 
 void HttpListener::incomingConnection(tSocketDescriptor socketDescriptor) {
@@ -84,6 +96,18 @@ void HttpListener::incomingConnection(tSocketDescriptor socketDescriptor) {
     qDebug("HttpListener: New connection");
 #endif
 
+    if (workerPool)
+    {
+        HttpWorker* worker=workerPool->getWorker();
+
+        if (worker)
+        {
+            // The descriptor is passed via event queue because the worker lives in another thread
+            QMetaObject::invokeMethod(worker, "handleConnection", Qt::QueuedConnection, Q_ARG(tSocketDescriptor, socketDescriptor));
+            return;
+        }
+    }
+
     HttpConnectionHandler* freeHandler=NULL;
     if (pool)
     {
@@ -12,6 +12,7 @@
 #include "httpglobal.h"
 #include "httpconnectionhandler.h"
 #include "httpconnectionhandlerpool.h"
+#include "httpworkerpool.h"
 #include "httprequesthandler.h"
 #include "httplistenersettings.h"
 
@@ -38,6 +39,8 @@ namespace qtwebapp {
   The listener handles all network interfaces if no host is configured.
   The port number specifies the incoming TCP port that this listener listens to.
   @see HttpConnectionHandlerPool for description of config settings minThreads, maxThreads, cleanupInterval and ssl settings
+  @see HttpWorkerPool for the event driven connections served by a fixed number of threads. These are used
+  when the listener is constructed with HttpListenerSettings with workerThreads greater than 0.
   @see HttpConnectionHandler for description of the readTimeout
   @see HttpRequest for description of config settings maxRequestSize and maxMultiPartSize
 */
@@ -112,6 +115,9 @@ private:
     /** Pool of connection handlers */
     HttpConnectionHandlerPool* pool;
 
+    /** Pool of event driven workers used instead of the connection handlers if configured */
+    HttpWorkerPool* workerPool;
+
     /** Settings flag */
     bool useQtSettings;
 
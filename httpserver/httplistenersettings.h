@@ -22,6 +22,9 @@ struct HttpListenerSettings
     QString sslCertFile;
     int maxRequestSize;
     int maxMultiPartSize;
+    int workerThreads;        //!< 0: one thread per connection (HttpConnectionHandlerPool) else size of the HttpWorkerPool
+    int maxConnections;       //!< with workers: maximum number of open connections
+    int maxKeepAliveRequests; //!< with workers: maximum number of requests on one connection (0: no limit)
 
     HttpListenerSettings() {
         resetToDefaults();
@@ -39,6 +42,9 @@ struct HttpListenerSettings
         sslCertFile = "";
         maxRequestSize = 16000;
         maxMultiPartSize = 1000000;
+        workerThreads = 0;
+        maxConnections = 1000;
+        maxKeepAliveRequests = 0;
     }
 };
 
@@ -15,6 +15,18 @@ HttpResponse::HttpResponse(QTcpSocket* socket)
     sentHeaders=false;
     sentLastPart=false;
     chunkedMode=false;
+    blocking=true;
+}
+
+HttpResponse::HttpResponse(QTcpSocket* socket, bool blocking)
+{
+    this->socket=socket;
+    statusCode=200;
+    statusText="OK";
+    sentHeaders=false;
+    sentLastPart=false;
+    chunkedMode=false;
+    this->blocking=blocking;
 }
 
 void HttpResponse::setHeader(QByteArray name, QByteArray value)
@@ -79,7 +91,7 @@ bool HttpResponse::writeToSocket(QByteArray data)
     while (socket->isOpen() && remaining>0)
     {
         // If the output buffer has become large, then wait until it has been sent.
-        if (socket->bytesToWrite()>16384)
+        if (blocking && socket->bytesToWrite()>16384)
         {
             socket->waitForBytesWritten(-1);
         }
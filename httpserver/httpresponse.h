@@ -43,6 +43,14 @@ public:
     */
     HttpResponse(QTcpSocket* socket);
 
+    /**
+      Constructor.
+      @param socket used to write the response
+      @param blocking if false the response is only appended to the socket output buffer and
+      never waits for the data to be sent. Used by connections served by an event loop.
+    */
+    HttpResponse(QTcpSocket* socket, bool blocking);
+
     /**
       Set a HTTP response header.
       You must call this method before the first write().
@@ -143,10 +151,13 @@ private:
     /** Whether the response is sent in chunked mode */
     bool chunkedMode;
 
+    /** Whether writing waits for the output buffer to be sent when it becomes large */
+    bool blocking;
+
     /** Cookies */
     QMap<QByteArray,HttpCookie> cookies;
 
-    /** Write raw data to the socket. This method blocks until all bytes have been passed to the TCP buffer */
+    /** Write raw data to the socket. In blocking mode this method blocks until all bytes have been passed to the TCP buffer */
     bool writeToSocket(QByteArray data);
 
     /**
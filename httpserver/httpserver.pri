@@ -12,6 +12,9 @@ HEADERS += $$PWD/httpglobal.h \
            $$PWD/httplistener.h \
            $$PWD/httpconnectionhandler.h \
            $$PWD/httpconnectionhandlerpool.h \
+           $$PWD/httpconnection.h \
+           $$PWD/httpworker.h \
+           $$PWD/httpworkerpool.h \
            $$PWD/httprequest.h \
            $$PWD/httpresponse.h \
            $$PWD/httpcookie.h \
@@ -24,6 +27,9 @@ SOURCES += $$PWD/httpglobal.cpp \
            $$PWD/httplistener.cpp \
            $$PWD/httpconnectionhandler.cpp \
            $$PWD/httpconnectionhandlerpool.cpp \
+           $$PWD/httpconnection.cpp \
+           $$PWD/httpworker.cpp \
+           $$PWD/httpworkerpool.cpp \
            $$PWD/httprequest.cpp \
            $$PWD/httpresponse.cpp \
            $$PWD/httpcookie.cpp \
@@ -24,6 +24,9 @@ HEADERS += $$PWD/httpglobal.h \
            $$PWD/httplistener.h \
            $$PWD/httpconnectionhandler.h \
            $$PWD/httpconnectionhandlerpool.h \
+           $$PWD/httpconnection.h \
+           $$PWD/httpworker.h \
+           $$PWD/httpworkerpool.h \
            $$PWD/httprequest.h \
            $$PWD/httpresponse.h \
            $$PWD/httpcookie.h \
@@ -40,6 +43,9 @@ SOURCES += $$PWD/httpglobal.cpp \
            $$PWD/httplistener.cpp \
            $$PWD/httpconnectionhandler.cpp \
            $$PWD/httpconnectionhandlerpool.cpp \
+           $$PWD/httpconnection.cpp \
+           $$PWD/httpworker.cpp \
+           $$PWD/httpworkerpool.cpp \
            $$PWD/httprequest.cpp \
            $$PWD/httpresponse.cpp \
            $$PWD/httpcookie.cpp \
@@ -0,0 +1,67 @@
+/**
+  @file
+  @author Stefan Frings
+*/
+
+#include "httpworker.h"
+#include "httpconnection.h"
+
+using namespace qtwebapp;
+
+HttpWorker::HttpWorker(const HttpListenerSettings* settings, HttpRequestHandler* requestHandler)
+    : QThread(), connectionCount(0)
+{
+    Q_ASSERT(settings != 0);
+    Q_ASSERT(requestHandler != 0);
+    this->listenerSettings = settings;
+    this->requestHandler = requestHandler;
+
+    // execute signals in my own thread
+    moveToThread(this);
+
+    qDebug("HttpWorker (%p): constructed", this);
+    this->start();
+}
+
+
+HttpWorker::~HttpWorker()
+{
+    quit();
+    wait();
+    qDebug("HttpWorker (%p): destroyed", this);
+}
+
+
+void HttpWorker::run()
+{
+    qDebug("HttpWorker (%p): thread started", this);
+    try
+    {
+        exec();
+    }
+    catch (...)
+    {
+        qCritical("HttpWorker (%p): an uncatched exception occured in the thread",this);
+    }
+    // connections live in this thread so they are deleted here
+    qDeleteAll(findChildren<HttpConnection*>());
+    qDebug("HttpWorker (%p): thread stopped", this);
+}
+
+
+void HttpWorker::handleConnection(tSocketDescriptor socketDescriptor)
+{
+    HttpConnection* connection = new HttpConnection(socketDescriptor, listenerSettings, requestHandler, this);
+
+    if (connection->isValid()) {
+        connect(connection, SIGNAL(closed()), SLOT(connectionClosed()));
+    } else {
+        connectionCount.deref();
+    }
+}
+
+
+void HttpWorker::connectionClosed()
+{
+    connectionCount.deref();
+}
@@ -0,0 +1,77 @@
+/**
+  @file
+  @author Stefan Frings
+*/
+
+#ifndef HTTPWORKER_H
+#define HTTPWORKER_H
+
+#include <QThread>
+#include <QAtomicInt>
+#include "httpglobal.h"
+#include "httpconnectionhandler.h"
+#include "httprequesthandler.h"
+#include "httplistenersettings.h"
+
+namespace qtwebapp {
+
+/**
+  Thread running an event loop that serves any number of HTTP connections. Each connection
+  is a HttpConnection object living in the thread of the worker. This replaces the thread per
+  connection model of HttpConnectionHandler when workerThreads is configured.
+  @see HttpWorkerPool
+*/
+class DECLSPEC HttpWorker : public QThread {
+    Q_OBJECT
+    Q_DISABLE_COPY(HttpWorker)
+
+public:
+
+    /**
+      Constructor. Starts the thread.
+      @param settings Configuration settings of the HTTP webserver as a structure
+      @param requestHandler Handler that will process each incoming HTTP request
+    */
+    HttpWorker(const HttpListenerSettings* settings, HttpRequestHandler* requestHandler);
+
+    /** Destructor. Closes all connections and stops the thread. */
+    virtual ~HttpWorker();
+
+    /** Number of connections served or about to be served by this worker */
+    int getConnectionCount() const { return connectionCount.load(); }
+
+    /** Account for a connection that will be passed to handleConnection */
+    void reserveConnection() { connectionCount.ref(); }
+
+public slots:
+
+    /**
+      Received from the pool when the worker shall serve a new connection.
+      @param socketDescriptor references the accepted connection.
+    */
+    void handleConnection(tSocketDescriptor socketDescriptor);
+
+private:
+
+    /** Configuration settings */
+    const HttpListenerSettings* listenerSettings;
+
+    /** Dispatches received requests to services */
+    HttpRequestHandler* requestHandler;
+
+    /** Number of open connections */
+    QAtomicInt connectionCount;
+
+    /** Executes the threads own event loop */
+    void run();
+
+private slots:
+
+    /** Received from a connection when it has been closed */
+    void connectionClosed();
+
+};
+
+} // end of namespace
+
+#endif // HTTPWORKER_H
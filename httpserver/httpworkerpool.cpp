@@ -0,0 +1,60 @@
+/**
+  @file
+  @author Stefan Frings
+*/
+
+#include "httpworkerpool.h"
+
+using namespace qtwebapp;
+
+HttpWorkerPool::HttpWorkerPool(const HttpListenerSettings* settings, HttpRequestHandler* requestHandler)
+    : QObject()
+{
+    Q_ASSERT(settings != 0);
+    this->listenerSettings = settings;
+
+    for (int i = 0; i < settings->workerThreads; i++)
+    {
+        pool.append(new HttpWorker(settings, requestHandler));
+    }
+
+    qDebug("HttpWorkerPool (%p): started %d workers", this, pool.size());
+}
+
+HttpWorkerPool::~HttpWorkerPool()
+{
+    // delete all workers and wait until their threads are closed
+    foreach(HttpWorker* worker, pool)
+    {
+       delete worker;
+    }
+    qDebug("HttpWorkerPool (%p): destroyed", this);
+}
+
+
+HttpWorker* HttpWorkerPool::getWorker()
+{
+    HttpWorker* leastBusy=0;
+    int leastCount=0;
+    int totalConnections=0;
+
+    foreach(HttpWorker* worker, pool)
+    {
+        int count=worker->getConnectionCount();
+        totalConnections+=count;
+
+        if (!leastBusy || count<leastCount)
+        {
+            leastBusy=worker;
+            leastCount=count;
+        }
+    }
+
+    if (!leastBusy || totalConnections>=listenerSettings->maxConnections)
+    {
+        return 0;
+    }
+
+    leastBusy->reserveConnection();
+    return leastBusy;
+}
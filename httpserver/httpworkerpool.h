@@ -0,0 +1,69 @@
+/**
+  @file
+  @author Stefan Frings
+*/
+
+#ifndef HTTPWORKERPOOL_H
+#define HTTPWORKERPOOL_H
+
+#include <QList>
+#include <QObject>
+#include "httpglobal.h"
+#include "httpworker.h"
+#include "httplistenersettings.h"
+
+namespace qtwebapp {
+
+/**
+  Fixed size pool of HttpWorker threads. Connections are spread over the workers so that
+  a burst of clients never creates threads. The pool is used by the HttpListener instead of
+  the HttpConnectionHandlerPool when workerThreads is greater than 0 in the listener settings.
+  <p>
+  Related settings:
+  <code><pre>
+  workerThreads=2
+  maxConnections=1000
+  maxKeepAliveRequests=0
+  readTimeout=10000
+  maxRequestSize=16000
+  maxMultiPartSize=1000000
+  </pre></code>
+  A new connection is passed to the worker with the least open connections. When maxConnections
+  connections are open new connections are rejected. readTimeout is also the time a kept alive
+  connection may stay idle. maxKeepAliveRequests limits the number of requests per connection
+  (0 is no limit).
+  <p>
+  SSL is not supported by the workers.
+*/
+
+class DECLSPEC HttpWorkerPool : public QObject {
+    Q_OBJECT
+    Q_DISABLE_COPY(HttpWorkerPool)
+public:
+
+    /**
+      Constructor. Starts all workers.
+      @param settings Configuration settings for the HTTP server as structure
+      @param requestHandler The handler that will process each received HTTP request.
+    */
+    HttpWorkerPool(const HttpListenerSettings* settings, HttpRequestHandler* requestHandler);
+
+    /** Destructor. Closes all connections and stops the workers. */
+    virtual ~HttpWorkerPool();
+
+    /** Get the worker that will serve a new connection, or 0 if too many connections are open. */
+    HttpWorker* getWorker();
+
+private:
+
+    /** Settings for this pool as structure*/
+    const HttpListenerSettings *listenerSettings;
+
+    /** Pool of workers */
+    QList<HttpWorker*> pool;
+
+};
+
+} // end of namespace
+
+#endif // HTTPWORKERPOOL_H
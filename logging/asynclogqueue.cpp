@@ -0,0 +1,220 @@
+/*
+ * asynclogqueue.cpp
+ */
+
+#include "asynclogqueue.h"
+#include "logger.h"
+#include <stdio.h>
+#include <QDateTime>
+
+using namespace qtwebapp;
+
+AsyncLogQueue::AsyncLogQueue(Logger *logger, int size, int rateLimit, QObject *parent) :
+    QThread(parent),
+    m_logger(logger),
+    m_enqueuePos(0),
+    m_dequeuePos(0),
+    m_rateLimit(rateLimit),
+    m_stop(0),
+    m_dropped(0),
+    m_rateLimited(0),
+    m_droppedReported(0),
+    m_rateLimitedReported(0)
+{
+    unsigned int ringSize = 2;
+
+    while ((int) ringSize < size) {
+        ringSize <<= 1;
+    }
+
+    m_slots = new Slot[ringSize];
+    m_mask = ringSize - 1;
+
+    for (unsigned int i = 0; i < ringSize; i++)
+    {
+        m_slots[i].sequence = (int) i;
+        m_slots[i].file = 0;
+        m_slots[i].function = 0;
+        m_slots[i].line = 0;
+    }
+
+    for (int i = 0; i < nbRateCounters; i++)
+    {
+        m_rateCounters[i].second = 0;
+        m_rateCounters[i].count = 0;
+    }
+}
+
+AsyncLogQueue::~AsyncLogQueue()
+{
+    stop();
+    delete[] m_slots;
+}
+
+void AsyncLogQueue::stop()
+{
+    if (isRunning())
+    {
+        m_stop.storeRelease(1);
+        wait();
+    }
+    else
+    {
+        drain();
+    }
+}
+
+bool AsyncLogQueue::push(const QtMsgType type, const QString& message, const char *file, const char *function, const int line)
+{
+    qint64 timestamp = QDateTime::currentMSecsSinceEpoch();
+
+    if (rateLimited(message, file, line, timestamp))
+    {
+        m_rateLimited.fetchAndAddRelaxed(1);
+        return false;
+    }
+
+    // Reserve a slot by moving the enqueue position forward. The slot is free when its
+    // sequence equals the position, it is still in use by the previous round otherwise.
+    unsigned int pos = (unsigned int) m_enqueuePos.loadAcquire();
+    Slot *slot;
+
+    while (true)
+    {
+        slot = &m_slots[pos & m_mask];
+        int diff = (int) ((unsigned int) slot->sequence.loadAcquire() - pos);
+
+        if (diff == 0)
+        {
+            if (m_enqueuePos.testAndSetRelaxed((int) pos, (int) (pos + 1))) {
+                break;
+            }
+
+            pos = (unsigned int) m_enqueuePos.loadAcquire();
+        }
+        else if (diff < 0) // full
+        {
+            m_dropped.fetchAndAddRelaxed(1);
+            return false;
+        }
+        else // another thread took the slot
+        {
+            pos = (unsigned int) m_enqueuePos.loadAcquire();
+        }
+    }
+
+    slot->type = type;
+    slot->message = message; // shared, the data is released by the background thread
+    slot->file = file;
+    slot->function = function;
+    slot->line = line;
+    slot->timestamp = timestamp;
+    slot->threadId = QThread::currentThreadId();
+    slot->sequence.storeRelease((int) (pos + 1));
+
+    return true;
+}
+
+bool AsyncLogQueue::rateLimited(const QString& message, const char *file, const int line, qint64 timestamp)
+{
+    if (m_rateLimit <= 0) {
+        return false;
+    }
+
+    unsigned int key;
+
+    if (file)
+    {
+        key = (unsigned int) ((quintptr) file >> 3) ^ ((unsigned int) line * 2654435761U);
+    }
+    else
+    {
+        // Messages of the application start with the class and method name
+        key = 2166136261U;
+        int n = message.size() < 32 ? message.size() : 32;
+        const QChar *c = message.constData();
+
+        for (int i = 0; i < n; i++) {
+            key = (key ^ c[i].unicode()) * 16777619U;
+        }
+    }
+
+    RateCounter& counter = m_rateCounters[(key ^ (key >> 16)) & (nbRateCounters - 1)];
+    int second = (int) (timestamp / 1000);
+    int counterSecond = counter.second.loadAcquire();
+
+    // The first message of a new second resets the count. Concurrent resets may let
+    // a few more messages in, this is not meant to be exact.
+    if ((counterSecond != second) && counter.second.testAndSetOrdered(counterSecond, second)) {
+        counter.count.storeRelease(0);
+    }
+
+    return counter.count.fetchAndAddRelaxed(1) >= m_rateLimit;
+}
+
+bool AsyncLogQueue::drain()
+{
+    bool done = false;
+
+    while (true)
+    {
+        Slot& slot = m_slots[m_dequeuePos & m_mask];
+        int diff = (int) ((unsigned int) slot.sequence.loadAcquire() - (m_dequeuePos + 1));
+
+        if (diff < 0) { // empty
+            break;
+        }
+
+        m_logger->log(slot.type, slot.message, slot.file, slot.function, slot.line,
+                QDateTime::fromMSecsSinceEpoch(slot.timestamp), slot.threadId);
+        slot.message = QString();
+        slot.sequence.storeRelease((int) (m_dequeuePos + m_mask + 1)); // free for the next round
+        m_dequeuePos++;
+        done = true;
+    }
+
+    return done;
+}
+
+void AsyncLogQueue::reportDrops()
+{
+    int dropped = m_dropped.load();
+    int rateLimited = m_rateLimited.load();
+
+    if ((dropped == m_droppedReported) && (rateLimited == m_rateLimitedReported)) {
+        return;
+    }
+
+    QString message = QString("AsyncLogQueue: %1 messages dropped (queue full), %2 messages dropped (rate limit) in the last second")
+        .arg(dropped - m_droppedReported)
+        .arg(rateLimited - m_rateLimitedReported);
+    m_logger->log(QtWarningMsg, message, __FILE__, Q_FUNC_INFO, __LINE__,
+            QDateTime::currentDateTime(), QThread::currentThreadId());
+    m_droppedReported = dropped;
+    m_rateLimitedReported = rateLimited;
+}
+
+void AsyncLogQueue::run()
+{
+    qint64 lastReport = QDateTime::currentMSecsSinceEpoch();
+
+    while (m_stop.loadAcquire() == 0)
+    {
+        // Producers never signal: an idle queue is polled at a period short
+        // enough to keep the log lines in sync with what the user sees
+        if (!drain()) {
+            msleep(10);
+        }
+
+        qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+        if (now - lastReport >= 1000)
+        {
+            reportDrops();
+            lastReport = now;
+        }
+    }
+
+    drain();
+    reportDrops();
+}
@@ -0,0 +1,129 @@
+/*
+ * asynclogqueue.h
+ */
+
+#ifndef LOGGING_ASYNCLOGQUEUE_H_
+#define LOGGING_ASYNCLOGQUEUE_H_
+
+#include <QtGlobal>
+#include <QThread>
+#include <QAtomicInt>
+#include <QString>
+#include "logglobal.h"
+
+namespace qtwebapp {
+
+class Logger;
+
+/**
+  Hands log messages over to a background thread so that the thread that
+  generates a message never waits for the console or the log file.
+  <p>
+  Messages are stored in a fixed size ring that any number of threads can fill
+  without locking (bounded multiple producers single consumer queue). The
+  background thread takes them out in order and passes them to the logger
+  together with the time and the thread id captured when they were queued.
+  <p>
+  When the ring is full the message is dropped. Each call site (source file
+  and line or, when the context is not available, the beginning of the message
+  text) may queue at most rateLimit messages per second, the excess being
+  dropped too. This prevents a message generated on each block of samples from
+  filling the ring. Call sites that share the same counter share the budget.
+  The number of dropped messages is logged by the background thread every
+  second as long as messages are dropped.
+*/
+
+class DECLSPEC AsyncLogQueue : public QThread {
+    Q_DISABLE_COPY(AsyncLogQueue)
+public:
+
+    /**
+      Constructor. The background thread is started with start().
+      @param logger Logger that writes the messages out
+      @param size Number of messages in the ring, rounded up to a power of 2
+      @param rateLimit Maximum number of messages per second and call site. 0=unlimited.
+      @param parent Parent object. None for the queue of Logger::startAsync() which is deleted
+      by Logger::stopAsync() while the logger is still complete.
+    */
+    AsyncLogQueue(Logger *logger, int size = 4096, int rateLimit = 100, QObject *parent = 0);
+
+    /** Destructor. Stops the background thread after writing out the pending messages. */
+    virtual ~AsyncLogQueue();
+
+    /**
+      Queue a message. Never blocks nor allocates memory.
+      This method is thread safe.
+      @param type Message type (level)
+      @param message Message text
+      @param file Name of the source file, must be a string literal or 0
+      @param function Name of the function, must be a string literal or 0
+      @param line Line Number of the source file
+      @return false if the message was dropped
+    */
+    bool push(const QtMsgType type, const QString& message, const char *file, const char *function, const int line);
+
+    /** Write out the pending messages and stop the background thread. */
+    void stop();
+
+    Logger *getLogger() const { return m_logger; }
+
+    void setRateLimit(int rateLimit) { m_rateLimit = rateLimit; }
+    int getRateLimit() const { return m_rateLimit; }
+
+    /** Number of messages dropped because the ring was full since the start */
+    int getDroppedCount() const { return m_dropped.load(); }
+
+    /** Number of messages dropped by rate limiting since the start */
+    int getRateLimitedCount() const { return m_rateLimited.load(); }
+
+protected:
+
+    virtual void run();
+
+private:
+
+    struct Slot
+    {
+        QAtomicInt sequence; //!< slot position when free, slot position + 1 when filled
+        QtMsgType type;
+        QString message;
+        const char *file;
+        const char *function;
+        int line;
+        qint64 timestamp;    //!< ms since epoch
+        Qt::HANDLE threadId;
+    };
+
+    struct RateCounter
+    {
+        QAtomicInt second;   //!< second (since epoch, truncated) the count applies to
+        QAtomicInt count;
+    };
+
+    static const int nbRateCounters = 256;
+
+    Logger *m_logger;
+    Slot *m_slots;
+    unsigned int m_mask;
+    QAtomicInt m_enqueuePos;
+    unsigned int m_dequeuePos; //!< only used by the background thread
+    RateCounter m_rateCounters[nbRateCounters];
+    int m_rateLimit;
+    QAtomicInt m_stop;
+    QAtomicInt m_dropped;
+    QAtomicInt m_rateLimited;
+    int m_droppedReported;
+    int m_rateLimitedReported;
+
+    bool rateLimited(const QString& message, const char *file, const int line, qint64 timestamp);
+
+    /** Write out all queued messages. Returns false if there was none. */
+    bool drain();
+
+    /** Log the number of messages dropped since the last report if any */
+    void reportDrops();
+};
+
+} // end of namespace
+
+#endif /* LOGGING_ASYNCLOGQUEUE_H_ */
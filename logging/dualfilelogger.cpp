@@ -14,10 +14,11 @@ DualFileLogger::DualFileLogger(QSettings* firstSettings, QSettings* secondSettin
      secondLogger=new FileLogger(secondSettings, refreshInterval, this);
 }
 
-void DualFileLogger::log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line)
+void DualFileLogger::log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line,
+        const QDateTime& timestamp, Qt::HANDLE threadId)
 {
-    firstLogger->log(type,message,file,function,line);
-    secondLogger->log(type,message,file,function,line);
+    firstLogger->log(type,message,file,function,line,timestamp,threadId);
+    secondLogger->log(type,message,file,function,line,timestamp,threadId);
 }
 
 void DualFileLogger::clear(const bool buffer, const bool variables)
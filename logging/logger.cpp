@@ -4,6 +4,7 @@
 */
 
 #include "logger.h"
+#include "asynclogqueue.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <QMutex>
@@ -16,6 +17,15 @@ using namespace qtwebapp;
 Logger* Logger::defaultLogger=0;
 
 
+QAtomicPointer<AsyncLogQueue> Logger::asyncQueue;
+
+
+QAtomicInt Logger::asyncProducers;
+
+
+static const int asyncClosed=0x40000000;
+
+
 QThreadStorage<QHash<QString,QString>*> Logger::logVars;
 
 
@@ -51,6 +61,15 @@ void Logger::msgHandler(const QtMsgType type, const QString &message, const QStr
     // if the logger itself produces an error message.
     recursiveMutex.lock();
 
+    // Let the background thread write out what happened before the fatal message
+    if (type==QtFatalMsg)
+    {
+        AsyncLogQueue *queue=asyncQueue.load();
+        if (queue && (QThread::currentThread() != queue)) {
+            queue->stop();
+        }
+    }
+
     // Fall back to stderr when this method has been called recursively.
     if (defaultLogger && nonRecursiveMutex.tryLock())
     {
@@ -76,7 +95,22 @@ void Logger::msgHandler(const QtMsgType type, const QString &message, const QStr
 #if QT_VERSION >= 0x050000
     void Logger::msgHandler5(const QtMsgType type, const QMessageLogContext &context, const QString &message)
     {
-      (void)(context); // suppress "unused parameter" warning
+      // The queue keeps the context pointers that point to string literals
+      if (type!=QtFatalMsg)
+      {
+          // Counted in flight before the queue is loaded so that stopAsync() drains after the push
+          if ((asyncProducers.fetchAndAddOrdered(1) & asyncClosed) == 0)
+          {
+              AsyncLogQueue *queue=asyncQueue.loadAcquire();
+              if (queue)
+              {
+                  queue->push(type,message,context.file,context.function,context.line);
+                  asyncProducers.deref();
+                  return;
+              }
+          }
+          asyncProducers.deref();
+      }
       msgHandler(type,message,context.file,context.function,context.line);
     }
 #else
@@ -89,6 +123,9 @@ void Logger::msgHandler(const QtMsgType type, const QString &message, const QStr
 
 Logger::~Logger()
 {
+    // Before the children are destroyed and while the logger can still write
+    stopAsync();
+
     if (defaultLogger==this)
     {
 #if QT_VERSION >= 0x050000
@@ -119,6 +156,41 @@ void Logger::installMsgHandler()
 }
 
 
+void Logger::startAsync(const int queueSize, const int rateLimit)
+{
+    if (asyncQueue.load() || (defaultLogger != this)) {
+        return;
+    }
+
+    AsyncLogQueue *queue=new AsyncLogQueue(this, queueSize, rateLimit);
+    queue->start(QThread::LowPriority);
+    asyncQueue.storeRelease(queue);
+}
+
+
+void Logger::stopAsync()
+{
+    AsyncLogQueue *queue=asyncQueue.load();
+
+    if (!queue || (queue->getLogger() != this)) {
+        return;
+    }
+
+    // New messages are written synchronously from now on. The threads that already
+    // hold the queue finish their push before it is drained and deleted.
+    asyncProducers.fetchAndAddOrdered(asyncClosed);
+
+    while ((asyncProducers.loadAcquire() & ~asyncClosed) != 0) {
+        QThread::yieldCurrentThread();
+    }
+
+    asyncQueue.storeRelease(0);
+    queue->stop();
+    delete queue;
+    asyncProducers.fetchAndAddOrdered(-asyncClosed);
+}
+
+
 void Logger::set(const QString& name, const QString& value)
 {
     mutex.lock();
@@ -151,6 +223,13 @@ void Logger::clear(const bool buffer, const bool variables)
 
 
 void Logger::log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line)
+{
+    log(type,message,file,function,line,QDateTime::currentDateTime(),QThread::currentThreadId());
+}
+
+
+void Logger::log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line,
+        const QDateTime& timestamp, Qt::HANDLE threadId)
 {
     mutex.lock();
 
@@ -162,7 +241,7 @@ void Logger::log(const QtMsgType type, const QString& message, const QString &fi
         }
         QList<LogMessage*>* buffer=buffers.localData();
         // Append the decorated log message
-        LogMessage* logMessage=new LogMessage(type,message,logVars.localData(),file,function,line);
+        LogMessage* logMessage=new LogMessage(type,message,logVars.localData(),file,function,line,timestamp,threadId);
         buffer->append(logMessage);
         // Delete oldest message if the buffer became too large
         if (buffer->size()>bufferSize)
@@ -184,7 +263,7 @@ void Logger::log(const QtMsgType type, const QString& message, const QString &fi
     else {
         if (type>=minLevel)
         {
-            LogMessage logMessage(type,message,logVars.localData(),file,function,line);
+            LogMessage logMessage(type,message,logVars.localData(),file,function,line,timestamp,threadId);
             write(&logMessage);
         }
     }
@@ -11,12 +11,16 @@
 #include <QHash>
 #include <QStringList>
 #include <QMutex>
+#include <QAtomicInt>
+#include <QAtomicPointer>
 #include <QObject>
 #include "logglobal.h"
 #include "logmessage.h"
 
 namespace qtwebapp {
 
+class AsyncLogQueue;
+
 /**
   Decorates and writes log messages to the console, stderr.
   <p>
@@ -86,12 +90,51 @@ public:
     */
     virtual void log(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
 
+    /**
+      Decorate and log a message that was generated earlier, possibly by another thread, if type>=minLevel.
+      This is the method that derived classes override. The other log() method calls it with the current
+      time and thread.
+      This method is thread safe.
+      @param type Message type (level)
+      @param message Message text
+      @param file Name of the source file where the message was generated
+      @param function Name of the function where the message was generated
+      @param line Line Number of the source file, where the message was generated
+      @param timestamp Date and time the message was generated
+      @param threadId ID number of the thread that generated the message
+    */
+    virtual void log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line,
+            const QDateTime& timestamp, Qt::HANDLE threadId);
+
     /**
       Installs this logger as the default message handler, so it
       can be used through the global static logging functions (e.g. qDebug()).
     */
     void installMsgHandler();
 
+    /**
+      Messages of the global static logging functions are written out by a background thread
+      instead of the calling thread. The calling thread never blocks, messages are dropped
+      instead when the queue is full or when a call site exceeds the rate limit.
+      Fatal messages are still written synchronously.
+      Must be called after installMsgHandler().
+      @param queueSize Number of messages that can be pending
+      @param rateLimit Maximum number of messages per second and call site. 0=unlimited.
+      @see AsyncLogQueue
+    */
+    void startAsync(const int queueSize=4096, const int rateLimit=100);
+
+    /**
+      Write out the pending messages and return to synchronous logging.
+      Waits for the threads that are pushing a message so that none is lost.
+      Should be called before the application exits so that the last messages are not lost.
+      The destructor calls it as well.
+    */
+    void stopAsync();
+
+    /** Asynchronous queue of the default logger or 0 when logging synchronously */
+    static AsyncLogQueue *getAsyncQueue() { return asyncQueue.load(); }
+
     /**
      * Sets the minimum message level on the fly
      */
@@ -150,6 +193,15 @@ private:
     /** Pointer to the default logger, used by msgHandler() */
     static Logger* defaultLogger;
 
+    /** Queue of the messages written by the background thread, 0 when logging synchronously */
+    static QAtomicPointer<AsyncLogQueue> asyncQueue;
+
+    /**
+      Number of threads between the load of asyncQueue and the end of their push.
+      The asyncClosed bit is added by stopAsync() so that new messages bypass the queue.
+    */
+    static QAtomicInt asyncProducers;
+
     /**
       Message Handler for the global static logging functions (e.g. qDebug()).
       Forward calls to the default logger.
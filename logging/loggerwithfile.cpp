@@ -17,6 +17,7 @@ LoggerWithFile::LoggerWithFile(QObject* parent)
 
 LoggerWithFile::~LoggerWithFile()
 {
+    stopAsync(); // the queue writes through the console and file loggers
     destroyFileLogger();
     delete consoleLogger;
 }
@@ -39,12 +40,13 @@ void LoggerWithFile::destroyFileLogger()
     }
 }
 
-void LoggerWithFile::log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line)
+void LoggerWithFile::log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line,
+        const QDateTime& timestamp, Qt::HANDLE threadId)
 {
-    consoleLogger->log(type,message,file,function,line);
+    consoleLogger->log(type,message,file,function,line,timestamp,threadId);
 
     if (fileLogger && useFileFlogger) {
-        fileLogger->log(type,message,file,function,line);
+        fileLogger->log(type,message,file,function,line,timestamp,threadId);
     }
 }
 
@@ -31,17 +31,22 @@ public:
     void createOrSetFileLogger(const FileLoggerSettings& settings, const int refreshInterval=10000);
     void destroyFileLogger();
 
+    using Logger::log;
+
     /**
-      Decorate and log the message, if type>=minLevel.
+      Decorate and log a message that was generated earlier, possibly by another thread, if type>=minLevel.
       This method is thread safe.
       @param type Message type (level)
       @param message Message text
-      @param file Name of the source file where the message was generated (usually filled with the macro __FILE__)
-      @param function Name of the function where the message was generated (usually filled with the macro __LINE__)
-      @param line Line Number of the source file, where the message was generated (usually filles with the macro __func__ or __FUNCTION__)
+      @param file Name of the source file where the message was generated
+      @param function Name of the function where the message was generated
+      @param line Line Number of the source file, where the message was generated
+      @param timestamp Date and time the message was generated
+      @param threadId ID number of the thread that generated the message
       @see LogMessage for a description of the message decoration.
     */
-    virtual void log(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
+    virtual void log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line,
+            const QDateTime& timestamp, Qt::HANDLE threadId);
 
     /**
       Clear the thread-local data of the current thread.
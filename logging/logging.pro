@@ -25,11 +25,13 @@ HEADERS += $$PWD/logglobal.h \
            $$PWD/logger.h \
            $$PWD/filelogger.h \
            $$PWD/dualfilelogger.h \
-           $$PWD/loggerwithfile.h
+           $$PWD/loggerwithfile.h \
+           $$PWD/asynclogqueue.h
 
 SOURCES += $$PWD/logmessage.cpp \
            $$PWD/logger.cpp \
            $$PWD/filelogger.cpp \
            $$PWD/dualfilelogger.cpp \
-           $$PWD/loggerwithfile.cpp
+           $$PWD/loggerwithfile.cpp \
+           $$PWD/asynclogqueue.cpp
            
@@ -9,14 +9,20 @@
 using namespace qtwebapp;
 
 LogMessage::LogMessage(const QtMsgType type, const QString& message, QHash<QString, QString>* logVars, const QString &file, const QString &function, const int line)
+    : LogMessage(type,message,logVars,file,function,line,QDateTime::currentDateTime(),QThread::currentThreadId())
+{
+}
+
+LogMessage::LogMessage(const QtMsgType type, const QString& message, QHash<QString, QString>* logVars, const QString &file, const QString &function, const int line,
+        const QDateTime& timestamp, Qt::HANDLE threadId)
 {
     this->type=type;
     this->message=message;
     this->file=file;
     this->function=function;
     this->line=line;
-    timestamp=QDateTime::currentDateTime();
-    threadId=QThread::currentThreadId();
+    this->timestamp=timestamp;
+    this->threadId=threadId;
 
     // Copy the logVars if not null,
     // so that later changes in the original do not affect the copy
@@ -67,9 +73,9 @@ QString LogMessage::toString(const QString& msgFormat, const QString& timestampF
     decorated.replace("{function}",function);
     decorated.replace("{line}",QString::number(line));
 
-    QString threadId;
-    threadId.setNum((std::size_t)QThread::currentThreadId());
-    decorated.replace("{thread}",threadId);
+    QString threadIdStr;
+    threadIdStr.setNum((std::size_t)threadId);
+    decorated.replace("{thread}",threadIdStr);
 
     // Fill in variables
     if (decorated.contains("{") && !logVars.isEmpty())
@@ -50,6 +50,20 @@ public:
     */
     LogMessage(const QtMsgType type, const QString& message, QHash<QString,QString>* logVars, const QString &file, const QString &function, const int line);
 
+    /**
+      Constructor for a message that was generated earlier, possibly by another thread.
+      @param type Type of the message
+      @param message Message text
+      @param logVars Logger variables, 0 is allowed
+      @param file Name of the source file where the message was generated
+      @param function Name of the function where the message was generated
+      @param line Line Number of the source file, where the message was generated
+      @param timestamp Date and time the message was generated
+      @param threadId ID number of the thread that generated the message
+    */
+    LogMessage(const QtMsgType type, const QString& message, QHash<QString,QString>* logVars, const QString &file, const QString &function, const int line,
+            const QDateTime& timestamp, Qt::HANDLE threadId);
+
     /**
       Returns the log message as decorated string.
       @param msgFormat Format of the decoration. May contain variables and static text,
@@ -22,9 +22,13 @@
 
 #include "SWGChannelSettings.h"
 #include "SWGNFMDemodSettings.h"
+#include "SWGChannelReport.h"
+#include "SWGNFMDemodReport.h"
 
 #include "dsp/downchannelizer.h"
 #include "util/stepfunctions.h"
+#include "util/db.h"
+#include "util/messagedispatcher.h"
 #include "audio/audiooutput.h"
 #include "dsp/dspengine.h"
 #include "dsp/threadedbasebandsamplesink.h"
@@ -84,6 +88,7 @@ NFMDemod::NFMDemod(DeviceSourceAPI *devieAPI) :
 
     m_channelizer = new DownChannelizer(this);
     m_threadedChannelizer = new ThreadedBasebandSampleSink(m_channelizer, this);
+    setChannelRecord(m_channelizer->getChannelRecord());
     m_deviceAPI->addThreadedSink(m_threadedChannelizer);
     m_deviceAPI->addChannelAPI(this);
 
@@ -155,175 +160,215 @@ void NFMDemod::feed(const SampleVector::const_iterator& begin, const SampleVecto
 
         if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
         {
+            processOneSample(ci);
+            m_interpolatorDistanceRemain += m_interpolatorDistance;
+        }
+	}
 
-            qint16 sample;
+	flushAudio();
+	m_settingsMutex.unlock();
+}
 
-            double magsqRaw; // = ci.real()*ci.real() + c.imag()*c.imag();
-            Real deviation;
+void NFMDemod::feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool firstOfBurst __attribute__((unused)))
+{
+	Complex ci;
 
-            Real demod = m_phaseDiscri.phaseDiscriminatorDelta(ci, magsqRaw, deviation);
+	if (!m_running) {
+	    return;
+	}
 
-            Real magsq = magsqRaw / (SDR_RX_SCALED*SDR_RX_SCALED);
-            m_movingAverage(magsq);
-            m_magsqSum += magsq;
+	m_settingsMutex.lock();
 
-            if (magsq > m_magsqPeak)
-            {
-                m_magsqPeak = magsq;
-            }
+	// no quantization nor clipping: only the scale of the fixed point path is restored
+	for (FSampleVector::const_iterator it = begin; it != end; ++it)
+	{
+		Complex c(it->real() * SDR_RX_SCALEF, it->imag() * SDR_RX_SCALEF);
+		c *= m_nco.nextIQ();
 
-            m_magsqCount++;
-            m_sampleCount++;
+        if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
+        {
+            processOneSample(ci);
+            m_interpolatorDistanceRemain += m_interpolatorDistance;
+        }
+	}
 
-            // AF processing
+	flushAudio();
+	m_settingsMutex.unlock();
+}
 
-            if (m_settings.m_deltaSquelch)
-            {
-                if (m_afSquelch.analyze(demod)) {
-                    m_afSquelchOpen = m_afSquelch.evaluate() ? m_squelchGate + 480 : 0;
-                }
+void NFMDemod::flushAudio()
+{
+	if (m_audioBufferFill > 0)
+	{
+		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill, 10);
 
-                if (m_afSquelchOpen)
-                {
-                    if (m_squelchCount < m_squelchGate + 480)
-                    {
-                        m_squelchCount++;
-                    }
-                }
-                else
-                {
-                    if (m_squelchCount > 0)
-                    {
-                        m_squelchCount--;
-                    }
-                }
+		if (res != m_audioBufferFill)
+		{
+			qDebug("NFMDemod::flushAudio: %u/%u tail samples written", res, m_audioBufferFill);
+		}
+
+		m_audioBufferFill = 0;
+	}
+}
+
+void NFMDemod::processOneSample(Complex& ci)
+{
+    qint16 sample;
+
+    double magsqRaw; // = ci.real()*ci.real() + c.imag()*c.imag();
+    Real deviation;
+
+    Real demod = m_phaseDiscri.phaseDiscriminatorDelta(ci, magsqRaw, deviation);
+
+    Real magsq = magsqRaw / (SDR_RX_SCALED*SDR_RX_SCALED);
+    m_movingAverage(magsq);
+    m_magsqSum += magsq;
+
+    if (magsq > m_magsqPeak)
+    {
+        m_magsqPeak = magsq;
+    }
+
+    m_magsqCount++;
+    m_sampleCount++;
+
+    // AF processing
+
+    if (m_settings.m_deltaSquelch)
+    {
+        if (m_afSquelch.analyze(demod)) {
+            m_afSquelchOpen = m_afSquelch.evaluate() ? m_squelchGate + 480 : 0;
+        }
+
+        if (m_afSquelchOpen)
+        {
+            if (m_squelchCount < m_squelchGate + 480)
+            {
+                m_squelchCount++;
             }
-            else
+        }
+        else
+        {
+            if (m_squelchCount > 0)
             {
-                if ((Real) m_movingAverage < m_squelchLevel)
-                {
-                    if (m_squelchCount > 0)
-                    {
-                        m_squelchCount--;
-                    }
-                }
-                else
-                {
-                    if (m_squelchCount < m_squelchGate + 480)
-                    {
-                        m_squelchCount++;
-                    }
-                }
+                m_squelchCount--;
+            }
+        }
+    }
+    else
+    {
+        if ((Real) m_movingAverage < m_squelchLevel)
+        {
+            if (m_squelchCount > 0)
+            {
+                m_squelchCount--;
             }
+        }
+        else
+        {
+            if (m_squelchCount < m_squelchGate + 480)
+            {
+                m_squelchCount++;
+            }
+        }
+    }
+
+    bool squelchOpen = (m_squelchCount > m_squelchGate);
+
+    if (squelchOpen && !m_squelchOpen) {
+        m_deviceAPI->channelSquelchOpened(getIndexInDeviceSet()); // may trigger the pre-trigger recorder
+    }
 
-            m_squelchOpen = (m_squelchCount > m_squelchGate);
+    m_squelchOpen = squelchOpen;
 
-            if ((m_squelchOpen) && !m_settings.m_audioMute)
+    if ((m_squelchOpen) && !m_settings.m_audioMute)
+    {
+        if (m_settings.m_ctcssOn)
+        {
+            Real ctcss_sample = m_lowpass.filter(demod);
+
+            if ((m_sampleCount & 7) == 7) // decimate 48k -> 6k
             {
-                if (m_settings.m_ctcssOn)
+                if (m_ctcssDetector.analyze(&ctcss_sample))
                 {
-                    Real ctcss_sample = m_lowpass.filter(demod);
+                    int maxToneIndex;
 
-                    if ((m_sampleCount & 7) == 7) // decimate 48k -> 6k
+                    if (m_ctcssDetector.getDetectedTone(maxToneIndex))
                     {
-                        if (m_ctcssDetector.analyze(&ctcss_sample))
+                        if (maxToneIndex+1 != m_ctcssIndex)
                         {
-                            int maxToneIndex;
-
-                            if (m_ctcssDetector.getDetectedTone(maxToneIndex))
-                            {
-                                if (maxToneIndex+1 != m_ctcssIndex)
-                                {
-                                    if (getMessageQueueToGUI()) {
-                                        MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
-                                        getMessageQueueToGUI()->push(msg);
-                                    }
-                                    m_ctcssIndex = maxToneIndex+1;
-                                }
-                            }
-                            else
-                            {
-                                if (m_ctcssIndex != 0)
-                                {
-                                    if (getMessageQueueToGUI()) {
-                                        MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
-                                        getMessageQueueToGUI()->push(msg);
-                                    }
-                                    m_ctcssIndex = 0;
-                                }
+                            if (getMessageQueueToGUI()) {
+                                MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
+                                getMessageQueueToGUI()->push(msg);
                             }
+                            m_ctcssIndex = maxToneIndex+1;
                         }
                     }
-                }
-
-                if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
-                {
-                    sample = 0;
-                    if (m_settings.m_copyAudioToUDP) {
-                        m_audioNetSink->write(0);
-                    }
-                }
-                else
-                {
-                    demod = m_bandpass.filter(demod);
-                    Real squelchFactor = StepFunctions::smootherstep((Real) (m_squelchCount - m_squelchGate) / 480.0f);
-                    sample = demod * m_settings.m_volume * squelchFactor;
-                    if (m_settings.m_copyAudioToUDP) {
-                        m_audioNetSink->write(demod * 5.0f * squelchFactor);
+                    else
+                    {
+                        if (m_ctcssIndex != 0)
+                        {
+                            if (getMessageQueueToGUI()) {
+                                MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
+                                getMessageQueueToGUI()->push(msg);
+                            }
+                            m_ctcssIndex = 0;
+                        }
                     }
                 }
             }
-            else
-            {
-                if (m_ctcssIndex != 0)
-                {
-                    if (getMessageQueueToGUI()) {
-                        MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
-                        getMessageQueueToGUI()->push(msg);
-                    }
-
-                    m_ctcssIndex = 0;
-                }
+        }
 
-                sample = 0;
-                if (m_settings.m_copyAudioToUDP) {
-                    m_audioNetSink->write(0);
-                }
+        if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
+        {
+            sample = 0;
+            if (m_settings.m_copyAudioToUDP) {
+                m_audioNetSink->write(0);
             }
-
-            m_audioBuffer[m_audioBufferFill].l = sample;
-            m_audioBuffer[m_audioBufferFill].r = sample;
-            ++m_audioBufferFill;
-
-            if (m_audioBufferFill >= m_audioBuffer.size())
-            {
-                uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill, 10);
-
-                if (res != m_audioBufferFill)
-                {
-                    qDebug("NFMDemod::feed: %u/%u audio samples written", res, m_audioBufferFill);
-                }
-
-                m_audioBufferFill = 0;
+        }
+        else
+        {
+            demod = m_bandpass.filter(demod);
+            Real squelchFactor = StepFunctions::smootherstep((Real) (m_squelchCount - m_squelchGate) / 480.0f);
+            sample = demod * m_settings.m_volume * squelchFactor;
+            if (m_settings.m_copyAudioToUDP) {
+                m_audioNetSink->write(demod * 5.0f * squelchFactor);
+            }
+        }
+    }
+    else
+    {
+        if (m_ctcssIndex != 0)
+        {
+            if (getMessageQueueToGUI()) {
+                MsgReportCTCSSFreq *msg = MsgReportCTCSSFreq::create(0);
+                getMessageQueueToGUI()->push(msg);
             }
 
-            m_interpolatorDistanceRemain += m_interpolatorDistance;
+            m_ctcssIndex = 0;
         }
-	}
 
-	if (m_audioBufferFill > 0)
-	{
-		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill, 10);
+        sample = 0;
+        if (m_settings.m_copyAudioToUDP) {
+            m_audioNetSink->write(0);
+        }
+    }
 
-		if (res != m_audioBufferFill)
-		{
-			qDebug("NFMDemod::feed: %u/%u tail samples written", res, m_audioBufferFill);
-		}
+    m_audioBuffer[m_audioBufferFill].l = sample;
+    m_audioBuffer[m_audioBufferFill].r = sample;
+    ++m_audioBufferFill;
 
-		m_audioBufferFill = 0;
-	}
+    if (m_audioBufferFill >= m_audioBuffer.size())
+    {
+        uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill, 10);
 
-	m_settingsMutex.unlock();
+        if (res != m_audioBufferFill)
+        {
+            qDebug("NFMDemod::processOneSample: %u/%u audio samples written", res, m_audioBufferFill);
+        }
+
+        m_audioBufferFill = 0;
+    }
 }
 
 void NFMDemod::start()
@@ -344,46 +389,53 @@ void NFMDemod::stop()
 
 bool NFMDemod::handleMessage(const Message& cmd)
 {
-	if (DownChannelizer::MsgChannelizerNotification::match(cmd))
-	{
-		DownChannelizer::MsgChannelizerNotification& notif = (DownChannelizer::MsgChannelizerNotification&) cmd;
-		qDebug() << "NFMDemod::handleMessage: DownChannelizer::MsgChannelizerNotification";
+    static const MessageDispatcher<NFMDemod> dispatcher = MessageDispatcher<NFMDemod>()
+        .add<DownChannelizer::MsgChannelizerNotification>(&NFMDemod::handleChannelizerNotification)
+        .add<MsgConfigureChannelizer>(&NFMDemod::handleConfigureChannelizer)
+        .add<MsgConfigureNFMDemod>(&NFMDemod::handleConfigureNFMDemod)
+        .add<DSPSignalNotification>(&NFMDemod::handleSignalNotification);
 
-		applyChannelSettings(notif.getSampleRate(), notif.getFrequencyOffset());
+    return dispatcher.dispatch(this, cmd);
+}
 
-		return true;
-	}
-    else if (MsgConfigureChannelizer::match(cmd))
-    {
-        MsgConfigureChannelizer& cfg = (MsgConfigureChannelizer&) cmd;
+bool NFMDemod::handleChannelizerNotification(const Message& cmd)
+{
+    DownChannelizer::MsgChannelizerNotification& notif = (DownChannelizer::MsgChannelizerNotification&) cmd;
+    qDebug() << "NFMDemod::handleMessage: DownChannelizer::MsgChannelizerNotification";
 
-        qDebug() << "NFMDemod::handleMessage: MsgConfigureChannelizer:"
-                 << " sampleRate: " << cfg.getSampleRate()
-                 << " centerFrequency: " << cfg.getCenterFrequency();
+    applyChannelSettings(notif.getSampleRate(), notif.getFrequencyOffset());
 
-        m_channelizer->configure(m_channelizer->getInputMessageQueue(),
-            cfg.getSampleRate(),
-            cfg.getCenterFrequency());
+    return true;
+}
 
-        return true;
-    }
-	else if (MsgConfigureNFMDemod::match(cmd))
-	{
-	    MsgConfigureNFMDemod& cfg = (MsgConfigureNFMDemod&) cmd;
-		qDebug() << "NFMDemod::handleMessage: MsgConfigureNFMDemod";
+bool NFMDemod::handleConfigureChannelizer(const Message& cmd)
+{
+    MsgConfigureChannelizer& cfg = (MsgConfigureChannelizer&) cmd;
 
-        applySettings(cfg.getSettings(), cfg.getForce());
+    qDebug() << "NFMDemod::handleMessage: MsgConfigureChannelizer:"
+             << " sampleRate: " << cfg.getSampleRate()
+             << " centerFrequency: " << cfg.getCenterFrequency();
 
-        return true;
-	}
-	else if (DSPSignalNotification::match(cmd))
-	{
-	    return true;
-	}
-	else
-	{
-		return false;
-	}
+    m_channelizer->configure(m_channelizer->getInputMessageQueue(),
+        cfg.getSampleRate(),
+        cfg.getCenterFrequency());
+
+    return true;
+}
+
+bool NFMDemod::handleConfigureNFMDemod(const Message& cmd)
+{
+    MsgConfigureNFMDemod& cfg = (MsgConfigureNFMDemod&) cmd;
+    qDebug() << "NFMDemod::handleMessage: MsgConfigureNFMDemod";
+
+    applySettings(cfg.getSettings(), cfg.getForce());
+
+    return true;
+}
+
+bool NFMDemod::handleSignalNotification(const Message& cmd __attribute__((unused)))
+{
+    return true;
 }
 
 void NFMDemod::applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force)
@@ -636,6 +688,16 @@ int NFMDemod::webapiSettingsPutPatch(
     return 200;
 }
 
+int NFMDemod::webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response,
+            QString& errorMessage __attribute__((unused)))
+{
+    response.setNfmDemodReport(new SWGSDRangel::SWGNFMDemodReport());
+    response.getNfmDemodReport()->init();
+    webapiFormatChannelReport(response);
+    return 200;
+}
+
 void NFMDemod::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const NFMDemodSettings& settings)
 {
     response.getNfmDemodSettings()->setAfBandwidth(settings.m_afBandwidth);
@@ -668,3 +730,13 @@ void NFMDemod::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& resp
     }
 }
 
+void NFMDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
+{
+    // average since last GUI poll without resetting the GUI accumulators
+    double magsqAvg = m_magsqCount == 0 ? m_magsq : m_magsqSum / m_magsqCount;
+
+    response.getNfmDemodReport()->setChannelPowerDb(CalcDb::dbPower(magsqAvg));
+    response.getNfmDemodReport()->setSquelch(m_squelchOpen ? 1 : 0);
+    response.getNfmDemodReport()->setAudioSampleRate(m_settings.m_audioSampleRate);
+    response.getNfmDemodReport()->setChannelSampleRate(m_inputSampleRate);
+}
@@ -115,6 +115,7 @@ public:
 	virtual void destroy() { delete this; }
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool po);
+	virtual void feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool po);
 	virtual void start();
 	virtual void stop();
 	virtual bool handleMessage(const Message& cmd);
@@ -136,6 +137,10 @@ public:
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
 
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response,
+            QString& errorMessage);
+
 	const Real *getCtcssToneSet(int& nbTones) const {
 		nbTones = m_ctcssDetector.getNTones();
 		return m_ctcssDetector.getToneSet();
@@ -226,8 +231,15 @@ private:
 
 //    void apply(bool force = false);
     void applyChannelSettings(int inputSampleRate, int inputFrequencyOffset, bool force = false);
+    void processOneSample(Complex& ci); //!< demodulation of one sample at the audio rate (fixed point scale)
+    void flushAudio();
     void applySettings(const NFMDemodSettings& settings, bool force = false);
+    bool handleChannelizerNotification(const Message& cmd);
+    bool handleConfigureChannelizer(const Message& cmd);
+    bool handleConfigureNFMDemod(const Message& cmd);
+    bool handleSignalNotification(const Message& cmd);
     void webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const NFMDemodSettings& settings);
+    void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
 };
 
 #endif // INCLUDE_NFMDEMOD_H
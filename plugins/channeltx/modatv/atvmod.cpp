@@ -25,6 +25,7 @@
 #include "device/devicesinkapi.h"
 
 #include "atvmod.h"
+#include "atvmodframethread.h"
 
 MESSAGE_CLASS_DEFINITION(ATVMod::MsgConfigureATVMod, Message)
 MESSAGE_CLASS_DEFINITION(ATVMod::MsgConfigureChannelizer, Message)
@@ -57,10 +58,13 @@ ATVMod::ATVMod(DeviceSinkAPI *deviceAPI) :
     m_inputFrequencyOffset(0),
 	m_modPhasor(0.0f),
     m_tvSampleRate(1000000),
-    m_evenImage(true),
     m_settingsMutex(QMutex::Recursive),
-    m_horizontalCount(0),
-    m_lineCount(0),
+    m_frameThread(0),
+    m_frameMutex(QMutex::Recursive),
+    m_frameDirty(true),
+    m_frame(0),
+    m_frameSize(0),
+    m_framePosition(0),
 	m_imageOK(false),
 	m_videoFPSq(1.0f),
     m_videoFPSCount(0.0f),
@@ -90,6 +94,8 @@ ATVMod::ATVMod(DeviceSinkAPI *deviceAPI) :
     m_interpolatorDistanceRemain = 0.0f;
     m_interpolatorDistance = 1.0f;
 
+    m_frameThread = new ATVModFrameThread(this);
+
     m_channelizer = new UpChannelizer(this);
     m_threadedChannelizer = new ThreadedBasebandSampleSource(m_channelizer, this);
     m_deviceAPI->addThreadedSource(m_threadedChannelizer);
@@ -97,10 +103,14 @@ ATVMod::ATVMod(DeviceSinkAPI *deviceAPI) :
 
     applyChannelSettings(m_outputSampleRate, m_inputFrequencyOffset, true);
     applySettings(m_settings, true); // does applyStandard() too;
+
+    m_frameThread->startWork();
 }
 
 ATVMod::~ATVMod()
 {
+    m_frameThread->stopWork();
+    delete m_frameThread;
 	if (m_video.isOpened()) m_video.release();
 	releaseCameras();
 	m_deviceAPI->removeChannelAPI(this);
@@ -244,225 +254,257 @@ Complex& ATVMod::modulateVestigialSSB(Real& sample)
 
 void ATVMod::pullVideo(Real& sample)
 {
-    if ((m_settings.m_atvStd == ATVModSettings::ATVStdHSkip) && (m_lineCount == m_nbLines2)) // last line in skip mode
+    if (m_framePosition >= m_frameSize) // end of frame: get the next frame rendered by the frame thread
+    {
+        m_frame = m_frameThread->nextFrame(m_frameSize);
+        m_framePosition = 0;
+
+        if (m_frameSize == 0) // nothing rendered yet
+        {
+            sample = 0.0f;
+            return;
+        }
+    }
+
+    sample = m_frame[m_framePosition++];
+}
+
+bool ATVMod::renderFrame(std::vector<Real>& frame)
+{
+    QMutexLocker mutexLocker(&m_frameMutex);
+
+    if (nextSourceFrame()) {
+        m_frameDirty = true;
+    }
+
+    if (!m_frameDirty) {
+        return false;
+    }
+
+    frame.resize(m_nbLines * m_nbHorizPoints);
+    std::vector<Real>::iterator it = frame.begin();
+
+    for (int lineCount = 0; lineCount < m_nbLines; lineCount++)
+    {
+        for (int horizontalCount = 0; horizontalCount < m_nbHorizPoints; horizontalCount++, ++it) {
+            renderSample(*it, lineCount, horizontalCount);
+        }
+    }
+
+    m_frameDirty = false;
+    return true;
+}
+
+void ATVMod::renderSample(Real& sample, int lineCount, int horizontalCount)
+{
+    if ((m_settings.m_atvStd == ATVModSettings::ATVStdHSkip) && (lineCount == m_nbLines2)) // last line in skip mode
     {
-        pullImageLine(sample, true); // pull image line without sync
+        pullImageLine(sample, lineCount, horizontalCount, true); // pull image line without sync
     }
-    else if (m_lineCount < m_nbLines2 + 1) // even image or non interlaced
+    else if (lineCount < m_nbLines2 + 1) // even image or non interlaced
     {
-        int iLine = m_lineCount;
+        int iLine = lineCount;
 
         if (iLine < m_nbSyncLinesHeadE + m_nbBlankLines)
         {
-            pullVSyncLine(sample);
+            pullVSyncLine(sample, lineCount, horizontalCount);
         }
         else if (iLine > m_nbLines2 - m_nbSyncLinesBottom)
         {
-            pullVSyncLine(sample);
+            pullVSyncLine(sample, lineCount, horizontalCount);
         }
         else
         {
-            pullImageLine(sample);
+            pullImageLine(sample, lineCount, horizontalCount);
         }
     }
     else // odd image
     {
-        int iLine = m_lineCount - m_nbLines2 - 1;
+        int iLine = lineCount - m_nbLines2 - 1;
 
         if (iLine < m_nbSyncLinesHeadO + m_nbBlankLines)
         {
-            pullVSyncLine(sample);
+            pullVSyncLine(sample, lineCount, horizontalCount);
         }
         else if (iLine > m_nbLines2 - 1 - m_nbSyncLinesBottom)
         {
-            pullVSyncLine(sample);
+            pullVSyncLine(sample, lineCount, horizontalCount);
         }
         else
         {
-            pullImageLine(sample);
+            pullImageLine(sample, lineCount, horizontalCount);
         }
     }
+}
+
+bool ATVMod::nextSourceFrame()
+{
+    bool newFrame = false;
 
-    if (m_horizontalCount < m_nbHorizPoints - 1)
+    if ((m_settings.m_atvModInput == ATVModSettings::ATVModInputVideo) && m_videoOK && (m_settings.m_videoPlay) && !m_videoEOF)
     {
-        m_horizontalCount++;
+    	int grabOK = 0;
+    	int fpsIncrement = (int) m_videoFPSCount - m_videoPrevFPSCount;
+
+    	// move a number of frames according to increment
+    	// use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
+    	// TODO: handle pause (no move)
+    	for (int i = 0; i < fpsIncrement; i++)
+    	{
+    		grabOK = m_video.grab();
+    		if (!grabOK) break;
+    	}
+
+    	if (grabOK)
+    	{
+    		cv::Mat colorFrame;
+    		m_video.retrieve(colorFrame);
+
+    		if (!colorFrame.empty()) // some frames may not come out properly
+    		{
+    		    if (m_showOverlayText) {
+    		        mixImageAndText(colorFrame);
+    		    }
+
+    		    cv::cvtColor(colorFrame, m_videoframeOriginal, CV_BGR2GRAY);
+    		    resizeVideo();
+    		    newFrame = true;
+    		}
+    	}
+    	else
+    	{
+    	    if (m_settings.m_videoPlayLoop) { // play loop
+    	        seekVideoFileStream(0);
+    	    } else { // stops
+    	        m_videoEOF = true;
+    	    }
+    	}
+
+    	if (m_videoFPSCount < m_videoFPS)
+    	{
+    		m_videoPrevFPSCount = (int) m_videoFPSCount;
+        	m_videoFPSCount += m_videoFPSq;
+    	}
+    	else
+    	{
+    		m_videoPrevFPSCount = 0;
+    		m_videoFPSCount = m_videoFPSq;
+    	}
     }
-    else
+    else if ((m_settings.m_atvModInput == ATVModSettings::ATVModInputCamera) && (m_settings.m_cameraPlay) && (m_cameraIndex >= 0))
     {
-        if (m_lineCount < m_nbLines - 1)
+        ATVCamera& camera = m_cameras[m_cameraIndex]; // currently selected canera
+
+        if (camera.m_videoFPS < 0.0f) // default frame rate when it could not be obtained via get
         {
-            m_lineCount++;
-            if (m_lineCount > (m_nbLines/2)) m_evenImage = !m_evenImage;
+            time_t start, end;
+            cv::Mat frame;
+
+            if (getMessageQueueToGUI())
+            {
+                MsgReportCameraData *report;
+                report = MsgReportCameraData::create(
+                        camera.m_cameraNumber,
+                        0.0f,
+                        camera.m_videoFPSManual,
+                        camera.m_videoFPSManualEnable,
+                        camera.m_videoWidth,
+                        camera.m_videoHeight,
+                        1); // open splash screen on GUI side
+                getMessageQueueToGUI()->push(report);
+            }
+
+            int nbFrames = 0;
+
+            time(&start);
+
+            for (int i = 0; i < m_cameraFPSTestNbFrames; i++)
+            {
+                camera.m_camera >> frame;
+                if (!frame.empty()) nbFrames++;
+            }
+
+            time(&end);
+
+            double seconds = difftime (end, start);
+            // take a 10% guard and divide bandwidth between all cameras as a hideous hack
+            camera.m_videoFPS = ((nbFrames / seconds) * 0.9) / m_cameras.size();
+            camera.m_videoFPSq = camera.m_videoFPS / m_fps;
+            camera.m_videoFPSCount = camera.m_videoFPSq;
+            camera.m_videoPrevFPSCount = 0;
+
+            if (getMessageQueueToGUI())
+            {
+                MsgReportCameraData *report;
+                report = MsgReportCameraData::create(
+                        camera.m_cameraNumber,
+                        camera.m_videoFPS,
+                        camera.m_videoFPSManual,
+                        camera.m_videoFPSManualEnable,
+                        camera.m_videoWidth,
+                        camera.m_videoHeight,
+                        2); // close splash screen on GUI side
+                getMessageQueueToGUI()->push(report);
+            }
         }
-        else // new image
+        else if (camera.m_videoFPS == 0.0f) // Hideous hack for windows
         {
-            m_lineCount = 0;
-            m_evenImage = !m_evenImage;
+            camera.m_videoFPS = 5.0f;
+            camera.m_videoFPSq = camera.m_videoFPS / m_fps;
+            camera.m_videoFPSCount = camera.m_videoFPSq;
+            camera.m_videoPrevFPSCount = 0;
 
-            if ((m_settings.m_atvModInput == ATVModSettings::ATVModInputVideo) && m_videoOK && (m_settings.m_videoPlay) && !m_videoEOF)
+            if (getMessageQueueToGUI())
             {
-            	int grabOK = 0;
-            	int fpsIncrement = (int) m_videoFPSCount - m_videoPrevFPSCount;
-
-            	// move a number of frames according to increment
-            	// use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
-            	// TODO: handle pause (no move)
-            	for (int i = 0; i < fpsIncrement; i++)
-            	{
-            		grabOK = m_video.grab();
-            		if (!grabOK) break;
-            	}
-
-            	if (grabOK)
-            	{
-            		cv::Mat colorFrame;
-            		m_video.retrieve(colorFrame);
-
-            		if (!colorFrame.empty()) // some frames may not come out properly
-            		{
-            		    if (m_showOverlayText) {
-            		        mixImageAndText(colorFrame);
-            		    }
-
-            		    cv::cvtColor(colorFrame, m_videoframeOriginal, CV_BGR2GRAY);
-            		    resizeVideo();
-            		}
-            	}
-            	else
-            	{
-            	    if (m_settings.m_videoPlayLoop) { // play loop
-            	        seekVideoFileStream(0);
-            	    } else { // stops
-            	        m_videoEOF = true;
-            	    }
-            	}
-
-            	if (m_videoFPSCount < m_videoFPS)
-            	{
-            		m_videoPrevFPSCount = (int) m_videoFPSCount;
-                	m_videoFPSCount += m_videoFPSq;
-            	}
-            	else
-            	{
-            		m_videoPrevFPSCount = 0;
-            		m_videoFPSCount = m_videoFPSq;
-            	}
+                MsgReportCameraData *report;
+                report = MsgReportCameraData::create(
+                        camera.m_cameraNumber,
+                        camera.m_videoFPS,
+                        camera.m_videoFPSManual,
+                        camera.m_videoFPSManualEnable,
+                        camera.m_videoWidth,
+                        camera.m_videoHeight,
+                        0);
+                getMessageQueueToGUI()->push(report);
             }
-            else if ((m_settings.m_atvModInput == ATVModSettings::ATVModInputCamera) && (m_settings.m_cameraPlay))
-            {
-                ATVCamera& camera = m_cameras[m_cameraIndex]; // currently selected canera
-
-                if (camera.m_videoFPS < 0.0f) // default frame rate when it could not be obtained via get
-                {
-                    time_t start, end;
-                    cv::Mat frame;
-
-                    if (getMessageQueueToGUI())
-                    {
-                        MsgReportCameraData *report;
-                        report = MsgReportCameraData::create(
-                                camera.m_cameraNumber,
-                                0.0f,
-                                camera.m_videoFPSManual,
-                                camera.m_videoFPSManualEnable,
-                                camera.m_videoWidth,
-                                camera.m_videoHeight,
-                                1); // open splash screen on GUI side
-                        getMessageQueueToGUI()->push(report);
-                    }
-
-                    int nbFrames = 0;
-
-                    time(&start);
-
-                    for (int i = 0; i < m_cameraFPSTestNbFrames; i++)
-                    {
-                        camera.m_camera >> frame;
-                        if (!frame.empty()) nbFrames++;
-                    }
-
-                    time(&end);
-
-                    double seconds = difftime (end, start);
-                    // take a 10% guard and divide bandwidth between all cameras as a hideous hack
-                    camera.m_videoFPS = ((nbFrames / seconds) * 0.9) / m_cameras.size();
-                    camera.m_videoFPSq = camera.m_videoFPS / m_fps;
-                    camera.m_videoFPSCount = camera.m_videoFPSq;
-                    camera.m_videoPrevFPSCount = 0;
-
-                    if (getMessageQueueToGUI())
-                    {
-                        MsgReportCameraData *report;
-                        report = MsgReportCameraData::create(
-                                camera.m_cameraNumber,
-                                camera.m_videoFPS,
-                                camera.m_videoFPSManual,
-                                camera.m_videoFPSManualEnable,
-                                camera.m_videoWidth,
-                                camera.m_videoHeight,
-                                2); // close splash screen on GUI side
-                        getMessageQueueToGUI()->push(report);
-                    }
-                }
-                else if (camera.m_videoFPS == 0.0f) // Hideous hack for windows
-                {
-                    camera.m_videoFPS = 5.0f;
-                    camera.m_videoFPSq = camera.m_videoFPS / m_fps;
-                    camera.m_videoFPSCount = camera.m_videoFPSq;
-                    camera.m_videoPrevFPSCount = 0;
-
-                    if (getMessageQueueToGUI())
-                    {
-                        MsgReportCameraData *report;
-                        report = MsgReportCameraData::create(
-                                camera.m_cameraNumber,
-                                camera.m_videoFPS,
-                                camera.m_videoFPSManual,
-                                camera.m_videoFPSManualEnable,
-                                camera.m_videoWidth,
-                                camera.m_videoHeight,
-                                0);
-                        getMessageQueueToGUI()->push(report);
-                    }
-                }
-
-                int fpsIncrement = (int) camera.m_videoFPSCount - camera.m_videoPrevFPSCount;
-
-                // move a number of frames according to increment
-                // use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
-                cv::Mat colorFrame;
-
-                for (int i = 0; i < fpsIncrement; i++)
-                {
-                    camera.m_camera >> colorFrame;
-                    if (colorFrame.empty()) break;
-                }
-
-                if (!colorFrame.empty()) // some frames may not come out properly
-                {
-                    if (m_showOverlayText) {
-                        mixImageAndText(colorFrame);
-                    }
-
-                    cv::cvtColor(colorFrame, camera.m_videoframeOriginal, CV_BGR2GRAY);
-                    resizeCamera();
-                }
-
-                if (camera.m_videoFPSCount < camera.m_videoFPSManualEnable ? camera.m_videoFPSManual : camera.m_videoFPS)
-                {
-                    camera.m_videoPrevFPSCount = (int) camera.m_videoFPSCount;
-                    camera.m_videoFPSCount += (camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq);
-                }
-                else
-                {
-                    camera.m_videoPrevFPSCount = 0;
-                    camera.m_videoFPSCount = camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq;
-                }
+        }
+
+        int fpsIncrement = (int) camera.m_videoFPSCount - camera.m_videoPrevFPSCount;
+
+        // move a number of frames according to increment
+        // use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
+        cv::Mat colorFrame;
+
+        for (int i = 0; i < fpsIncrement; i++)
+        {
+            camera.m_camera >> colorFrame;
+            if (colorFrame.empty()) break;
+        }
+
+        if (!colorFrame.empty()) // some frames may not come out properly
+        {
+            if (m_showOverlayText) {
+                mixImageAndText(colorFrame);
             }
+
+            cv::cvtColor(colorFrame, camera.m_videoframeOriginal, CV_BGR2GRAY);
+            resizeCamera();
+            newFrame = true;
         }
 
-        m_horizontalCount = 0;
+        if (camera.m_videoFPSCount < camera.m_videoFPSManualEnable ? camera.m_videoFPSManual : camera.m_videoFPS)
+        {
+            camera.m_videoPrevFPSCount = (int) camera.m_videoFPSCount;
+            camera.m_videoFPSCount += (camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq);
+        }
+        else
+        {
+            camera.m_videoPrevFPSCount = 0;
+            camera.m_videoFPSCount = camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq;
+        }
     }
+
+    return newFrame;
 }
 
 void ATVMod::calculateLevel(Real& sample)
@@ -532,12 +574,14 @@ bool ATVMod::handleMessage(const Message& cmd)
     else if (MsgConfigureImageFileName::match(cmd))
     {
         MsgConfigureImageFileName& conf = (MsgConfigureImageFileName&) cmd;
+        QMutexLocker mutexLocker(&m_frameMutex);
         openImage(conf.getFileName());
         return true;
     }
     else if (MsgConfigureVideoFileName::match(cmd))
     {
         MsgConfigureVideoFileName& conf = (MsgConfigureVideoFileName&) cmd;
+        QMutexLocker mutexLocker(&m_frameMutex);
         openVideo(conf.getFileName());
         return true;
     }
@@ -551,6 +595,7 @@ bool ATVMod::handleMessage(const Message& cmd)
     else if (MsgConfigureVideoFileSourceStreamTiming::match(cmd))
     {
         int framesCount;
+        QMutexLocker mutexLocker(&m_frameMutex);
 
         if (m_videoOK && m_video.isOpened())
         {
@@ -572,10 +617,12 @@ bool ATVMod::handleMessage(const Message& cmd)
     {
     	MsgConfigureCameraIndex& cfg = (MsgConfigureCameraIndex&) cmd;
     	uint32_t index = cfg.getIndex() & 0x7FFFFFF;
+    	QMutexLocker mutexLocker(&m_frameMutex);
 
     	if (index < m_cameras.size())
     	{
     		m_cameraIndex = index;
+    		m_frameDirty = true;
 
     		if (getMessageQueueToGUI())
     		{
@@ -600,6 +647,7 @@ bool ATVMod::handleMessage(const Message& cmd)
     	uint32_t index = cfg.getIndex() & 0x7FFFFFF;
     	float mnaualFPS = cfg.getManualFPS();
     	bool manualFPSEnable = cfg.getManualFPSEnable();
+    	QMutexLocker mutexLocker(&m_frameMutex);
 
     	if (index < m_cameras.size())
     	{
@@ -612,6 +660,7 @@ bool ATVMod::handleMessage(const Message& cmd)
     else if (MsgConfigureOverlayText::match(cmd))
     {
         MsgConfigureOverlayText& cfg = (MsgConfigureOverlayText&) cmd;
+        QMutexLocker mutexLocker(&m_frameMutex);
         m_overlayText = cfg.getOverlayText().toStdString();
         return true;
     }
@@ -619,6 +668,7 @@ bool ATVMod::handleMessage(const Message& cmd)
     {
         MsgConfigureShowOverlayText& cfg = (MsgConfigureShowOverlayText&) cmd;
         bool showOverlayText = cfg.getShowOverlayText();
+        QMutexLocker mutexLocker(&m_frameMutex);
 
         if (!m_imageFromFile.empty())
         {
@@ -632,6 +682,7 @@ bool ATVMod::handleMessage(const Message& cmd)
             }
 
             resizeImage();
+            m_frameDirty = true;
         }
 
         m_showOverlayText = showOverlayText;
@@ -681,6 +732,8 @@ float ATVMod::getRFBandwidthDivisor(ATVModSettings::ATVModulation modulation)
 
 void ATVMod::applyStandard()
 {
+    QMutexLocker mutexLocker(&m_frameMutex);
+
     m_pointsPerSync  = (uint32_t) ((4.7f / 64.0f) * m_pointsPerLine);
     m_pointsPerBP    = (uint32_t) ((4.7f / 64.0f) * m_pointsPerLine);
     m_pointsPerFP    = (uint32_t) ((2.6f / 64.0f) * m_pointsPerLine);
@@ -809,6 +862,7 @@ void ATVMod::applyStandard()
     }
 
     calculateCamerasSizes();
+    m_frameDirty = true;
 }
 
 void ATVMod::openImage(const QString& fileName)
@@ -825,6 +879,7 @@ void ATVMod::openImage(const QString& fileName)
 	    }
 
 	    resizeImage();
+	    m_frameDirty = true;
 	}
 }
 
@@ -929,7 +984,7 @@ void ATVMod::resizeCamera()
 
 void ATVMod::seekVideoFileStream(int seekPercentage)
 {
-    QMutexLocker mutexLocker(&m_settingsMutex);
+    QMutexLocker mutexLocker(&m_frameMutex);
 
     if ((m_videoOK) && m_video.isOpened())
     {
@@ -1153,7 +1208,10 @@ void ATVMod::applySettings(const ATVModSettings& settings, bool force)
         m_settingsMutex.unlock();
     }
 
+    m_frameMutex.lock();
     m_settings = settings;
+    m_frameDirty = true;
+    m_frameMutex.unlock();
 }
 
 QByteArray ATVMod::serialize() const
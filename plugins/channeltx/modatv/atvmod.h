@@ -40,10 +40,13 @@
 class DeviceSinkAPI;
 class ThreadedBasebandSampleSource;
 class UpChannelizer;
+class ATVModFrameThread;
 
 class ATVMod : public BasebandSampleSource, public ChannelSourceAPI {
     Q_OBJECT
 
+    friend class ATVModFrameThread;
+
 public:
     class MsgConfigureATVMod : public Message {
         MESSAGE_CLASS_DECLARATION
@@ -506,12 +509,16 @@ private:
     float    m_hBarIncrement;    //!< video level increment at each horizontal bar increment
     float    m_vBarIncrement;    //!< video level increment at each vertical bar increment
     bool     m_interleaved;      //!< true if image is interlaced (2 half frames per frame)
-    bool     m_evenImage;        //!< in interlaced mode true if this is an even image
     QMutex   m_settingsMutex;
-    int      m_horizontalCount;  //!< current point index on line
-    int      m_lineCount;        //!< current line index in frame
     float    m_fps;              //!< resulting frames per second
 
+    ATVModFrameThread *m_frameThread; //!< renders the frames samples ahead of time
+    QMutex   m_frameMutex;       //!< protects line timings and image sources used to render frames
+    bool     m_frameDirty;       //!< frame has to be rendered again
+    const Real *m_frame;         //!< samples of the frame being transmitted
+    unsigned int m_frameSize;    //!< number of samples in the frame being transmitted
+    unsigned int m_framePosition; //!< index of the next sample to transmit in the frame
+
     MovingAverageUtil<double, double, 16> m_movingAverage;
     quint32 m_levelCalcCount;
     Real m_peakLevel;
@@ -565,6 +572,9 @@ private:
     void applySettings(const ATVModSettings& settings, bool force = false);
     void pullFinalize(Complex& ci, Sample& sample);
     void pullVideo(Real& sample);
+    bool renderFrame(std::vector<Real>& frame);
+    void renderSample(Real& sample, int lineCount, int horizontalCount);
+    bool nextSourceFrame();
     void calculateLevel(Real& sample);
     void modulateSample();
     Complex& modulateSSB(Real& sample);
@@ -583,21 +593,21 @@ private:
     void resizeCamera();
     void mixImageAndText(cv::Mat& image);
 
-    inline void pullImageLine(Real& sample, bool noHSync = false)
+    inline void pullImageLine(Real& sample, int lineCount, int horizontalCount, bool noHSync = false)
     {
-        if (m_horizontalCount < m_pointsPerSync) // sync pulse
+        if (horizontalCount < m_pointsPerSync) // sync pulse
         {
             sample = noHSync ? m_blackLevel : 0.0f; // ultra-black
         }
-        else if (m_horizontalCount < m_pointsPerSync + m_pointsPerBP) // back porch
+        else if (horizontalCount < m_pointsPerSync + m_pointsPerBP) // back porch
         {
             sample = m_blackLevel; // black
         }
-        else if (m_horizontalCount < m_pointsPerSync + m_pointsPerBP + m_pointsPerImgLine)
+        else if (horizontalCount < m_pointsPerSync + m_pointsPerBP + m_pointsPerImgLine)
         {
-            int pointIndex = m_horizontalCount - (m_pointsPerSync + m_pointsPerBP);
-            int oddity = m_lineCount < m_nbLines2 + 1 ? 0 : 1;
-            int iLine = oddity == 0 ? m_lineCount :  m_lineCount - m_nbLines2 - 1;
+            int pointIndex = horizontalCount - (m_pointsPerSync + m_pointsPerBP);
+            int oddity = lineCount < m_nbLines2 + 1 ? 0 : 1;
+            int iLine = oddity == 0 ? lineCount :  lineCount - m_nbLines2 - 1;
             int iLineImage = iLine - m_nbBlankLines - (oddity == 0 ? m_nbSyncLinesHeadE : m_nbSyncLinesHeadO);
 
             switch(m_settings.m_atvModInput)
@@ -691,9 +701,9 @@ private:
         }
     }
 
-    inline void pullVSyncLineLongPulses(Real& sample)
+    inline void pullVSyncLineLongPulses(Real& sample, int horizontalCount)
     {
-        int halfIndex = m_horizontalCount % (m_nbHorizPoints/2);
+        int halfIndex = horizontalCount % (m_nbHorizPoints/2);
 
         if (halfIndex < (m_nbHorizPoints/2) - m_pointsPerSync) // ultra-black
         {
@@ -701,7 +711,7 @@ private:
         }
         else // black
         {
-            if (m_singleLongSync && (m_horizontalCount < m_nbHorizPoints/2)) {
+            if (m_singleLongSync && (horizontalCount < m_nbHorizPoints/2)) {
                 sample = 0.0f;
             } else {
                 sample = m_blackLevel;
@@ -709,17 +719,17 @@ private:
         }
     }
 
-    inline void pullVSyncLineEqualizingPulses(Real& sample)
+    inline void pullVSyncLineEqualizingPulses(Real& sample, int horizontalCount)
     {
-        if (m_horizontalCount < m_pointsPerSync)
+        if (horizontalCount < m_pointsPerSync)
         {
             sample = 0.0f; // ultra-black
         }
-        else if (m_horizontalCount < (m_nbHorizPoints/2))
+        else if (horizontalCount < (m_nbHorizPoints/2))
         {
             sample = m_blackLevel; // black
         }
-        else if (m_horizontalCount < (m_nbHorizPoints/2) + m_pointsPerFSync)
+        else if (horizontalCount < (m_nbHorizPoints/2) + m_pointsPerFSync)
         {
             sample = 0.0f; // ultra-black
         }
@@ -729,17 +739,17 @@ private:
         }
     }
 
-    inline void pullVSyncLineEqualizingThenLongPulses(Real& sample)
+    inline void pullVSyncLineEqualizingThenLongPulses(Real& sample, int horizontalCount)
     {
-        if (m_horizontalCount < m_pointsPerSync)
+        if (horizontalCount < m_pointsPerSync)
         {
             sample = 0.0f; // ultra-black
         }
-        else if (m_horizontalCount < (m_nbHorizPoints/2))
+        else if (horizontalCount < (m_nbHorizPoints/2))
         {
             sample = m_blackLevel; // black
         }
-        else if (m_horizontalCount < m_nbHorizPoints - m_pointsPerSync)
+        else if (horizontalCount < m_nbHorizPoints - m_pointsPerSync)
         {
             sample = 0.0f; // ultra-black
         }
@@ -749,17 +759,17 @@ private:
         }
     }
 
-    inline void pullVSyncLineLongThenEqualizingPulses(Real& sample)
+    inline void pullVSyncLineLongThenEqualizingPulses(Real& sample, int horizontalCount)
     {
-        if (m_horizontalCount < (m_nbHorizPoints/2) - m_pointsPerSync)
+        if (horizontalCount < (m_nbHorizPoints/2) - m_pointsPerSync)
         {
             sample = 0.0f; // ultra-black
         }
-        else if (m_horizontalCount < (m_nbHorizPoints/2))
+        else if (horizontalCount < (m_nbHorizPoints/2))
         {
             sample = m_blackLevel; // black
         }
-        else if (m_horizontalCount < (m_nbHorizPoints/2) + m_pointsPerFSync)
+        else if (horizontalCount < (m_nbHorizPoints/2) + m_pointsPerFSync)
         {
             sample = 0.0f; // ultra-black
         }
@@ -769,35 +779,35 @@ private:
         }
     }
 
-    inline void pullVSyncLine(Real& sample)
+    inline void pullVSyncLine(Real& sample, int lineCount, int horizontalCount)
     {
-        if (m_lineCount < m_nbLines2 + 1) // even
+        if (lineCount < m_nbLines2 + 1) // even
         {
-            int fieldLine = m_lineCount;
+            int fieldLine = lineCount;
 
             if (fieldLine < m_nbLongSyncLines) // 0,1: Whole line "long" pulses
             {
-                pullVSyncLineLongPulses(sample);
+                pullVSyncLineLongPulses(sample, horizontalCount);
             }
             else if (fieldLine < m_nbLongSyncLines + m_nbHalfLongSync) // long pulse then equalizing pulse
             {
-                pullVSyncLineLongThenEqualizingPulses(sample);
+                pullVSyncLineLongThenEqualizingPulses(sample, horizontalCount);
             }
             else if (fieldLine < m_nbLongSyncLines + m_nbHalfLongSync + m_nbWholeEqLines) // Whole line equalizing pulses
             {
-                pullVSyncLineEqualizingPulses(sample);
+                pullVSyncLineEqualizingPulses(sample, horizontalCount);
             }
             else if (fieldLine > m_nbLines2 - m_nbHalfLongSync) // equalizing pulse then long pulse
             {
-                pullVSyncLineEqualizingThenLongPulses(sample);
+                pullVSyncLineEqualizingThenLongPulses(sample, horizontalCount);
             }
             else if (fieldLine > m_nbLines2 - m_nbHalfLongSync - m_nbWholeEqLines) // Whole line equalizing pulses
             {
-                pullVSyncLineEqualizingPulses(sample);
+                pullVSyncLineEqualizingPulses(sample, horizontalCount);
             }
             else // black images
             {
-                if (m_horizontalCount < m_pointsPerSync)
+                if (horizontalCount < m_pointsPerSync)
                 {
                     sample = 0.0f;
                 }
@@ -809,23 +819,23 @@ private:
         }
         else // odd
         {
-            int fieldLine = m_lineCount - m_nbLines2 - 1;
+            int fieldLine = lineCount - m_nbLines2 - 1;
 
             if (fieldLine < m_nbLongSyncLines) // 0,1: Whole line "long" pulses
             {
-                pullVSyncLineLongPulses(sample);
+                pullVSyncLineLongPulses(sample, horizontalCount);
             }
             else if (fieldLine < m_nbLongSyncLines + m_nbWholeEqLines) // Whole line equalizing pulses
             {
-                pullVSyncLineEqualizingPulses(sample);
+                pullVSyncLineEqualizingPulses(sample, horizontalCount);
             }
             else if (fieldLine > m_nbLines2 - 1 - m_nbWholeEqLines - m_nbHalfLongSync) // Whole line equalizing pulses
             {
-                pullVSyncLineEqualizingPulses(sample);
+                pullVSyncLineEqualizingPulses(sample, horizontalCount);
             }
             else // black images
             {
-                if (m_horizontalCount < m_pointsPerSync)
+                if (horizontalCount < m_pointsPerSync)
                 {
                     sample = 0.0f;
                 }
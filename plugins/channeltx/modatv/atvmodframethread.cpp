@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "atvmod.h"
+#include "atvmodframethread.h"
+
+ATVModFrameThread::ATVModFrameThread(ATVMod *atvMod, QObject* parent) :
+    QThread(parent),
+    m_atvMod(atvMod),
+    m_readIndex(0),
+    m_readyIndex(-1),
+    m_frameRequested(true),
+    m_running(false)
+{
+}
+
+ATVModFrameThread::~ATVModFrameThread()
+{
+    if (m_running) {
+        stopWork();
+    }
+}
+
+void ATVModFrameThread::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+    while(!m_running)
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    m_startWaitMutex.unlock();
+}
+
+void ATVModFrameThread::stopWork()
+{
+    m_mutex.lock();
+    m_running = false;
+    m_frameRequest.wakeAll();
+    m_mutex.unlock();
+    wait();
+}
+
+const Real *ATVModFrameThread::nextFrame(unsigned int& size)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_readyIndex >= 0)
+    {
+        m_readIndex = m_readyIndex;
+        m_readyIndex = -1;
+    }
+
+    m_frameRequested = true;
+    m_frameRequest.wakeOne();
+
+    size = m_frames[m_readIndex].size();
+    return size > 0 ? m_frames[m_readIndex].data() : 0;
+}
+
+void ATVModFrameThread::run()
+{
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    qDebug("ATVModFrameThread::run: started");
+
+    while (m_running)
+    {
+        int writeIndex = 0;
+
+        m_mutex.lock();
+
+        while (m_running && !m_frameRequested) {
+            m_frameRequest.wait(&m_mutex, 100);
+        }
+
+        m_frameRequested = false;
+
+        // the frame being rendered is neither the one being read nor the last completed one
+        while ((writeIndex == m_readIndex) || (writeIndex == m_readyIndex)) {
+            writeIndex++;
+        }
+
+        m_mutex.unlock();
+
+        if (!m_running) {
+            break;
+        }
+
+        if (m_atvMod->renderFrame(m_frames[writeIndex])) // frame has changed
+        {
+            m_mutex.lock();
+            m_readyIndex = writeIndex;
+            m_mutex.unlock();
+        }
+    }
+
+    qDebug("ATVModFrameThread::run: stopped");
+}
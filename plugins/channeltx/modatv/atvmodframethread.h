@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_CHANNELTX_MODATV_ATVMODFRAMETHREAD_H_
+#define PLUGINS_CHANNELTX_MODATV_ATVMODFRAMETHREAD_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+
+class ATVMod;
+
+/**
+ * Producer of complete video frames for the ATV modulator. Each frame is rendered
+ * ahead of time as the sequence of line samples (sync, porches and image) that will
+ * be pulled by the modulator. Three frame buffers are rotated: the one being read by
+ * the modulator, the last completed one and the one being rendered.
+ */
+class ATVModFrameThread : public QThread {
+    Q_OBJECT
+
+public:
+    ATVModFrameThread(ATVMod *atvMod, QObject* parent = 0);
+    ~ATVModFrameThread();
+
+    void startWork();
+    void stopWork();
+
+    /**
+     * Called by the modulator at the end of the current frame. Returns the last completed
+     * frame if any else the current one again and requests the rendering of the next one.
+     * \param size returns the number of samples in the frame (0 if nothing rendered yet)
+     */
+    const Real *nextFrame(unsigned int& size);
+
+private:
+    static const int m_nbFrames = 3;
+
+    ATVMod *m_atvMod;
+    std::vector<Real> m_frames[m_nbFrames];
+    int m_readIndex;     //!< frame being pulled by the modulator
+    int m_readyIndex;    //!< last completed frame not yet pulled or -1
+    bool m_frameRequested;
+    QMutex m_mutex;
+    QWaitCondition m_frameRequest;
+
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    volatile bool m_running;
+
+    void run();
+};
+
+#endif /* PLUGINS_CHANNELTX_MODATV_ATVMODFRAMETHREAD_H_ */
@@ -29,11 +29,13 @@ CONFIG(MINGW64):INCLUDEPATH += "D:\softs\opencv\build\include"
 CONFIG(macx):INCLUDEPATH += "/opt/local/include"
 
 SOURCES += atvmod.cpp\
+	atvmodframethread.cpp\
 	atvmodgui.cpp\
 	atvmodplugin.cpp\
 	atvmodsettings.cpp
 
 HEADERS += atvmod.h\
+	atvmodframethread.h\
 	atvmodgui.h\
 	atvmodplugin.h\
 	atvmodsettings.h
@@ -36,6 +36,7 @@ public:
 	void initPlugin(PluginAPI* pluginAPI);
 
 	virtual SamplingDevices enumSampleSinks();
+	virtual bool isDeviceEnumerationCacheable() const { return false; } //!< devices are opened from the scan done at enumeration
 	virtual PluginInstanceGUI* createSampleSinkPluginInstanceGUI(
 	        const QString& sinkId,
 	        QWidget **widget,
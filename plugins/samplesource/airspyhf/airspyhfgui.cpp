@@ -220,6 +220,7 @@ void AirspyHFGui::displaySettings()
 	ui->LOppmText->setText(QString("%1").arg(QString::number(m_settings.m_LOppmTenths/10.0, 'f', 1)));
 	ui->sampleRate->setCurrentIndex(m_settings.m_devSampleRateIndex);
 	ui->decim->setCurrentIndex(m_settings.m_log2Decim);
+	ui->floatBaseband->setChecked(m_settings.m_floatBaseband);
     ui->band->blockSignals(false);
     blockApplySettings(false);
 }
@@ -290,6 +291,12 @@ void AirspyHFGui::on_decim_currentIndexChanged(int index)
 	sendSettings();
 }
 
+void AirspyHFGui::on_floatBaseband_toggled(bool checked)
+{
+	m_settings.m_floatBaseband = checked;
+	sendSettings();
+}
+
 void AirspyHFGui::on_startStop_toggled(bool checked)
 {
     if (m_doApplySettings)
@@ -82,6 +82,7 @@ private slots:
     void on_resetLOppm_clicked();
 	void on_sampleRate_currentIndexChanged(int index);
 	void on_decim_currentIndexChanged(int index);
+	void on_floatBaseband_toggled(bool checked);
 	void on_startStop_toggled(bool checked);
     void on_record_toggled(bool checked);
     void on_transverter_clicked();
@@ -448,6 +448,12 @@ bool AirspyHFInput::applySettings(const AirspyHFSettings& settings, bool force)
 		forwardChange = true;
 	}
 
+	if ((m_settings.m_floatBaseband != settings.m_floatBaseband) || force)
+	{
+		m_deviceAPI->configureFloatBaseband(settings.m_floatBaseband);
+		qDebug("AirspyHFInput::applySettings: %s baseband", settings.m_floatBaseband ? "floating point" : "fixed point");
+	}
+
 	if (forwardChange && (sampleRateIndex >= 0))
 	{
 		int sampleRate = m_sampleRates[sampleRateIndex]/(1<<settings.m_log2Decim);
@@ -33,6 +33,7 @@ void AirspyHFSettings::resetToDefaults()
     m_transverterMode = false;
     m_transverterDeltaFrequency = 0;
     m_bandIndex = 0;
+    m_floatBaseband = false;
 }
 
 QByteArray AirspyHFSettings::serialize() const
@@ -45,6 +46,7 @@ QByteArray AirspyHFSettings::serialize() const
     s.writeBool(7, m_transverterMode);
     s.writeS64(8, m_transverterDeltaFrequency);
     s.writeU32(9, m_bandIndex);
+    s.writeBool(10, m_floatBaseband);
 
 	return s.final();
 }
@@ -72,6 +74,7 @@ bool AirspyHFSettings::deserialize(const QByteArray& data)
         d.readS64(8, &m_transverterDeltaFrequency, 0);
         d.readU32(9, &uintval, 0);
         m_bandIndex = uintval > 1 ? 1 : uintval;
+        d.readBool(10, &m_floatBaseband, false);
 
 		return true;
 	}
@@ -26,6 +26,7 @@ struct AirspyHFSettings
     bool m_transverterMode;
     qint64 m_transverterDeltaFrequency;
     quint32 m_bandIndex;
+    bool m_floatBaseband; //!< pass floating point samples to the DSP engine
 
     AirspyHFSettings();
 	void resetToDefaults();
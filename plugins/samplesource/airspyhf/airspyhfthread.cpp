@@ -27,6 +27,7 @@ AirspyHFThread::AirspyHFThread(airspyhf_device_t* dev, SampleSinkFifo* sampleFif
 	m_running(false),
 	m_dev(dev),
 	m_convertBuffer(AIRSPYHF_BLOCKSIZE),
+	m_convertBufferF(),
 	m_sampleFifo(sampleFifo),
 	m_samplerate(10),
 	m_log2Decim(0)
@@ -99,10 +100,9 @@ void AirspyHFThread::run()
 }
 
 //  Decimate according to specified log2 (ex: log2=4 => decim=16)
-void AirspyHFThread::callback(const float* buf, qint32 len)
+template<typename Iterator>
+Iterator AirspyHFThread::decimate(Iterator it, const float* buf, qint32 len)
 {
-	SampleVector::iterator it = m_convertBuffer.begin();
-
     switch (m_log2Decim)
     {
     case 0:
@@ -130,7 +130,25 @@ void AirspyHFThread::callback(const float* buf, qint32 len)
         break;
     }
 
-	m_sampleFifo->write(m_convertBuffer.begin(), it);
+    return it;
+}
+
+void AirspyHFThread::callback(const float* buf, qint32 len)
+{
+    if (m_sampleFifo->isFloat()) // floating point baseband: no conversion
+    {
+        if (m_convertBufferF.size() != AIRSPYHF_BLOCKSIZE) {
+            m_convertBufferF.resize(AIRSPYHF_BLOCKSIZE);
+        }
+
+        FSampleVector::iterator it = decimate(m_convertBufferF.begin(), buf, len);
+        m_sampleFifo->write(m_convertBufferF.begin(), it);
+    }
+    else
+    {
+        SampleVector::iterator it = decimate(m_convertBuffer.begin(), buf, len);
+        m_sampleFifo->write(m_convertBuffer.begin(), it);
+    }
 }
 
 
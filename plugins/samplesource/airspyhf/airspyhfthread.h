@@ -47,6 +47,7 @@ private:
 	airspyhf_device_t* m_dev;
 	qint16 m_buf[2*AIRSPYHF_BLOCKSIZE];
 	SampleVector m_convertBuffer;
+	FSampleVector m_convertBufferF; //!< used when the FIFO stores floating point samples
 	SampleSinkFifo* m_sampleFifo;
 
 	int m_samplerate;
@@ -57,6 +58,7 @@ private:
 
 	void run();
 	void callback(const float* buf, qint32 len);
+	template<typename Iterator> Iterator decimate(Iterator it, const float* buf, qint32 len);
 	static int rx_callback(airspyhf_transfer_t* transfer);
 };
 
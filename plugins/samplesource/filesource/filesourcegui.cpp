@@ -271,13 +271,10 @@ void FileSourceGui::on_play_toggled(bool checked)
 
 void FileSourceGui::on_navTimeSlider_valueChanged(int value)
 {
-	if (m_enableNavTime && ((value >= 0) && (value <= 100)))
+	if (m_enableNavTime && (value >= 0))
 	{
-		int t_sec = (m_recordLength * value) / 100;
-		QTime t(0, 0, 0, 0);
-		t = t.addSecs(t_sec);
-
-		FileSourceInput::MsgConfigureFileSourceSeek* message = FileSourceInput::MsgConfigureFileSourceSeek::create(value);
+		// one step per second of the recording
+		FileSourceInput::MsgConfigureFileSourceSeekTime* message = FileSourceInput::MsgConfigureFileSourceSeekTime::create(value * 1000LL);
 		m_sampleSource->getInputMessageQueue()->push(message);
 	}
 }
@@ -285,7 +282,7 @@ void FileSourceGui::on_navTimeSlider_valueChanged(int value)
 void FileSourceGui::on_showFileDialog_clicked(bool checked __attribute__((unused)))
 {
 	QString fileName = QFileDialog::getOpenFileName(this,
-	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq)"));
+	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq *.sigmf-meta)"));
 
 	if (fileName != "")
 	{
@@ -319,6 +316,7 @@ void FileSourceGui::updateWithStreamData()
 	recordLength = recordLength.addSecs(m_recordLength);
 	QString s_time = recordLength.toString("hh:mm:ss");
 	ui->recordLengthText->setText(s_time);
+	ui->navTimeSlider->setMaximum(m_recordLength > 0 ? m_recordLength : 1);
 	updateWithStreamTime(); // TODO: remove when time data is implemented
 }
 
@@ -346,10 +344,8 @@ void FileSourceGui::updateWithStreamTime()
 	QString s_date = dt.toString("yyyy-MM-dd hh:mm:ss.zzz");
 	ui->absTimeText->setText(s_date);
 
-	if (!m_enableNavTime)
-	{
-		float posRatio = (float) t_sec / (float) m_recordLength;
-		ui->navTimeSlider->setValue((int) (posRatio * 100.0));
+	if (!m_enableNavTime) {
+		ui->navTimeSlider->setValue(t_sec);
 	}
 }
 
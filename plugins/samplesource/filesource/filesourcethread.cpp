@@ -34,8 +34,9 @@ FileSourceThread::FileSourceThread(std::ifstream *samplesStream, SampleSinkFifo*
 	m_sampleFifo(sampleFifo),
 	m_samplesCount(0),
     m_samplerate(0),
-	m_samplesize(0),
+	m_format(SampleFormat::getNativeFormat()),
 	m_samplebytes(0),
+	m_dataOffset(sizeof(FileRecord::Header)),
     m_throttlems(FILESOURCE_THROTTLE_MS),
     m_throttleToggle(false)
 {
@@ -84,23 +85,23 @@ void FileSourceThread::stopWork()
 	wait();
 }
 
-void FileSourceThread::setSampleRateAndSize(int samplerate, quint32 samplesize)
+void FileSourceThread::setSampleRateAndFormat(int samplerate, SampleFormat::Format format)
 {
-	qDebug() << "FileSourceThread::setSampleRateAndSize:"
+	qDebug() << "FileSourceThread::setSampleRateAndFormat:"
 			<< " new rate:" << samplerate
-			<< " new size:" << samplesize
+			<< " new format:" << SampleFormat::getSigMFDatatype(format)
 			<< " old rate:" << m_samplerate
-			<< " old size:" << m_samplesize;
+			<< " old format:" << SampleFormat::getSigMFDatatype(m_format);
 
-	if ((samplerate != m_samplerate) || (samplesize != m_samplesize))
+	if ((samplerate != m_samplerate) || (format != m_format) || (m_samplebytes == 0))
 	{
 		if (m_running) {
 			stopWork();
 		}
 
 		m_samplerate = samplerate;
-		m_samplesize = samplesize;
-		m_samplebytes = m_samplesize > 16 ? sizeof(int32_t) : sizeof(int16_t);
+		m_format = format;
+		m_samplebytes = SampleFormat::getComponentBytes(m_format);
         // TODO: implement FF and slow motion here. 2 corresponds to live. 1 is half speed, 4 is double speed
         m_chunksize = (m_samplerate * 2 * m_samplebytes * m_throttlems) / 1000;
 
@@ -190,7 +191,7 @@ void FileSourceThread::tick()
             //m_sampleFifo->write(m_buf, m_ifstream->gcount());
             // TODO: handle loop playback situation
     		m_ifstream->clear();
-            m_ifstream->seekg(sizeof(FileRecord::Header), std::ios::beg);
+            m_ifstream->seekg(m_dataOffset, std::ios::beg);
     		m_samplesCount = 0;
             //stopWork();
             //m_ifstream->close();
@@ -206,46 +207,14 @@ void FileSourceThread::tick()
 
 void FileSourceThread::writeToSampleFifo(const quint8* buf, qint32 nbBytes)
 {
-	if (m_samplesize == 16)
+	if (m_format == SampleFormat::getNativeFormat())
 	{
-		if (SDR_RX_SAMP_SZ == 16)
-		{
-			m_sampleFifo->write(buf, nbBytes);
-		}
-		else if (SDR_RX_SAMP_SZ == 24)
-		{
-			FixReal *convertBuf = (FixReal *) m_convertBuf;
-			const int16_t *fileBuf = (int16_t *) buf;
-			int nbSamples = nbBytes / (2 * m_samplebytes);
-
-			for (int is = 0; is < nbSamples; is++)
-			{
-				convertBuf[2*is]   = fileBuf[2*is] << 8;
-				convertBuf[2*is+1] = fileBuf[2*is+1] << 8;
-			}
-
-			m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-		}
+		m_sampleFifo->write(buf, nbBytes);
 	}
-	else if (m_samplesize == 24)
+	else
 	{
-		if (SDR_RX_SAMP_SZ == 24)
-		{
-			m_sampleFifo->write(buf, nbBytes);
-		}
-		else if (SDR_RX_SAMP_SZ == 16)
-		{
-			FixReal *convertBuf = (FixReal *) m_convertBuf;
-			const int32_t *fileBuf = (int32_t *) buf;
-			int nbSamples = nbBytes / (2 * m_samplebytes);
-
-			for (int is = 0; is < nbSamples; is++)
-			{
-				convertBuf[2*is]   = fileBuf[2*is] >> 8;
-				convertBuf[2*is+1] = fileBuf[2*is+1] >> 8;
-			}
-
-			m_sampleFifo->write((quint8*) convertBuf, nbSamples*sizeof(Sample));
-		}
+		int nbSamples = nbBytes / (2 * m_samplebytes);
+		SampleFormat::toSamples(m_format, buf, (Sample *) m_convertBuf, nbSamples);
+		m_sampleFifo->write(m_convertBuf, nbSamples*sizeof(Sample));
 	}
 }
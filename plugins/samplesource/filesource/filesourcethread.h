@@ -27,6 +27,7 @@
 #include <cstdlib>
 
 #include "dsp/inthalfbandfilter.h"
+#include "dsp/sampleformat.h"
 
 #define FILESOURCE_THROTTLE_MS 50
 
@@ -41,7 +42,8 @@ public:
 
 	void startWork();
 	void stopWork();
-	void setSampleRateAndSize(int samplerate, quint32 samplesize);
+	void setSampleRateAndFormat(int samplerate, SampleFormat::Format format);
+	void setDataOffset(quint64 dataOffset) { m_dataOffset = dataOffset; } //!< position of the first sample in the file
     void setBuffers(std::size_t chunksize);
 	bool isRunning() const { return m_running; }
 	std::size_t getSamplesCount() const { return m_samplesCount; }
@@ -63,8 +65,9 @@ private:
 	std::size_t m_samplesCount;
 
 	int m_samplerate;      //!< File I/Q stream original sample rate
-	quint32 m_samplesize;  //!< File effective sample size in bits (I or Q). Ex: 16, 24.
-	quint32 m_samplebytes; //!< Number of bytes used to store a I or Q sample. Ex: 2. 4.
+	SampleFormat::Format m_format; //!< File I/Q sample format
+	quint32 m_samplebytes; //!< Number of bytes used to store a I or Q sample. Ex: 1, 2, 4.
+	quint64 m_dataOffset;  //!< Position of the first sample in the file (after header)
     int m_throttlems;
     QElapsedTimer m_elapsedTimer;
     bool m_throttleToggle;
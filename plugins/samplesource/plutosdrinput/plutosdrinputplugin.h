@@ -36,6 +36,7 @@ public:
 	void initPlugin(PluginAPI* pluginAPI);
 
 	virtual SamplingDevices enumSampleSources();
+	virtual bool isDeviceEnumerationCacheable() const { return false; } //!< devices are opened from the scan done at enumeration
 	virtual PluginInstanceGUI* createSampleSourcePluginInstanceGUI(
 	        const QString& sourceId,
 	        QWidget **widget,
@@ -16,7 +16,9 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <string.h>
-#include <QTime>
+#include <atomic>
+#include <QElapsedTimer>
+#include <QThread>
 #include "dsp/dsptypes.h"
 #include "audio/audiofifo.h"
 
@@ -25,237 +27,240 @@
 AudioFifo::AudioFifo() :
 	m_fifo(0),
 	m_sampleSize(sizeof(AudioSample)),
+	m_size(0),
+	m_mask(0),
+	m_writeCount(0),
+	m_writeReserve(0),
+	m_readCount(0),
+	m_streaming(false),
+	m_overrunCount(0),
+	m_droppedSamples(0),
+	m_underrunCount(0),
+	m_mixerGain(1.0f),
 	m_udpSink(0),
 	m_copyToUDP(false)
 {
-	m_size = 0;
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
 }
 
 AudioFifo::AudioFifo(uint32_t numSamples) :
 	m_fifo(0),
-    m_sampleSize(sizeof(AudioSample)),
-    m_udpSink(0),
-    m_copyToUDP(false)
+	m_sampleSize(sizeof(AudioSample)),
+	m_size(0),
+	m_mask(0),
+	m_writeCount(0),
+	m_writeReserve(0),
+	m_readCount(0),
+	m_streaming(false),
+	m_overrunCount(0),
+	m_droppedSamples(0),
+	m_underrunCount(0),
+	m_mixerGain(1.0f),
+	m_udpSink(0),
+	m_copyToUDP(false)
 {
-	QMutexLocker mutexLocker(&m_mutex);
-
 	create(numSamples);
 }
 
 AudioFifo::~AudioFifo()
 {
-	QMutexLocker mutexLocker(&m_mutex);
-
 	if (m_fifo != 0)
 	{
 		delete[] m_fifo;
 		m_fifo = 0;
 	}
 
-	m_writeWaitCondition.wakeOne();
-	m_readWaitCondition.wakeOne();
-
 	m_size = 0;
 }
 
 bool AudioFifo::setSize(uint32_t numSamples)
 {
-	QMutexLocker mutexLocker(&m_mutex);
-
 	return create(numSamples);
 }
 
 uint AudioFifo::write(const quint8* data, uint32_t numSamples, int timeout_ms)
 {
-	QTime time;
-	uint32_t total;
-	uint32_t remaining;
-	uint32_t copyLen;
+	QElapsedTimer time;
+	uint32_t remaining = numSamples;
 
 	if (m_copyToUDP && m_udpSink)
 	{
 	    m_udpSink->write((AudioSample *) data, numSamples);
 	}
 
-	if(m_fifo == 0)
+	if (m_fifo == 0)
 	{
 		return 0;
 	}
 
 	time.start();
-	m_mutex.lock();
-
-	if(timeout_ms == 0)
-	{
-		total = MIN(numSamples, m_size - m_fill);
-	}
-	else
-	{
-		total = numSamples;
-	}
-
-	remaining = total;
 
 	while (remaining > 0)
 	{
-		if (isFull())
+		quint32 writeCount = m_writeCount.load(); // only this thread moves it
+		quint32 room = m_size - (writeCount - (quint32) m_readCount.loadAcquire());
+
+		if (room == 0)
 		{
 			if (time.elapsed() < timeout_ms)
 			{
-				m_writeWaitLock.lock();
-				m_mutex.unlock();
-				int ms = timeout_ms - time.elapsed();
-
-				if(ms < 1)
-				{
-					ms = 1;
-				}
-
-				bool ok = m_writeWaitCondition.wait(&m_writeWaitLock, ms);
-				m_writeWaitLock.unlock();
-
-				if(!ok)
-				{
-					return total - remaining;
-				}
-
-				m_mutex.lock();
-
-				if(m_fifo == 0)
-				{
-					m_mutex.unlock();
-					return 0;
-				}
-			}
-			else
-			{
-				m_mutex.unlock();
-				return total - remaining;
+				QThread::usleep(500); // wait for the reader
+				continue;
 			}
+
+			break;
 		}
 
-		copyLen = MIN(remaining, m_size - m_fill);
-		copyLen = MIN(copyLen, m_size - m_tail);
-		memcpy(m_fifo + (m_tail * m_sampleSize), data, copyLen * m_sampleSize);
-		m_tail += copyLen;
-		m_tail %= m_size;
-		m_fill += copyLen;
+		uint32_t copyLen = MIN(remaining, room);
+		uint32_t tail = writeCount & m_mask;
+		uint32_t firstLen = MIN(copyLen, m_mask + 1 - tail);
+		// a tap checks the reserve after copying samples out to know if they were overwritten meanwhile
+		m_writeReserve.store(writeCount + copyLen);
+		std::atomic_thread_fence(std::memory_order_release);
+		memcpy(m_fifo + (tail * m_sampleSize), data, firstLen * m_sampleSize);
+		memcpy(m_fifo, data + firstLen * m_sampleSize, (copyLen - firstLen) * m_sampleSize);
+		m_writeCount.storeRelease(writeCount + copyLen); // publish
 		data += copyLen * m_sampleSize;
 		remaining -= copyLen;
-		m_readWaitCondition.wakeOne();
 	}
 
-	m_mutex.unlock();
-	return total;
+	if (remaining > 0)
+	{
+		m_overrunCount.fetchAndAddRelaxed(1);
+		m_droppedSamples.fetchAndAddRelaxed(remaining);
+	}
+
+	return numSamples - remaining;
 }
 
 uint AudioFifo::read(quint8* data, uint32_t numSamples, int timeout_ms)
 {
-	QTime time;
-	uint32_t total;
-	uint32_t remaining;
-	uint32_t copyLen;
+	QElapsedTimer time;
+	uint32_t total = 0;
 
-	if(m_fifo == 0)
+	if (m_fifo == 0)
 	{
 		return 0;
 	}
 
 	time.start();
-	m_mutex.lock();
 
-	if(timeout_ms == 0)
+	while (total < numSamples)
 	{
-		total = MIN(numSamples, m_fill);
-	}
-	else
-	{
-		total = numSamples;
-	}
+		quint32 readCount = m_readCount.loadAcquire();
+		quint32 available = (quint32) m_writeCount.loadAcquire() - readCount;
 
-	remaining = total;
-
-	while(remaining > 0)
-	{
-		if(isEmpty())
+		if (available == 0)
 		{
-			if(time.elapsed() < timeout_ms)
-			{
-				m_readWaitLock.lock();
-				m_mutex.unlock();
-				int ms = timeout_ms - time.elapsed();
-
-				if(ms < 1)
-				{
-					ms = 1;
-				}
-
-				bool ok = m_readWaitCondition.wait(&m_readWaitLock, ms);
-				m_readWaitLock.unlock();
-
-				if(!ok)
-				{
-					return total - remaining;
-				}
-
-				m_mutex.lock();
-
-				if(m_fifo == 0)
-				{
-					m_mutex.unlock();
-					return 0;
-				}
-			}
-			else
+			if (time.elapsed() < timeout_ms)
 			{
-				m_mutex.unlock();
-				return total - remaining;
+				QThread::usleep(500); // wait for the writer
+				continue;
 			}
+
+			break;
 		}
 
-		copyLen = MIN(remaining, m_fill);
-		copyLen = MIN(copyLen, m_size - m_head);
-		memcpy(data, m_fifo + (m_head * m_sampleSize), copyLen * m_sampleSize);
-		m_head += copyLen;
-		m_head %= m_size;
-		m_fill -= copyLen;
-		data += copyLen * m_sampleSize;
-		remaining -= copyLen;
-		m_writeWaitCondition.wakeOne();
+		uint32_t copyLen = MIN(numSamples - total, available);
+		copyFrom(readCount, data, copyLen);
+
+		// fails only if drain() or clear() moved the read count meanwhile: the samples were discarded
+		if (m_readCount.testAndSetOrdered(readCount, readCount + copyLen))
+		{
+			data += copyLen * m_sampleSize;
+			total += copyLen;
+		}
+	}
+
+	if ((total < numSamples) && (m_streaming || (total > 0))) {
+		m_underrunCount.fetchAndAddRelaxed(1);
 	}
 
-	m_mutex.unlock();
+	m_streaming = total > 0;
 	return total;
 }
 
-uint AudioFifo::drain(uint32_t numSamples)
+void AudioFifo::attachTap(Tap& tap)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	tap.m_readCount = m_writeCount.loadAcquire();
+	tap.m_lostSamples = 0;
+}
 
-	if(numSamples > m_fill)
+uint AudioFifo::readTap(Tap& tap, quint8* data, uint32_t numSamples)
+{
+	if (m_fifo == 0)
 	{
-		numSamples = m_fill;
+		return 0;
+	}
+
+	quint32 writeCount = m_writeCount.loadAcquire();
+	quint32 available = writeCount - tap.m_readCount;
+
+	if (available > m_mask + 1) // the writer went round
+	{
+		tap.m_lostSamples += available - (m_mask + 1);
+		tap.m_readCount = writeCount - (m_mask + 1);
+		available = m_mask + 1;
+	}
+
+	uint32_t copyLen = MIN(numSamples, available);
+	copyFrom(tap.m_readCount, data, copyLen);
+
+	// samples of the write in progress may have overwritten the beginning of the copy
+	std::atomic_thread_fence(std::memory_order_acquire);
+	quint32 overwritten = (quint32) m_writeReserve.loadAcquire() - tap.m_readCount;
+
+	if (overwritten > m_mask + 1)
+	{
+		overwritten -= m_mask + 1;
+
+		if (overwritten >= copyLen)
+		{
+			tap.m_lostSamples += overwritten;
+			tap.m_readCount += overwritten;
+			return 0;
+		}
+
+		memmove(data, data + overwritten * m_sampleSize, (copyLen - overwritten) * m_sampleSize);
+		tap.m_lostSamples += overwritten;
+		tap.m_readCount += overwritten;
+		copyLen -= overwritten;
 	}
 
-	m_head = (m_head + numSamples) % m_size;
-	m_fill -= numSamples;
+	tap.m_readCount += copyLen;
+	return copyLen;
+}
 
-	m_writeWaitCondition.wakeOne();
-	return numSamples;
+uint AudioFifo::drain(uint32_t numSamples)
+{
+	while (true)
+	{
+		quint32 readCount = m_readCount.loadAcquire();
+		uint32_t count = MIN(numSamples, (quint32) m_writeCount.loadAcquire() - readCount);
+
+		if (m_readCount.testAndSetOrdered(readCount, readCount + count)) {
+			return count;
+		}
+	}
 }
 
 void AudioFifo::clear()
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	drain(m_size);
+}
 
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+void AudioFifo::resetCounters()
+{
+	m_overrunCount.store(0);
+	m_droppedSamples.store(0);
+	m_underrunCount.store(0);
+}
 
-	m_writeWaitCondition.wakeOne();
+void AudioFifo::copyFrom(quint32 position, quint8* data, uint32_t numSamples) const
+{
+	uint32_t head = position & m_mask;
+	uint32_t firstLen = MIN(numSamples, m_mask + 1 - head);
+	memcpy(data, m_fifo + (head * m_sampleSize), firstLen * m_sampleSize);
+	memcpy(data + firstLen * m_sampleSize, m_fifo, (numSamples - firstLen) * m_sampleSize);
 }
 
 bool AudioFifo::create(uint32_t numSamples)
@@ -267,12 +272,21 @@ bool AudioFifo::create(uint32_t numSamples)
 	}
 
 	m_size = 0;
-	m_fill = 0;
-	m_head = 0;
-	m_tail = 0;
+	m_mask = 0;
+	m_writeCount.store(0);
+	m_writeReserve.store(0);
+	m_readCount.store(0);
+
+	// power of two storage so that positions stay continuous when the counts wrap
+	uint32_t storageSize = 1;
+
+	while (storageSize < numSamples) {
+		storageSize <<= 1;
+	}
 
-	m_fifo = new qint8[numSamples * m_sampleSize];
+	m_fifo = new qint8[storageSize * m_sampleSize];
 	m_size = numSamples;
+	m_mask = storageSize - 1;
 
 	return m_fifo != 0;
 }
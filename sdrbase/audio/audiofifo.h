@@ -19,58 +19,91 @@
 #define INCLUDE_AUDIOFIFO_H
 
 #include <QObject>
-#include <QMutex>
-#include <QWaitCondition>
+#include <QAtomicInt>
 
 #include "dsp/dsptypes.h"
 #include "util/export.h"
 #include "util/udpsink.h"
 
+/**
+ * Lock free single producer single consumer FIFO of audio samples (AudioSample, stereo frames).
+ *
+ * - The writer (a channel) only moves the write count and the reader (the audio device callback)
+ *   only moves the read count so neither ever waits on a lock held by the other.
+ * - write() and read() with a timeout poll for room or data in the calling thread. The audio
+ *   device side uses timeout 0 so it never waits at all.
+ * - Taps are additional readers (monitoring, recording...) that never hold the writer back:
+ *   a tap that falls behind by more than the FIFO size loses the oldest samples.
+ * - Overruns (samples that could not be written) and underruns (reads that could not be
+ *   completed while the FIFO was streaming) are counted.
+ */
 class SDRANGEL_API AudioFifo : public QObject {
 	Q_OBJECT
 public:
+	/** Read position of a tap. Use it with one thread at a time. */
+	struct Tap
+	{
+		quint32 m_readCount;    //!< samples read since the FIFO creation (wraps)
+		quint32 m_lostSamples;  //!< samples overwritten before the tap could read them
+
+		Tap() : m_readCount(0), m_lostSamples(0) {}
+	};
+
 	AudioFifo();
 	AudioFifo(uint32_t numSamples);
 	~AudioFifo();
 
-	bool setSize(uint32_t numSamples);
+	bool setSize(uint32_t numSamples); //!< not thread safe: reader and writer must be stopped
 
 	uint32_t write(const quint8* data, uint32_t numSamples, int timeout_ms = INT_MAX);
 	uint32_t read(quint8* data, uint32_t numSamples, int timeout_ms = INT_MAX);
 
+	void attachTap(Tap& tap);                                      //!< tap starts at the current write position
+	uint32_t readTap(Tap& tap, quint8* data, uint32_t numSamples); //!< never waits
+
 	uint32_t drain(uint32_t numSamples);
 	void clear();
 
-	inline uint32_t flush() { return drain(m_fill); }
-	inline uint32_t fill() const { return m_fill; }
-	inline bool isEmpty() const { return m_fill == 0; }
-	inline bool isFull() const { return m_fill == m_size; }
+	inline uint32_t flush() { return drain(fill()); }
+	inline uint32_t fill() const { return (quint32) m_writeCount.loadAcquire() - (quint32) m_readCount.loadAcquire(); }
+	inline bool isEmpty() const { return fill() == 0; }
+	inline bool isFull() const { return fill() == m_size; }
 	inline uint32_t size() const { return m_size; }
 
+	quint32 getOverrunCount() const { return m_overrunCount.load(); }   //!< writes that could not store all samples
+	quint32 getDroppedSamples() const { return m_droppedSamples.load(); } //!< samples lost by these writes
+	quint32 getUnderrunCount() const { return m_underrunCount.load(); } //!< reads that could not be completed
+	void resetCounters();
+
+	void setMixerGain(float gain) { m_mixerGain = gain; } //!< gain applied when mixed into the audio output
+	float getMixerGain() const { return m_mixerGain; }
+
 	void setUDPSink(UDPSink<AudioSample> *udpSink) { m_udpSink = udpSink; }
 	void setCopyToUDP(bool copyToUDP) { m_copyToUDP = copyToUDP; }
 
 private:
-	QMutex m_mutex;
-
 	qint8* m_fifo;
 
 	const uint32_t m_sampleSize;
 
-	uint32_t m_size;
-	uint32_t m_fill;
-	uint32_t m_head;
-	uint32_t m_tail;
+	uint32_t m_size;           //!< number of samples the FIFO can hold
+	uint32_t m_mask;           //!< storage size (power of two, at least m_size) minus one
+	QAtomicInt m_writeCount;   //!< samples written since creation (wraps). Moved by the writer only.
+	QAtomicInt m_writeReserve; //!< write count at the end of the write in progress (for taps)
+	QAtomicInt m_readCount;    //!< samples read since creation (wraps). Moved by the reader, drain() and clear().
+	bool m_streaming;          //!< last read returned samples (reader side)
+
+	QAtomicInt m_overrunCount;
+	QAtomicInt m_droppedSamples;
+	QAtomicInt m_underrunCount;
 
-	QMutex m_writeWaitLock;
-	QMutex m_readWaitLock;
-	QWaitCondition m_writeWaitCondition;
-	QWaitCondition m_readWaitCondition;
+	float m_mixerGain;
 
 	UDPSink<AudioSample> *m_udpSink;
 	bool m_copyToUDP;
 
 	bool create(uint32_t numSamples);
+	void copyFrom(quint32 position, quint8* data, uint32_t numSamples) const; //!< copy out of the ring with wrap around
 };
 
 #endif // INCLUDE_AUDIOFIFO_H
@@ -16,18 +16,80 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <string.h>
+#include <math.h>
+#include <algorithm>
 #include <QAudioFormat>
 #include <QAudioDeviceInfo>
 #include <QAudioOutput>
+#include <QThread>
 #include "audio/audiooutput.h"
 #include "audio/audiofifo.h"
 
+#ifdef USE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+/** mix += gain * src on nbValues interleaved 16 bit samples */
+void mixSamples(float *mix, const qint16 *src, unsigned int nbValues, float gain)
+{
+	unsigned int i = 0;
+#ifdef USE_SSE2
+	__m128 g = _mm_set1_ps(gain);
+
+	for (; i + 8 <= nbValues; i += 8)
+	{
+		__m128i s = _mm_loadu_si128((const __m128i*) &src[i]);
+		__m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16)); // sign extension
+		__m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16));
+		_mm_storeu_ps(&mix[i], _mm_add_ps(_mm_loadu_ps(&mix[i]), _mm_mul_ps(lo, g)));
+		_mm_storeu_ps(&mix[i+4], _mm_add_ps(_mm_loadu_ps(&mix[i+4]), _mm_mul_ps(hi, g)));
+	}
+#endif
+	for (; i < nbValues; i++) {
+		mix[i] += gain * src[i];
+	}
+}
+
+/** dst = mix rounded and saturated to 16 bits */
+void saturateSamples(qint16 *dst, const float *mix, unsigned int nbValues)
+{
+	unsigned int i = 0;
+#ifdef USE_SSE2
+	__m128 max = _mm_set1_ps(32767.0f);
+	__m128 min = _mm_set1_ps(-32768.0f);
+
+	for (; i + 8 <= nbValues; i += 8)
+	{
+		__m128i lo = _mm_cvtps_epi32(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(&mix[i]), max), min));
+		__m128i hi = _mm_cvtps_epi32(_mm_max_ps(_mm_min_ps(_mm_loadu_ps(&mix[i+4]), max), min));
+		_mm_storeu_si128((__m128i*) &dst[i], _mm_packs_epi32(lo, hi));
+	}
+#endif
+	for (; i < nbValues; i++)
+	{
+		float s = mix[i];
+
+		if (s < -32768.0f) {
+			s = -32768.0f;
+		} else if (s > 32767.0f) {
+			s = 32767.0f;
+		}
+
+		dst[i] = lrintf(s);
+	}
+}
+
+} // namespace
+
 AudioOutput::AudioOutput() :
 	m_mutex(QMutex::Recursive),
 	m_audioOutput(0),
 	m_audioUsageCount(0),
 	m_onExit(false),
-	m_audioFifos()
+	m_audioFifos(new AudioFifos()),
+	m_audioFifosInUse(0)
 {
 }
 
@@ -35,14 +97,15 @@ AudioOutput::~AudioOutput()
 {
 	stop();
 
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(&m_fifosMutex);
+	AudioFifos *audioFifos = m_audioFifos.load();
 
-	for (AudioFifos::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it)
+	for (AudioFifos::iterator it = audioFifos->begin(); it != audioFifos->end(); ++it)
 	{
 		delete *it;
 	}
 
-	m_audioFifos.clear();
+	publishFifos(0);
 }
 
 bool AudioOutput::start(int device, int rate)
@@ -224,16 +287,69 @@ void AudioOutput::stopImmediate()
 
 void AudioOutput::addFifo(AudioFifo* audioFifo)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(&m_fifosMutex);
 
-	m_audioFifos.push_back(audioFifo);
+	AudioFifos *audioFifos = new AudioFifos(*m_audioFifos.load());
+	audioFifos->push_back(audioFifo);
+	publishFifos(audioFifos);
 }
 
 void AudioOutput::removeFifo(AudioFifo* audioFifo)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(&m_fifosMutex);
+
+	AudioFifos *audioFifos = new AudioFifos(*m_audioFifos.load());
+	AudioFifos::iterator it = std::find(audioFifos->begin(), audioFifos->end(), audioFifo);
+
+	if (it == audioFifos->end())
+	{
+		delete audioFifos;
+		return;
+	}
+
+	audioFifos->erase(it);
+	publishFifos(audioFifos);
+
+	m_removedCounters.m_overrunCount += audioFifo->getOverrunCount();
+	m_removedCounters.m_droppedSamples += audioFifo->getDroppedSamples();
+	m_removedCounters.m_underrunCount += audioFifo->getUnderrunCount();
+}
+
+void AudioOutput::getCounters(Counters& counters)
+{
+	QMutexLocker mutexLocker(&m_fifosMutex);
+	AudioFifos *audioFifos = m_audioFifos.load();
+	counters = m_removedCounters;
+	counters.m_nbFifos = audioFifos->size();
 
-	m_audioFifos.remove(audioFifo);
+	for (AudioFifos::const_iterator it = audioFifos->begin(); it != audioFifos->end(); ++it)
+	{
+		counters.m_overrunCount += (*it)->getOverrunCount();
+		counters.m_droppedSamples += (*it)->getDroppedSamples();
+		counters.m_underrunCount += (*it)->getUnderrunCount();
+	}
+}
+
+void AudioOutput::publishFifos(AudioFifos *audioFifos)
+{
+	AudioFifos *previous = m_audioFifos.fetchAndStoreOrdered(audioFifos);
+
+	// the callback has either taken the new list or marked the previous one in use before reading it again
+	while (m_audioFifosInUse.fetchAndAddOrdered(0) == previous) {
+		QThread::usleep(100);
+	}
+
+	delete previous;
+}
+
+void AudioOutput::flushFifos()
+{
+	QMutexLocker mutexLocker(&m_fifosMutex);
+	AudioFifos *audioFifos = m_audioFifos.load();
+
+	for (AudioFifos::iterator it = audioFifos->begin(); it != audioFifos->end(); ++it) {
+		(*it)->flush();
+	}
 }
 
 /*
@@ -262,7 +378,7 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 
 	if (m_mixBuffer.size() < framesPerBuffer * 2)
 	{
-		m_mixBuffer.resize(framesPerBuffer * 2); // allocate 2 qint32 per frame (stereo)
+		m_mixBuffer.resize(framesPerBuffer * 2); // allocate 2 floats per frame (stereo)
 
 		if (m_mixBuffer.size() != framesPerBuffer * 2)
 		{
@@ -270,72 +386,33 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 		}
 	}
 
-	memset(&m_mixBuffer[0], 0x00, 2 * framesPerBuffer * sizeof(m_mixBuffer[0])); // start with silence
-
-	// sum up a block from all fifos
+	std::fill(m_mixBuffer.begin(), m_mixBuffer.begin() + 2 * framesPerBuffer, 0.0f); // start with silence
 
-	for (AudioFifos::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it)
-	{
-		// use outputBuffer as temp - yes, one memcpy could be saved
-		uint samples = (*it)->read((quint8*) data, framesPerBuffer, 1);
-		const qint16* src = (const qint16*) data;
-		std::vector<qint32>::iterator dst = m_mixBuffer.begin();
+	// sum up a block from all fifos. Reads do not wait: a late channel is an underrun of its FIFO.
+	// The list in use is marked then checked to be still the current one so that it is not deleted meanwhile.
 
-//		if (samples != framesPerBuffer)
-//		{
-//            qDebug("AudioOutput::readData: read %d samples vs %d requested", samples, framesPerBuffer);
-//		}
+	AudioFifos *audioFifos;
 
-		for (uint i = 0; i < samples; i++)
-		{
-			*dst += *src;
-			++src;
-			++dst;
-			*dst += *src;
-			++src;
-			++dst;
-		}
-    }
-	// convert to int16
-
-	//std::vector<qint32>::const_iterator src = m_mixBuffer.begin(); // Valgrind optim
-	qint16* dst = (qint16*) data;
-	qint32 s;
-
-	for (uint i = 0; i < framesPerBuffer; i++)
+	do
 	{
-		// left channel
+		audioFifos = m_audioFifos.loadAcquire();
+		m_audioFifosInUse.fetchAndStoreOrdered(audioFifos);
+	} while (m_audioFifos.fetchAndAddOrdered(0) != audioFifos);
 
-		//s = *src++; // Valgrind optim
-		s = m_mixBuffer[2*i];
-
-		if(s < -32768)
-		{
-			s = -32768;
-		}
-		else if (s > 32767)
+	if (audioFifos)
+	{
+		for (AudioFifos::iterator it = audioFifos->begin(); it != audioFifos->end(); ++it)
 		{
-			s = 32767;
+			// use outputBuffer as temp - yes, one memcpy could be saved
+			uint samples = (*it)->read((quint8*) data, framesPerBuffer, 0);
+			mixSamples(&m_mixBuffer[0], (const qint16*) data, 2 * samples, (*it)->getMixerGain());
 		}
+	}
 
-		*dst++ = s;
-
-		// right channel
-
-		//s = *src++; // Valgrind optim
-		s = m_mixBuffer[2*i + 1];
+	m_audioFifosInUse.storeRelease(0);
 
-		if(s < -32768)
-		{
-			s = -32768;
-		}
-		else if (s > 32767)
-		{
-			s = 32767;
-		}
-
-		*dst++ = s;
-	}
+	// convert to int16 with saturation
+	saturateSamples((qint16*) data, &m_mixBuffer[0], 2 * framesPerBuffer);
 
 	return framesPerBuffer * 4;
 }
@@ -19,6 +19,7 @@
 #define INCLUDE_AUDIOOUTPUT_H
 
 #include <QMutex>
+#include <QAtomicPointer>
 #include <QIODevice>
 #include <QAudioFormat>
 #include <list>
@@ -31,6 +32,17 @@ class AudioOutputPipe;
 
 class SDRANGEL_API AudioOutput : QIODevice {
 public:
+	/** Counters of the FIFOs mixed since the creation including the ones removed since */
+	struct Counters
+	{
+		uint m_nbFifos;           //!< FIFOs currently mixed
+		quint64 m_overrunCount;   //!< channel writes that could not store all samples
+		quint64 m_droppedSamples; //!< samples lost by these writes
+		quint64 m_underrunCount;  //!< audio callback reads that could not be completed
+
+		Counters() : m_nbFifos(0), m_overrunCount(0), m_droppedSamples(0), m_underrunCount(0) {}
+	};
+
 	AudioOutput();
 	virtual ~AudioOutput();
 
@@ -42,19 +54,30 @@ public:
 
 	void addFifo(AudioFifo* audioFifo);
 	void removeFifo(AudioFifo* audioFifo);
+	void flushFifos(); //!< discard what the FIFOs hold in place of the audio device when it is not started (offline processing)
+	void getCounters(Counters& counters);
 
 	uint getRate() const { return m_audioFormat.sampleRate(); }
 	void setOnExit(bool onExit) { m_onExit = onExit; }
 
 private:
 	QMutex m_mutex;
+	QMutex m_fifosMutex; //!< serializes the changes of the FIFOs list. Never taken by the audio callback.
 	QAudioOutput* m_audioOutput;
 	uint m_audioUsageCount;
 	bool m_onExit;
 
+	/**
+	 * The FIFOs list is copied on write: a change publishes a new list and the previous one is
+	 * deleted once the audio callback does not use it anymore so that the callback takes no lock.
+	 */
 	typedef std::list<AudioFifo*> AudioFifos;
-	AudioFifos m_audioFifos;
-	std::vector<qint32> m_mixBuffer;
+	QAtomicPointer<AudioFifos> m_audioFifos;      //!< current list
+	QAtomicPointer<AudioFifos> m_audioFifosInUse; //!< list being mixed by the audio callback or null
+	std::vector<float> m_mixBuffer;
+	Counters m_removedCounters; //!< of the FIFOs removed. Protected by m_fifosMutex.
+
+	void publishFifos(AudioFifos *audioFifos); //!< with m_fifosMutex held
 
 	QAudioFormat m_audioFormat;
 
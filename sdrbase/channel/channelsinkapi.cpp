@@ -22,6 +22,7 @@
 ChannelSinkAPI::ChannelSinkAPI(const QString& name) :
         m_name(name),
         m_indexInDeviceSet(-1),
-        m_uid(UidCalculator::getNewObjectId())
+        m_uid(UidCalculator::getNewObjectId()),
+        m_channelRecord(0)
 {
 }
@@ -25,9 +25,12 @@
 
 #include "util/export.h"
 
+class ChannelRecord;
+
 namespace SWGSDRangel
 {
     class SWGChannelSettings;
+    class SWGChannelReport;
 }
 
 class SDRANGEL_API ChannelSinkAPI {
@@ -57,9 +60,18 @@ public:
             QString& errorMessage)
     { errorMessage = "Not implemented"; return 501; }
 
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response __attribute__((unused)),
+            QString& errorMessage)
+    { errorMessage = "Not implemented"; return 501; }
+
     int getIndexInDeviceSet() const { return m_indexInDeviceSet; }
     void setIndexInDeviceSet(int indexInDeviceSet) { m_indexInDeviceSet = indexInDeviceSet; }
     uint64_t getUID() const { return m_uid; }
+    ChannelRecord *getChannelRecord() { return m_channelRecord; } //!< I/Q recording of the channel input or 0 if not supported
+
+protected:
+    void setChannelRecord(ChannelRecord *channelRecord) { m_channelRecord = channelRecord; }
 
 private:
     /** Unique identifier in a device set used for sorting. Used when there is no GUI.
@@ -69,6 +81,7 @@ private:
 
     int m_indexInDeviceSet;
     uint64_t m_uid;
+    ChannelRecord *m_channelRecord;
 };
 
 
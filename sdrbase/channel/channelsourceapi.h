@@ -27,6 +27,7 @@
 namespace SWGSDRangel
 {
     class SWGChannelSettings;
+    class SWGChannelReport;
 }
 
 class SDRANGEL_API ChannelSourceAPI {
@@ -56,6 +57,11 @@ public:
             QString& errorMessage)
     { errorMessage = "Not implemented"; return 501; }
 
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response __attribute__((unused)),
+            QString& errorMessage)
+    { errorMessage = "Not implemented"; return 501; }
+
     int getIndexInDeviceSet() const { return m_indexInDeviceSet; }
     void setIndexInDeviceSet(int indexInDeviceSet) { m_indexInDeviceSet = indexInDeviceSet; }
     uint64_t getUID() const { return m_uid; }
@@ -15,67 +15,518 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QGlobalStatic>
+#include <QCoreApplication>
+#include <QSettings>
+#include <QSemaphore>
+#include <QSharedPointer>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QSet>
+#include <QAtomicInt>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QStringList>
+#include <QFile>
+#include <QDebug>
 
 #include "plugin/pluginmanager.h"
 #include "deviceenumerator.h"
 
+namespace {
+
+struct EnumerationResult
+{
+    PluginInterface::SamplingDevices m_devices;
+    QAtomicInt m_finished;
+
+    EnumerationResult() : m_finished(0) {}
+};
+
+QString readFirstLine(const QString& fileName)
+{
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+
+    return QString(file.readLine()).trimmed();
+}
+
+QSettings *createCacheSettings()
+{
+    return new QSettings(QSettings::IniFormat, QSettings::UserScope,
+            QCoreApplication::organizationName(),
+            QCoreApplication::applicationName() + "-devices");
+}
+
+} // namespace
+
+/** Plugins with an enumeration running. A plugin is not entered again until its enumeration returns. */
+struct DeviceEnumerator::BusyPlugins
+{
+    QMutex m_mutex;
+    QSet<PluginInterface*> m_plugins;
+
+    bool acquire(PluginInterface *plugin) //!< false if the plugin is busy
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if (m_plugins.contains(plugin)) {
+            return false;
+        }
+
+        m_plugins.insert(plugin);
+        return true;
+    }
+
+    void release(PluginInterface *plugin)
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_plugins.remove(plugin);
+    }
+
+    bool isBusy(PluginInterface *plugin)
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        return m_plugins.contains(plugin);
+    }
+};
+
+/**
+ * Runs the enumeration of one plugin. Result, semaphore and busy plugins are shared as the task
+ * may outlive the wait and even the enumerator if the plugin hangs.
+ */
+class DeviceEnumerator::EnumerationTask : public QRunnable
+{
+public:
+    EnumerationTask(PluginInterface *plugin, bool rxElseTx, QSharedPointer<EnumerationResult> result,
+            QSharedPointer<QSemaphore> done, QSharedPointer<BusyPlugins> busyPlugins) :
+        m_plugin(plugin),
+        m_rxElseTx(rxElseTx),
+        m_result(result),
+        m_done(done),
+        m_busyPlugins(busyPlugins)
+    {}
+
+    virtual void run()
+    {
+        m_result->m_devices = m_rxElseTx ? m_plugin->enumSampleSources() : m_plugin->enumSampleSinks();
+        m_result->m_finished.storeRelease(1);
+        m_busyPlugins->release(m_plugin);
+        m_done->release();
+    }
+
+private:
+    PluginInterface *m_plugin;
+    bool m_rxElseTx;
+    QSharedPointer<EnumerationResult> m_result;
+    QSharedPointer<QSemaphore> m_done;
+    QSharedPointer<BusyPlugins> m_busyPlugins;
+};
+
 Q_GLOBAL_STATIC(DeviceEnumerator, deviceEnumerator)
 DeviceEnumerator *DeviceEnumerator::instance()
 {
     return deviceEnumerator;
 }
 
-DeviceEnumerator::DeviceEnumerator()
-{}
+DeviceEnumerator::DeviceEnumerator() :
+    m_pluginManager(0),
+    m_enumerationTimeout(10000),
+    m_threadPool(new QThreadPool()),
+    m_busyPlugins(new BusyPlugins()),
+    m_refreshing(false),
+    m_refreshComplete(false)
+{
+    m_threadPool->setMaxThreadCount(16); // enumerations mostly wait for the hardware
+}
 
 DeviceEnumerator::~DeviceEnumerator()
-{}
+{
+    if (m_threadPool->waitForDone(0))
+    {
+        delete m_threadPool;
+    }
+    else // deleting the pool would wait for the hung plugin and the exit would never complete
+    {
+        qWarning("DeviceEnumerator::~DeviceEnumerator: a plugin enumeration is still running: abandoned");
+    }
+}
+
+void DeviceEnumerator::enumerateDevices(PluginManager *pluginManager)
+{
+    m_pluginManager = pluginManager;
+    QString hardwareSignature = getHardwareSignature();
+    CachedDevices rxCache, txCache;
+    bool cacheValid = loadCache(hardwareSignature, rxCache, txCache);
+    const PluginAPI::SamplingDeviceRegistrations& rxRegistrations = pluginManager->getSourceDeviceRegistrations();
+    const PluginAPI::SamplingDeviceRegistrations& txRegistrations = pluginManager->getSinkDeviceRegistrations();
+
+    bool complete = enumerate(m_rxEnumeration, rxRegistrations, true, cacheValid ? getCacheKeptDevices(rxCache, rxRegistrations) : CachedDevices());
+    complete = enumerate(m_txEnumeration, txRegistrations, false, cacheValid ? getCacheKeptDevices(txCache, txRegistrations) : CachedDevices()) && complete;
+
+    qDebug("DeviceEnumerator::enumerateDevices: %s: %d Rx and %d Tx devices",
+            cacheValid ? "from cache" : "enumerated",
+            (int) m_rxEnumeration.size(), (int) m_txEnumeration.size());
+
+    if (!cacheValid && complete) {
+        saveCache(hardwareSignature);
+    }
+}
 
 void DeviceEnumerator::enumerateRxDevices(PluginManager *pluginManager)
 {
-    m_rxEnumeration.clear();
-    PluginAPI::SamplingDeviceRegistrations& rxDeviceRegistrations = pluginManager->getSourceDeviceRegistrations();
+    m_pluginManager = pluginManager;
+    enumerate(m_rxEnumeration, pluginManager->getSourceDeviceRegistrations(), true, CachedDevices());
+}
+
+void DeviceEnumerator::enumerateTxDevices(PluginManager *pluginManager)
+{
+    m_pluginManager = pluginManager;
+    enumerate(m_txEnumeration, pluginManager->getSinkDeviceRegistrations(), false, CachedDevices());
+}
+
+/** Runs a complete enumeration in the background then hands it over to the enumerator thread */
+class DeviceEnumerator::RefreshTask : public QRunnable
+{
+public:
+    RefreshTask(DeviceEnumerator *enumerator, const CachedDevices& rxKeptDevices, const CachedDevices& txKeptDevices) :
+        m_enumerator(enumerator),
+        m_rxKeptDevices(rxKeptDevices),
+        m_txKeptDevices(txKeptDevices)
+    {}
+
+    virtual void run()
+    {
+        PluginManager *pluginManager = m_enumerator->m_pluginManager;
+        DevicesEnumeration rxEnumeration, txEnumeration;
+        bool complete = m_enumerator->enumerate(rxEnumeration, pluginManager->getSourceDeviceRegistrations(), true, m_rxKeptDevices);
+        complete = m_enumerator->enumerate(txEnumeration, pluginManager->getSinkDeviceRegistrations(), false, m_txKeptDevices) && complete;
+
+        QMutexLocker mutexLocker(&m_enumerator->m_refreshMutex);
+        m_enumerator->m_refreshRxEnumeration.swap(rxEnumeration);
+        m_enumerator->m_refreshTxEnumeration.swap(txEnumeration);
+        m_enumerator->m_refreshComplete = complete;
+        QMetaObject::invokeMethod(m_enumerator, "applyRefresh", Qt::QueuedConnection);
+    }
+
+private:
+    DeviceEnumerator *m_enumerator;
+    CachedDevices m_rxKeptDevices; //!< devices of the plugins not enumerated again
+    CachedDevices m_txKeptDevices;
+};
+
+void DeviceEnumerator::refreshDevices()
+{
+    if (!m_pluginManager || m_refreshing) {
+        return;
+    }
+
+    m_refreshing = true;
+    QThreadPool::globalInstance()->start(new RefreshTask(this,
+            getRefreshKeptDevices(m_rxEnumeration, m_pluginManager->getSourceDeviceRegistrations()),
+            getRefreshKeptDevices(m_txEnumeration, m_pluginManager->getSinkDeviceRegistrations())));
+}
+
+void DeviceEnumerator::applyRefresh()
+{
+    QMutexLocker mutexLocker(&m_refreshMutex);
+
+    keepClaims(m_refreshRxEnumeration, m_rxEnumeration);
+    keepClaims(m_refreshTxEnumeration, m_txEnumeration);
+    m_rxEnumeration.swap(m_refreshRxEnumeration);
+    m_txEnumeration.swap(m_refreshTxEnumeration);
+    m_refreshRxEnumeration.clear();
+    m_refreshTxEnumeration.clear();
+
+    if (m_refreshComplete) {
+        saveCache(getHardwareSignature());
+    }
+
+    m_refreshing = false;
+    qDebug("DeviceEnumerator::applyRefresh: %d Rx and %d Tx devices", (int) m_rxEnumeration.size(), (int) m_txEnumeration.size());
+    emit devicesChanged();
+}
+
+bool DeviceEnumerator::enumerate(
+        DevicesEnumeration& enumeration,
+        const PluginAPI::SamplingDeviceRegistrations& registrations,
+        bool rxElseTx,
+        const CachedDevices& keptDevices)
+{
+    QSharedPointer<QSemaphore> done(new QSemaphore());
+    std::vector<QSharedPointer<EnumerationResult> > results(registrations.count());
+    int nbTasks = 0;
+    bool complete = true;
+
+    for (int i = 0; i < registrations.count(); i++)
+    {
+        PluginInterface *plugin = registrations[i].m_plugin;
+
+        if (keptDevices.contains(registrations[i].m_deviceId)) {
+            continue; // taken from the kept devices below
+        }
+
+        if (!m_busyPlugins->acquire(plugin))
+        {
+            qWarning("DeviceEnumerator::enumerate: %s is still busy with a previous enumeration: skipped",
+                    qPrintable(registrations[i].m_deviceId));
+            complete = false;
+            continue;
+        }
+
+        results[i] = QSharedPointer<EnumerationResult>(new EnumerationResult());
+        m_threadPool->start(new EnumerationTask(plugin, rxElseTx, results[i], done, m_busyPlugins));
+        nbTasks++;
+    }
+
+    complete = done->tryAcquire(nbTasks, m_enumerationTimeout) && complete;
+    enumeration.clear();
     int index = 0;
 
-    for (int i = 0; i < rxDeviceRegistrations.count(); i++)
+    for (int i = 0; i < registrations.count(); i++)
     {
-        PluginInterface::SamplingDevices samplingDevices = rxDeviceRegistrations[i].m_plugin->enumSampleSources();
+        PluginInterface::SamplingDevices samplingDevices;
+
+        if (results[i].isNull())
+        {
+            samplingDevices = keptDevices.value(registrations[i].m_deviceId); // none if the plugin was busy
+        }
+        else if (results[i]->m_finished.loadAcquire())
+        {
+            samplingDevices = results[i]->m_devices;
+        }
+        else
+        {
+            qWarning("DeviceEnumerator::enumerate: %s did not answer within %d ms: skipped",
+                    qPrintable(registrations[i].m_deviceId), m_enumerationTimeout);
+            continue;
+        }
 
         for (int j = 0; j < samplingDevices.count(); j++)
         {
-            m_rxEnumeration.push_back(
+            enumeration.push_back(
                 DeviceEnumeration(
                     samplingDevices[j],
-                    rxDeviceRegistrations[i].m_plugin,
+                    registrations[i].m_plugin,
                     index
                 )
             );
             index++;
         }
     }
+
+    return complete;
 }
 
-void DeviceEnumerator::enumerateTxDevices(PluginManager *pluginManager)
+DeviceEnumerator::CachedDevices DeviceEnumerator::getCacheKeptDevices(
+        const CachedDevices& cache,
+        const PluginAPI::SamplingDeviceRegistrations& registrations)
 {
-    m_txEnumeration.clear();
-    PluginAPI::SamplingDeviceRegistrations& txDeviceRegistrations = pluginManager->getSinkDeviceRegistrations();
-    int index = 0;
+    CachedDevices keptDevices;
 
-    for (int i = 0; i < txDeviceRegistrations.count(); i++)
+    for (int i = 0; i < registrations.count(); i++)
     {
-        PluginInterface::SamplingDevices samplingDevices = txDeviceRegistrations[i].m_plugin->enumSampleSinks();
+        if (registrations[i].m_plugin->isDeviceEnumerationCacheable()) { // a plugin with no devices is not in the cache
+            keptDevices.insert(registrations[i].m_deviceId, cache.value(registrations[i].m_deviceId));
+        }
+    }
 
-        for (int j = 0; j < samplingDevices.count(); j++)
+    return keptDevices;
+}
+
+DeviceEnumerator::CachedDevices DeviceEnumerator::getRefreshKeptDevices(
+        const DevicesEnumeration& enumeration,
+        const PluginAPI::SamplingDeviceRegistrations& registrations) const
+{
+    CachedDevices keptDevices;
+
+    for (int i = 0; i < registrations.count(); i++)
+    {
+        PluginInterface *plugin = registrations[i].m_plugin;
+        PluginInterface::SamplingDevices samplingDevices;
+        bool claimed = false;
+
+        for (DevicesEnumeration::const_iterator it = enumeration.begin(); it != enumeration.end(); ++it)
         {
-            m_txEnumeration.push_back(
-                DeviceEnumeration(
-                    samplingDevices[j],
-                    txDeviceRegistrations[i].m_plugin,
-                    index
+            if (it->m_pluginInterface == plugin)
+            {
+                samplingDevices.append(it->m_samplingDevice);
+                samplingDevices.back().claimed = -1; // claims are carried over by keepClaims when the refresh is applied
+                claimed = claimed || (it->m_samplingDevice.claimed >= 0);
+            }
+        }
+
+        // scanning again may reset the state of a plugin with open devices or built by the previous scan
+        if (claimed || !plugin->isDeviceEnumerationCacheable() || m_busyPlugins->isBusy(plugin)) {
+            keptDevices.insert(registrations[i].m_deviceId, samplingDevices);
+        }
+    }
+
+    return keptDevices;
+}
+
+void DeviceEnumerator::keepClaims(DevicesEnumeration& enumeration, const DevicesEnumeration& previous)
+{
+    for (DevicesEnumeration::const_iterator prev = previous.begin(); prev != previous.end(); ++prev)
+    {
+        if (prev->m_samplingDevice.claimed < 0) {
+            continue;
+        }
+
+        DevicesEnumeration::iterator it = enumeration.begin();
+
+        for (; it != enumeration.end(); ++it)
+        {
+            if ((it->m_samplingDevice.id == prev->m_samplingDevice.id)
+             && (it->m_samplingDevice.serial == prev->m_samplingDevice.serial)
+             && (it->m_samplingDevice.sequence == prev->m_samplingDevice.sequence)
+             && (it->m_samplingDevice.deviceItemIndex == prev->m_samplingDevice.deviceItemIndex)) {
+                break;
+            }
+        }
+
+        if (it != enumeration.end())
+        {
+            it->m_samplingDevice.claimed = prev->m_samplingDevice.claimed;
+        }
+        else // a device in use may not show up while it is open: keep it
+        {
+            enumeration.push_back(DeviceEnumeration(prev->m_samplingDevice, prev->m_pluginInterface, enumeration.size()));
+        }
+    }
+}
+
+QString DeviceEnumerator::getPluginsSignature() const
+{
+    QStringList plugins;
+    const PluginAPI::SamplingDeviceRegistrations& rxRegistrations = m_pluginManager->getSourceDeviceRegistrations();
+    const PluginAPI::SamplingDeviceRegistrations& txRegistrations = m_pluginManager->getSinkDeviceRegistrations();
+
+    for (int i = 0; i < rxRegistrations.count(); i++) {
+        plugins.append("Rx:" + rxRegistrations[i].m_deviceId + ":" + rxRegistrations[i].m_plugin->getPluginDescriptor().version);
+    }
+
+    for (int i = 0; i < txRegistrations.count(); i++) {
+        plugins.append("Tx:" + txRegistrations[i].m_deviceId + ":" + txRegistrations[i].m_plugin->getPluginDescriptor().version);
+    }
+
+    return plugins.join(",");
+}
+
+/** USB devices attached (location, vendor, product, serial). Empty if this cannot be known on this system. */
+QString DeviceEnumerator::getHardwareSignature()
+{
+#ifdef __linux__
+    QDir usbDir("/sys/bus/usb/devices");
+    QStringList devices;
+
+    foreach (const QString& name, usbDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot))
+    {
+        QString path = usbDir.filePath(name);
+        QString vendor = readFirstLine(path + "/idVendor");
+
+        if (vendor.isEmpty()) { // interface entry
+            continue;
+        }
+
+        devices.append(QString("%1 %2:%3 %4").arg(name).arg(vendor).arg(readFirstLine(path + "/idProduct")).arg(readFirstLine(path + "/serial")));
+    }
+
+    devices.sort();
+    return QString(QCryptographicHash::hash(devices.join("\n").toUtf8(), QCryptographicHash::Md5).toHex());
+#else
+    return QString();
+#endif
+}
+
+bool DeviceEnumerator::loadCache(const QString& hardwareSignature, CachedDevices& rxCache, CachedDevices& txCache) const
+{
+    if (hardwareSignature.isEmpty()) {
+        return false;
+    }
+
+    QSharedPointer<QSettings> settings(createCacheSettings());
+
+    if ((settings->value("hardwareSignature").toString() != hardwareSignature)
+     || (settings->value("pluginsSignature").toString() != getPluginsSignature())) {
+        return false;
+    }
+
+    for (int direction = 0; direction < 2; direction++)
+    {
+        CachedDevices& cache = direction == 0 ? rxCache : txCache;
+        int size = settings->beginReadArray(direction == 0 ? "rx" : "tx");
+
+        for (int i = 0; i < size; i++)
+        {
+            settings->setArrayIndex(i);
+            cache[settings->value("registration").toString()].append(
+                PluginInterface::SamplingDevice(
+                    settings->value("displayedName").toString(),
+                    settings->value("hardwareId").toString(),
+                    settings->value("id").toString(),
+                    settings->value("serial").toString(),
+                    settings->value("sequence").toInt(),
+                    (PluginInterface::SamplingDevice::SamplingDeviceType) settings->value("type").toInt(),
+                    direction == 0,
+                    settings->value("deviceNbItems").toInt(),
+                    settings->value("deviceItemIndex").toInt()
                 )
             );
-            index++;
         }
+
+        settings->endArray();
+    }
+
+    return true;
+}
+
+void DeviceEnumerator::saveCache(const QString& hardwareSignature) const
+{
+    if (hardwareSignature.isEmpty()) {
+        return;
+    }
+
+    QSharedPointer<QSettings> settings(createCacheSettings());
+    settings->clear();
+    settings->setValue("hardwareSignature", hardwareSignature);
+    settings->setValue("pluginsSignature", getPluginsSignature());
+
+    for (int direction = 0; direction < 2; direction++)
+    {
+        const DevicesEnumeration& enumeration = direction == 0 ? m_rxEnumeration : m_txEnumeration;
+        const PluginAPI::SamplingDeviceRegistrations& registrations = direction == 0 ?
+                m_pluginManager->getSourceDeviceRegistrations() : m_pluginManager->getSinkDeviceRegistrations();
+        settings->beginWriteArray(direction == 0 ? "rx" : "tx");
+        int arrayIndex = 0;
+
+        for (DevicesEnumeration::const_iterator it = enumeration.begin(); it != enumeration.end(); ++it)
+        {
+            QString registration;
+
+            for (int i = 0; i < registrations.count(); i++)
+            {
+                if (registrations[i].m_plugin == it->m_pluginInterface) {
+                    registration = registrations[i].m_deviceId;
+                    break;
+                }
+            }
+
+            settings->setArrayIndex(arrayIndex++);
+            settings->setValue("registration", registration);
+            settings->setValue("displayedName", it->m_samplingDevice.displayedName);
+            settings->setValue("hardwareId", it->m_samplingDevice.hardwareId);
+            settings->setValue("id", it->m_samplingDevice.id);
+            settings->setValue("serial", it->m_samplingDevice.serial);
+            settings->setValue("sequence", it->m_samplingDevice.sequence);
+            settings->setValue("type", (int) it->m_samplingDevice.type);
+            settings->setValue("deviceNbItems", it->m_samplingDevice.deviceNbItems);
+            settings->setValue("deviceItemIndex", it->m_samplingDevice.deviceItemIndex);
+        }
+
+        settings->endArray();
     }
 }
 
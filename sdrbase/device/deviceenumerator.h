@@ -18,21 +18,45 @@
 #define SDRBASE_DEVICE_DEVICEENUMERATOR_H_
 
 #include <vector>
+#include <QObject>
+#include <QMap>
+#include <QMutex>
+#include <QSharedPointer>
 
 #include "plugin/plugininterface.h"
+#include "plugin/pluginapi.h"
 
 class PluginManager;
+class QThreadPool;
 
-class DeviceEnumerator
+/**
+ * Sampling devices of all device plugins.
+ *
+ * - Plugins are enumerated concurrently, each one in a thread of a pool. A plugin that does not
+ *   return within the enumeration timeout is skipped. It is not enumerated again until its
+ *   enumeration returns and the pool is abandoned at exit if it never does.
+ * - The device list is cached on disk with a signature of the attached USB devices and of the
+ *   device plugins. When both are unchanged at next start the cached list is used except for
+ *   plugins that need a fresh enumeration (see PluginInterface::isDeviceEnumerationCacheable).
+ * - refreshDevices() enumerates again in the background. devicesChanged() is emitted in the
+ *   thread of the enumerator when the new list is in place. Plugins with a device in use and
+ *   plugins that cannot be cached keep their devices as the scan could disturb the open devices.
+ */
+class DeviceEnumerator : public QObject
 {
+    Q_OBJECT
 public:
     DeviceEnumerator();
     ~DeviceEnumerator();
 
     static DeviceEnumerator *instance();
 
+    void enumerateDevices(PluginManager *pluginManager); //!< Rx and Tx devices from the cache when it is valid
     void enumerateRxDevices(PluginManager *pluginManager);
     void enumerateTxDevices(PluginManager *pluginManager);
+    void refreshDevices();  //!< enumerate again in the background
+    bool isRefreshing() const { return m_refreshing; }
+    void setEnumerationTimeout(int timeoutMs) { m_enumerationTimeout = timeoutMs; }
     void listRxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void listTxDeviceNames(QList<QString>& list, std::vector<int>& indexes) const;
     void changeRxSelection(int tabIndex, int deviceIndex);
@@ -50,7 +74,17 @@ public:
     int getRxSamplingDeviceIndex(const QString& deviceId, int sequence);
     int getTxSamplingDeviceIndex(const QString& deviceId, int sequence);
 
+signals:
+    void devicesChanged();
+
+private slots:
+    void applyRefresh();
+
 private:
+    class RefreshTask;
+    class EnumerationTask;
+    struct BusyPlugins;
+
     struct DeviceEnumeration
     {
         PluginInterface::SamplingDevice m_samplingDevice;
@@ -65,9 +99,32 @@ private:
     };
 
     typedef std::vector<DeviceEnumeration> DevicesEnumeration;
+    typedef QMap<QString, PluginInterface::SamplingDevices> CachedDevices; //!< devices by plugin registration
 
     DevicesEnumeration m_rxEnumeration;
     DevicesEnumeration m_txEnumeration;
+    PluginManager *m_pluginManager;
+    int m_enumerationTimeout;  //!< per enumeration in ms
+    QThreadPool *m_threadPool; //!< runs the plugins enumerations. Not deleted if an enumeration hangs.
+    QSharedPointer<BusyPlugins> m_busyPlugins; //!< plugins being enumerated. Shared with the enumeration tasks.
+    bool m_refreshing;
+    QMutex m_refreshMutex;
+    DevicesEnumeration m_refreshRxEnumeration; //!< background enumeration results
+    DevicesEnumeration m_refreshTxEnumeration;
+    bool m_refreshComplete;
+
+    /**
+     * Enumerate the plugins concurrently except the ones in keptDevices that take their devices from it.
+     * Returns false if a plugin timed out or was still busy with a previous enumeration.
+     */
+    bool enumerate(DevicesEnumeration& enumeration, const PluginAPI::SamplingDeviceRegistrations& registrations, bool rxElseTx, const CachedDevices& keptDevices);
+    CachedDevices getRefreshKeptDevices(const DevicesEnumeration& enumeration, const PluginAPI::SamplingDeviceRegistrations& registrations) const;
+    bool loadCache(const QString& hardwareSignature, CachedDevices& rxCache, CachedDevices& txCache) const;
+    void saveCache(const QString& hardwareSignature) const;
+    QString getPluginsSignature() const;
+    static QString getHardwareSignature();
+    static CachedDevices getCacheKeptDevices(const CachedDevices& cache, const PluginAPI::SamplingDeviceRegistrations& registrations);
+    static void keepClaims(DevicesEnumeration& enumeration, const DevicesEnumeration& previous);
 };
 
 #endif /* SDRBASE_DEVICE_DEVICEENUMERATOR_H_ */
@@ -21,6 +21,7 @@
 #include "plugin/plugininterface.h"
 #include "settings/preset.h"
 #include "dsp/dspengine.h"
+#include "dsp/dspcommands.h"
 #include "channel/channelsinkapi.h"
 
 DeviceSourceAPI::DeviceSourceAPI(int deviceTabIndex,
@@ -34,12 +35,16 @@ DeviceSourceAPI::DeviceSourceAPI(int deviceTabIndex,
     m_sampleSourcePluginInstanceUI(0),
     m_buddySharedPtr(0),
     m_isBuddyLeader(false),
-    m_masterTimer(DSPEngine::instance()->getMasterTimer())
+    m_masterTimer(DSPEngine::instance()->getMasterTimer()),
+    m_preTriggerRecord(0),
+    m_spectrumArchive(0)
 {
 }
 
 DeviceSourceAPI::~DeviceSourceAPI()
 {
+    delete m_preTriggerRecord; // the device engine is gone already
+    delete m_spectrumArchive;
 }
 
 void DeviceSourceAPI::addSink(BasebandSampleSink *sink)
@@ -154,6 +159,184 @@ void DeviceSourceAPI::configureCorrections(bool dcOffsetCorrection, bool iqImbal
     m_deviceSourceEngine->configureCorrections(dcOffsetCorrection, iqImbalanceCorrection);
 }
 
+void DeviceSourceAPI::configureFloatBaseband(bool floatBaseband)
+{
+    m_deviceSourceEngine->configureFloatBaseband(floatBaseband);
+}
+
+bool DeviceSourceAPI::armPreTriggerRecord(const PreTriggerRecord::Settings& settings, QString& errorMessage)
+{
+    disarmPreTriggerRecord();
+
+    int sampleRate = m_deviceSourceEngine->getSampleRate();
+    quint64 centerFrequency = m_deviceSourceEngine->getCenterFrequency();
+
+    if ((sampleRate == 0) && getSampleSource()) // engine not started yet
+    {
+        sampleRate = getSampleSource()->getSampleRate();
+        centerFrequency = getSampleSource()->getCenterFrequency();
+    }
+
+    if (sampleRate <= 0)
+    {
+        errorMessage = "Unknown sample rate";
+        m_preTriggerRecordSettings = settings;
+        return false;
+    }
+
+    PreTriggerRecord *preTriggerRecord = new PreTriggerRecord(settings, sampleRate, centerFrequency);
+
+    if (!preTriggerRecord->isAllocated())
+    {
+        PreTriggerRecord::Report report;
+        preTriggerRecord->getReport(report);
+        errorMessage = report.m_errorMessage;
+        delete preTriggerRecord;
+        m_preTriggerRecordSettings = settings;
+        return false;
+    }
+
+    m_deviceSourceEngine->addSink(preTriggerRecord);
+
+    QMutexLocker mutexLocker(&m_preTriggerRecordMutex);
+    m_preTriggerRecord = preTriggerRecord;
+    m_preTriggerRecordSettings = settings;
+    return true;
+}
+
+void DeviceSourceAPI::disarmPreTriggerRecord()
+{
+    m_preTriggerRecordMutex.lock();
+    PreTriggerRecord *preTriggerRecord = m_preTriggerRecord;
+    m_preTriggerRecord = 0;
+    m_preTriggerRecordMutex.unlock();
+
+    if (preTriggerRecord)
+    {
+        m_deviceSourceEngine->removeSink(preTriggerRecord);
+        delete preTriggerRecord; // closes the current recording
+    }
+}
+
+bool DeviceSourceAPI::isPreTriggerRecordArmed()
+{
+    QMutexLocker mutexLocker(&m_preTriggerRecordMutex);
+    return m_preTriggerRecord != 0;
+}
+
+bool DeviceSourceAPI::triggerPreTriggerRecord()
+{
+    QMutexLocker mutexLocker(&m_preTriggerRecordMutex);
+
+    if (m_preTriggerRecord)
+    {
+        m_preTriggerRecord->trigger();
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void DeviceSourceAPI::stopPreTriggerRecord()
+{
+    QMutexLocker mutexLocker(&m_preTriggerRecordMutex);
+
+    if (m_preTriggerRecord) {
+        m_preTriggerRecord->stopRecording();
+    }
+}
+
+bool DeviceSourceAPI::getPreTriggerRecordReport(PreTriggerRecord::Report& report)
+{
+    QMutexLocker mutexLocker(&m_preTriggerRecordMutex);
+
+    if (m_preTriggerRecord)
+    {
+        m_preTriggerRecord->getReport(report);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+bool DeviceSourceAPI::startSpectrumArchive(const SpectrumArchive::Settings& settings, QString& errorMessage)
+{
+    stopSpectrumArchive();
+
+    SpectrumArchive *spectrumArchive = new SpectrumArchive(settings, m_deviceTabIndex, SDR_RX_SCALEF);
+
+    if (!spectrumArchive->isOpen())
+    {
+        SpectrumArchive::Report report;
+        spectrumArchive->getReport(report);
+        errorMessage = report.m_errorMessage;
+        delete spectrumArchive;
+        m_spectrumArchiveSettings = settings;
+        return false;
+    }
+
+    m_deviceSourceEngine->addSink(spectrumArchive);
+
+    QMutexLocker mutexLocker(&m_spectrumArchiveMutex);
+    m_spectrumArchive = spectrumArchive;
+    m_spectrumArchiveSettings = settings;
+    return true;
+}
+
+void DeviceSourceAPI::stopSpectrumArchive()
+{
+    m_spectrumArchiveMutex.lock();
+    SpectrumArchive *spectrumArchive = m_spectrumArchive;
+    m_spectrumArchive = 0;
+    m_spectrumArchiveMutex.unlock();
+
+    if (spectrumArchive)
+    {
+        m_deviceSourceEngine->removeSink(spectrumArchive);
+        delete spectrumArchive; // writes the last block
+    }
+}
+
+bool DeviceSourceAPI::isSpectrumArchiveRunning()
+{
+    QMutexLocker mutexLocker(&m_spectrumArchiveMutex);
+    return m_spectrumArchive != 0;
+}
+
+bool DeviceSourceAPI::getSpectrumArchiveReport(SpectrumArchive::Report& report)
+{
+    QMutexLocker mutexLocker(&m_spectrumArchiveMutex);
+
+    if (m_spectrumArchive)
+    {
+        m_spectrumArchive->getReport(report);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void DeviceSourceAPI::channelSquelchOpened(int channelIndex)
+{
+    // marked in the recordings of the device that support annotations
+    DSPRecordAnnotation *annotation = new DSPRecordAnnotation(QString("Channel %1 squelch open").arg(channelIndex), QString());
+    getDeviceEngineInputMessageQueue()->push(annotation);
+
+    QMutexLocker mutexLocker(&m_preTriggerRecordMutex);
+
+    if (m_preTriggerRecord && (channelIndex >= 0) && (channelIndex == m_preTriggerRecordSettings.m_squelchChannelIndex))
+    {
+        qDebug("DeviceSourceAPI::channelSquelchOpened: trigger on channel %d", channelIndex);
+        m_preTriggerRecord->trigger();
+    }
+}
+
 void DeviceSourceAPI::setHardwareId(const QString& id)
 {
     m_hardwareId = id;
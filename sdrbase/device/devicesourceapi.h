@@ -20,8 +20,11 @@
 #include <stdint.h>
 #include <QObject>
 #include <QString>
+#include <QMutex>
 
 #include "dsp/dspdevicesourceengine.h"
+#include "dsp/pretriggerrecord.h"
+#include "dsp/spectrumarchive.h"
 
 #include "util/export.h"
 
@@ -62,6 +65,26 @@ public:
     MessageQueue *getSampleSourceInputMessageQueue();
     MessageQueue *getSampleSourceGUIMessageQueue();
     void configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection); //!< Configure current device engine DSP corrections
+    void configureFloatBaseband(bool floatBaseband); //!< Configure current device engine baseband format
+
+    // Pre-trigger recorder
+    bool armPreTriggerRecord(const PreTriggerRecord::Settings& settings, QString& errorMessage); //!< (Re)create the recorder and its buffer at the current sample rate
+    void disarmPreTriggerRecord();                //!< Remove the recorder from the device engine and free its buffer
+    bool isPreTriggerRecordArmed();
+    bool triggerPreTriggerRecord();               //!< Start or extend a recording. Returns false if not armed.
+    void stopPreTriggerRecord();                  //!< End the current recording
+    bool getPreTriggerRecordReport(PreTriggerRecord::Report& report); //!< Returns false if not armed
+    const PreTriggerRecord::Settings& getPreTriggerRecordSettings() const { return m_preTriggerRecordSettings; }
+    void setPreTriggerRecordSettings(const PreTriggerRecord::Settings& settings) { m_preTriggerRecordSettings = settings; } //!< Applied at next arm
+    // Long term spectrum archive
+    bool startSpectrumArchive(const SpectrumArchive::Settings& settings, QString& errorMessage); //!< (Re)start archiving with these settings
+    void stopSpectrumArchive();                   //!< Remove the archive sink from the device engine and close the files
+    bool isSpectrumArchiveRunning();
+    bool getSpectrumArchiveReport(SpectrumArchive::Report& report); //!< Returns false if not archiving
+    const SpectrumArchive::Settings& getSpectrumArchiveSettings() const { return m_spectrumArchiveSettings; }
+    void setSpectrumArchiveSettings(const SpectrumArchive::Settings& settings) { m_spectrumArchiveSettings = settings; } //!< Applied at next start
+
+    void channelSquelchOpened(int channelIndex);  //!< Called by channels from their thread when their squelch opens. Annotates recordings and may trigger the pre-trigger recorder.
 
     void setHardwareId(const QString& id);
     void setSampleSourceId(const QString& id);
@@ -128,6 +151,14 @@ protected:
 
     QList<ChannelSinkAPI*> m_channelAPIs;
 
+    PreTriggerRecord *m_preTriggerRecord;
+    PreTriggerRecord::Settings m_preTriggerRecordSettings;
+    QMutex m_preTriggerRecordMutex; //!< channels trigger from their own thread
+
+    SpectrumArchive *m_spectrumArchive;
+    SpectrumArchive::Settings m_spectrumArchiveSettings;
+    QMutex m_spectrumArchiveMutex;  //!< web API requests come from its worker threads
+
     friend class DeviceSinkAPI;
 
 private:
@@ -11,6 +11,18 @@ BasebandSampleSink::~BasebandSampleSink()
 {
 }
 
+void BasebandSampleSink::feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	m_floatConvertBuffer.resize(end - begin);
+	SampleVector::iterator out = m_floatConvertBuffer.begin();
+
+	for (FSampleVector::const_iterator it = begin; it != end; ++it, ++out) {
+		*out = it->toSample();
+	}
+
+	feed(m_floatConvertBuffer.begin(), m_floatConvertBuffer.end(), positiveOnly);
+}
+
 void BasebandSampleSink::handleInputMessages()
 {
 	Message* message;
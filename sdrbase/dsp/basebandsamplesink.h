@@ -34,6 +34,8 @@ public:
 	virtual void start() = 0;
 	virtual void stop() = 0;
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly) = 0;
+	/** Floating point baseband (full scale 1.0). Sinks that process floats natively override it. By default samples are converted to fixed point and passed to feed(). */
+	virtual void feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
 	virtual bool handleMessage(const Message& cmd) = 0; //!< Processing of a message. Returns true if message has actually been processed
 
 	MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
@@ -43,6 +45,7 @@ public:
 protected:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     MessageQueue *m_guiMessageQueue;  //!< Input message queue to the GUI
+	SampleVector m_floatConvertBuffer; //!< default feedFloat() conversion
 
 protected slots:
 	void handleInputMessages();
@@ -0,0 +1,374 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <ctime>
+
+#include <QGlobalStatic>
+#include <QDateTime>
+#include <QDebug>
+
+#include "dsp/channelrecord.h"
+#include "dsp/filerecord.h"
+
+Q_GLOBAL_STATIC(ChannelRecordWriter, channelRecordWriter)
+
+ChannelRecord::ChannelRecord() :
+    m_recording(false),
+    m_writeCount(0),
+    m_readCount(0),
+    m_droppedSamples(0),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_registered(false),
+    m_fileSampleRate(0),
+    m_fileCenterFrequency(0),
+    m_nbFiles(0),
+    m_writtenBytes(0),
+    m_writerRecording(false),
+    m_writerSampleRate(0),
+    m_writerCenterFrequency(0)
+{
+}
+
+ChannelRecord::~ChannelRecord()
+{
+    ChannelRecordWriter *writer = ChannelRecordWriter::instance();
+
+    if (m_registered && writer)
+    {
+        writer->unregisterRecord(this);
+        drain(); // what is left in the ring buffer
+    }
+
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+}
+
+void ChannelRecord::startRecording(const QString& fileBase)
+{
+    bool registerRecord;
+
+    {
+        QMutexLocker mutexLocker(&m_stateMutex);
+
+        if (m_ring.size() == 0) {
+            m_ring.resize(m_ringSize);
+        }
+
+        Event event;
+        event.m_type = Event::EventStart;
+        event.m_fileBase = fileBase;
+        pushEvent(event);
+        m_fileBase = fileBase;
+        m_errorMessage.clear();
+        m_recording.store(true, std::memory_order_release);
+        registerRecord = !m_registered;
+        m_registered = true;
+    }
+
+    ChannelRecordWriter *writer = ChannelRecordWriter::instance();
+
+    if (writer)
+    {
+        if (registerRecord) {
+            writer->registerRecord(this);
+        }
+
+        writer->wakeUp();
+    }
+}
+
+void ChannelRecord::stopRecording()
+{
+    QMutexLocker mutexLocker(&m_stateMutex);
+
+    if (m_recording.load(std::memory_order_relaxed))
+    {
+        m_recording.store(false, std::memory_order_release);
+        Event event;
+        event.m_type = Event::EventStop;
+        pushEvent(event);
+    }
+}
+
+void ChannelRecord::getReport(Report& report)
+{
+    QMutexLocker mutexLocker(&m_stateMutex);
+
+    report.m_recording = m_recording.load(std::memory_order_relaxed);
+    report.m_fileBase = m_fileBase;
+    report.m_fileName = m_fileName;
+    report.m_sampleRate = m_fileSampleRate;
+    report.m_centerFrequency = m_fileCenterFrequency;
+    report.m_nbFiles = m_nbFiles;
+    report.m_writtenBytes = m_writtenBytes;
+    report.m_droppedSamples = m_droppedSamples.load(std::memory_order_relaxed);
+    report.m_errorMessage = m_errorMessage;
+}
+
+void ChannelRecord::setStreamFormat(int sampleRate, quint64 centerFrequency)
+{
+    if ((sampleRate == m_sampleRate) && (centerFrequency == m_centerFrequency)) {
+        return;
+    }
+
+    m_sampleRate = sampleRate;
+    m_centerFrequency = centerFrequency;
+
+    QMutexLocker mutexLocker(&m_stateMutex);
+    Event event;
+    event.m_type = Event::EventFormat;
+    event.m_sampleRate = sampleRate;
+    event.m_centerFrequency = centerFrequency;
+    pushEvent(event);
+}
+
+void ChannelRecord::write(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (!m_recording.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    quint64 writeCount = m_writeCount.load(std::memory_order_relaxed);
+    quint64 space = m_ringSize - (writeCount - m_readCount.load(std::memory_order_acquire));
+    quint64 nbSamples = end - begin;
+
+    if (nbSamples > space)
+    {
+        m_droppedSamples.fetch_add(nbSamples - space, std::memory_order_relaxed);
+        nbSamples = space;
+    }
+
+    quint64 index = writeCount % m_ringSize;
+    quint64 first = std::min(nbSamples, m_ringSize - index);
+    std::copy(begin, begin + first, m_ring.begin() + index);
+    std::copy(begin + first, begin + nbSamples, m_ring.begin());
+    m_writeCount.store(writeCount + nbSamples, std::memory_order_release);
+}
+
+void ChannelRecord::write(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end)
+{
+    if (!m_recording.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    quint64 writeCount = m_writeCount.load(std::memory_order_relaxed);
+    quint64 space = m_ringSize - (writeCount - m_readCount.load(std::memory_order_acquire));
+    quint64 nbSamples = end - begin;
+
+    if (nbSamples > space)
+    {
+        m_droppedSamples.fetch_add(nbSamples - space, std::memory_order_relaxed);
+        nbSamples = space;
+    }
+
+    FSampleVector::const_iterator it = begin;
+
+    for (quint64 i = 0; i < nbSamples; i++, ++it) {
+        m_ring[(writeCount + i) % m_ringSize] = it->toSample();
+    }
+
+    m_writeCount.store(writeCount + nbSamples, std::memory_order_release);
+}
+
+void ChannelRecord::pushEvent(Event& event)
+{
+    // called with the state mutex locked. Events from the channel thread apply exactly at the next sample.
+    event.m_count = m_writeCount.load(std::memory_order_acquire);
+    m_events.push_back(event);
+}
+
+void ChannelRecord::drain()
+{
+    QMutexLocker mutexLocker(&m_stateMutex);
+
+    while (true)
+    {
+        quint64 readCount = m_readCount.load(std::memory_order_relaxed);
+
+        while (!m_events.empty() && (m_events.front().m_count <= readCount))
+        {
+            Event event = m_events.front();
+            m_events.pop_front();
+
+            switch (event.m_type)
+            {
+            case Event::EventStart:
+                m_writerFileBase = event.m_fileBase;
+                m_writerRecording = true;
+                break;
+            case Event::EventStop:
+                m_writerRecording = false;
+                break;
+            case Event::EventFormat:
+                m_writerSampleRate = event.m_sampleRate;
+                m_writerCenterFrequency = event.m_centerFrequency;
+                break;
+            }
+
+            if (m_file.is_open()) // next samples go to a new file if still recording
+            {
+                mutexLocker.unlock();
+                m_file.close();
+                mutexLocker.relock();
+            }
+        }
+
+        quint64 end = m_writeCount.load(std::memory_order_acquire);
+
+        if (!m_events.empty()) {
+            end = std::min(end, m_events.front().m_count);
+        }
+
+        if (end <= readCount) {
+            break;
+        }
+
+        quint64 nbSamples = std::min(end - readCount, (quint64) m_writeChunkSize);
+
+        if (m_writerRecording && !m_file.is_open() && (m_writerSampleRate > 0)) {
+            openFile(mutexLocker);
+        }
+
+        if (m_file.is_open())
+        {
+            mutexLocker.unlock();
+            quint64 index = readCount % m_ringSize;
+            quint64 first = std::min(nbSamples, m_ringSize - index);
+            m_file.write(reinterpret_cast<const char*>(&m_ring[index]), first*sizeof(Sample));
+            m_file.write(reinterpret_cast<const char*>(&m_ring[0]), (nbSamples - first)*sizeof(Sample));
+            mutexLocker.relock();
+
+            if (m_file.fail())
+            {
+                m_errorMessage = QString("Write error on %1").arg(m_fileName);
+                qWarning("ChannelRecord::drain: %s", qPrintable(m_errorMessage));
+                m_writerRecording = false;
+                m_recording.store(false, std::memory_order_release);
+                mutexLocker.unlock();
+                m_file.close();
+                mutexLocker.relock();
+            }
+            else
+            {
+                m_writtenBytes += nbSamples*sizeof(Sample);
+            }
+        }
+
+        m_readCount.store(readCount + nbSamples, std::memory_order_release);
+    }
+}
+
+void ChannelRecord::openFile(QMutexLocker& mutexLocker)
+{
+    qint64 startTime = QDateTime::currentMSecsSinceEpoch();
+    QString fileName = QString("%1_%2.sdriq")
+        .arg(m_writerFileBase)
+        .arg(QDateTime::fromMSecsSinceEpoch(startTime).toString("yyyy-MM-ddTHH_mm_ss_zzz"));
+
+    mutexLocker.unlock();
+    m_file.open(fileName.toStdString().c_str(), std::ios::binary);
+
+    if (m_file.is_open())
+    {
+        FileRecord::Header header;
+        header.sampleRate = m_writerSampleRate;
+        header.centerFrequency = m_writerCenterFrequency;
+        header.startTimeStamp = startTime / 1000;
+        header.sampleSize = SDR_RX_SAMP_SZ;
+        FileRecord::writeHeader(m_file, header);
+    }
+
+    mutexLocker.relock();
+    m_fileName = fileName;
+
+    if (m_file.is_open())
+    {
+        m_fileSampleRate = m_writerSampleRate;
+        m_fileCenterFrequency = m_writerCenterFrequency;
+        m_nbFiles++;
+        qDebug("ChannelRecord::openFile: %s at %d S/s %llu Hz", qPrintable(fileName), m_writerSampleRate, m_writerCenterFrequency);
+    }
+    else
+    {
+        m_errorMessage = QString("Cannot open %1").arg(fileName);
+        qWarning("ChannelRecord::openFile: %s", qPrintable(m_errorMessage));
+        m_writerRecording = false;
+        m_recording.store(false, std::memory_order_release);
+    }
+}
+
+ChannelRecordWriter::ChannelRecordWriter() :
+    m_running(false)
+{
+    setObjectName("ChannelRecordWriter");
+}
+
+ChannelRecordWriter::~ChannelRecordWriter()
+{
+    m_mutex.lock();
+    m_running = false;
+    m_condition.wakeAll();
+    m_mutex.unlock();
+    wait();
+}
+
+ChannelRecordWriter *ChannelRecordWriter::instance()
+{
+    return channelRecordWriter(); // null once destroyed at exit
+}
+
+void ChannelRecordWriter::registerRecord(ChannelRecord *record)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_records.push_back(record);
+
+    if (!m_running)
+    {
+        m_running = true;
+        start();
+    }
+}
+
+void ChannelRecordWriter::unregisterRecord(ChannelRecord *record)
+{
+    QMutexLocker mutexLocker(&m_mutex); // held by the writer while it drains the records
+    m_records.remove(record);
+}
+
+void ChannelRecordWriter::wakeUp()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_condition.wakeAll();
+}
+
+void ChannelRecordWriter::run()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (m_running)
+    {
+        for (std::list<ChannelRecord*>::iterator it = m_records.begin(); it != m_records.end(); ++it) {
+            (*it)->drain();
+        }
+
+        m_condition.wait(&m_mutex, m_pollPeriodMs);
+    }
+}
@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_DSP_CHANNELRECORD_H_
+#define SDRBASE_DSP_CHANNELRECORD_H_
+
+#include <atomic>
+#include <fstream>
+#include <list>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "util/export.h"
+
+/**
+ * I/Q recording tap at the output of a channelizer. It records the decimated stream given
+ * to the channel (a few tens of kS/s for most demodulators) into .sdriq files (FileRecord
+ * format) with the channelizer output sample rate and absolute center frequency in the header.
+ *
+ * The channel thread only copies samples into a ring buffer and never blocks: samples that
+ * do not fit are counted as dropped. All files are written by a single writer thread shared
+ * by all channel records (ChannelRecordWriter) so recording many channels at once costs one
+ * thread and a few kilobytes per second per channel.
+ *
+ * A change of sample rate or center frequency starts a new file so that each file has a
+ * valid header. Files are named <fileBase>_<yyyy-MM-ddTHH_mm_ss_zzz>.sdriq
+ */
+class SDRANGEL_API ChannelRecord {
+public:
+    struct Report
+    {
+        bool m_recording;
+        QString m_fileBase;
+        QString m_fileName;        //!< current or last file
+        int m_sampleRate;          //!< of the recorded stream
+        quint64 m_centerFrequency; //!< of the recorded stream
+        int m_nbFiles;
+        quint64 m_writtenBytes;    //!< total of all files
+        quint64 m_droppedSamples;  //!< ring buffer was full
+        QString m_errorMessage;    //!< last file error
+    };
+
+    ChannelRecord();
+    ~ChannelRecord();
+
+    void startRecording(const QString& fileBase); //!< Any thread
+    void stopRecording();                         //!< Any thread
+    bool isRecording() const { return m_recording.load(std::memory_order_acquire); }
+    void getReport(Report& report);
+
+    /** Channel thread. A change starts a new file at the next sample. */
+    void setStreamFormat(int sampleRate, quint64 centerFrequency);
+    /** Channel thread. Copies the samples into the ring buffer if recording. Never blocks. */
+    void write(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void write(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end);
+
+private:
+    friend class ChannelRecordWriter;
+
+    struct Event
+    {
+        enum Type
+        {
+            EventStart,
+            EventStop,
+            EventFormat
+        };
+
+        Type m_type;
+        quint64 m_count;           //!< applies from this sample
+        QString m_fileBase;        //!< start
+        int m_sampleRate;          //!< format
+        quint64 m_centerFrequency; //!< format
+    };
+
+    static const int m_ringSize = 1<<17; //!< samples, at least 0.5s of a 250 kS/s channel
+    static const int m_writeChunkSize = 8192;
+
+    std::atomic<bool> m_recording;
+    std::vector<Sample> m_ring;          //!< allocated at the first start and kept
+    std::atomic<quint64> m_writeCount;   //!< samples pushed into the ring. Ring index is modulo m_ringSize.
+    std::atomic<quint64> m_readCount;    //!< samples taken out of the ring by the writer
+    std::atomic<quint64> m_droppedSamples;
+    int m_sampleRate;                    //!< channel thread only
+    quint64 m_centerFrequency;           //!< channel thread only
+
+    QMutex m_stateMutex;                 //!< guards the members below
+    bool m_registered;
+    std::list<Event> m_events;
+    QString m_fileBase;
+    QString m_fileName;
+    int m_fileSampleRate;
+    quint64 m_fileCenterFrequency;
+    int m_nbFiles;
+    quint64 m_writtenBytes;
+    QString m_errorMessage;
+
+    // writer thread only
+    std::ofstream m_file;
+    bool m_writerRecording;              //!< samples read are written to m_file
+    QString m_writerFileBase;
+    int m_writerSampleRate;
+    quint64 m_writerCenterFrequency;
+
+    void pushEvent(Event& event);
+    void drain();                        //!< Writer thread
+    void openFile(QMutexLocker& mutexLocker);
+};
+
+/**
+ * Writer thread shared by all channel records. It wakes up periodically and drains each
+ * registered record in turn. Records register at their first start.
+ */
+class SDRANGEL_API ChannelRecordWriter : public QThread
+{
+public:
+    ChannelRecordWriter();
+    ~ChannelRecordWriter();
+
+    static ChannelRecordWriter *instance();
+
+    void registerRecord(ChannelRecord *record);
+    void unregisterRecord(ChannelRecord *record); //!< waits until the record is not being written anymore
+    void wakeUp();
+
+protected:
+    virtual void run();
+
+private:
+    static const unsigned long m_pollPeriodMs = 50;
+
+    QMutex m_mutex;
+    QWaitCondition m_condition;
+    std::list<ChannelRecord*> m_records;
+    bool m_running;
+};
+
+#endif /* SDRBASE_DSP_CHANNELRECORD_H_ */
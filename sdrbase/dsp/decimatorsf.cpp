@@ -16,7 +16,8 @@
 
 #include "decimatorsf.h"
 
-void DecimatorsF::decimate1(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate1(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     float xreal, yimag;
 
@@ -24,13 +25,13 @@ void DecimatorsF::decimate1(SampleVector::iterator* it, const float* buf, qint32
     {
         xreal = buf[pos+0];
         yimag = buf[pos+1];
-        (**it).setReal(xreal * SDR_RX_SCALEF);
-        (**it).setImag(yimag * SDR_RX_SCALEF);
+        store(**it, xreal, yimag);
         ++(*it); // Valgrind optim (comment not repeated)
     }
 }
 
-void DecimatorsF::decimate2_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate2_cen(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double intbuf[2];
 
@@ -45,14 +46,14 @@ void DecimatorsF::decimate2_cen(SampleVector::iterator* it, const float* buf, qi
                 &intbuf[0],
                 &intbuf[1]);
 
-        (**it).setReal(intbuf[0] * SDR_RX_SCALED);
-        (**it).setImag(intbuf[1] * SDR_RX_SCALED);
+        store(**it, intbuf[0], intbuf[1]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate2_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate2_inf(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal, yimag;
 
@@ -60,19 +61,18 @@ void DecimatorsF::decimate2_inf(SampleVector::iterator* it, const float* buf, qi
     {
         xreal = (buf[pos+0] - buf[pos+3]);
         yimag = (buf[pos+1] + buf[pos+2]);
-        (**it).setReal(xreal * SDR_RX_SCALED);
-        (**it).setImag(yimag * SDR_RX_SCALED);
+        store(**it, xreal, yimag);
         ++(*it);
 
         xreal = (buf[pos+7] - buf[pos+4]);
         yimag = (- buf[pos+5] - buf[pos+6]);
-        (**it).setReal(xreal * SDR_RX_SCALED);
-        (**it).setImag(yimag * SDR_RX_SCALED);
+        store(**it, xreal, yimag);
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate2_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate2_sup(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal, yimag;
 
@@ -80,19 +80,18 @@ void DecimatorsF::decimate2_sup(SampleVector::iterator* it, const float* buf, qi
     {
         xreal = (buf[pos+1] - buf[pos+2]);
         yimag = (- buf[pos+0] - buf[pos+3]);
-        (**it).setReal(xreal * SDR_RX_SCALED);
-        (**it).setImag(yimag * SDR_RX_SCALED);
+        store(**it, xreal, yimag);
         ++(*it);
 
         xreal = (buf[pos+6] - buf[pos+5]);
         yimag = (buf[pos+4] + buf[pos+7]);
-        (**it).setReal(xreal * SDR_RX_SCALED);
-        (**it).setImag(yimag * SDR_RX_SCALED);
+        store(**it, xreal, yimag);
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate4_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate4_inf(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal, yimag;
 
@@ -101,14 +100,14 @@ void DecimatorsF::decimate4_inf(SampleVector::iterator* it, const float* buf, qi
         xreal = (buf[pos+0] - buf[pos+3] + buf[pos+7] - buf[pos+4]);
         yimag = (buf[pos+1] - buf[pos+5] + buf[pos+2] - buf[pos+6]);
 
-        (**it).setReal(xreal * SDR_RX_SCALED);
-        (**it).setImag(yimag * SDR_RX_SCALED);
+        store(**it, xreal, yimag);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate4_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate4_sup(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     // Sup (USB):
     //            x  y   x  y   x   y  x   y  / x -> 1,-2,-5,6 / y -> -0,-3,4,7
@@ -123,14 +122,14 @@ void DecimatorsF::decimate4_sup(SampleVector::iterator* it, const float* buf, qi
         xreal = (buf[pos+1] - buf[pos+2] - buf[pos+5] + buf[pos+6]);
         yimag = (- buf[pos+0] - buf[pos+3] + buf[pos+4] + buf[pos+7]);
 
-        (**it).setReal(xreal * SDR_RX_SCALED);
-        (**it).setImag(yimag * SDR_RX_SCALED);
+        store(**it, xreal, yimag);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate8_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate8_inf(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal[2], yimag[2];
 
@@ -145,14 +144,14 @@ void DecimatorsF::decimate8_inf(SampleVector::iterator* it, const float* buf, qi
 
         m_decimator2.myDecimate(xreal[0], yimag[0], &xreal[1], &yimag[1]);
 
-        (**it).setReal(xreal[1] * SDR_RX_SCALED);
-        (**it).setImag(yimag[1] * SDR_RX_SCALED);
+        store(**it, xreal[1], yimag[1]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate8_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate8_sup(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal[2], yimag[2];
 
@@ -167,14 +166,14 @@ void DecimatorsF::decimate8_sup(SampleVector::iterator* it, const float* buf, qi
 
         m_decimator2.myDecimate(xreal[0], yimag[0], &xreal[1], &yimag[1]);
 
-        (**it).setReal(xreal[1] * SDR_RX_SCALED);
-        (**it).setImag(yimag[1] * SDR_RX_SCALED);
+        store(**it, xreal[1], yimag[1]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate16_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate16_inf(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     // Offset tuning: 4x downsample and rotate, then
     // downsample 4x more. [ rotate:  0, 1, -3, 2, -4, -5, 7, -6]
@@ -194,14 +193,14 @@ void DecimatorsF::decimate16_inf(SampleVector::iterator* it, const float* buf, q
 
         m_decimator4.myDecimate(xreal[1], yimag[1], &xreal[3], &yimag[3]);
 
-        (**it).setReal(xreal[3] * SDR_RX_SCALED);
-        (**it).setImag(yimag[3] * SDR_RX_SCALED);
+        store(**it, xreal[3], yimag[3]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate16_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate16_sup(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     // Offset tuning: 4x downsample and rotate, then
     // downsample 4x more. [ rotate:  1, 0, -2, 3, -5, -4, 6, -7]
@@ -221,14 +220,14 @@ void DecimatorsF::decimate16_sup(SampleVector::iterator* it, const float* buf, q
 
         m_decimator4.myDecimate(xreal[1], yimag[1], &xreal[3], &yimag[3]);
 
-        (**it).setReal(xreal[3] * SDR_RX_SCALED);
-        (**it).setImag(yimag[3] * SDR_RX_SCALED);
+        store(**it, xreal[3], yimag[3]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate32_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate32_inf(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal[8], yimag[8];
 
@@ -251,14 +250,14 @@ void DecimatorsF::decimate32_inf(SampleVector::iterator* it, const float* buf, q
 
         m_decimator8.myDecimate(xreal[3], yimag[3], &xreal[7], &yimag[7]);
 
-        (**it).setReal(xreal[7] * SDR_RX_SCALED);
-        (**it).setImag(yimag[7] * SDR_RX_SCALED);
+        store(**it, xreal[7], yimag[7]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate32_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate32_sup(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal[8], yimag[8];
 
@@ -281,14 +280,14 @@ void DecimatorsF::decimate32_sup(SampleVector::iterator* it, const float* buf, q
 
         m_decimator8.myDecimate(xreal[3], yimag[3], &xreal[7], &yimag[7]);
 
-        (**it).setReal(xreal[7] * SDR_RX_SCALED);
-        (**it).setImag(yimag[7] * SDR_RX_SCALED);
+        store(**it, xreal[7], yimag[7]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate64_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate64_inf(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal[16], yimag[16];
 
@@ -320,14 +319,14 @@ void DecimatorsF::decimate64_inf(SampleVector::iterator* it, const float* buf, q
 
         m_decimator16.myDecimate(xreal[7], yimag[7], &xreal[15], &yimag[15]);
 
-        (**it).setReal(xreal[15] * SDR_RX_SCALED);
-        (**it).setImag(yimag[15] * SDR_RX_SCALED);
+        store(**it, xreal[15], yimag[15]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate64_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate64_sup(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double xreal[16], yimag[16];
 
@@ -359,14 +358,14 @@ void DecimatorsF::decimate64_sup(SampleVector::iterator* it, const float* buf, q
 
         m_decimator16.myDecimate(xreal[7], yimag[7], &xreal[15], &yimag[15]);
 
-        (**it).setReal(xreal[15] * SDR_RX_SCALED);
-        (**it).setImag(yimag[15] * SDR_RX_SCALED);
+        store(**it, xreal[15], yimag[15]);
 
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate4_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate4_cen(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double intbuf[4];
 
@@ -394,13 +393,13 @@ void DecimatorsF::decimate4_cen(SampleVector::iterator* it, const float* buf, qi
                 &intbuf[2],
                 &intbuf[3]);
 
-        (**it).setReal(intbuf[2] * SDR_RX_SCALED);
-        (**it).setImag(intbuf[3] * SDR_RX_SCALED);
+        store(**it, intbuf[2], intbuf[3]);
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate8_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate8_cen(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double intbuf[8];
 
@@ -453,13 +452,13 @@ void DecimatorsF::decimate8_cen(SampleVector::iterator* it, const float* buf, qi
                 &intbuf[6],
                 &intbuf[7]);
 
-        (**it).setReal(intbuf[6] * SDR_RX_SCALED);
-        (**it).setImag(intbuf[7] * SDR_RX_SCALED);
+        store(**it, intbuf[6], intbuf[7]);
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate16_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate16_cen(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double intbuf[16];
 
@@ -561,13 +560,13 @@ void DecimatorsF::decimate16_cen(SampleVector::iterator* it, const float* buf, q
                 &intbuf[14],
                 &intbuf[15]);
 
-        (**it).setReal(intbuf[14] * SDR_RX_SCALED);
-        (**it).setImag(intbuf[15] * SDR_RX_SCALED);
+        store(**it, intbuf[14], intbuf[15]);
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate32_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate32_cen(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double intbuf[32];
 
@@ -766,13 +765,13 @@ void DecimatorsF::decimate32_cen(SampleVector::iterator* it, const float* buf, q
                 &intbuf[30],
                 &intbuf[31]);
 
-        (**it).setReal(intbuf[30] * SDR_RX_SCALED);
-        (**it).setImag(intbuf[31] * SDR_RX_SCALED);
+        store(**it, intbuf[30], intbuf[31]);
         ++(*it);
     }
 }
 
-void DecimatorsF::decimate64_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ)
+template<typename Iterator>
+void DecimatorsF::decimate64_cen(Iterator* it, const float* buf, qint32 nbIAndQ)
 {
     double intbuf[64];
 
@@ -1165,9 +1164,32 @@ void DecimatorsF::decimate64_cen(SampleVector::iterator* it, const float* buf, q
                 &intbuf[62],
                 &intbuf[63]);
 
-        (**it).setReal(intbuf[62] * SDR_RX_SCALED);
-        (**it).setImag(intbuf[63] * SDR_RX_SCALED);
+        store(**it, intbuf[62], intbuf[63]);
         ++(*it);
     }
 }
 
+// samples are stored in fixed point or in floating point (full scale 1.0)
+#define DECIMATORSF_INSTANTIATE(Iterator) \
+    template void DecimatorsF::decimate1(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate2_cen(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate2_inf(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate2_sup(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate4_inf(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate4_sup(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate8_inf(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate8_sup(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate16_inf(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate16_sup(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate32_inf(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate32_sup(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate64_inf(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate64_sup(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate4_cen(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate8_cen(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate16_cen(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate32_cen(Iterator* it, const float* buf, qint32 nbIAndQ); \
+    template void DecimatorsF::decimate64_cen(Iterator* it, const float* buf, qint32 nbIAndQ);
+
+DECIMATORSF_INSTANTIATE(SampleVector::iterator)
+DECIMATORSF_INSTANTIATE(FSampleVector::iterator)
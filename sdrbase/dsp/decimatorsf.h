@@ -21,28 +21,32 @@
 
 #define DECIMATORSF_HB_FILTER_ORDER 64
 
+/**
+ * Decimators of floating point samples (full scale 1.0). The output iterator is a SampleVector
+ * iterator (clipped fixed point) or a FSampleVector iterator (floating point baseband).
+ */
 class DecimatorsF
 {
 public:
-    void decimate1(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate2_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate2_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate2_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate4_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate4_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate4_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate8_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate8_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate8_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate16_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate16_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate16_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate32_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate32_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate32_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate64_inf(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate64_sup(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
-    void decimate64_cen(SampleVector::iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate1(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate2_inf(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate2_sup(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate2_cen(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate4_inf(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate4_sup(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate4_cen(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate8_inf(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate8_sup(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate8_cen(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate16_inf(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate16_sup(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate16_cen(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate32_inf(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate32_sup(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate32_cen(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate64_inf(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate64_sup(Iterator* it, const float* buf, qint32 nbIAndQ);
+    template<typename Iterator> void decimate64_cen(Iterator* it, const float* buf, qint32 nbIAndQ);
 
     IntHalfbandFilterDBF<double, float, DECIMATORSF_HB_FILTER_ORDER> m_decimator2;  // 1st stages
     IntHalfbandFilterDBF<double, float, DECIMATORSF_HB_FILTER_ORDER> m_decimator4;  // 2nd stages
@@ -50,6 +54,19 @@ public:
     IntHalfbandFilterDBF<double, float, DECIMATORSF_HB_FILTER_ORDER> m_decimator16; // 4th stages
     IntHalfbandFilterDBF<double, float, DECIMATORSF_HB_FILTER_ORDER> m_decimator32; // 5th stages
     IntHalfbandFilterDBF<double, float, DECIMATORSF_HB_FILTER_ORDER> m_decimator64; // 6th stages
+
+private:
+    static void store(Sample& sample, double x, double y)
+    {
+        sample.setReal(FSample::clip(x));
+        sample.setImag(FSample::clip(y));
+    }
+
+    static void store(FSample& sample, double x, double y)
+    {
+        sample.setReal(x);
+        sample.setImag(y);
+    }
 };
 
 
@@ -30,7 +30,8 @@ DownChannelizer::DownChannelizer(BasebandSampleSink* sampleSink) :
 	m_requestedOutputSampleRate(0),
 	m_requestedCenterFrequency(0),
 	m_currentOutputSampleRate(0),
-	m_currentCenterFrequency(0)
+	m_currentCenterFrequency(0),
+	m_deviceCenterFrequency(0)
 {
 	QString name = "DownChannelizer(" + m_sampleSink->objectName() + ")";
 	setObjectName(name);
@@ -56,15 +57,56 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 
 	if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
 	{
+		m_channelRecord.write(begin, end);
 		m_sampleSink->feed(begin, end, positiveOnly);
 	}
 	else
 	{
 		m_mutex.lock();
 
-		for(SampleVector::const_iterator sample = begin; sample != end; ++sample)
+		// the whole block goes through each stage in turn, in place
+		m_sampleBuffer.assign(begin, end);
+		int nbSamples = m_sampleBuffer.size();
+
+		for (FilterStages::iterator stage = m_filterStages.begin(); (stage != m_filterStages.end()) && (nbSamples > 0); ++stage) {
+			nbSamples = (*stage)->work(&m_sampleBuffer[0], nbSamples);
+		}
+
+		m_sampleBuffer.resize(nbSamples);
+
+		for (SampleVector::iterator it = m_sampleBuffer.begin(); it != m_sampleBuffer.end(); ++it)
 		{
-			Sample s(*sample);
+			it->m_real /= (1<<(m_filterStages.size()));
+			it->m_imag /= (1<<(m_filterStages.size()));
+		}
+
+		m_mutex.unlock();
+
+		m_channelRecord.write(m_sampleBuffer.begin(), m_sampleBuffer.end());
+		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), positiveOnly);
+		m_sampleBuffer.clear();
+	}
+}
+
+void DownChannelizer::feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	if(m_sampleSink == 0) {
+		m_sampleBufferF.clear();
+		return;
+	}
+
+	if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
+	{
+		m_channelRecord.write(begin, end);
+		m_sampleSink->feedFloat(begin, end, positiveOnly);
+	}
+	else
+	{
+		m_mutex.lock();
+
+		for(FSampleVector::const_iterator sample = begin; sample != end; ++sample)
+		{
+			FSample s(*sample);
 			FilterStages::iterator stage = m_filterStages.begin();
 
 			for (; stage != m_filterStages.end(); ++stage)
@@ -75,18 +117,16 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 				}
 			}
 
-			if(stage == m_filterStages.end())
-			{
-			    s.m_real /= (1<<(m_filterStages.size()));
-			    s.m_imag /= (1<<(m_filterStages.size()));
-				m_sampleBuffer.push_back(s);
+			if(stage == m_filterStages.end()) {
+				m_sampleBufferF.push_back(s); // floating point stages have unity gain
 			}
 		}
 
 		m_mutex.unlock();
 
-		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), positiveOnly);
-		m_sampleBuffer.clear();
+		m_channelRecord.write(m_sampleBufferF.begin(), m_sampleBufferF.end());
+		m_sampleSink->feedFloat(m_sampleBufferF.begin(), m_sampleBufferF.end(), positiveOnly);
+		m_sampleBufferF.clear();
 	}
 }
 
@@ -118,6 +158,7 @@ bool DownChannelizer::handleMessage(const Message& cmd)
 	{
 		DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
 		m_inputSampleRate = notif.getSampleRate();
+		m_deviceCenterFrequency = notif.getCenterFrequency();
 		qDebug() << "DownChannelizer::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_inputSampleRate;
 		applyConfiguration();
 
@@ -185,6 +226,10 @@ void DownChannelizer::applyConfiguration()
 			<< ", out=" << m_currentOutputSampleRate
 			<< ", fc=" << m_currentCenterFrequency;
 
+	// absolute frequency at the center of the output band
+	m_channelRecord.setStreamFormat(m_currentOutputSampleRate,
+		m_deviceCenterFrequency + m_requestedCenterFrequency - m_currentCenterFrequency);
+
 	if (m_sampleSink != 0)
 	{
 		MsgChannelizerNotification *notif = MsgChannelizerNotification::create(m_currentOutputSampleRate, m_currentCenterFrequency);
@@ -192,75 +237,39 @@ void DownChannelizer::applyConfiguration()
 	}
 }
 
-#ifdef SDR_RX_SAMPLE_24BIT
-DownChannelizer::FilterStage::FilterStage(Mode mode) :
-    m_filter(new IntHalfbandFilterDB<qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0),
-    m_mode(mode),
-    m_sse(false)
-{
-    switch(mode) {
-        case ModeCenter:
-            m_workFunction = &IntHalfbandFilterDB<qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
-            break;
-
-        case ModeLowerHalf:
-            m_workFunction = &IntHalfbandFilterDB<qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
-            break;
-
-        case ModeUpperHalf:
-            m_workFunction = &IntHalfbandFilterDB<qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
-            break;
-    }
-}
-#else
-#ifdef USE_SSE4_1
 DownChannelizer::FilterStage::FilterStage(Mode mode) :
-	m_filter(new IntHalfbandFilterEO1<DOWNCHANNELIZER_HB_FILTER_ORDER>),
+	m_filter(new Filter),
 	m_workFunction(0),
-	m_mode(mode),
-	m_sse(true)
+	m_blockFunction(0),
+	m_filterF(new FilterF),
+	m_workFunctionF(0),
+	m_mode(mode)
 {
 	switch(mode) {
 		case ModeCenter:
-			m_workFunction = &IntHalfbandFilterEO1<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
+			m_workFunction = &Filter::workDecimateCenter;
+			m_blockFunction = &Filter::decimateCenter;
+			m_workFunctionF = &FilterF::workDecimateCenter;
 			break;
 
 		case ModeLowerHalf:
-			m_workFunction = &IntHalfbandFilterEO1<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
+			m_workFunction = &Filter::workDecimateLowerHalf;
+			m_blockFunction = &Filter::decimateLowerHalf;
+			m_workFunctionF = &FilterF::workDecimateLowerHalf;
 			break;
 
 		case ModeUpperHalf:
-			m_workFunction = &IntHalfbandFilterEO1<DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
+			m_workFunction = &Filter::workDecimateUpperHalf;
+			m_blockFunction = &Filter::decimateUpperHalf;
+			m_workFunctionF = &FilterF::workDecimateUpperHalf;
 			break;
 	}
 }
-#else
-DownChannelizer::FilterStage::FilterStage(Mode mode) :
-	m_filter(new IntHalfbandFilterDB<qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>),
-	m_workFunction(0),
-	m_mode(mode),
-	m_sse(false)
-{
-	switch(mode) {
-		case ModeCenter:
-			m_workFunction = &IntHalfbandFilterDB<qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateCenter;
-			break;
-
-		case ModeLowerHalf:
-			m_workFunction = &IntHalfbandFilterDB<qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateLowerHalf;
-			break;
 
-		case ModeUpperHalf:
-			m_workFunction = &IntHalfbandFilterDB<qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::workDecimateUpperHalf;
-			break;
-	}
-}
-#endif
-#endif
 DownChannelizer::FilterStage::~FilterStage()
 {
 	delete m_filter;
+	delete m_filterF;
 }
 
 bool DownChannelizer::signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const
@@ -328,16 +337,16 @@ void DownChannelizer::debugFilterChain()
         switch ((*it)->m_mode)
         {
         case FilterStage::ModeCenter:
-            qDebug("DownChannelizer::debugFilterChain: center %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: center %s", HBFilterKernels::getISAName(HBFilterKernels::getISA()));
             break;
         case FilterStage::ModeLowerHalf:
-            qDebug("DownChannelizer::debugFilterChain: lower %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: lower %s", HBFilterKernels::getISAName(HBFilterKernels::getISA()));
             break;
         case FilterStage::ModeUpperHalf:
-            qDebug("DownChannelizer::debugFilterChain: upper %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: upper %s", HBFilterKernels::getISAName(HBFilterKernels::getISA()));
             break;
         default:
-            qDebug("DownChannelizer::debugFilterChain: none %s", (*it)->m_sse ? "sse" : "no_sse");
+            qDebug("DownChannelizer::debugFilterChain: none %s", HBFilterKernels::getISAName(HBFilterKernels::getISA()));
             break;
         }
     }
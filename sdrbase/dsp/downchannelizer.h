@@ -23,15 +23,9 @@
 #include <QMutex>
 #include "util/export.h"
 #include "util/message.h"
-#ifdef SDR_RX_SAMPLE_24BIT
-#include "dsp/inthalfbandfilterdb.h"
-#else
-#ifdef USE_SSE4_1
-#include "dsp/inthalfbandfiltereo1.h"
-#else
-#include "dsp/inthalfbandfilterdb.h"
-#endif
-#endif
+#include "dsp/inthalfbandfilterng.h"
+#include "dsp/inthalfbandfilterdbf.h"
+#include "dsp/channelrecord.h"
 
 #define DOWNCHANNELIZER_HB_FILTER_ORDER 48
 
@@ -68,10 +62,12 @@ public:
 
 	void configure(MessageQueue* messageQueue, int sampleRate, int centerFrequency);
 	int getInputSampleRate() const { return m_inputSampleRate; }
+	ChannelRecord *getChannelRecord() { return &m_channelRecord; } //!< I/Q recording of the channelizer output
 
 	virtual void start();
 	virtual void stop();
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+	virtual void feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
 	virtual bool handleMessage(const Message& cmd);
 
 protected:
@@ -83,20 +79,20 @@ protected:
 		};
 
 #ifdef SDR_RX_SAMPLE_24BIT
-        typedef bool (IntHalfbandFilterDB<qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* s);
-        IntHalfbandFilterDB<qint64, DOWNCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#else
-#ifdef USE_SSE4_1
-		typedef bool (IntHalfbandFilterEO1<DOWNCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* s);
-		IntHalfbandFilterEO1<DOWNCHANNELIZER_HB_FILTER_ORDER>* m_filter;
+		typedef IntHalfbandFilterNG<qint64, DOWNCHANNELIZER_HB_FILTER_ORDER> Filter; // 24 bit samples need 64 bit accumulators
 #else
-		typedef bool (IntHalfbandFilterDB<qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* s);
-		IntHalfbandFilterDB<qint32, DOWNCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#endif
+		typedef IntHalfbandFilterNG<qint32, DOWNCHANNELIZER_HB_FILTER_ORDER> Filter;
 #endif
+		typedef bool (Filter::*WorkFunction)(Sample* s);
+		typedef int (Filter::*BlockFunction)(const Sample* in, Sample* out, int nbIn);
+		typedef IntHalfbandFilterDBF<double, float, DOWNCHANNELIZER_HB_FILTER_ORDER> FilterF; //!< floating point baseband
+		typedef bool (FilterF::*WorkFunctionF)(FSample* s);
+		Filter* m_filter;
 		WorkFunction m_workFunction;
+		BlockFunction m_blockFunction;
+		FilterF* m_filterF;
+		WorkFunctionF m_workFunctionF;
 		Mode m_mode;
-		bool m_sse;
 
 		FilterStage(Mode mode);
 		~FilterStage();
@@ -105,6 +101,17 @@ protected:
 		{
 			return (m_filter->*m_workFunction)(sample);
 		}
+
+		/** decimates in place and returns the number of output samples */
+		int work(Sample* samples, int nbSamples)
+		{
+			return (m_filter->*m_blockFunction)(samples, samples, nbSamples);
+		}
+
+		bool work(FSample* sample)
+		{
+			return (m_filterF->*m_workFunctionF)(sample);
+		}
 	};
 	typedef std::list<FilterStage*> FilterStages;
 	FilterStages m_filterStages;
@@ -114,8 +121,11 @@ protected:
 	int m_requestedCenterFrequency;
 	int m_currentOutputSampleRate;
 	int m_currentCenterFrequency;
+	quint64 m_deviceCenterFrequency;
 	SampleVector m_sampleBuffer;
+	FSampleVector m_sampleBufferF;
 	QMutex m_mutex;
+	ChannelRecord m_channelRecord;
 
 	void applyConfiguration();
 	bool signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const;
@@ -296,6 +296,21 @@ private:
 
 };
 
+class SDRANGEL_API DSPConfigureFloatBaseband : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPConfigureFloatBaseband(bool floatBaseband) :
+		Message(),
+		m_floatBaseband(floatBaseband)
+	{ }
+
+	bool getFloatBaseband() const { return m_floatBaseband; }
+
+private:
+	bool m_floatBaseband;
+};
+
 class SDRANGEL_API DSPEngineReport : public Message {
 	MESSAGE_CLASS_DECLARATION
 
@@ -353,6 +368,25 @@ private:
 	qint64 m_centerFrequency;
 };
 
+/** Event to mark in recordings that support annotations (SigMF). Handled by the direct baseband sinks. */
+class SDRANGEL_API DSPRecordAnnotation : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPRecordAnnotation(const QString& label, const QString& comment) :
+		Message(),
+		m_label(label),
+		m_comment(comment)
+	{ }
+
+	const QString& getLabel() const { return m_label; }
+	const QString& getComment() const { return m_comment; }
+
+private:
+	QString m_label;
+	QString m_comment;
+};
+
 class SDRANGEL_API DSPConfigureChannelizer : public Message {
 	MESSAGE_CLASS_DECLARATION
 
@@ -25,6 +25,7 @@
 #include "dsp/basebandsamplesink.h"
 #include "dsp/devicesamplesink.h"
 #include "dsp/dspcommands.h"
+#include "util/messagedispatcher.h"
 #include "samplesourcefifo.h"
 #include "threadedbasebandsamplesource.h"
 
@@ -38,11 +39,17 @@ DSPDeviceSinkEngine::DSPDeviceSinkEngine(uint32_t uid, QObject* parent) :
 	m_spectrumSink(0),
 	m_sampleRate(0),
 	m_centerFrequency(0),
-	m_multipleSourcesDivisionFactor(1)
+	m_multipleSourcesDivisionFactor(1),
+	m_busyTime(0),
+	m_processedSamples(0),
+	m_underrunCountBase(0),
+	m_underrunSamplesBase(0)
 {
 	connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
 	connect(&m_syncMessenger, SIGNAL(messageSent()), this, SLOT(handleSynchronousMessages()), Qt::QueuedConnection);
 
+	m_schedulingTimer.start();
+
 	moveToThread(this);
 }
 
@@ -176,6 +183,7 @@ void DSPDeviceSinkEngine::work(int nbWriteSamples)
 	if ((m_threadedBasebandSampleSources.size() + m_basebandSampleSources.size()) > 1)
 	{
 //	    qDebug("DSPDeviceSinkEngine::work: multiple channel sources handling: %u", m_multipleSourcesDivisionFactor);
+	    m_workTimer.start();
 
 	    SampleVector::iterator writeBegin;
 	    SampleSourceFifo* sampleFifo = m_deviceSampleSink->getSampleFifo();
@@ -215,6 +223,84 @@ void DSPDeviceSinkEngine::work(int nbWriteSamples)
 
 			sampleFifo->bumpIndex(writeAt);
 		}
+
+	    QMutexLocker mutexLocker(&m_reportMutex);
+	    m_busyTime += m_workTimer.nsecsElapsed();
+	    m_processedSamples += nbWriteSamples;
+	}
+}
+
+void DSPDeviceSinkEngine::getBusyCounters(quint64& busyTime, quint64& runningTime, quint64& processedSamples)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+	busyTime = m_busyTime;
+	runningTime = (m_state == StRunning) && m_runningTimer.isValid() ? m_runningTimer.nsecsElapsed() : 0;
+	processedSamples = m_processedSamples;
+}
+
+void DSPDeviceSinkEngine::setThreadScheduling(const ThreadSchedulingSettings& settings)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+
+	// keep what was observed with the previous settings for comparison
+	fetchSchedulingCounters(m_previousSchedulingCounters);
+	resetSchedulingCounters();
+
+	m_threadScheduling = settings;
+	m_engineScheduling.setSettings(settings);
+
+	if (m_deviceSampleSink) {
+		m_deviceSampleSink->getSampleFifo()->getReaderScheduling().setSettings(settings);
+	}
+}
+
+void DSPDeviceSinkEngine::getThreadSchedulingReport(ThreadSchedulingReport& report)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+	QString deviceError;
+
+	report.m_settings = m_threadScheduling;
+	report.m_engineApplied = m_engineScheduling.getResult(report.m_enginePolicy, report.m_errorMessage);
+	report.m_deviceApplied = false;
+	report.m_devicePolicy = ThreadSchedulingSettings::PolicyDefault;
+
+	if (m_deviceSampleSink) {
+		report.m_deviceApplied = m_deviceSampleSink->getSampleFifo()->getReaderScheduling().getResult(report.m_devicePolicy, deviceError);
+	}
+
+	if (!deviceError.isEmpty()) {
+		report.m_errorMessage += QString(report.m_errorMessage.isEmpty() ? "" : "; ") + "device: " + deviceError;
+	}
+
+	fetchSchedulingCounters(report.m_counters);
+	report.m_previousCounters = m_previousSchedulingCounters;
+}
+
+void DSPDeviceSinkEngine::fetchSchedulingCounters(ThreadSchedulingCounters& counters)
+{
+	counters = m_schedulingCounters;
+	counters.m_runningTime = m_schedulingTimer.nsecsElapsed();
+
+	if (m_deviceSampleSink)
+	{
+		SampleSourceFifo *sampleFifo = m_deviceSampleSink->getSampleFifo();
+		counters.m_overflowCount = sampleFifo->getUnderrunCount() - m_underrunCountBase;
+		counters.m_droppedSamples = sampleFifo->getUnderrunSamples() - m_underrunSamplesBase;
+	}
+}
+
+void DSPDeviceSinkEngine::resetSchedulingCounters()
+{
+	m_schedulingCounters.reset();
+	m_schedulingTimer.start();
+	m_underrunCountBase = 0;
+	m_underrunSamplesBase = 0;
+
+	if (m_deviceSampleSink)
+	{
+		SampleSourceFifo *sampleFifo = m_deviceSampleSink->getSampleFifo();
+		m_underrunCountBase = sampleFifo->getUnderrunCount();
+		m_underrunSamplesBase = sampleFifo->getUnderrunSamples();
 	}
 }
 
@@ -383,6 +469,12 @@ DSPDeviceSinkEngine::State DSPDeviceSinkEngine::gotoRunning()
         m_spectrumSink->start();
 	}
 
+	m_reportMutex.lock();
+	m_busyTime = 0;
+	m_processedSamples = 0;
+	m_runningTimer.start();
+	m_reportMutex.unlock();
+
 	qDebug() << "DSPDeviceSinkEngine::gotoRunning: input message queue pending: " << m_inputMessageQueue.size();
 
 	return StRunning;
@@ -402,7 +494,15 @@ void DSPDeviceSinkEngine::handleSetSink(DeviceSampleSink* sink)
 {
 	gotoIdle();
 
+	m_reportMutex.lock();
 	m_deviceSampleSink = sink;
+	resetSchedulingCounters();
+
+	if ((m_deviceSampleSink != 0) && !m_threadScheduling.isDefault()) { // the new device threads start with the default scheduling
+		m_deviceSampleSink->getSampleFifo()->getReaderScheduling().setSettings(m_threadScheduling);
+	}
+
+	m_reportMutex.unlock();
 
 	if(m_deviceSampleSink != 0)
 	{
@@ -418,7 +518,12 @@ void DSPDeviceSinkEngine::handleData(int nbSamples)
 {
 	if(m_state == StRunning)
 	{
+		m_engineScheduling.check();
+		qint64 latency = m_deviceSampleSink->getSampleFifo()->takeReadLatency();
 		work(nbSamples);
+
+		QMutexLocker mutexLocker(&m_reportMutex);
+		m_schedulingCounters.addLatency(latency);
 	}
 }
 
@@ -523,6 +628,9 @@ void DSPDeviceSinkEngine::handleSynchronousMessages()
 
 void DSPDeviceSinkEngine::handleInputMessages()
 {
+	static const MessageDispatcher<DSPDeviceSinkEngine> dispatcher = MessageDispatcher<DSPDeviceSinkEngine>()
+		.add<DSPSignalNotification>(&DSPDeviceSinkEngine::handleSignalNotification);
+
 	qDebug() << "DSPDeviceSinkEngine::handleInputMessages";
 
 	Message* message;
@@ -530,42 +638,44 @@ void DSPDeviceSinkEngine::handleInputMessages()
 	while ((message = m_inputMessageQueue.pop()) != 0)
 	{
 		qDebug("DSPDeviceSinkEngine::handleInputMessages: message: %s", message->getIdentifier());
+		dispatcher.dispatch(this, *message);
+		delete message;
+	}
+}
 
-		if (DSPSignalNotification::match(*message))
-		{
-			DSPSignalNotification *notif = (DSPSignalNotification *) message;
-
-			// update DSP values
+bool DSPDeviceSinkEngine::handleSignalNotification(const Message& message)
+{
+	const DSPSignalNotification& notif = (const DSPSignalNotification&) message;
 
-			m_sampleRate = notif->getSampleRate();
-			m_centerFrequency = notif->getCenterFrequency();
+	// update DSP values
 
-			qDebug() << "DSPDeviceSinkEngine::handleInputMessages: DSPSignalNotification(" << m_sampleRate << "," << m_centerFrequency << ")";
+	m_sampleRate = notif.getSampleRate();
+	m_centerFrequency = notif.getCenterFrequency();
 
-            // forward source changes to sources with immediate execution
+	qDebug() << "DSPDeviceSinkEngine::handleInputMessages: DSPSignalNotification(" << m_sampleRate << "," << m_centerFrequency << ")";
 
-			for(BasebandSampleSources::const_iterator it = m_basebandSampleSources.begin(); it != m_basebandSampleSources.end(); it++)
-			{
-				qDebug() << "DSPDeviceSinkEngine::handleInputMessages: forward message to " << (*it)->objectName().toStdString().c_str();
-				(*it)->handleMessage(*message);
-			}
+	// forward source changes to sources with immediate execution
 
-			for (ThreadedBasebandSampleSources::const_iterator it = m_threadedBasebandSampleSources.begin(); it != m_threadedBasebandSampleSources.end(); ++it)
-			{
-				qDebug() << "DSPDeviceSinkEngine::handleSourceMessages: forward message to ThreadedSampleSource(" << (*it)->getSampleSourceObjectName().toStdString().c_str() << ")";
-				(*it)->handleSourceMessage(*message);
-			}
+	for(BasebandSampleSources::const_iterator it = m_basebandSampleSources.begin(); it != m_basebandSampleSources.end(); it++)
+	{
+		qDebug() << "DSPDeviceSinkEngine::handleInputMessages: forward message to " << (*it)->objectName().toStdString().c_str();
+		(*it)->handleMessage(message);
+	}
 
-			// forward changes to listeners on DSP output queue
-			if (m_deviceSampleSink->getMessageQueueToGUI())
-			{
-                DSPSignalNotification* rep = new DSPSignalNotification(*notif); // make a copy for the output queue
-                m_deviceSampleSink->getMessageQueueToGUI()->push(rep);
-			}
+	for (ThreadedBasebandSampleSources::const_iterator it = m_threadedBasebandSampleSources.begin(); it != m_threadedBasebandSampleSources.end(); ++it)
+	{
+		qDebug() << "DSPDeviceSinkEngine::handleSourceMessages: forward message to ThreadedSampleSource(" << (*it)->getSampleSourceObjectName().toStdString().c_str() << ")";
+		(*it)->handleSourceMessage(message);
+	}
 
-			delete message;
-		}
+	// forward changes to listeners on DSP output queue
+	if (m_deviceSampleSink->getMessageQueueToGUI())
+	{
+		DSPSignalNotification* rep = new DSPSignalNotification(notif); // make a copy for the output queue
+		m_deviceSampleSink->getMessageQueueToGUI()->push(rep);
 	}
+
+	return true;
 }
 
 void DSPDeviceSinkEngine::handleForwardToSpectrumSink(int nbSamples)
@@ -622,7 +732,9 @@ void DSPDeviceSinkEngine::checkNumberOfBasebandSources()
             m_multipleSourcesDivisionFactor = 1<<nbSources;
         }
 
-        if (nbSources > 1) {
+        if (nbSources > 1)
+        {
+            sampleFifo->takeReadLatency(); // discard what accumulated while the engine was not handling the FIFO
             connect(sampleFifo, SIGNAL(dataWrite(int)), this, SLOT(handleData(int)), Qt::QueuedConnection);
         }
 
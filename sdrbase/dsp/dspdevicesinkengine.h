@@ -22,6 +22,7 @@
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
+#include <QElapsedTimer>
 #include <stdint.h>
 #include <list>
 #include <map>
@@ -30,6 +31,7 @@
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "util/export.h"
+#include "util/threadscheduling.h"
 
 class DeviceSampleSink;
 class BasebandSampleSource;
@@ -82,6 +84,12 @@ public:
 	QString errorMessage(); //!< Return the current error message
 	QString sinkDeviceDescription(); //!< Return the sink device description
 
+	uint32_t getSampleRate() const { return m_sampleRate; }           //!< Current baseband sample rate
+	quint64 getCenterFrequency() const { return m_centerFrequency; }  //!< Current center frequency
+	void getBusyCounters(quint64& busyTime, quint64& runningTime, quint64& processedSamples); //!< Times in ns since last start
+	void setThreadScheduling(const ThreadSchedulingSettings& settings); //!< Scheduling of the engine thread and of the device threads reading the FIFO
+	void getThreadSchedulingReport(ThreadSchedulingReport& report);     //!< Scheduling settings, result and counters before and after
+
 private:
 	uint32_t m_uid; //!< unique ID
 
@@ -116,6 +124,20 @@ private:
 	quint64 m_centerFrequency;
 	uint32_t m_multipleSourcesDivisionFactor;
 
+	QMutex m_reportMutex;         //!< Protects counters against report requests
+	QElapsedTimer m_runningTimer; //!< Started when going to the running state
+	QElapsedTimer m_workTimer;
+	quint64 m_busyTime;           //!< Time spent mixing sources in work() since last start (ns)
+	quint64 m_processedSamples;   //!< Samples mixed since last start
+
+	ThreadSchedulingSettings m_threadScheduling;    //!< protected by m_reportMutex
+	ThreadSchedulingHook m_engineScheduling;        //!< applied in handleData()
+	ThreadSchedulingCounters m_schedulingCounters;  //!< since the scheduling settings were last applied
+	ThreadSchedulingCounters m_previousSchedulingCounters;
+	QElapsedTimer m_schedulingTimer;
+	quint64 m_underrunCountBase;                    //!< device FIFO counters when the current counters were reset
+	quint64 m_underrunSamplesBase;
+
 	void run();
 	void work(int nbWriteSamples); //!< transfer samples from beseband sources to sink if in running state
 
@@ -126,6 +148,10 @@ private:
 
 	void handleSetSink(DeviceSampleSink* sink); //!< Manage sink setting
 	void checkNumberOfBasebandSources();
+	void fetchSchedulingCounters(ThreadSchedulingCounters& counters); //!< current counters with device FIFO deltas. m_reportMutex must be held.
+	void resetSchedulingCounters(); //!< m_reportMutex must be held
+
+	bool handleSignalNotification(const Message& message); //!< input messages handler
 
 private slots:
 	void handleData(int nbSamples); //!< Handle data when samples have to be written to the sample FIFO
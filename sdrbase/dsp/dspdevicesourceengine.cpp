@@ -24,6 +24,7 @@
 #include <QDebug>
 #include "dsp/dspcommands.h"
 #include "util/fixed.h"
+#include "util/messagedispatcher.h"
 #include "samplesinkfifo.h"
 #include "threadedbasebandsamplesink.h"
 
@@ -36,8 +37,13 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_basebandSampleSinks(),
 	m_sampleRate(0),
 	m_centerFrequency(0),
+	m_busyTime(0),
+	m_processedSamples(0),
+	m_overflowCountBase(0),
+	m_droppedSamplesBase(0),
 	m_dcOffsetCorrection(false),
 	m_iqImbalanceCorrection(false),
+	m_floatBaseband(false),
 	m_iOffset(0),
 	m_qOffset(0),
 	m_iRange(1 << 16),
@@ -47,6 +53,8 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
 	connect(&m_syncMessenger, SIGNAL(messageSent()), this, SLOT(handleSynchronousMessages()), Qt::QueuedConnection);
 
+	m_schedulingTimer.start();
+
 	moveToThread(this);
 }
 
@@ -156,6 +164,13 @@ void DSPDeviceSourceEngine::configureCorrections(bool dcOffsetCorrection, bool i
 	m_inputMessageQueue.push(cmd);
 }
 
+void DSPDeviceSourceEngine::configureFloatBaseband(bool floatBaseband)
+{
+	qDebug() << "DSPDeviceSourceEngine::configureFloatBaseband: " << floatBaseband;
+	DSPConfigureFloatBaseband* cmd = new DSPConfigureFloatBaseband(floatBaseband);
+	m_inputMessageQueue.push(cmd);
+}
+
 QString DSPDeviceSourceEngine::errorMessage()
 {
 	qDebug() << "DSPDeviceSourceEngine::errorMessage";
@@ -261,6 +276,49 @@ void DSPDeviceSourceEngine::iqCorrections(SampleVector::iterator begin, SampleVe
     }
 }
 
+void DSPDeviceSourceEngine::iqCorrections(FSampleVector::iterator begin, FSampleVector::iterator end, bool imbalanceCorrection)
+{
+    for(FSampleVector::iterator it = begin; it < end; it++)
+    {
+        m_iBetaF(it->real());
+        m_qBetaF(it->imag());
+
+        // DC correction
+        float xi = it->m_real - (float) m_iBetaF.asDouble();
+        float xq = it->m_imag - (float) m_qBetaF.asDouble();
+
+#if IMBALANCE_INT
+        (void) imbalanceCorrection; // the fixed point imbalance averages do not apply
+#else
+        if (imbalanceCorrection)
+        {
+            // phase imbalance
+            m_avgII(xi*xi); // <I", I">
+            m_avgIQ(xi*xq); // <I", Q">
+
+            if (m_avgII.asDouble() != 0) {
+                m_avgPhi(m_avgIQ.asDouble()/m_avgII.asDouble());
+            }
+
+            xq = xq - m_avgPhi.asDouble()*xi;
+
+            // amplitude I/Q imbalance
+            m_avgII2(xi*xi); // <I, I>
+            m_avgQQ2(xq*xq); // <Q, Q>
+
+            if (m_avgQQ2.asDouble() != 0) {
+                m_avgAmp(sqrt(m_avgII2.asDouble() / m_avgQQ2.asDouble()));
+            }
+
+            xq = m_avgAmp.asDouble() * xq;
+        }
+#endif
+
+        it->m_real = xi;
+        it->m_imag = xq;
+    }
+}
+
 void DSPDeviceSourceEngine::dcOffset(SampleVector::iterator begin, SampleVector::iterator end)
 {
 	// sum and correct in one pass
@@ -322,88 +380,240 @@ void DSPDeviceSourceEngine::imbalance(SampleVector::iterator begin, SampleVector
 	}
 }
 
+void DSPDeviceSourceEngine::feedSinks(SampleVector::const_iterator begin, SampleVector::const_iterator end, bool positiveOnly)
+{
+	// feed data to direct sinks
+	DirectSinkProfiles::iterator profileIt = m_pendingDirectSinkProfiles.begin();
+
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it, ++profileIt)
+	{
+		m_feedTimer.start();
+		(*it)->feed(begin, end, positiveOnly);
+		profileIt->m_feedTime.add(m_feedTimer.nsecsElapsed());
+		profileIt->m_processedSamples += end - begin;
+	}
+
+	// feed data to threaded sinks
+	for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
+	{
+		(*it)->feed(begin, end, positiveOnly);
+	}
+}
+
+void DSPDeviceSourceEngine::feedSinks(FSampleVector::const_iterator begin, FSampleVector::const_iterator end, bool positiveOnly)
+{
+	// feed data to direct sinks
+	DirectSinkProfiles::iterator profileIt = m_pendingDirectSinkProfiles.begin();
+
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it, ++profileIt)
+	{
+		m_feedTimer.start();
+		(*it)->feedFloat(begin, end, positiveOnly);
+		profileIt->m_feedTime.add(m_feedTimer.nsecsElapsed());
+		profileIt->m_processedSamples += end - begin;
+	}
+
+	// feed data to threaded sinks
+	for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
+	{
+		(*it)->feedFloat(begin, end, positiveOnly);
+	}
+}
+
+template<typename Vector>
+std::size_t DSPDeviceSourceEngine::transfer(SampleSinkFifo* sampleFifo)
+{
+	bool positiveOnly = false;
+	typename Vector::iterator part1begin;
+	typename Vector::iterator part1end;
+	typename Vector::iterator part2begin;
+	typename Vector::iterator part2end;
+
+	std::size_t count = sampleFifo->readBegin(sampleFifo->fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+	// first part of FIFO data
+	if (part1begin != part1end)
+	{
+		// correct stuff
+		if (m_dcOffsetCorrection)
+		{
+			iqCorrections(part1begin, part1end, m_iqImbalanceCorrection);
+		}
+
+		feedSinks(part1begin, part1end, positiveOnly);
+	}
+
+	// second part of FIFO data (used when block wraps around)
+	if(part2begin != part2end)
+	{
+		// correct stuff
+		if (m_dcOffsetCorrection)
+		{
+			iqCorrections(part2begin, part2end, m_iqImbalanceCorrection);
+		}
+
+		feedSinks(part2begin, part2end, positiveOnly);
+	}
+
+	// adjust FIFO pointers
+	sampleFifo->readCommit((unsigned int) count);
+	return count;
+}
+
 void DSPDeviceSourceEngine::work()
 {
 	SampleSinkFifo* sampleFifo = m_deviceSampleSource->getSampleFifo();
 	std::size_t samplesDone = 0;
-	bool positiveOnly = false;
+	m_engineScheduling.check();
+	qint64 latency = sampleFifo->takeWriteLatency();
+	m_workTimer.start();
 
 	while ((sampleFifo->fill() > 0) && (m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
 	{
-		SampleVector::iterator part1begin;
-		SampleVector::iterator part1end;
-		SampleVector::iterator part2begin;
-		SampleVector::iterator part2end;
+		if (sampleFifo->isFloat()) {
+			samplesDone += transfer<FSampleVector>(sampleFifo);
+		} else {
+			samplesDone += transfer<SampleVector>(sampleFifo);
+		}
+	}
+
+	qint64 workTime = m_workTimer.nsecsElapsed();
+	QMutexLocker mutexLocker(&m_reportMutex);
+	m_busyTime += workTime;
+	m_processedSamples += samplesDone;
+	m_schedulingCounters.addLatency(latency);
 
-		std::size_t count = sampleFifo->readBegin(sampleFifo->fill(), &part1begin, &part1end, &part2begin, &part2end);
+	if (samplesDone > 0)
+	{
+		m_workTime.add(workTime);
 
-		// first part of FIFO data
-		if (part1begin != part1end)
+		for (unsigned int i = 0; i < m_directSinkProfiles.size(); i++)
 		{
-			// correct stuff
-            if (m_dcOffsetCorrection)
-            {
-                iqCorrections(part1begin, part1end, m_iqImbalanceCorrection);
-            }
+			m_directSinkProfiles[i].merge(m_pendingDirectSinkProfiles[i]);
+			m_pendingDirectSinkProfiles[i].reset();
+		}
+	}
+}
 
-//			if (m_dcOffsetCorrection)
-//			{
-//				dcOffset(part1begin, part1end);
-//			}
-//
-//			if (m_iqImbalanceCorrection)
-//			{
-//				imbalance(part1begin, part1end);
-//			}
-
-			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
-			{
-				(*it)->feed(part1begin, part1end, positiveOnly);
-			}
+void DSPDeviceSourceEngine::applyFloatBaseband()
+{
+	if (m_deviceSampleSource) {
+		m_deviceSampleSource->getSampleFifo()->setFloat(m_floatBaseband);
+	}
 
-			// feed data to threaded sinks
-			for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
-			{
-				(*it)->feed(part1begin, part1end, positiveOnly);
-			}
-		}
+	for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it) {
+		(*it)->setFloat(m_floatBaseband);
+	}
+}
 
-		// second part of FIFO data (used when block wraps around)
-		if(part2begin != part2end)
-		{
-			// correct stuff
-            if (m_dcOffsetCorrection)
-            {
-                iqCorrections(part2begin, part2end, m_iqImbalanceCorrection);
-            }
+void DSPDeviceSourceEngine::getBusyCounters(quint64& busyTime, quint64& runningTime, quint64& processedSamples)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+	busyTime = m_busyTime;
+	runningTime = (m_state == StRunning) && m_runningTimer.isValid() ? m_runningTimer.nsecsElapsed() : 0;
+	processedSamples = m_processedSamples;
+}
 
-//            if (m_dcOffsetCorrection)
-//			{
-//				dcOffset(part2begin, part2end);
-//			}
-//
-//			if (m_iqImbalanceCorrection)
-//			{
-//				imbalance(part2begin, part2end);
-//			}
-
-			// feed data to direct sinks
-			for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
-			{
-				(*it)->feed(part2begin, part2end, positiveOnly);
-			}
+void DSPDeviceSourceEngine::getThreadedSinksReports(std::vector<ThreadedBasebandSampleSink::Report>& reports)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+	reports.clear();
 
-			// feed data to threaded sinks
-			for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
-			{
-				(*it)->feed(part2begin, part2end, positiveOnly);
-			}
-		}
+	for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
+	{
+		reports.push_back(ThreadedBasebandSampleSink::Report());
+		(*it)->getReport(reports.back());
+	}
+}
+
+void DSPDeviceSourceEngine::getDirectSinksReports(std::vector<ThreadedBasebandSampleSink::Report>& reports)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+	reports.clear();
+	DirectSinkProfiles::const_iterator profileIt = m_directSinkProfiles.begin();
 
-		// adjust FIFO pointers
-		sampleFifo->readCommit((unsigned int) count);
-		samplesDone += count;
+	for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it, ++profileIt)
+	{
+		reports.push_back(ThreadedBasebandSampleSink::Report());
+		ThreadedBasebandSampleSink::Report& report = reports.back();
+		report.m_name = (*it)->objectName();
+		report.m_direct = true;
+		report.m_processingTime = profileIt->m_feedTime.getSum();
+		report.m_processedSamples = profileIt->m_processedSamples;
+		report.m_samplesIn = profileIt->m_processedSamples;
+		report.m_feedTime = profileIt->m_feedTime;
+	}
+}
+
+void DSPDeviceSourceEngine::getWorkTime(ProfileHistogram& workTime)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+	workTime = m_workTime;
+}
+
+void DSPDeviceSourceEngine::setThreadScheduling(const ThreadSchedulingSettings& settings)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+
+	// keep what was observed with the previous settings for comparison
+	fetchSchedulingCounters(m_previousSchedulingCounters);
+	resetSchedulingCounters();
+
+	m_threadScheduling = settings;
+	m_engineScheduling.setSettings(settings);
+
+	if (m_deviceSampleSource) {
+		m_deviceSampleSource->getSampleFifo()->getWriterScheduling().setSettings(settings);
+	}
+}
+
+void DSPDeviceSourceEngine::getThreadSchedulingReport(ThreadSchedulingReport& report)
+{
+	QMutexLocker mutexLocker(&m_reportMutex);
+	QString deviceError;
+
+	report.m_settings = m_threadScheduling;
+	report.m_engineApplied = m_engineScheduling.getResult(report.m_enginePolicy, report.m_errorMessage);
+	report.m_deviceApplied = false;
+	report.m_devicePolicy = ThreadSchedulingSettings::PolicyDefault;
+
+	if (m_deviceSampleSource) {
+		report.m_deviceApplied = m_deviceSampleSource->getSampleFifo()->getWriterScheduling().getResult(report.m_devicePolicy, deviceError);
+	}
+
+	if (!deviceError.isEmpty()) {
+		report.m_errorMessage += QString(report.m_errorMessage.isEmpty() ? "" : "; ") + "device: " + deviceError;
+	}
+
+	fetchSchedulingCounters(report.m_counters);
+	report.m_previousCounters = m_previousSchedulingCounters;
+}
+
+void DSPDeviceSourceEngine::fetchSchedulingCounters(ThreadSchedulingCounters& counters)
+{
+	counters = m_schedulingCounters;
+	counters.m_runningTime = m_schedulingTimer.nsecsElapsed();
+
+	if (m_deviceSampleSource)
+	{
+		SampleSinkFifo *sampleFifo = m_deviceSampleSource->getSampleFifo();
+		counters.m_overflowCount = sampleFifo->getOverflowCount() - m_overflowCountBase;
+		counters.m_droppedSamples = sampleFifo->getDroppedSamples() - m_droppedSamplesBase;
+	}
+}
+
+void DSPDeviceSourceEngine::resetSchedulingCounters()
+{
+	m_schedulingCounters.reset();
+	m_schedulingTimer.start();
+	m_overflowCountBase = 0;
+	m_droppedSamplesBase = 0;
+
+	if (m_deviceSampleSource)
+	{
+		SampleSinkFifo *sampleFifo = m_deviceSampleSource->getSampleFifo();
+		m_overflowCountBase = sampleFifo->getOverflowCount();
+		m_droppedSamplesBase = sampleFifo->getDroppedSamples();
 	}
 }
 
@@ -559,6 +769,20 @@ DSPDeviceSourceEngine::State DSPDeviceSourceEngine::gotoRunning()
 		(*it)->start();
 	}
 
+	m_reportMutex.lock();
+	m_busyTime = 0;
+	m_processedSamples = 0;
+	m_workTime.reset();
+
+	for (unsigned int i = 0; i < m_directSinkProfiles.size(); i++)
+	{
+		m_directSinkProfiles[i].reset();
+		m_pendingDirectSinkProfiles[i].reset();
+	}
+
+	m_runningTimer.start();
+	m_reportMutex.unlock();
+
 	qDebug() << "DSPDeviceSourceEngine::gotoRunning:input message queue pending: " << m_inputMessageQueue.size();
 
 	return StRunning;
@@ -583,11 +807,20 @@ void DSPDeviceSourceEngine::handleSetSource(DeviceSampleSource* source)
 //		disconnect(m_sampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()));
 //	}
 
+	m_reportMutex.lock();
 	m_deviceSampleSource = source;
+	resetSchedulingCounters();
+
+	if ((m_deviceSampleSource != 0) && !m_threadScheduling.isDefault()) { // the new device threads start with the default scheduling
+		m_deviceSampleSource->getSampleFifo()->getWriterScheduling().setSettings(m_threadScheduling);
+	}
+
+	m_reportMutex.unlock();
 
 	if(m_deviceSampleSource != 0)
 	{
 		qDebug("DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
+		m_deviceSampleSource->getSampleFifo()->setFloat(m_floatBaseband);
 		connect(m_deviceSampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
 	}
 	else
@@ -641,7 +874,11 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	else if (DSPAddBasebandSampleSink::match(*message))
 	{
 		BasebandSampleSink* sink = ((DSPAddBasebandSampleSink*) message)->getSampleSink();
+		m_reportMutex.lock();
 		m_basebandSampleSinks.push_back(sink);
+		m_directSinkProfiles.push_back(DirectSinkProfile());
+		m_pendingDirectSinkProfiles.push_back(DirectSinkProfile());
+		m_reportMutex.unlock();
         // initialize sample rate and center frequency in the sink:
         DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
         sink->handleMessage(msg);
@@ -658,12 +895,29 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 			sink->stop();
 		}
 
-		m_basebandSampleSinks.remove(sink);
+		m_reportMutex.lock();
+		int index = 0;
+
+		for (BasebandSampleSinks::iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it, index++)
+		{
+			if (*it == sink)
+			{
+				m_basebandSampleSinks.erase(it);
+				m_directSinkProfiles.erase(m_directSinkProfiles.begin() + index);
+				m_pendingDirectSinkProfiles.erase(m_pendingDirectSinkProfiles.begin() + index);
+				break;
+			}
+		}
+
+		m_reportMutex.unlock();
 	}
 	else if (DSPAddThreadedBasebandSampleSink::match(*message))
 	{
 		ThreadedBasebandSampleSink *threadedSink = ((DSPAddThreadedBasebandSampleSink*) message)->getThreadedSampleSink();
+		m_reportMutex.lock();
 		m_threadedBasebandSampleSinks.push_back(threadedSink);
+		m_reportMutex.unlock();
+		threadedSink->setFloat(m_floatBaseband);
 		// initialize sample rate and center frequency in the sink:
 		DSPSignalNotification msg(m_sampleRate, m_centerFrequency);
 		threadedSink->handleSinkMessage(msg);
@@ -676,7 +930,9 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 	{
 		ThreadedBasebandSampleSink* threadedSink = ((DSPRemoveThreadedBasebandSampleSink*) message)->getThreadedSampleSink();
 		threadedSink->stop();
+		m_reportMutex.lock();
 		m_threadedBasebandSampleSinks.remove(threadedSink);
+		m_reportMutex.unlock();
 	}
 
 	m_syncMessenger.done(m_state);
@@ -684,6 +940,12 @@ void DSPDeviceSourceEngine::handleSynchronousMessages()
 
 void DSPDeviceSourceEngine::handleInputMessages()
 {
+	static const MessageDispatcher<DSPDeviceSourceEngine> dispatcher = MessageDispatcher<DSPDeviceSourceEngine>()
+		.add<DSPConfigureCorrection>(&DSPDeviceSourceEngine::handleConfigureCorrection)
+		.add<DSPConfigureFloatBaseband>(&DSPDeviceSourceEngine::handleConfigureFloatBaseband)
+		.add<DSPSignalNotification>(&DSPDeviceSourceEngine::handleSignalNotification)
+		.add<DSPRecordAnnotation>(&DSPDeviceSourceEngine::handleRecordAnnotation);
+
 	qDebug() << "DSPDeviceSourceEngine::handleInputMessages";
 
 	Message* message;
@@ -691,76 +953,103 @@ void DSPDeviceSourceEngine::handleInputMessages()
 	while ((message = m_inputMessageQueue.pop()) != 0)
 	{
 		qDebug("DSPDeviceSourceEngine::handleInputMessages: message: %s", message->getIdentifier());
+		dispatcher.dispatch(this, *message);
+		delete message;
+	}
+}
 
-		if (DSPConfigureCorrection::match(*message))
-		{
-			DSPConfigureCorrection* conf = (DSPConfigureCorrection*) message;
-			m_iqImbalanceCorrection = conf->getIQImbalanceCorrection();
+bool DSPDeviceSourceEngine::handleConfigureCorrection(const Message& message)
+{
+	const DSPConfigureCorrection& conf = (const DSPConfigureCorrection&) message;
+	m_iqImbalanceCorrection = conf.getIQImbalanceCorrection();
 
-			if(m_dcOffsetCorrection != conf->getDCOffsetCorrection())
-			{
-				m_dcOffsetCorrection = conf->getDCOffsetCorrection();
-				m_iOffset = 0;
-				m_qOffset = 0;
-			}
+	if(m_dcOffsetCorrection != conf.getDCOffsetCorrection())
+	{
+		m_dcOffsetCorrection = conf.getDCOffsetCorrection();
+		m_iOffset = 0;
+		m_qOffset = 0;
+	}
 
-			if(m_iqImbalanceCorrection != conf->getIQImbalanceCorrection())
-			{
-				m_iqImbalanceCorrection = conf->getIQImbalanceCorrection();
-				m_iRange = 1 << 16;
-				m_qRange = 1 << 16;
-				m_imbalance = 65536;
-			}
+	if(m_iqImbalanceCorrection != conf.getIQImbalanceCorrection())
+	{
+		m_iqImbalanceCorrection = conf.getIQImbalanceCorrection();
+		m_iRange = 1 << 16;
+		m_qRange = 1 << 16;
+		m_imbalance = 65536;
+	}
 
-			m_avgAmp.reset();
-			m_avgII.reset();
-			m_avgII2.reset();
-			m_avgIQ.reset();
-			m_avgPhi.reset();
-			m_avgQQ2.reset();
-			m_iBeta.reset();
-			m_qBeta.reset();
+	m_avgAmp.reset();
+	m_avgII.reset();
+	m_avgII2.reset();
+	m_avgIQ.reset();
+	m_avgPhi.reset();
+	m_avgQQ2.reset();
+	m_iBeta.reset();
+	m_qBeta.reset();
+	m_iBetaF.reset();
+	m_qBetaF.reset();
+
+	return true;
+}
 
-			delete message;
-		}
-		else if (DSPSignalNotification::match(*message))
-		{
-			DSPSignalNotification *notif = (DSPSignalNotification *) message;
+bool DSPDeviceSourceEngine::handleConfigureFloatBaseband(const Message& message)
+{
+	const DSPConfigureFloatBaseband& conf = (const DSPConfigureFloatBaseband&) message;
 
-			// update DSP values
+	if (m_floatBaseband != conf.getFloatBaseband())
+	{
+		m_floatBaseband = conf.getFloatBaseband();
+		m_iBetaF.reset();
+		m_qBetaF.reset();
+		applyFloatBaseband();
+	}
 
-			m_sampleRate = notif->getSampleRate();
-			m_centerFrequency = notif->getCenterFrequency();
+	return true;
+}
 
-			qDebug() << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification(" << m_sampleRate << "," << m_centerFrequency << ")";
+bool DSPDeviceSourceEngine::handleSignalNotification(const Message& message)
+{
+	const DSPSignalNotification& notif = (const DSPSignalNotification&) message;
 
-			// forward source changes to channel sinks with immediate execution (no queuing)
+	// update DSP values
 
-			for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
-			{
-				qDebug() << "DSPDeviceSourceEngine::handleInputMessages: forward message to " << (*it)->objectName().toStdString().c_str();
-				(*it)->handleMessage(*message);
-			}
+	m_sampleRate = notif.getSampleRate();
+	m_centerFrequency = notif.getCenterFrequency();
 
-			for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
-			{
-				qDebug() << "DSPDeviceSourceEngine::handleSourceMessages: forward message to ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
-				(*it)->handleSinkMessage(*message);
-			}
+	qDebug() << "DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification(" << m_sampleRate << "," << m_centerFrequency << ")";
+
+	// forward source changes to channel sinks with immediate execution (no queuing)
+
+	for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++)
+	{
+		qDebug() << "DSPDeviceSourceEngine::handleInputMessages: forward message to " << (*it)->objectName().toStdString().c_str();
+		(*it)->handleMessage(message);
+	}
 
-			// forward changes to source GUI input queue
+	for (ThreadedBasebandSampleSinks::const_iterator it = m_threadedBasebandSampleSinks.begin(); it != m_threadedBasebandSampleSinks.end(); ++it)
+	{
+		qDebug() << "DSPDeviceSourceEngine::handleSourceMessages: forward message to ThreadedSampleSink(" << (*it)->getSampleSinkObjectName().toStdString().c_str() << ")";
+		(*it)->handleSinkMessage(message);
+	}
 
-			MessageQueue *guiMessageQueue = m_deviceSampleSource->getMessageQueueToGUI();
-			qDebug("DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification: guiMessageQueue: %p", guiMessageQueue);
+	// forward changes to source GUI input queue
 
-			if (guiMessageQueue) {
-			    DSPSignalNotification* rep = new DSPSignalNotification(*notif); // make a copy for the source GUI
-                m_deviceSampleSource->getMessageQueueToGUI()->push(rep);
-			}
+	MessageQueue *guiMessageQueue = m_deviceSampleSource->getMessageQueueToGUI();
+	qDebug("DSPDeviceSourceEngine::handleInputMessages: DSPSignalNotification: guiMessageQueue: %p", guiMessageQueue);
 
-			//m_outputMessageQueue.push(rep);
+	if (guiMessageQueue) {
+		DSPSignalNotification* rep = new DSPSignalNotification(notif); // make a copy for the source GUI
+		guiMessageQueue->push(rep);
+	}
 
-			delete message;
-		}
+	return true;
+}
+
+bool DSPDeviceSourceEngine::handleRecordAnnotation(const Message& message)
+{
+	for(BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); it++) {
+		(*it)->handleMessage(message);
 	}
+
+	return true;
 }
@@ -22,16 +22,21 @@
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
+#include <QElapsedTimer>
+#include <vector>
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "util/export.h"
 #include "util/movingaverage.h"
+#include "util/threadscheduling.h"
+#include "util/profilehistogram.h"
+#include "threadedbasebandsamplesink.h"
 
 class DeviceSampleSource;
 class BasebandSampleSink;
-class ThreadedBasebandSampleSink;
+class SampleSinkFifo;
 
 class SDRANGEL_API DSPDeviceSourceEngine : public QThread {
 	Q_OBJECT
@@ -70,12 +75,22 @@ public:
 	void removeThreadedSink(ThreadedBasebandSampleSink* sink); //!< Remove a sample sink that runs on its own thread
 
 	void configureCorrections(bool dcOffsetCorrection, bool iqImbalanceCorrection); //!< Configure DSP corrections
+	void configureFloatBaseband(bool floatBaseband); //!< Transfer samples from source to sinks in floating point
 
 	State state() const { return m_state; } //!< Return DSP engine current state
 
 	QString errorMessage(); //!< Return the current error message
 	QString sourceDeviceDescription(); //!< Return the source device description
 
+	uint getSampleRate() const { return m_sampleRate; }               //!< Current baseband sample rate
+	quint64 getCenterFrequency() const { return m_centerFrequency; }  //!< Current center frequency
+	void getBusyCounters(quint64& busyTime, quint64& runningTime, quint64& processedSamples); //!< Times in ns since last start
+	void getThreadedSinksReports(std::vector<ThreadedBasebandSampleSink::Report>& reports);  //!< FIFO and processing counters of threaded sinks
+	void getDirectSinksReports(std::vector<ThreadedBasebandSampleSink::Report>& reports);    //!< processing counters of the sinks fed in the engine thread since last start
+	void getWorkTime(ProfileHistogram& workTime); //!< durations of the transfers from the device FIFO to the sinks since last start
+	void setThreadScheduling(const ThreadSchedulingSettings& settings); //!< Scheduling of the engine thread and of the device threads writing to the FIFO
+	void getThreadSchedulingReport(ThreadSchedulingReport& report);     //!< Scheduling settings, result and counters before and after
+
 private:
 	uint m_uid; //!< unique ID
 
@@ -93,18 +108,51 @@ private:
 	typedef std::list<BasebandSampleSink*> BasebandSampleSinks;
 	BasebandSampleSinks m_basebandSampleSinks; //!< sample sinks within main thread (usually spectrum, file output)
 
+	struct DirectSinkProfile
+	{
+		quint64 m_processedSamples;
+		ProfileHistogram m_feedTime;
+
+		DirectSinkProfile() : m_processedSamples(0) {}
+		void merge(const DirectSinkProfile& other) { m_processedSamples += other.m_processedSamples; m_feedTime.merge(other.m_feedTime); }
+		void reset() { m_processedSamples = 0; m_feedTime.reset(); }
+	};
+
+	typedef std::vector<DirectSinkProfile> DirectSinkProfiles;
+	DirectSinkProfiles m_directSinkProfiles;        //!< same order as m_basebandSampleSinks. Protected by m_reportMutex.
+	DirectSinkProfiles m_pendingDirectSinkProfiles; //!< profiles of the current work() merged at its end
+	QElapsedTimer m_feedTimer;
+
 	typedef std::list<ThreadedBasebandSampleSink*> ThreadedBasebandSampleSinks;
 	ThreadedBasebandSampleSinks m_threadedBasebandSampleSinks; //!< sample sinks on their own threads (usually channels)
 
 	uint m_sampleRate;
 	quint64 m_centerFrequency;
 
+	QMutex m_reportMutex;         //!< Protects counters and sinks lists against report requests
+	QElapsedTimer m_runningTimer; //!< Started when going to the running state
+	QElapsedTimer m_workTimer;
+	quint64 m_busyTime;           //!< Time spent in work() since last start (ns)
+	quint64 m_processedSamples;   //!< Samples transferred to sinks since last start
+	ProfileHistogram m_workTime;  //!< Durations of work() calls that transferred samples since last start
+
+	ThreadSchedulingSettings m_threadScheduling;    //!< protected by m_reportMutex
+	ThreadSchedulingHook m_engineScheduling;        //!< applied in work()
+	ThreadSchedulingCounters m_schedulingCounters;  //!< since the scheduling settings were last applied
+	ThreadSchedulingCounters m_previousSchedulingCounters;
+	QElapsedTimer m_schedulingTimer;
+	quint64 m_overflowCountBase;                    //!< device FIFO counters when the current counters were reset
+	quint64 m_droppedSamplesBase;
+
 	bool m_dcOffsetCorrection;
 	bool m_iqImbalanceCorrection;
+	bool m_floatBaseband;
 	double m_iOffset, m_qOffset;
 
 	MovingAverageUtil<int32_t, int64_t, 1024> m_iBeta;
     MovingAverageUtil<int32_t, int64_t, 1024> m_qBeta;
+    MovingAverageUtil<float, double, 1024> m_iBetaF; //!< DC of floating point baseband
+    MovingAverageUtil<float, double, 1024> m_qBetaF;
 
 #if IMBALANCE_INT
     // Fixed point DC + IQ corrections
@@ -132,9 +180,16 @@ private:
 	void run();
 
 	void iqCorrections(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection);
+	void iqCorrections(FSampleVector::iterator begin, FSampleVector::iterator end, bool imbalanceCorrection);
 	void dcOffset(SampleVector::iterator begin, SampleVector::iterator end);
 	void imbalance(SampleVector::iterator begin, SampleVector::iterator end);
 	void work(); //!< transfer samples from source to sinks if in running state
+	template<typename Vector> std::size_t transfer(SampleSinkFifo* sampleFifo); //!< one FIFO read in its storage format
+	void feedSinks(SampleVector::const_iterator begin, SampleVector::const_iterator end, bool positiveOnly);
+	void feedSinks(FSampleVector::const_iterator begin, FSampleVector::const_iterator end, bool positiveOnly);
+	void applyFloatBaseband(); //!< set the baseband format of the source FIFO and threaded sinks
+	void fetchSchedulingCounters(ThreadSchedulingCounters& counters); //!< current counters with device FIFO deltas. m_reportMutex must be held.
+	void resetSchedulingCounters(); //!< m_reportMutex must be held
 
 	State gotoIdle();     //!< Go to the idle state
 	State gotoInit();     //!< Go to the acquisition init state from idle
@@ -143,6 +198,12 @@ private:
 
 	void handleSetSource(DeviceSampleSource* source); //!< Manage source setting
 
+	// input messages handlers
+	bool handleConfigureCorrection(const Message& message);
+	bool handleConfigureFloatBaseband(const Message& message);
+	bool handleSignalNotification(const Message& message);
+	bool handleRecordAnnotation(const Message& message);
+
 private slots:
 	void handleData(); //!< Handle data when samples from source FIFO are ready to be processed
 	void handleInputMessages(); //!< Handle input message queue
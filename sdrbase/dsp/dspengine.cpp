@@ -21,6 +21,7 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "dsp/dspexecutor.h"
 
 
 DSPEngine::DSPEngine() :
@@ -29,7 +30,8 @@ DSPEngine::DSPEngine() :
 	m_audioOutputSampleRate(48000), // Use default output device at 48 kHz
     m_audioInputSampleRate(48000),  // Use default input device at 48 kHz
     m_audioInputDeviceIndex(-1),    // default device
-    m_audioOutputDeviceIndex(-1)    // default device
+    m_audioOutputDeviceIndex(-1),   // default device
+    m_executor(0)
 {
 	m_dvSerialSupport = false;
     m_masterTimer.start(50);
@@ -47,6 +49,8 @@ DSPEngine::~DSPEngine()
         delete *it;
         ++it;
     }
+
+    delete m_executor;
 }
 
 Q_GLOBAL_STATIC(DSPEngine, dspEngine)
@@ -55,6 +59,18 @@ DSPEngine *DSPEngine::instance()
 	return dspEngine;
 }
 
+void DSPEngine::setDSPThreadPool(bool use, int nbThreads)
+{
+    if (use && !m_executor)
+    {
+        m_executor = new DSPExecutor(nbThreads);
+    }
+    else if (!use && m_executor)
+    {
+        qDebug("DSPEngine::setDSPThreadPool: the DSP thread pool is used until the application is restarted");
+    }
+}
+
 DSPDeviceSourceEngine *DSPEngine::addDeviceSourceEngine()
 {
     m_deviceSourceEngines.push_back(new DSPDeviceSourceEngine(m_deviceSourceEnginesUIDSequence));
@@ -147,6 +163,11 @@ void DSPEngine::removeAudioSink(AudioFifo* audioFifo)
 	m_audioOutput.removeFifo(audioFifo);
 }
 
+void DSPEngine::flushAudioSinks()
+{
+	m_audioOutput.flushFifos();
+}
+
 void DSPEngine::addAudioSource(AudioFifo* audioFifo)
 {
     qDebug("DSPEngine::addAudioSource");
@@ -31,6 +31,7 @@
 
 class DSPDeviceSourceEngine;
 class DSPDeviceSinkEngine;
+class DSPExecutor;
 
 class SDRANGEL_API DSPEngine : public QObject {
 	Q_OBJECT
@@ -69,6 +70,8 @@ public:
 
     void addAudioSink(AudioFifo* audioFifo); //!< Add the audio sink
 	void removeAudioSink(AudioFifo* audioFifo); //!< Remove the audio sink
+	void flushAudioSinks(); //!< Discard the audio of all sinks when no audio output is started
+	void getAudioOutputCounters(AudioOutput::Counters& counters) { m_audioOutput.getCounters(counters); }
 
 	void addAudioSource(AudioFifo* audioFifo); //!< Add an audio source
     void removeAudioSource(AudioFifo* audioFifo); //!< Remove an audio source
@@ -88,6 +91,14 @@ public:
 
     const QTimer& getMasterTimer() const { return m_masterTimer; }
 
+    /**
+     * Run the channels created from now on in a shared pool of nbThreads threads (0: number of CPU cores)
+     * instead of one thread each. The pool cannot be removed once channels use it: disabling it takes
+     * effect at the next start.
+     */
+    void setDSPThreadPool(bool use, int nbThreads = 0);
+    DSPExecutor *getExecutor() { return m_executor; } //!< null when channels run in their own thread
+
 private:
 	std::vector<DSPDeviceSourceEngine*> m_deviceSourceEngines;
 	uint m_deviceSourceEnginesUIDSequence;
@@ -101,6 +112,7 @@ private:
     int m_audioOutputDeviceIndex;
     QTimer m_masterTimer;
 	bool m_dvSerialSupport;
+	DSPExecutor *m_executor;
 #ifdef DSD_USE_SERIALDV
 	DVSerialEngine m_dvSerialEngine;
 #endif
@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <QAbstractEventDispatcher>
+#include <QEventLoop>
+#include <QDebug>
+
+#include "dsp/dspexecutor.h"
+
+DSPExecutor::Strand::Strand(DSPExecutor *executor) :
+    m_executor(executor),
+    m_homeIndex(executor->allocateHomeIndex()),
+    m_enabled(1),
+    m_pending(0),
+    m_queuedTime(0)
+{
+}
+
+DSPExecutor::Strand::~Strand()
+{
+    setEnabled(false);
+}
+
+QThread *DSPExecutor::Strand::getHomeThread()
+{
+    return m_executor->m_workers[m_homeIndex];
+}
+
+void DSPExecutor::Strand::schedule()
+{
+    if (m_enabled.loadAcquire() == 0) {
+        return;
+    }
+
+    // only the first call queues the strand, the others are served by the same run
+    if (m_pending.fetchAndAddOrdered(1) == 0) {
+        m_executor->submit(this);
+    }
+}
+
+void DSPExecutor::Strand::setEnabled(bool enabled)
+{
+    m_enabled.storeRelease(enabled ? 1 : 0);
+
+    if (!enabled)
+    {
+        while (m_pending.loadAcquire() != 0) {
+            QThread::usleep(100);
+        }
+    }
+}
+
+void DSPExecutor::Strand::run()
+{
+    static const int maxLoops = 4;
+    int pending = m_pending.loadAcquire();
+
+    for (int loop = 0;; loop++)
+    {
+        m_mutex.lock();
+        process();
+        m_mutex.unlock();
+
+        if (m_pending.testAndSetOrdered(pending, 0)) { // nothing scheduled meanwhile
+            return;
+        }
+
+        pending = m_pending.loadAcquire();
+
+        // Scheduled again while processing. Continue but requeue from time to time so that a
+        // busy channel does not hold the thread. m_pending stays above 0 so nobody else queues it.
+        if (loop == maxLoops)
+        {
+            m_executor->submit(this);
+            return;
+        }
+    }
+}
+
+DSPExecutor::Worker::Worker(DSPExecutor *executor, int index) :
+    m_idle(0),
+    m_nbRuns(0),
+    m_nbSteals(0),
+    m_latencySum(0),
+    m_latencyMax(0),
+    m_executor(executor),
+    m_index(index)
+{
+    setObjectName(QString("DSPExecutor%1").arg(index));
+}
+
+void DSPExecutor::Worker::run()
+{
+    QAbstractEventDispatcher *dispatcher = QAbstractEventDispatcher::instance();
+
+    while (m_executor->m_running.loadAcquire())
+    {
+        Strand *strand = m_executor->take(m_index);
+
+        if (strand)
+        {
+            strand->run();
+            dispatcher->processEvents(QEventLoop::AllEvents); // messages of the objects living here
+            continue;
+        }
+
+        // a strand queued before the idle flag was seen would not wake this thread up
+        m_idle.fetchAndStoreOrdered(1);
+
+        if (!m_executor->hasWork()) {
+            dispatcher->processEvents(QEventLoop::WaitForMoreEvents);
+        }
+
+        m_idle.fetchAndStoreOrdered(0);
+    }
+}
+
+DSPExecutor::DSPExecutor(int nbThreads) :
+    m_running(1),
+    m_nextHomeIndex(0)
+{
+    if (nbThreads <= 0) {
+        nbThreads = QThread::idealThreadCount();
+    }
+
+    if (nbThreads <= 0) {
+        nbThreads = 1;
+    }
+
+    m_time.start();
+
+    for (int i = 0; i < nbThreads; i++) {
+        m_workers.push_back(new Worker(this, i));
+    }
+
+    for (int i = 0; i < nbThreads; i++) {
+        m_workers[i]->start();
+    }
+
+    qDebug("DSPExecutor::DSPExecutor: %d threads", nbThreads);
+}
+
+DSPExecutor::~DSPExecutor()
+{
+    m_running.storeRelease(0);
+
+    for (unsigned int i = 0; i < m_workers.size(); i++)
+    {
+        QAbstractEventDispatcher *dispatcher = m_workers[i]->eventDispatcher();
+
+        if (dispatcher) {
+            dispatcher->wakeUp();
+        }
+
+        m_workers[i]->wait();
+        delete m_workers[i];
+    }
+}
+
+int DSPExecutor::allocateHomeIndex()
+{
+    return m_nextHomeIndex.fetchAndAddRelaxed(1) % m_workers.size();
+}
+
+QThread *DSPExecutor::allocateThread()
+{
+    return m_workers[allocateHomeIndex()];
+}
+
+void DSPExecutor::submit(Strand *strand)
+{
+    Worker *home = m_workers[strand->m_homeIndex];
+
+    home->m_queueMutex.lock();
+    strand->m_queuedTime = m_time.nsecsElapsed();
+    home->m_queue.push_back(strand);
+    home->m_queueMutex.unlock();
+
+    Worker *wake = 0;
+
+    if (home->m_idle.fetchAndAddOrdered(0))
+    {
+        wake = home;
+    }
+    else // home thread busy: let an idle one steal the strand
+    {
+        for (unsigned int i = 0; i < m_workers.size(); i++)
+        {
+            if (m_workers[i]->m_idle.fetchAndAddOrdered(0))
+            {
+                wake = m_workers[i];
+                break;
+            }
+        }
+    }
+
+    if (wake)
+    {
+        QAbstractEventDispatcher *dispatcher = wake->eventDispatcher();
+
+        if (dispatcher) {
+            dispatcher->wakeUp();
+        }
+    }
+}
+
+DSPExecutor::Strand *DSPExecutor::take(int index)
+{
+    Worker *worker = m_workers[index];
+    Strand *strand = 0;
+    bool stolen = false;
+
+    // own queue first in order, then the most recently queued strand of the others
+    worker->m_queueMutex.lock();
+
+    if (!worker->m_queue.empty())
+    {
+        strand = worker->m_queue.front();
+        worker->m_queue.pop_front();
+    }
+
+    worker->m_queueMutex.unlock();
+
+    for (unsigned int i = 1; !strand && (i < m_workers.size()); i++)
+    {
+        Worker *victim = m_workers[(index + i) % m_workers.size()];
+        victim->m_queueMutex.lock();
+
+        if (!victim->m_queue.empty())
+        {
+            strand = victim->m_queue.back();
+            victim->m_queue.pop_back();
+            stolen = true;
+        }
+
+        victim->m_queueMutex.unlock();
+    }
+
+    if (strand)
+    {
+        quint64 latency = m_time.nsecsElapsed() - strand->m_queuedTime;
+        worker->m_queueMutex.lock();
+        worker->m_nbRuns++;
+        worker->m_nbSteals += stolen ? 1 : 0;
+        worker->m_latencySum += latency;
+        worker->m_latencyMax = std::max(worker->m_latencyMax, latency);
+        worker->m_queueMutex.unlock();
+    }
+
+    return strand;
+}
+
+bool DSPExecutor::hasWork()
+{
+    for (unsigned int i = 0; i < m_workers.size(); i++)
+    {
+        QMutexLocker locker(&m_workers[i]->m_queueMutex);
+
+        if (!m_workers[i]->m_queue.empty()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void DSPExecutor::getStats(Stats& stats)
+{
+    stats.m_nbThreads = m_workers.size();
+    stats.m_nbRuns = 0;
+    stats.m_nbSteals = 0;
+    stats.m_latencySum = 0;
+    stats.m_latencyMax = 0;
+
+    for (unsigned int i = 0; i < m_workers.size(); i++)
+    {
+        QMutexLocker locker(&m_workers[i]->m_queueMutex);
+        stats.m_nbRuns += m_workers[i]->m_nbRuns;
+        stats.m_nbSteals += m_workers[i]->m_nbSteals;
+        stats.m_latencySum += m_workers[i]->m_latencySum;
+        stats.m_latencyMax = std::max(stats.m_latencyMax, m_workers[i]->m_latencyMax);
+    }
+}
@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_DSP_DSPEXECUTOR_H_
+#define SDRBASE_DSP_DSPEXECUTOR_H_
+
+#include <deque>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+
+#include "util/export.h"
+
+/**
+ * Fixed pool of DSP threads shared by the channels of all device sets, used instead of
+ * one thread per channel.
+ *
+ * The work of a channel is a Strand. Scheduling a strand queues it on its home thread.
+ * A thread with nothing to do steals strands from the others. A strand is processed by
+ * one thread at a time and is queued at most once so the processing of a channel stays
+ * serial and in order whatever the thread that runs it.
+ *
+ * Each thread also runs a Qt event loop so that the objects of the channels (QObjects
+ * with message queues and timers) live in the home thread of their strand.
+ */
+class SDRANGEL_API DSPExecutor
+{
+public:
+    class SDRANGEL_API Strand
+    {
+    public:
+        Strand(DSPExecutor *executor);
+        virtual ~Strand(); //!< the owner must disable the strand before: process() cannot run once the derived class is gone
+
+        void schedule();  //!< process() will run after this call. Thread safe, does not wait.
+        void setEnabled(bool enabled); //!< disabling waits for the current processing to complete
+        QMutex *getMutex() { return &m_mutex; } //!< held by the thread running process()
+        QThread *getHomeThread();
+
+    protected:
+        virtual void process() = 0;
+
+    private:
+        friend class DSPExecutor;
+
+        DSPExecutor *m_executor;
+        int m_homeIndex;
+        QAtomicInt m_enabled;
+        QAtomicInt m_pending;  //!< number of schedule() calls not yet served. 0 when not queued.
+        qint64 m_queuedTime;   //!< ns, executor time when queued
+        QMutex m_mutex;
+
+        void run();
+    };
+
+    struct Stats
+    {
+        int m_nbThreads;
+        quint64 m_nbRuns;       //!< strands run
+        quint64 m_nbSteals;     //!< strands run by another thread than their home thread
+        quint64 m_latencySum;   //!< ns, sum of the delays between queuing and running
+        quint64 m_latencyMax;   //!< ns
+    };
+
+    DSPExecutor(int nbThreads = 0); //!< 0 for the number of CPU cores
+    ~DSPExecutor();
+
+    int getNbThreads() const { return m_workers.size(); }
+    QThread *allocateThread(); //!< thread for objects that are not processed by a strand, in turn
+
+    void getStats(Stats& stats);
+
+private:
+    class Worker : public QThread
+    {
+    public:
+        Worker(DSPExecutor *executor, int index);
+        QMutex m_queueMutex;
+        std::deque<Strand*> m_queue;
+        QAtomicInt m_idle;
+        quint64 m_nbRuns;
+        quint64 m_nbSteals;
+        quint64 m_latencySum;
+        quint64 m_latencyMax;
+
+    protected:
+        virtual void run();
+
+    private:
+        DSPExecutor *m_executor;
+        int m_index;
+    };
+
+    std::vector<Worker*> m_workers;
+    QAtomicInt m_running;
+    QAtomicInt m_nextHomeIndex;
+    QElapsedTimer m_time;
+
+    int allocateHomeIndex();
+    void submit(Strand *strand);
+    Strand *take(int index);
+    bool hasWork();
+};
+
+#endif /* SDRBASE_DSP_DSPEXECUTOR_H_ */
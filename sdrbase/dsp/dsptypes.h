@@ -70,7 +70,37 @@ struct AudioSample {
 };
 #pragma pack(pop)
 
+/**
+ * Floating point baseband sample. Full scale is 1.0 whatever the fixed point sample size.
+ * It has the same accessors as Sample so that loops can be written for both.
+ */
+struct FSample
+{
+	FSample() : m_real(0), m_imag(0) {}
+	FSample(Real real, Real imag) : m_real(real), m_imag(imag) {}
+	explicit FSample(const Sample& s) : m_real(s.m_real / SDR_RX_SCALEF), m_imag(s.m_imag / SDR_RX_SCALEF) {}
+
+	inline void setReal(Real v) { m_real = v; }
+	inline void setImag(Real v) { m_imag = v; }
+
+	inline Real real() const { return m_real; }
+	inline Real imag() const { return m_imag; }
+
+	/** conversion to fixed point with clipping */
+	inline Sample toSample() const { return Sample(clip(m_real), clip(m_imag)); }
+
+	static inline FixReal clip(Real v)
+	{
+		v *= SDR_RX_SCALEF;
+		return v >= SDR_RX_SCALEF - 1.0f ? (FixReal) (SDR_RX_SCALEF - 1.0f) : v <= -SDR_RX_SCALEF ? (FixReal) -SDR_RX_SCALEF : (FixReal) v;
+	}
+
+	Real m_real;
+	Real m_imag;
+};
+
 typedef std::vector<Sample> SampleVector;
+typedef std::vector<FSample> FSampleVector;
 typedef std::vector<AudioSample> AudioVector;
 
 #endif // INCLUDE_DSPTYPES_H
@@ -3,8 +3,46 @@
 #include "util/simpleserializer.h"
 #include "util/message.h"
 
+#include <QDateTime>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QGlobalStatic>
 #include <QDebug>
 
+namespace {
+
+/** Writes the SigMF meta files out of the DSP thread one at a time so that they are written in order */
+class SigMFMetaWriter : public QThreadPool
+{
+public:
+    SigMFMetaWriter() { setMaxThreadCount(1); }
+};
+
+/** A copy of the meta data: later changes by the recorder do not affect the pending write */
+class SigMFMetaWriteTask : public QRunnable
+{
+public:
+    SigMFMetaWriteTask(const SigMFMeta& meta, const QString& fileName) :
+        m_meta(meta),
+        m_fileName(fileName)
+    {}
+
+    virtual void run()
+    {
+        m_meta.write(m_fileName); // reports its errors
+    }
+
+private:
+    SigMFMeta m_meta;
+    QString m_fileName;
+};
+
+} // namespace
+
+Q_GLOBAL_STATIC(SigMFMetaWriter, sigMFMetaWriter)
+
+FileRecord::RecordFormat FileRecord::m_defaultRecordFormat = FileRecord::FormatSDRiq;
+
 FileRecord::FileRecord() :
 	BasebandSampleSink(),
     m_fileName(std::string("test.sdriq")),
@@ -12,7 +50,11 @@ FileRecord::FileRecord() :
     m_centerFrequency(0),
 	m_recordOn(false),
     m_recordStart(false),
-    m_byteCount(0)
+    m_byteCount(0),
+    m_recordFormat(FormatSDRiq),
+    m_sigMFSetIndex(0),
+    m_sampleCount(0),
+    m_lastCaptureMs(0)
 {
 	setObjectName("FileSink");
 }
@@ -24,7 +66,11 @@ FileRecord::FileRecord(const std::string& filename) :
     m_centerFrequency(0),
     m_recordOn(false),
     m_recordStart(false),
-    m_byteCount(0)
+    m_byteCount(0),
+    m_recordFormat(FormatSDRiq),
+    m_sigMFSetIndex(0),
+    m_sampleCount(0),
+    m_lastCaptureMs(0)
 {
     setObjectName("FileRecord");
 }
@@ -52,10 +98,27 @@ void FileRecord::feed(const SampleVector::const_iterator& begin, const SampleVec
     {
         if (m_recordStart)
         {
-            writeHeader();
+            if (m_recordFormat == FormatSigMF) {
+                startSigMF();
+            } else {
+                writeHeader();
+            }
+
             m_recordStart = false;
         }
 
+        if (m_recordFormat == FormatSigMF)
+        {
+            qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+            m_sigMFIndex.update(m_sampleCount, nowMs);
+
+            if (nowMs - m_lastCaptureMs >= m_capturePeriodMs) {
+                addSigMFCapture(nowMs);
+            }
+
+            m_sampleCount += end - begin;
+        }
+
         m_sampleFile.write(reinterpret_cast<const char*>(&*(begin)), (end - begin)*sizeof(Sample));
         m_byteCount += end - begin;
     }
@@ -75,10 +138,20 @@ void FileRecord::startRecording()
     if (!m_sampleFile.is_open())
     {
     	qDebug() << "FileRecord::startRecording";
-        m_sampleFile.open(m_fileName.c_str(), std::ios::binary);
-        m_recordOn = true;
-        m_recordStart = true;
+        m_recordFormat = m_defaultRecordFormat;
         m_byteCount = 0;
+
+        if (m_recordFormat == FormatSigMF)
+        {
+            m_sigMFSetIndex = 0;
+            openSigMF();
+        }
+        else
+        {
+            m_sampleFile.open(m_fileName.c_str(), std::ios::binary);
+            m_recordOn = true;
+            m_recordStart = true;
+        }
     }
 }
 
@@ -87,6 +160,13 @@ void FileRecord::stopRecording()
     if (m_sampleFile.is_open())
     {
     	qDebug() << "FileRecord::stopRecording";
+
+        if (m_recordFormat == FormatSigMF)
+        {
+            closeSigMF();
+            sigMFMetaWriter->waitForDone(); // the recording can be played at once
+        }
+
         m_sampleFile.close();
         m_recordOn = false;
         m_recordStart = false;
@@ -98,12 +178,47 @@ bool FileRecord::handleMessage(const Message& message)
 	if (DSPSignalNotification::match(message))
 	{
 		DSPSignalNotification& notif = (DSPSignalNotification&) message;
+		bool sampleRateChange = notif.getSampleRate() != m_sampleRate;
+		bool centerFrequencyChange = (quint64) notif.getCenterFrequency() != m_centerFrequency;
 		m_sampleRate = notif.getSampleRate();
 		m_centerFrequency = notif.getCenterFrequency();
 		qDebug() << "FileRecord::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_sampleRate
 				<< " m_centerFrequency: " << m_centerFrequency;
+
+		if (m_recordOn && (m_recordFormat == FormatSigMF) && !m_recordStart)
+		{
+		    if (sampleRateChange) // the sample rate is global in SigMF: continue in a new set of files
+		    {
+		        closeSigMF();
+		        m_sampleFile.close();
+		        m_sigMFSetIndex++;
+		        openSigMF();
+		    }
+		    else if (centerFrequencyChange)
+		    {
+		        addSigMFCapture(QDateTime::currentMSecsSinceEpoch());
+		    }
+		}
+
 		return true;
 	}
+	else if (DSPRecordAnnotation::match(message))
+	{
+	    DSPRecordAnnotation& annotation = (DSPRecordAnnotation&) message;
+
+	    if (m_recordOn && (m_recordFormat == FormatSigMF) && !m_recordStart)
+	    {
+	        SigMFMeta::Annotation a;
+	        a.m_sampleStart = m_sampleCount;
+	        a.m_sampleCount = 0;
+	        a.m_label = annotation.getLabel();
+	        a.m_comment = annotation.getComment();
+	        m_sigMFMeta.m_annotations.append(a);
+	        writeSigMFMeta();
+	    }
+
+	    return true;
+	}
     else
     {
         return false;
@@ -122,12 +237,20 @@ void FileRecord::handleConfigure(const std::string& fileName)
 
 void FileRecord::writeHeader()
 {
-    m_sampleFile.write((const char *) &m_sampleRate, sizeof(qint32));         // 4 bytes
-    m_sampleFile.write((const char *) &m_centerFrequency, sizeof(quint64));   // 8 bytes
-    std::time_t ts = time(0);
-    m_sampleFile.write((const char *) &ts, sizeof(std::time_t));              // 8 bytes
-    quint32 sampleSize = SDR_RX_SAMP_SZ;
-    m_sampleFile.write((const char *) &sampleSize, sizeof(int));              // 4 bytes
+    Header header;
+    header.sampleRate = m_sampleRate;
+    header.centerFrequency = m_centerFrequency;
+    header.startTimeStamp = time(0);
+    header.sampleSize = SDR_RX_SAMP_SZ;
+    writeHeader(m_sampleFile, header);
+}
+
+void FileRecord::writeHeader(std::ofstream& sampleFile, const Header& header)
+{
+    sampleFile.write((const char *) &(header.sampleRate), sizeof(qint32));          // 4 bytes
+    sampleFile.write((const char *) &(header.centerFrequency), sizeof(quint64));    // 8 bytes
+    sampleFile.write((const char *) &(header.startTimeStamp), sizeof(std::time_t)); // 8 bytes
+    sampleFile.write((const char *) &(header.sampleSize), sizeof(quint32));         // 4 bytes
 }
 
 void FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
@@ -140,3 +263,66 @@ void FileRecord::readHeader(std::ifstream& sampleFile, Header& header)
     	header.sampleSize = 16;
     }
 }
+
+QString FileRecord::getSigMFBaseName() const
+{
+    QString baseName = SigMFMeta::getBaseName(QString::fromStdString(m_fileName));
+
+    if (m_sigMFSetIndex > 0) {
+        baseName += QString("_%1").arg(m_sigMFSetIndex);
+    }
+
+    return baseName;
+}
+
+void FileRecord::openSigMF()
+{
+    // meta and index are created with the first samples when the stream parameters are known
+    QString dataFileName = SigMFMeta::getDataFileName(getSigMFBaseName());
+    m_sampleFile.open(dataFileName.toStdString().c_str(), std::ios::binary);
+    m_recordOn = true;
+    m_recordStart = true;
+    qDebug("FileRecord::openSigMF: %s", qPrintable(dataFileName));
+}
+
+void FileRecord::startSigMF()
+{
+    QString baseName = getSigMFBaseName();
+    qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+
+    m_sigMFMeta = SigMFMeta();
+    m_sigMFMeta.m_format = SampleFormat::getNativeFormat();
+    m_sigMFMeta.m_sampleRate = m_sampleRate;
+    m_sampleCount = 0;
+    addSigMFCapture(nowMs); // writes the meta file
+
+    if (!m_sigMFIndex.create(SigMFMeta::getIndexFileName(baseName), nowMs, m_indexPeriodMs)) {
+        qWarning("FileRecord::startSigMF: cannot create index of %s", qPrintable(baseName));
+    }
+}
+
+void FileRecord::closeSigMF()
+{
+    if (!m_recordStart) // meta was started
+    {
+        writeSigMFMeta();
+        m_sigMFIndex.close();
+    }
+}
+
+void FileRecord::addSigMFCapture(qint64 nowMs)
+{
+    SigMFMeta::Capture capture;
+    capture.m_sampleStart = m_sampleCount;
+    capture.m_frequency = m_centerFrequency;
+    capture.m_dateTimeMs = nowMs;
+    m_sigMFMeta.m_captures.append(capture);
+    m_lastCaptureMs = nowMs;
+    writeSigMFMeta();
+}
+
+void FileRecord::writeSigMFMeta()
+{
+    // rewritten at each change so that it is valid if the recording is interrupted
+    sigMFMetaWriter->start(new SigMFMetaWriteTask(m_sigMFMeta, SigMFMeta::getMetaFileName(getSigMFBaseName())));
+}
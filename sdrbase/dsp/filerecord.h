@@ -7,12 +7,28 @@
 #include <fstream>
 
 #include <ctime>
+#include "dsp/sigmf.h"
 #include "util/export.h"
 
 class Message;
 
+/**
+ * Records the baseband to a file. The default .sdriq format is a 24 byte header (Header) followed
+ * by the raw samples. The SigMF format writes the raw samples in <base>.sigmf-data with the
+ * JSON metadata in <base>.sigmf-meta: a capture segment is added at each center frequency change
+ * and every minute with its date and time, and annotations are added by DSPRecordAnnotation
+ * messages. The metadata is rewritten by a background thread at each change and is complete
+ * when stopRecording() returns. A time index is written in <base>.sigmf-idx (see SigMFIndex).
+ * A sample rate change starts a new set of files <base>_<n>. The base name is the file name
+ * without its extension.
+ */
 class SDRANGEL_API FileRecord : public BasebandSampleSink {
 public:
+    typedef enum
+    {
+        FormatSDRiq,
+        FormatSigMF
+    } RecordFormat;
 
     struct Header
     {
@@ -37,8 +53,15 @@ public:
     void startRecording();
     void stopRecording();
     static void readHeader(std::ifstream& samplefile, Header& header);
+    static void writeHeader(std::ofstream& samplefile, const Header& header);
+    static void setDefaultRecordFormat(RecordFormat format) { m_defaultRecordFormat = format; } //!< applies from the next recording
+    static RecordFormat getDefaultRecordFormat() { return m_defaultRecordFormat; }
 
 private:
+    static const int m_indexPeriodMs = 1000;
+    static const int m_capturePeriodMs = 60000;
+    static RecordFormat m_defaultRecordFormat;
+
 	std::string m_fileName;
 	qint32 m_sampleRate;
 	quint64 m_centerFrequency;
@@ -46,9 +69,21 @@ private:
     bool m_recordStart;
     std::ofstream m_sampleFile;
     quint64 m_byteCount;
+    RecordFormat m_recordFormat;    //!< of the current recording
+    int m_sigMFSetIndex;            //!< files set number after sample rate changes
+    quint64 m_sampleCount;          //!< samples in the current SigMF data file
+    qint64 m_lastCaptureMs;
+    SigMFMeta m_sigMFMeta;
+    SigMFIndex m_sigMFIndex;
 
 	void handleConfigure(const std::string& fileName);
     void writeHeader();
+    QString getSigMFBaseName() const;
+    void openSigMF();
+    void startSigMF();
+    void closeSigMF();
+    void addSigMFCapture(qint64 nowMs);
+    void writeSigMFMeta(); //!< queued to the meta writer thread
 };
 
 #endif // INCLUDE_FILESINK_H
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifdef USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "dsp/firfilter.h"
+
+float FIRFilterKernels::symmetricDot(const float *w, const float *halfTaps, int nTaps)
+{
+    int nPairs = nTaps / 2;
+    int i = 0;
+    float acc = 0.0f;
+
+#ifdef USE_SSE2
+    // two accumulators to hide the addition latency
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+
+    for (; i + 8 <= nPairs; i += 8)
+    {
+        __m128 hi0 = _mm_loadu_ps(w + nTaps - 4 - i);
+        __m128 hi1 = _mm_loadu_ps(w + nTaps - 8 - i);
+        hi0 = _mm_shuffle_ps(hi0, hi0, _MM_SHUFFLE(0, 1, 2, 3));
+        hi1 = _mm_shuffle_ps(hi1, hi1, _MM_SHUFFLE(0, 1, 2, 3));
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(w + i), hi0), _mm_loadu_ps(halfTaps + i)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(w + i + 4), hi1), _mm_loadu_ps(halfTaps + i + 4)));
+    }
+
+    for (; i + 4 <= nPairs; i += 4)
+    {
+        __m128 hi = _mm_loadu_ps(w + nTaps - 4 - i);
+        hi = _mm_shuffle_ps(hi, hi, _MM_SHUFFLE(0, 1, 2, 3));
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(w + i), hi), _mm_loadu_ps(halfTaps + i)));
+    }
+
+    sum0 = _mm_add_ps(sum0, sum1);
+    sum0 = _mm_add_ps(sum0, _mm_movehl_ps(sum0, sum0));
+    sum0 = _mm_add_ss(sum0, _mm_shuffle_ps(sum0, sum0, _MM_SHUFFLE(1, 1, 1, 1)));
+    acc = _mm_cvtss_f32(sum0);
+#endif
+
+    for (; i < nPairs; i++) {
+        acc += halfTaps[i] * (w[i] + w[nTaps - 1 - i]);
+    }
+
+    return acc + halfTaps[nPairs] * w[nPairs];
+}
+
+double FIRFilterKernels::symmetricDot(const double *w, const double *halfTaps, int nTaps)
+{
+    int nPairs = nTaps / 2;
+    int i = 0;
+    double acc = 0.0;
+
+#ifdef USE_SSE2
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+
+    for (; i + 4 <= nPairs; i += 4)
+    {
+        __m128d hi0 = _mm_loadu_pd(w + nTaps - 2 - i);
+        __m128d hi1 = _mm_loadu_pd(w + nTaps - 4 - i);
+        hi0 = _mm_shuffle_pd(hi0, hi0, 1);
+        hi1 = _mm_shuffle_pd(hi1, hi1, 1);
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_add_pd(_mm_loadu_pd(w + i), hi0), _mm_loadu_pd(halfTaps + i)));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_add_pd(_mm_loadu_pd(w + i + 2), hi1), _mm_loadu_pd(halfTaps + i + 2)));
+    }
+
+    sum0 = _mm_add_pd(sum0, sum1);
+    sum0 = _mm_add_sd(sum0, _mm_unpackhi_pd(sum0, sum0));
+    acc = _mm_cvtsd_f64(sum0);
+#endif
+
+    for (; i < nPairs; i++) {
+        acc += halfTaps[i] * (w[i] + w[nTaps - 1 - i]);
+    }
+
+    return acc + halfTaps[nPairs] * w[nPairs];
+}
@@ -0,0 +1,295 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Symmetric (linear phase) FIR filter engine for real samples (float or double)
+ *
+ * - The history is mirrored: each sample is written twice, N samples apart, so that
+ *   the last N samples are always contiguous and the tap loop has no wraparound.
+ * - Symmetric taps are folded: the N taps filter costs N/2+1 multiplications.
+ * - The folded dot product is vectorized with SSE for float and double samples (see
+ *   FIRFilterKernels). Other sample types (Complex) use the generic scalar version.
+ * - The block filter() switches to FFT overlap-save for long filters and Real samples.
+ *   Samples are processed in place of the current block so this adds no delay. The FFT
+ *   engines compute in Real (float) so double samples, used for precision as in UDPSrc,
+ *   always take the direct path.
+ *
+ * Taps are given as the first half of the impulse response, center tap last
+ * (nTaps/2+1 values) like Lowpass, Bandpass and Highpass generate them.
+ */
+
+#ifndef SDRBASE_DSP_FIRFILTER_H_
+#define SDRBASE_DSP_FIRFILTER_H_
+
+#include <vector>
+#include <algorithm>
+#include <complex>
+#include <type_traits>
+
+#include "dsp/dsptypes.h"
+#include "dsp/fftengine.h"
+#include "util/export.h"
+
+class SDRANGEL_API FIRFilterKernels
+{
+public:
+    /** sum of halfTaps[k]*(w[k]+w[nTaps-1-k]) for k < nTaps/2 plus the center tap term. nTaps is odd. */
+    static float symmetricDot(const float *w, const float *halfTaps, int nTaps);
+    static double symmetricDot(const double *w, const double *halfTaps, int nTaps);
+
+    /** generic scalar version for other sample types e.g. Complex samples with real taps */
+    template <class Type, class TapType>
+    static Type symmetricDot(const Type *w, const TapType *halfTaps, int nTaps)
+    {
+        int nPairs = nTaps / 2;
+        Type acc = w[nPairs] * halfTaps[nPairs];
+
+        for (int i = 0; i < nPairs; i++) {
+            acc += (w[i] + w[nTaps - 1 - i]) * halfTaps[i];
+        }
+
+        return acc;
+    }
+};
+
+/**
+ * Taps are real: complex samples are filtered with taps of their component type.
+ * Overlap-save is used only where the Real precision of the FFT engines is that of the samples.
+ */
+template <class Type> struct FIRFilterTraits
+{
+    typedef Type TapType;
+    static const bool fftBlock = std::is_same<Type, Real>::value;
+};
+
+template <class T> struct FIRFilterTraits<std::complex<T> >
+{
+    typedef T TapType;
+    static const bool fftBlock = false;
+};
+
+template <class Type> class FIRFilter
+{
+public:
+    typedef typename FIRFilterTraits<Type>::TapType TapType;
+
+    static const int m_fftTapsThreshold = 128; //!< overlap-save is used in block mode from this number of taps
+
+    FIRFilter() :
+        m_nTaps(0),
+        m_ptr(0),
+        m_fftSize(0),
+        m_fftFailed(false),
+        m_fftForward(0),
+        m_fftInverse(0)
+    {}
+
+    ~FIRFilter()
+    {
+        delete m_fftForward;
+        delete m_fftInverse;
+    }
+
+    void setTaps(const std::vector<Real>& halfTaps)
+    {
+        m_nTaps = 2*halfTaps.size() - 1;
+        m_taps.resize(halfTaps.size());
+        std::copy(halfTaps.begin(), halfTaps.end(), m_taps.begin());
+        m_history.assign(2*m_nTaps, 0);
+        m_ptr = 0;
+        m_fftSize = 0; // filter spectrum is recomputed at next block
+    }
+
+    int getNbTaps() const { return m_nTaps; }
+
+    Type filter(Type sample)
+    {
+        push(sample);
+        return FIRFilterKernels::symmetricDot(&m_history[m_ptr], &m_taps[0], m_nTaps);
+    }
+
+    /** Filter a block of samples. in and out may be the same buffer. */
+    void filter(const Type *in, Type *out, int nbSamples)
+    {
+        filterBlock(in, out, nbSamples, std::integral_constant<bool, FIRFilterTraits<Type>::fftBlock>());
+    }
+
+private:
+    int m_nTaps;
+    std::vector<TapType> m_taps; //!< first half of the impulse response, center tap last
+    std::vector<Type> m_history; //!< last nTaps samples stored twice
+    int m_ptr;                   //!< oldest sample of the history
+    int m_fftSize;               //!< overlap-save FFT size or 0 if not initialized
+    bool m_fftFailed;            //!< no FFT engine could be created
+    FFTEngine *m_fftForward;
+    FFTEngine *m_fftInverse;
+    std::vector<Complex> m_spectrum; //!< filter frequency response scaled by 1/FFT size
+    std::vector<Type> m_segment;     //!< previous nTaps-1 samples followed by the current samples
+
+    FIRFilter(const FIRFilter&);
+    FIRFilter& operator=(const FIRFilter&);
+
+    void push(Type sample)
+    {
+        m_history[m_ptr] = sample;
+        m_history[m_ptr + m_nTaps] = sample;
+
+        if (++m_ptr == m_nTaps) {
+            m_ptr = 0;
+        }
+    }
+
+    void filterBlock(const Type *in, Type *out, int nbSamples, std::true_type)
+    {
+        if ((m_nTaps >= m_fftTapsThreshold) && (nbSamples >= m_nTaps) && initFFT())
+        {
+            filterFFT(in, out, nbSamples);
+        }
+        else
+        {
+            filterBlock(in, out, nbSamples, std::false_type());
+        }
+    }
+
+    void filterBlock(const Type *in, Type *out, int nbSamples, std::false_type)
+    {
+        for (int i = 0; i < nbSamples; i++) {
+            out[i] = filter(in[i]);
+        }
+    }
+
+    bool initFFT()
+    {
+        if (m_fftSize != 0) {
+            return true;
+        }
+
+        if (m_fftFailed) {
+            return false;
+        }
+
+        if (!m_fftForward)
+        {
+            m_fftForward = FFTEngine::create();
+            m_fftInverse = FFTEngine::create();
+
+            if (!m_fftForward || !m_fftInverse)
+            {
+                delete m_fftForward;
+                delete m_fftInverse;
+                m_fftForward = 0;
+                m_fftInverse = 0;
+                m_fftFailed = true;
+                return false;
+            }
+        }
+
+        // 4 times the filter length rounded to a power of two keeps the overlap below 25%
+        int fftSize = 1;
+
+        while (fftSize < 4*m_nTaps) {
+            fftSize <<= 1;
+        }
+
+        m_fftForward->configure(fftSize, false);
+        m_fftInverse->configure(fftSize, true);
+
+        Complex *fftIn = m_fftForward->in();
+        int half = m_nTaps / 2;
+
+        for (int i = 0; i < fftSize; i++)
+        {
+            if (i < m_nTaps) {
+                fftIn[i] = Complex(m_taps[i <= half ? i : m_nTaps - 1 - i], 0.0f);
+            } else {
+                fftIn[i] = Complex(0.0f, 0.0f);
+            }
+        }
+
+        m_fftForward->transform();
+        m_spectrum.resize(fftSize);
+        std::copy(m_fftForward->out(), m_fftForward->out() + fftSize, m_spectrum.begin());
+
+        for (int i = 0; i < fftSize; i++) {
+            m_spectrum[i] /= (Real) fftSize;
+        }
+
+        m_fftSize = fftSize;
+        return true;
+    }
+
+    /**
+     * Overlap-save. The filter is real so two consecutive segments are filtered in one complex
+     * FFT: the first in the real part and the second in the imaginary part. Only the last
+     * nTaps-1 samples of the previous segment are needed so the output of each block is complete.
+     */
+    void filterFFT(const Type *in, Type *out, int nbSamples)
+    {
+        int overlap = m_nTaps - 1;
+        int step = m_fftSize - overlap; // new samples per segment
+
+        if ((int) m_segment.size() < overlap + nbSamples) {
+            m_segment.resize(overlap + nbSamples);
+        }
+
+        Type *segment = &m_segment[0];
+
+        // previous samples, oldest first
+        std::copy(&m_history[m_ptr + 1], &m_history[m_ptr + m_nTaps], segment);
+        std::copy(in, in + nbSamples, segment + overlap); // in may be out
+
+        for (int done = 0; done < nbSamples; done += 2*step)
+        {
+            int nA = std::min(step, nbSamples - done);
+            int nB = std::min(step, nbSamples - done - nA);
+            const Type *segA = segment + done;
+            const Type *segB = segA + nA;
+            Complex *fftIn = m_fftForward->in();
+
+            for (int i = 0; i < m_fftSize; i++)
+            {
+                fftIn[i] = Complex(i < overlap + nA ? segA[i] : 0, i < overlap + nB ? segB[i] : 0);
+            }
+
+            m_fftForward->transform();
+            Complex *spectrum = m_fftForward->out();
+            Complex *ifftIn = m_fftInverse->in();
+
+            for (int i = 0; i < m_fftSize; i++) {
+                ifftIn[i] = spectrum[i] * m_spectrum[i];
+            }
+
+            m_fftInverse->transform();
+            Complex *result = m_fftInverse->out() + overlap; // first nTaps-1 outputs wrap around
+
+            for (int i = 0; i < nA; i++) {
+                out[done + i] = result[i].real();
+            }
+
+            for (int i = 0; i < nB; i++) {
+                out[done + nA + i] = result[i].imag();
+            }
+        }
+
+        // the history continues with the last samples of the block
+        for (int i = nbSamples - m_nTaps; i < nbSamples; i++) {
+            push(segment[overlap + i]);
+        }
+    }
+};
+
+#endif /* SDRBASE_DSP_FIRFILTER_H_ */
@@ -523,6 +523,46 @@ public:
         }
     }
 
+    // floating point samples (full scale 1.0): the gain is 1 so no bit is gained
+
+    // downsample by 2, return center part of original spectrum
+    bool workDecimateCenter(FSample* sample)
+    {
+        return decimateF(sample, sample->real(), sample->imag(), m_state == 0 ? 1 : 0);
+    }
+
+    // downsample by 2, return lower half of original spectrum
+    bool workDecimateLowerHalf(FSample* sample)
+    {
+        switch(m_state)
+        {
+            case 0:
+                return decimateF(sample, -sample->imag(), sample->real(), 1);
+            case 1:
+                return decimateF(sample, -sample->real(), -sample->imag(), 2);
+            case 2:
+                return decimateF(sample, sample->imag(), -sample->real(), 3);
+            default:
+                return decimateF(sample, sample->real(), sample->imag(), 0);
+        }
+    }
+
+    // downsample by 2, return upper half of original spectrum
+    bool workDecimateUpperHalf(FSample* sample)
+    {
+        switch(m_state)
+        {
+            case 0:
+                return decimateF(sample, sample->imag(), -sample->real(), 1);
+            case 1:
+                return decimateF(sample, -sample->real(), -sample->imag(), 2);
+            case 2:
+                return decimateF(sample, -sample->imag(), sample->real(), 3);
+            default:
+                return decimateF(sample, sample->real(), sample->imag(), 0);
+        }
+    }
+
     void myDecimate(const Sample* sample1, Sample* sample2)
     {
         storeSampleFixReal((FixReal) sample1->real(), (FixReal) sample1->imag());
@@ -601,6 +641,24 @@ protected:
         m_samplesDB[m_ptr + m_size][1] = y;
     }
 
+    /** store the rotated sample and filter on odd states */
+    bool decimateF(FSample* sample, AccuType x, AccuType y, int nextState)
+    {
+        bool output = (m_state & 1) != 0;
+        storeSampleAccu(x, y);
+
+        if (output)
+        {
+            doFIRAccu(&x, &y);
+            sample->setReal(x);
+            sample->setImag(y);
+        }
+
+        advancePointer();
+        m_state = nextState;
+        return output;
+    }
+
     void advancePointer()
     {
         m_ptr = m_ptr + 1 < m_size ? m_ptr + 1: 0;
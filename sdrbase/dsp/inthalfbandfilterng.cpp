@@ -0,0 +1,272 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtGlobal>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HBFILTER_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+#include "dsp/inthalfbandfilterng.h"
+
+namespace {
+
+// plain C: vectorized by the compiler where it can (NEON...)
+void foldGeneric(const int32_t *wI, const int32_t *wQ, const int32_t *coeffs, int nCoeffs, int32_t& iAcc, int32_t& qAcc)
+{
+    const int32_t *tI = wI + 2*nCoeffs - 1;
+    const int32_t *tQ = wQ + 2*nCoeffs - 1;
+    int32_t i = 0;
+    int32_t q = 0;
+
+    for (int k = 0; k < nCoeffs; k++)
+    {
+        i += (wI[k] + tI[-k]) * coeffs[k];
+        q += (wQ[k] + tQ[-k]) * coeffs[k];
+    }
+
+    iAcc = i;
+    qAcc = q;
+}
+
+void foldBlockGeneric(const int32_t *w, const int32_t *coeffs, int nCoeffs, int nOut, int32_t *acc)
+{
+    for (int j = 0; j < nOut; j++) {
+        acc[j] = 0;
+    }
+
+    // coefficient outer loop: consecutive outputs are independent and vectorize
+    for (int k = 0; k < nCoeffs; k++)
+    {
+        const int32_t *a = w + k;
+        const int32_t *b = w + 2*nCoeffs - 1 - k;
+        int32_t c = coeffs[k];
+
+        for (int j = 0; j < nOut; j++) {
+            acc[j] += (a[j] + b[j]) * c;
+        }
+    }
+}
+
+#ifdef HBFILTER_X86_DISPATCH
+
+__attribute__((target("sse4.1")))
+void foldSSE41(const int32_t *wI, const int32_t *wQ, const int32_t *coeffs, int nCoeffs, int32_t& iAcc, int32_t& qAcc)
+{
+    const int32_t *tI = wI + 2*nCoeffs - 4; // tip, read backwards
+    const int32_t *tQ = wQ + 2*nCoeffs - 4;
+    __m128i sumI = _mm_setzero_si128();
+    __m128i sumQ = _mm_setzero_si128();
+
+    for (int k = 0; k < nCoeffs; k += 4)
+    {
+        __m128i h = _mm_loadu_si128((const __m128i*) &coeffs[k]);
+        __m128i aI = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) (tI - k)), _MM_SHUFFLE(0,1,2,3));
+        __m128i aQ = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) (tQ - k)), _MM_SHUFFLE(0,1,2,3));
+        sumI = _mm_add_epi32(sumI, _mm_mullo_epi32(_mm_add_epi32(aI, _mm_loadu_si128((const __m128i*) &wI[k])), h));
+        sumQ = _mm_add_epi32(sumQ, _mm_mullo_epi32(_mm_add_epi32(aQ, _mm_loadu_si128((const __m128i*) &wQ[k])), h));
+    }
+
+    // horizontal add of four 32 bit partial sums
+    sumI = _mm_add_epi32(sumI, _mm_srli_si128(sumI, 8));
+    sumI = _mm_add_epi32(sumI, _mm_srli_si128(sumI, 4));
+    sumQ = _mm_add_epi32(sumQ, _mm_srli_si128(sumQ, 8));
+    sumQ = _mm_add_epi32(sumQ, _mm_srli_si128(sumQ, 4));
+    iAcc = _mm_cvtsi128_si32(sumI);
+    qAcc = _mm_cvtsi128_si32(sumQ);
+}
+
+__attribute__((target("avx2")))
+void foldAVX2(const int32_t *wI, const int32_t *wQ, const int32_t *coeffs, int nCoeffs, int32_t& iAcc, int32_t& qAcc)
+{
+    const int32_t *tI = wI + 2*nCoeffs - 8; // tip, read backwards
+    const int32_t *tQ = wQ + 2*nCoeffs - 8;
+    const __m256i reverse = _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i sumI = _mm256_setzero_si256();
+    __m256i sumQ = _mm256_setzero_si256();
+    int k = 0;
+
+    for (; k + 8 <= nCoeffs; k += 8)
+    {
+        __m256i h = _mm256_loadu_si256((const __m256i*) &coeffs[k]);
+        __m256i aI = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*) (tI - k)), reverse);
+        __m256i aQ = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i*) (tQ - k)), reverse);
+        sumI = _mm256_add_epi32(sumI, _mm256_mullo_epi32(_mm256_add_epi32(aI, _mm256_loadu_si256((const __m256i*) &wI[k])), h));
+        sumQ = _mm256_add_epi32(sumQ, _mm256_mullo_epi32(_mm256_add_epi32(aQ, _mm256_loadu_si256((const __m256i*) &wQ[k])), h));
+    }
+
+    __m128i sumI4 = _mm_add_epi32(_mm256_castsi256_si128(sumI), _mm256_extracti128_si256(sumI, 1));
+    __m128i sumQ4 = _mm_add_epi32(_mm256_castsi256_si128(sumQ), _mm256_extracti128_si256(sumQ, 1));
+
+    if (k < nCoeffs) // remaining 4 coefficients
+    {
+        __m128i h = _mm_loadu_si128((const __m128i*) &coeffs[k]);
+        __m128i aI = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) (tI + 4 - k)), _MM_SHUFFLE(0,1,2,3));
+        __m128i aQ = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) (tQ + 4 - k)), _MM_SHUFFLE(0,1,2,3));
+        sumI4 = _mm_add_epi32(sumI4, _mm_mullo_epi32(_mm_add_epi32(aI, _mm_loadu_si128((const __m128i*) &wI[k])), h));
+        sumQ4 = _mm_add_epi32(sumQ4, _mm_mullo_epi32(_mm_add_epi32(aQ, _mm_loadu_si128((const __m128i*) &wQ[k])), h));
+    }
+
+    sumI4 = _mm_add_epi32(sumI4, _mm_srli_si128(sumI4, 8));
+    sumI4 = _mm_add_epi32(sumI4, _mm_srli_si128(sumI4, 4));
+    sumQ4 = _mm_add_epi32(sumQ4, _mm_srli_si128(sumQ4, 8));
+    sumQ4 = _mm_add_epi32(sumQ4, _mm_srli_si128(sumQ4, 4));
+    iAcc = _mm_cvtsi128_si32(sumI4);
+    qAcc = _mm_cvtsi128_si32(sumQ4);
+}
+
+__attribute__((target("sse4.1")))
+void foldBlockSSE41(const int32_t *w, const int32_t *coeffs, int nCoeffs, int nOut, int32_t *acc)
+{
+    int j = 0;
+
+    for (; j + 4 <= nOut; j += 4) // 4 outputs at a time
+    {
+        const int32_t *a = w + j;
+        const int32_t *b = w + j + 2*nCoeffs - 1;
+        __m128i sum = _mm_setzero_si128();
+
+        for (int k = 0; k < nCoeffs; k++)
+        {
+            __m128i h = _mm_set1_epi32(coeffs[k]);
+            __m128i x = _mm_add_epi32(_mm_loadu_si128((const __m128i*) (a + k)), _mm_loadu_si128((const __m128i*) (b - k)));
+            sum = _mm_add_epi32(sum, _mm_mullo_epi32(x, h));
+        }
+
+        _mm_storeu_si128((__m128i*) &acc[j], sum);
+    }
+
+    if (j < nOut) {
+        foldBlockGeneric(w + j, coeffs, nCoeffs, nOut - j, acc + j);
+    }
+}
+
+__attribute__((target("avx2")))
+void foldBlockAVX2(const int32_t *w, const int32_t *coeffs, int nCoeffs, int nOut, int32_t *acc)
+{
+    int j = 0;
+
+    for (; j + 16 <= nOut; j += 16) // 16 outputs at a time in two independent chains
+    {
+        const int32_t *a = w + j;
+        const int32_t *b = w + j + 2*nCoeffs - 1;
+        __m256i sum0 = _mm256_setzero_si256();
+        __m256i sum1 = _mm256_setzero_si256();
+
+        for (int k = 0; k < nCoeffs; k++)
+        {
+            __m256i h = _mm256_set1_epi32(coeffs[k]);
+            __m256i x0 = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) (a + k)), _mm256_loadu_si256((const __m256i*) (b - k)));
+            __m256i x1 = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) (a + k + 8)), _mm256_loadu_si256((const __m256i*) (b - k + 8)));
+            sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(x0, h));
+            sum1 = _mm256_add_epi32(sum1, _mm256_mullo_epi32(x1, h));
+        }
+
+        _mm256_storeu_si256((__m256i*) &acc[j], sum0);
+        _mm256_storeu_si256((__m256i*) &acc[j + 8], sum1);
+    }
+
+    if (j < nOut) {
+        foldBlockSSE41(w + j, coeffs, nCoeffs, nOut - j, acc + j);
+    }
+}
+
+#endif // HBFILTER_X86_DISPATCH
+
+} // namespace
+
+// the generic kernels are constant initialized so they are valid even before the selection
+HBFilterKernels::Fold32 HBFilterKernels::m_fold = foldGeneric;
+HBFilterKernels::FoldBlock32 HBFilterKernels::m_foldBlock = foldBlockGeneric;
+HBFilterKernels::ISA HBFilterKernels::m_isa = HBFilterKernels::ISAGeneric;
+bool HBFilterKernels::m_isaSelected = HBFilterKernels::selectISA();
+
+bool HBFilterKernels::selectISA()
+{
+    // best kernels for this CPU
+    if (!setISA(ISAAVX2) && !setISA(ISASSE41)) {
+        setISA(ISAGeneric);
+    }
+
+    return true;
+}
+
+bool HBFilterKernels::isSupported(ISA isa)
+{
+    switch (isa)
+    {
+    case ISAGeneric:
+        return true;
+#ifdef HBFILTER_X86_DISPATCH
+    case ISASSE41:
+        __builtin_cpu_init(); // may run before the libgcc constructors
+        return __builtin_cpu_supports("sse4.1");
+    case ISAAVX2:
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+#endif
+    default:
+        return false;
+    }
+}
+
+bool HBFilterKernels::setISA(ISA isa)
+{
+    if (!isSupported(isa)) {
+        return false;
+    }
+
+    switch (isa)
+    {
+#ifdef HBFILTER_X86_DISPATCH
+    case ISASSE41:
+        m_fold = foldSSE41;
+        m_foldBlock = foldBlockSSE41;
+        break;
+    case ISAAVX2:
+        m_fold = foldAVX2;
+        m_foldBlock = foldBlockAVX2;
+        break;
+#endif
+    default:
+        m_fold = foldGeneric;
+        m_foldBlock = foldBlockGeneric;
+        break;
+    }
+
+    m_isa = isa;
+    return true;
+}
+
+HBFilterKernels::ISA HBFilterKernels::getISA()
+{
+    return m_isa;
+}
+
+const char *HBFilterKernels::getISAName(ISA isa)
+{
+    switch (isa)
+    {
+    case ISASSE41:
+        return "SSE4.1";
+    case ISAAVX2:
+        return "AVX2";
+    default:
+        return "generic";
+    }
+}
@@ -0,0 +1,614 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Integer half-band FIR based interpolator and decimator                        //
+// Single engine for all filter orders of hbfiltertraits with the SIMD kernel    //
+// chosen at run time for the CPU                                                //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_INTHALFBANDFILTERNG_H_
+#define SDRBASE_DSP_INTHALFBANDFILTERNG_H_
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+#include "dsp/dsptypes.h"
+#include "dsp/hbfiltertraits.h"
+#include "util/export.h"
+
+/**
+ * Folded dot product of the half-band filters with 32 bit accumulators. The implementation is
+ * selected at static initialization for the instruction set of the CPU so that filters running
+ * in different threads never see it change. It can be forced (benchmarks).
+ * The generic version is plain C that the compiler can vectorize (e.g. NEON on ARM).
+ *
+ * fold computes sum(coeffs[k] * (w[k] + w[2*nCoeffs-1-k])) for k < nCoeffs
+ * for the I and Q windows. nCoeffs is a multiple of 4.
+ * foldBlock computes the same sum for nOut windows starting at w, w+1, ... w+nOut-1
+ * and vectorizes over the outputs.
+ */
+class SDRANGEL_API HBFilterKernels
+{
+public:
+    typedef enum
+    {
+        ISAGeneric,
+        ISASSE41,
+        ISAAVX2
+    } ISA;
+
+    typedef void (*Fold32)(const int32_t *wI, const int32_t *wQ, const int32_t *coeffs, int nCoeffs, int32_t& iAcc, int32_t& qAcc);
+    typedef void (*FoldBlock32)(const int32_t *w, const int32_t *coeffs, int nCoeffs, int nOut, int32_t *acc);
+
+    static void fold(const int32_t *wI, const int32_t *wQ, const int32_t *coeffs, int nCoeffs, int32_t& iAcc, int32_t& qAcc)
+    {
+        m_fold(wI, wQ, coeffs, nCoeffs, iAcc, qAcc);
+    }
+
+    static void foldBlock(const int32_t *w, const int32_t *coeffs, int nCoeffs, int nOut, int32_t *acc)
+    {
+        m_foldBlock(w, coeffs, nCoeffs, nOut, acc);
+    }
+
+    static bool isSupported(ISA isa);
+    static bool setISA(ISA isa); //!< returns false and leaves the current kernel if the CPU does not support it
+    static ISA getISA();
+    static const char *getISAName(ISA isa);
+
+private:
+    static Fold32 m_fold;
+    static FoldBlock32 m_foldBlock;
+    static ISA m_isa;
+    static bool m_isaSelected;
+
+    static bool selectISA();
+};
+
+/** Accumulators wider than 32 bits (24 bit samples) use the generic code */
+template<typename AccuType>
+struct HBFilterFold
+{
+    static void fold(const AccuType *wI, const AccuType *wQ, const int32_t *coeffs, int nCoeffs, AccuType& iAcc, AccuType& qAcc)
+    {
+        const AccuType *tI = wI + 2*nCoeffs - 1;
+        const AccuType *tQ = wQ + 2*nCoeffs - 1;
+        iAcc = 0;
+        qAcc = 0;
+
+        for (int k = 0; k < nCoeffs; k++)
+        {
+            iAcc += (wI[k] + tI[-k]) * coeffs[k];
+            qAcc += (wQ[k] + tQ[-k]) * coeffs[k];
+        }
+    }
+
+    static void foldBlock(const AccuType *w, const int32_t *coeffs, int nCoeffs, int nOut, AccuType *acc)
+    {
+        for (int j = 0; j < nOut; j++)
+        {
+            const AccuType *t = w + j + 2*nCoeffs - 1;
+            AccuType sum = 0;
+
+            for (int k = 0; k < nCoeffs; k++) {
+                sum += (w[j + k] + t[-k]) * coeffs[k];
+            }
+
+            acc[j] = sum;
+        }
+    }
+};
+
+template<>
+struct HBFilterFold<int32_t>
+{
+    static void fold(const int32_t *wI, const int32_t *wQ, const int32_t *coeffs, int nCoeffs, int32_t& iAcc, int32_t& qAcc)
+    {
+        HBFilterKernels::fold(wI, wQ, coeffs, nCoeffs, iAcc, qAcc);
+    }
+
+    static void foldBlock(const int32_t *w, const int32_t *coeffs, int nCoeffs, int nOut, int32_t *acc)
+    {
+        HBFilterKernels::foldBlock(w, coeffs, nCoeffs, nOut, acc);
+    }
+};
+
+/**
+ * Half-band decimator and interpolator by 2 with the filter order of HBFIRFilterTraits.
+ * It gives the same results as IntHalfbandFilterEO1 and IntHalfbandFilterDB.
+ *
+ * The decimator splits the input in two polyphase branches. The branch of the newest sample
+ * holds the non null coefficients and the other one only contributes the center tap.
+ * Each branch is a double buffer so that its window is always contiguous.
+ * The interpolator computes only the non null samples of the zero stuffed input.
+ *
+ * Per sample work functions have the same signatures as the other half-band filters so that
+ * they can be used through member function pointers. The block functions process whole
+ * sample vectors: the branches are copied in linear buffers after the history so that each
+ * coefficient is applied to several consecutive outputs at once. Per sample and block calls
+ * can be mixed.
+ */
+template<typename AccuType, uint32_t HBFilterOrder>
+class IntHalfbandFilterNG
+{
+public:
+    IntHalfbandFilterNG();
+
+    // downsample by 2, return center part of original spectrum
+    bool workDecimateCenter(Sample* sample)
+    {
+        if (m_state == 0)
+        {
+            storeInner(sample->real(), sample->imag());
+            m_state = 1;
+            return false;
+        }
+        else
+        {
+            storeOuter(sample->real(), sample->imag());
+            doFIR(sample);
+            m_state = 0;
+            return true;
+        }
+    }
+
+    // downsample by 2, return lower half of original spectrum
+    bool workDecimateLowerHalf(Sample* sample)
+    {
+        switch (m_state)
+        {
+        case 0:
+            storeInner((FixReal) -sample->imag(), sample->real());
+            m_state = 1;
+            return false;
+        case 1:
+            storeOuter((FixReal) -sample->real(), (FixReal) -sample->imag());
+            doFIR(sample);
+            m_state = 2;
+            return true;
+        case 2:
+            storeInner(sample->imag(), (FixReal) -sample->real());
+            m_state = 3;
+            return false;
+        default:
+            storeOuter(sample->real(), sample->imag());
+            doFIR(sample);
+            m_state = 0;
+            return true;
+        }
+    }
+
+    // downsample by 2, return upper half of original spectrum
+    bool workDecimateUpperHalf(Sample* sample)
+    {
+        switch (m_state)
+        {
+        case 0:
+            storeInner(sample->imag(), (FixReal) -sample->real());
+            m_state = 1;
+            return false;
+        case 1:
+            storeOuter((FixReal) -sample->real(), (FixReal) -sample->imag());
+            doFIR(sample);
+            m_state = 2;
+            return true;
+        case 2:
+            storeInner((FixReal) -sample->imag(), sample->real());
+            m_state = 3;
+            return false;
+        default:
+            storeOuter(sample->real(), sample->imag());
+            doFIR(sample);
+            m_state = 0;
+            return true;
+        }
+    }
+
+    // upsample by 2, return center part of original spectrum. Returns true when the input sample is consumed.
+    bool workInterpolateCenter(Sample* sampleIn, Sample *sampleOut)
+    {
+        if (m_state == 0)
+        {
+            sampleOut->setReal(peak(0));
+            sampleOut->setImag(peak(1));
+            m_state = 1;
+            return false;
+        }
+        else
+        {
+            doInterpolateFIR(sampleOut);
+            storeInterpolator(sampleIn);
+            m_state = 0;
+            return true;
+        }
+    }
+
+    // upsample by 2, move original spectrum to lower half
+    bool workInterpolateLowerHalf(Sample* sampleIn, Sample *sampleOut)
+    {
+        Sample s;
+
+        switch (m_state)
+        {
+        case 0:
+            sampleOut->setReal(peak(1));
+            sampleOut->setImag(-peak(0));
+            m_state = 1;
+            return false;
+        case 1:
+            doInterpolateFIR(&s);
+            sampleOut->setReal(-s.real());
+            sampleOut->setImag(-s.imag());
+            storeInterpolator(sampleIn);
+            m_state = 2;
+            return true;
+        case 2:
+            sampleOut->setReal(-peak(1));
+            sampleOut->setImag(peak(0));
+            m_state = 3;
+            return false;
+        default:
+            doInterpolateFIR(sampleOut);
+            storeInterpolator(sampleIn);
+            m_state = 0;
+            return true;
+        }
+    }
+
+    // upsample by 2, move original spectrum to upper half
+    bool workInterpolateUpperHalf(Sample* sampleIn, Sample *sampleOut)
+    {
+        Sample s;
+
+        switch (m_state)
+        {
+        case 0:
+            sampleOut->setReal(-peak(1));
+            sampleOut->setImag(peak(0));
+            m_state = 1;
+            return false;
+        case 1:
+            doInterpolateFIR(&s);
+            sampleOut->setReal(-s.real());
+            sampleOut->setImag(-s.imag());
+            storeInterpolator(sampleIn);
+            m_state = 2;
+            return true;
+        case 2:
+            sampleOut->setReal(peak(1));
+            sampleOut->setImag(-peak(0));
+            m_state = 3;
+            return false;
+        default:
+            doInterpolateFIR(sampleOut);
+            storeInterpolator(sampleIn);
+            m_state = 0;
+            return true;
+        }
+    }
+
+    /** Block decimators. Return the number of samples written to out (up to nbIn/2 + 1). in and out may be the same buffer. */
+    int decimateCenter(const Sample* in, Sample* out, int nbIn) { return decimate(ModeCenter, in, out, nbIn); }
+    int decimateLowerHalf(const Sample* in, Sample* out, int nbIn) { return decimate(ModeLowerHalf, in, out, nbIn); }
+    int decimateUpperHalf(const Sample* in, Sample* out, int nbIn) { return decimate(ModeUpperHalf, in, out, nbIn); }
+
+    /** Block interpolators. Write 2*nbIn samples to out. */
+    void interpolateCenter(const Sample* in, Sample* out, int nbIn) { interpolate(ModeCenter, in, out, nbIn); }
+    void interpolateLowerHalf(const Sample* in, Sample* out, int nbIn) { interpolate(ModeLowerHalf, in, out, nbIn); }
+    void interpolateUpperHalf(const Sample* in, Sample* out, int nbIn) { interpolate(ModeUpperHalf, in, out, nbIn); }
+
+private:
+    static const int m_size = HBFIRFilterTraits<HBFilterOrder>::hbOrder / 2; //!< samples in each branch window
+    static const int m_nCoeffs = HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4;
+    static const int m_shift = HBFIRFilterTraits<HBFilterOrder>::hbShift - 1; // keeps the gained bit like the other half-band filters
+
+    AccuType m_inner[2][2*m_size]; //!< decimator branch of the center tap
+    AccuType m_outer[2][2*m_size]; //!< decimator branch of the non null coefficients
+    AccuType m_samples[2][2*m_size]; //!< interpolator input
+    int m_ptr;       //!< oldest sample of the decimator windows
+    int m_interpPtr; //!< oldest sample of the interpolator window
+    int m_state;
+    std::vector<AccuType> m_block[2][2]; //!< block processing: [inner, outer or interpolator][I, Q] history followed by the block
+    std::vector<AccuType> m_acc[2];      //!< block processing: [I, Q] FIR sums
+
+    enum Mode
+    {
+        ModeCenter,
+        ModeLowerHalf,
+        ModeUpperHalf
+    };
+
+    void storeInner(FixReal i, FixReal q)
+    {
+        m_inner[0][m_ptr] = m_inner[0][m_ptr + m_size] = i;
+        m_inner[1][m_ptr] = m_inner[1][m_ptr + m_size] = q;
+    }
+
+    void storeOuter(FixReal i, FixReal q)
+    {
+        m_outer[0][m_ptr] = m_outer[0][m_ptr + m_size] = i;
+        m_outer[1][m_ptr] = m_outer[1][m_ptr + m_size] = q;
+        m_ptr = m_ptr + 1 < m_size ? m_ptr + 1 : 0;
+    }
+
+    void storeInterpolator(const Sample *sample)
+    {
+        m_samples[0][m_interpPtr] = m_samples[0][m_interpPtr + m_size] = sample->real();
+        m_samples[1][m_interpPtr] = m_samples[1][m_interpPtr + m_size] = sample->imag();
+        m_interpPtr = m_interpPtr + 1 < m_size ? m_interpPtr + 1 : 0;
+    }
+
+    FixReal peak(int iq) const
+    {
+        return m_samples[iq][m_interpPtr + m_size/2 - 1];
+    }
+
+    void doFIR(Sample* sample)
+    {
+        AccuType iAcc, qAcc;
+
+        HBFilterFold<AccuType>::fold(&m_outer[0][m_ptr], &m_outer[1][m_ptr],
+            HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, m_nCoeffs, iAcc, qAcc);
+
+        iAcc += m_inner[0][m_ptr + m_size/2] << m_shift;
+        qAcc += m_inner[1][m_ptr + m_size/2] << m_shift;
+
+        sample->setReal(iAcc >> m_shift);
+        sample->setImag(qAcc >> m_shift);
+    }
+
+    void doInterpolateFIR(Sample* sample)
+    {
+        AccuType iAcc, qAcc;
+
+        HBFilterFold<AccuType>::fold(&m_samples[0][m_interpPtr], &m_samples[1][m_interpPtr],
+            HBFIRFilterTraits<HBFilterOrder>::hbCoeffs, m_nCoeffs, iAcc, qAcc);
+
+        sample->setReal(iAcc >> m_shift);
+        sample->setImag(qAcc >> m_shift);
+    }
+
+    bool workDecimate(Mode mode, Sample* sample)
+    {
+        switch (mode)
+        {
+        case ModeLowerHalf:
+            return workDecimateLowerHalf(sample);
+        case ModeUpperHalf:
+            return workDecimateUpperHalf(sample);
+        default:
+            return workDecimateCenter(sample);
+        }
+    }
+
+    bool workInterpolate(Mode mode, Sample* sampleIn, Sample* sampleOut)
+    {
+        switch (mode)
+        {
+        case ModeLowerHalf:
+            return workInterpolateLowerHalf(sampleIn, sampleOut);
+        case ModeUpperHalf:
+            return workInterpolateUpperHalf(sampleIn, sampleOut);
+        default:
+            return workInterpolateCenter(sampleIn, sampleOut);
+        }
+    }
+
+    void resizeBlock(int nbBlock)
+    {
+        if ((int) m_acc[0].size() < nbBlock)
+        {
+            for (int iq = 0; iq < 2; iq++)
+            {
+                m_block[0][iq].resize(m_size + nbBlock + 1);
+                m_block[1][iq].resize(m_size + nbBlock + 1);
+                m_acc[iq].resize(nbBlock);
+            }
+        }
+    }
+
+    /**
+     * Sample of a pair in the lower or upper half modes. The rotation by a quarter of the sample rate
+     * alternates with the parity of the pair like in the per sample work functions.
+     * Negation is done in FixReal (-32768 wraps) like IntHalfbandFilterEO1 so that both paths are bit exact.
+     */
+    static void rotate(Mode mode, bool inner, bool oddPair, const Sample& s, AccuType& i, AccuType& q)
+    {
+        if ((mode == ModeCenter) || (!inner && oddPair))
+        {
+            i = s.real();
+            q = s.imag();
+        }
+        else if (!inner) // even pair
+        {
+            i = (FixReal) -s.real();
+            q = (FixReal) -s.imag();
+        }
+        else if ((mode == ModeLowerHalf) != oddPair)
+        {
+            i = (FixReal) -s.imag();
+            q = s.real();
+        }
+        else
+        {
+            i = s.imag();
+            q = (FixReal) -s.real();
+        }
+    }
+
+    int decimate(Mode mode, const Sample* in, Sample* out, int nbIn)
+    {
+        Sample *begin = out;
+        int n = 0;
+
+        // complete the current pair (or quadruple) sample by sample
+        for (; (n < nbIn) && (m_state != 0); n++)
+        {
+            Sample s = in[n];
+
+            if (workDecimate(mode, &s)) {
+                *out++ = s;
+            }
+        }
+
+        int nbPairs = (nbIn - n) / 2;
+
+        if (nbPairs > 0)
+        {
+            resizeBlock(nbPairs);
+
+            for (int iq = 0; iq < 2; iq++) // history oldest first
+            {
+                std::copy(&m_inner[iq][m_ptr], &m_inner[iq][m_ptr + m_size], m_block[0][iq].begin());
+                std::copy(&m_outer[iq][m_ptr], &m_outer[iq][m_ptr + m_size], m_block[1][iq].begin());
+            }
+
+            for (int p = 0; p < nbPairs; p++, n += 2)
+            {
+                rotate(mode, true, p & 1, in[n], m_block[0][0][m_size + p], m_block[0][1][m_size + p]);
+                rotate(mode, false, p & 1, in[n + 1], m_block[1][0][m_size + p], m_block[1][1][m_size + p]);
+            }
+
+            for (int iq = 0; iq < 2; iq++)
+            {
+                HBFilterFold<AccuType>::foldBlock(&m_block[1][iq][1], HBFIRFilterTraits<HBFilterOrder>::hbCoeffs,
+                    m_nCoeffs, nbPairs, &m_acc[iq][0]);
+            }
+
+            for (int p = 0; p < nbPairs; p++)
+            {
+                out->setReal((m_acc[0][p] + (m_block[0][0][m_size/2 + 1 + p] << m_shift)) >> m_shift);
+                out->setImag((m_acc[1][p] + (m_block[0][1][m_size/2 + 1 + p] << m_shift)) >> m_shift);
+                out++;
+            }
+
+            // the windows continue with the end of the block
+            for (int iq = 0; iq < 2; iq++)
+            {
+                std::copy(&m_block[0][iq][nbPairs], &m_block[0][iq][nbPairs + m_size], &m_inner[iq][0]);
+                std::copy(&m_block[0][iq][nbPairs], &m_block[0][iq][nbPairs + m_size], &m_inner[iq][m_size]);
+                std::copy(&m_block[1][iq][nbPairs], &m_block[1][iq][nbPairs + m_size], &m_outer[iq][0]);
+                std::copy(&m_block[1][iq][nbPairs], &m_block[1][iq][nbPairs + m_size], &m_outer[iq][m_size]);
+            }
+
+            m_ptr = 0;
+            m_state = ((mode != ModeCenter) && (nbPairs & 1)) ? 2 : 0;
+        }
+
+        for (; n < nbIn; n++)
+        {
+            Sample s = in[n];
+
+            if (workDecimate(mode, &s)) {
+                *out++ = s;
+            }
+        }
+
+        return out - begin;
+    }
+
+    void interpolate(Mode mode, const Sample* in, Sample* out, int nbIn)
+    {
+        int n = 0;
+
+        // complete the current pair (or quadruple) sample by sample
+        for (; (n < nbIn) && (m_state != 0); n++)
+        {
+            Sample s = in[n];
+            while (!workInterpolate(mode, &s, out++));
+        }
+
+        int nbBlock = nbIn - n;
+
+        if (nbBlock > 0)
+        {
+            resizeBlock(nbBlock);
+
+            for (int iq = 0; iq < 2; iq++) {
+                std::copy(&m_samples[iq][m_interpPtr], &m_samples[iq][m_interpPtr + m_size], m_block[1][iq].begin());
+            }
+
+            for (int m = 0; m < nbBlock; m++)
+            {
+                m_block[1][0][m_size + m] = in[n + m].real();
+                m_block[1][1][m_size + m] = in[n + m].imag();
+            }
+
+            for (int iq = 0; iq < 2; iq++)
+            {
+                HBFilterFold<AccuType>::foldBlock(&m_block[1][iq][0], HBFIRFilterTraits<HBFilterOrder>::hbCoeffs,
+                    m_nCoeffs, nbBlock, &m_acc[iq][0]);
+            }
+
+            for (int m = 0; m < nbBlock; m++)
+            {
+                AccuType pi = m_block[1][0][m + m_size/2 - 1]; // middle peak
+                AccuType pq = m_block[1][1][m + m_size/2 - 1];
+                AccuType fi = m_acc[0][m] >> m_shift;
+                AccuType fq = m_acc[1][m] >> m_shift;
+
+                if (mode == ModeCenter)
+                {
+                    out[0].setReal(pi);
+                    out[0].setImag(pq);
+                    out[1].setReal(fi);
+                    out[1].setImag(fq);
+                }
+                else
+                {
+                    // quarter rate rotation, first output of even inputs is (+/-) j times the peak
+                    int sign = ((mode == ModeLowerHalf) != (m & 1)) ? 1 : -1;
+                    int fsign = (m & 1) ? 1 : -1;
+                    out[0].setReal(sign * pq);
+                    out[0].setImag(-sign * pi);
+                    out[1].setReal(fsign * fi);
+                    out[1].setImag(fsign * fq);
+                }
+
+                out += 2;
+            }
+
+            for (int iq = 0; iq < 2; iq++)
+            {
+                std::copy(&m_block[1][iq][nbBlock], &m_block[1][iq][nbBlock + m_size], &m_samples[iq][0]);
+                std::copy(&m_block[1][iq][nbBlock], &m_block[1][iq][nbBlock + m_size], &m_samples[iq][m_size]);
+            }
+
+            m_interpPtr = 0;
+            m_state = ((mode != ModeCenter) && (nbBlock & 1)) ? 2 : 0;
+        }
+    }
+};
+
+template<typename AccuType, uint32_t HBFilterOrder>
+IntHalfbandFilterNG<AccuType, HBFilterOrder>::IntHalfbandFilterNG()
+{
+    for (int i = 0; i < 2*m_size; i++)
+    {
+        m_inner[0][i] = 0;
+        m_inner[1][i] = 0;
+        m_outer[0][i] = 0;
+        m_outer[1][i] = 0;
+        m_samples[0][i] = 0;
+        m_samples[1][i] = 0;
+    }
+
+    m_ptr = 0;
+    m_interpPtr = 0;
+    m_state = 0;
+}
+
+#endif /* SDRBASE_DSP_INTHALFBANDFILTERNG_H_ */
@@ -0,0 +1,459 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <limits>
+#include <ctime>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include <QDateTime>
+#include <QDebug>
+
+#include "dsp/dspcommands.h"
+#include "dsp/filerecord.h"
+#include "util/message.h"
+#include "pretriggerrecord.h"
+
+const float PreTriggerRecord::m_marginTime = 1.0f;
+
+PreTriggerRecord::Settings::Settings()
+{
+    resetToDefaults();
+}
+
+void PreTriggerRecord::Settings::resetToDefaults()
+{
+    m_fileBase = "pretrigger";
+    m_preTriggerTime = 10.0f;
+    m_postTriggerTime = 10.0f;
+    m_hugePages = true;
+    m_squelchChannelIndex = -1;
+}
+
+PreTriggerRecord::Writer::Writer(PreTriggerRecord *record) :
+    m_record(record)
+{
+}
+
+void PreTriggerRecord::Writer::run()
+{
+    m_record->writeRecording();
+}
+
+PreTriggerRecord::PreTriggerRecord(const Settings& settings, int sampleRate, quint64 centerFrequency) :
+    BasebandSampleSink(),
+    m_settings(settings),
+    m_ring(0),
+    m_ringSize(0),
+    m_allocatedBytes(0),
+    m_mapped(false),
+    m_hugePagesUsed(false),
+    m_writeClaim(0),
+    m_writeCount(0),
+    m_running(true),
+    m_sampleRate(sampleRate),
+    m_centerFrequency(centerFrequency),
+    m_validFrom(0),
+    m_recording(false),
+    m_newFile(false),
+    m_recordFrom(0),
+    m_recordTo(0),
+    m_triggerTime(0),
+    m_triggerCount(0),
+    m_nbTriggers(0),
+    m_nbFiles(0),
+    m_writtenBytes(0),
+    m_droppedSamples(0),
+    m_writer(this)
+{
+    setObjectName("PreTriggerRecord");
+
+    if (sampleRate > 0) {
+        allocate((quint64) ((m_settings.m_preTriggerTime + m_marginTime) * sampleRate));
+    }
+
+    if (m_ring)
+    {
+        m_writeBuffer.resize(m_writeChunkSize);
+        m_writer.start();
+    }
+    else
+    {
+        m_errorMessage = QString("Cannot allocate %1 s of pre-trigger buffer at %2 S/s")
+            .arg(m_settings.m_preTriggerTime).arg(sampleRate);
+        qWarning("PreTriggerRecord::PreTriggerRecord: %s", qPrintable(m_errorMessage));
+    }
+}
+
+PreTriggerRecord::~PreTriggerRecord()
+{
+    m_stateMutex.lock();
+    m_running = false;
+    m_writerCondition.wakeAll();
+    m_stateMutex.unlock();
+
+    if (m_writer.isRunning()) {
+        m_writer.wait();
+    }
+
+    release();
+}
+
+void PreTriggerRecord::allocate(quint64 nbSamples)
+{
+    size_t bytes = nbSamples * sizeof(Sample);
+
+    if (bytes == 0) {
+        return;
+    }
+
+#ifdef __linux__
+#ifdef MAP_HUGETLB
+    if (m_settings.m_hugePages)
+    {
+        size_t hugePageSize = 2*1024*1024;
+        size_t hugeBytes = ((bytes + hugePageSize - 1) / hugePageSize) * hugePageSize;
+        void *p = mmap(0, hugeBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | MAP_POPULATE, -1, 0);
+
+        if (p != MAP_FAILED)
+        {
+            m_ring = (Sample *) p;
+            m_allocatedBytes = hugeBytes;
+            m_hugePagesUsed = true;
+        }
+        else
+        {
+            qDebug("PreTriggerRecord::allocate: no huge pages (%s). Using normal pages.", strerror(errno));
+        }
+    }
+#endif
+
+    if (!m_ring)
+    {
+        void *p = mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (p != MAP_FAILED)
+        {
+#ifdef MADV_HUGEPAGE
+            if (m_settings.m_hugePages) {
+                madvise(p, bytes, MADV_HUGEPAGE); // transparent huge pages if enabled in the kernel
+            }
+#endif
+            memset(p, 0, bytes); // touch all pages now rather than in the DSP thread
+            m_ring = (Sample *) p;
+            m_allocatedBytes = bytes;
+        }
+    }
+
+    m_mapped = m_ring != 0;
+#else
+    m_ring = new (std::nothrow) Sample[nbSamples];
+    m_allocatedBytes = m_ring ? bytes : 0;
+#endif
+
+    m_ringSize = m_allocatedBytes / sizeof(Sample);
+    qDebug("PreTriggerRecord::allocate: %llu samples (%llu MB) huge pages: %s",
+        m_ringSize, (quint64) (m_allocatedBytes >> 20), m_hugePagesUsed ? "yes" : "no");
+}
+
+void PreTriggerRecord::release()
+{
+#ifdef __linux__
+    if (m_mapped) {
+        munmap(m_ring, m_allocatedBytes);
+    }
+#else
+    delete[] m_ring;
+#endif
+    m_ring = 0;
+    m_ringSize = 0;
+    m_allocatedBytes = 0;
+}
+
+quint64 PreTriggerRecord::getPreTriggerSamples() const
+{
+    if (m_sampleRate <= 0) {
+        return 0;
+    }
+
+    // keep the margin for the writer also when the sample rate went up
+    quint64 maxSamples = (quint64) (m_ringSize * (m_settings.m_preTriggerTime / (m_settings.m_preTriggerTime + m_marginTime)));
+    return std::min((quint64) (m_settings.m_preTriggerTime * m_sampleRate), maxSamples);
+}
+
+void PreTriggerRecord::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly __attribute__((unused)))
+{
+    if (!m_ring || (begin >= end)) {
+        return;
+    }
+
+    quint64 count = m_writeCount.load(std::memory_order_relaxed); // written by this thread only
+    quint64 nbSamples = end - begin;
+    quint64 newCount = count + nbSamples;
+    SampleVector::const_iterator from = begin;
+
+    if (nbSamples > m_ringSize) // only the last ring size samples are kept
+    {
+        from += nbSamples - m_ringSize;
+        count += nbSamples - m_ringSize;
+        nbSamples = m_ringSize;
+    }
+
+    // the writer checks the claim after copying samples out to know if they were overwritten meanwhile
+    m_writeClaim.store(newCount, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    quint64 index = count % m_ringSize;
+    quint64 first = std::min(nbSamples, m_ringSize - index);
+    std::copy(from, from + first, m_ring + index);
+    std::copy(from + first, from + nbSamples, m_ring);
+
+    m_writeCount.store(newCount, std::memory_order_release);
+}
+
+void PreTriggerRecord::start()
+{
+}
+
+void PreTriggerRecord::stop()
+{
+    stopRecording();
+}
+
+bool PreTriggerRecord::handleMessage(const Message& message)
+{
+    if (DSPSignalNotification::match(message))
+    {
+        DSPSignalNotification& notif = (DSPSignalNotification&) message;
+
+        if (notif.getSampleRate() <= 0) { // engine not started yet
+            return true;
+        }
+
+        QMutexLocker mutexLocker(&m_stateMutex);
+
+        if ((notif.getSampleRate() != m_sampleRate) || ((quint64) notif.getCenterFrequency() != m_centerFrequency))
+        {
+            quint64 count = m_writeCount.load(std::memory_order_acquire);
+            m_validFrom = count;
+
+            if (m_recording) {
+                m_recordTo = std::min(m_recordTo, count);
+            }
+
+            m_sampleRate = notif.getSampleRate();
+            m_centerFrequency = notif.getCenterFrequency();
+            qDebug() << "PreTriggerRecord::handleMessage: DSPSignalNotification: m_sampleRate: " << m_sampleRate
+                    << " m_centerFrequency: " << m_centerFrequency;
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void PreTriggerRecord::trigger()
+{
+    QMutexLocker mutexLocker(&m_stateMutex);
+
+    if (!m_ring || (m_sampleRate <= 0)) {
+        return;
+    }
+
+    quint64 count = m_writeCount.load(std::memory_order_acquire);
+    quint64 recordTo = m_settings.m_postTriggerTime > 0.0f ?
+        count + (quint64) (m_settings.m_postTriggerTime * m_sampleRate) :
+        std::numeric_limits<quint64>::max();
+    m_nbTriggers++;
+
+    if (m_recording)
+    {
+        m_recordTo = std::max(m_recordTo, recordTo);
+    }
+    else
+    {
+        quint64 preTriggerSamples = std::min(getPreTriggerSamples(), count - m_validFrom);
+        m_recordFrom = count - preTriggerSamples;
+        m_recordTo = recordTo;
+        m_triggerTime = QDateTime::currentMSecsSinceEpoch();
+        m_triggerCount = count;
+        m_recording = true;
+        m_newFile = true;
+        m_writerCondition.wakeAll();
+    }
+}
+
+void PreTriggerRecord::stopRecording()
+{
+    QMutexLocker mutexLocker(&m_stateMutex);
+
+    if (m_recording)
+    {
+        m_recordTo = std::min(m_recordTo, m_writeCount.load(std::memory_order_acquire));
+        m_writerCondition.wakeAll();
+    }
+}
+
+void PreTriggerRecord::getReport(Report& report)
+{
+    QMutexLocker mutexLocker(&m_stateMutex);
+    quint64 preTriggerSamples = getPreTriggerSamples();
+    quint64 buffered = std::min(preTriggerSamples, m_writeCount.load(std::memory_order_acquire) - m_validFrom);
+
+    report.m_recording = m_recording;
+    report.m_bufferTime = m_sampleRate > 0 ? preTriggerSamples / (float) m_sampleRate : 0.0f;
+    report.m_bufferedTime = m_sampleRate > 0 ? buffered / (float) m_sampleRate : 0.0f;
+    report.m_bufferSize = m_allocatedBytes;
+    report.m_hugePages = m_hugePagesUsed;
+    report.m_nbTriggers = m_nbTriggers;
+    report.m_nbFiles = m_nbFiles;
+    report.m_writtenBytes = m_writtenBytes;
+    report.m_droppedSamples = m_droppedSamples;
+    report.m_fileName = m_fileName;
+    report.m_errorMessage = m_errorMessage;
+}
+
+void PreTriggerRecord::writeRecording()
+{
+    quint64 pos = 0; // next sample to write
+    QMutexLocker mutexLocker(&m_stateMutex);
+
+    while (m_running)
+    {
+        if (!m_recording)
+        {
+            m_writerCondition.wait(&m_stateMutex);
+            continue;
+        }
+
+        if (m_newFile)
+        {
+            m_newFile = false;
+            pos = m_recordFrom;
+            qint64 startTime = m_triggerTime - (qint64) (((m_triggerCount - m_recordFrom) * 1000) / m_sampleRate);
+            QString fileName = QString("%1_%2.sdriq")
+                .arg(m_settings.m_fileBase)
+                .arg(QDateTime::fromMSecsSinceEpoch(startTime).toString("yyyy-MM-ddTHH_mm_ss_zzz"));
+            int sampleRate = m_sampleRate;
+            quint64 centerFrequency = m_centerFrequency;
+
+            mutexLocker.unlock();
+            m_file.open(fileName.toStdString().c_str(), std::ios::binary);
+
+            if (m_file.is_open())
+            {
+                FileRecord::Header header;
+                header.sampleRate = sampleRate;
+                header.centerFrequency = centerFrequency;
+                header.startTimeStamp = startTime / 1000;
+                header.sampleSize = SDR_RX_SAMP_SZ;
+                FileRecord::writeHeader(m_file, header);
+            }
+
+            mutexLocker.relock();
+            m_fileName = fileName;
+
+            if (!m_file.is_open())
+            {
+                m_errorMessage = QString("Cannot open %1").arg(fileName);
+                qWarning("PreTriggerRecord::writeRecording: %s", qPrintable(m_errorMessage));
+                m_recording = false;
+                continue;
+            }
+
+            qDebug("PreTriggerRecord::writeRecording: start %s with %llu pre-trigger samples",
+                qPrintable(fileName), m_triggerCount - m_recordFrom);
+            m_nbFiles++;
+        }
+
+        quint64 writeCount = m_writeCount.load(std::memory_order_acquire);
+
+        if (writeCount > pos + m_ringSize) // the DSP thread went round the ring: skip to half a ring behind it
+        {
+            quint64 skipTo = std::min(writeCount - m_ringSize/2, m_recordTo);
+            m_droppedSamples += skipTo - pos;
+            pos = skipTo;
+        }
+
+        quint64 end = std::min(writeCount, m_recordTo);
+
+        if (pos >= end)
+        {
+            if (pos >= m_recordTo) // complete
+            {
+                m_recording = false;
+                mutexLocker.unlock();
+                m_file.close();
+                qDebug("PreTriggerRecord::writeRecording: end of recording");
+                mutexLocker.relock();
+            }
+            else
+            {
+                m_writerCondition.wait(&m_stateMutex, 20);
+            }
+
+            continue;
+        }
+
+        quint64 nbSamples = std::min(end - pos, (quint64) m_writeChunkSize);
+        mutexLocker.unlock();
+
+        quint64 index = pos % m_ringSize;
+        quint64 first = std::min(nbSamples, m_ringSize - index);
+        std::copy(m_ring + index, m_ring + index + first, m_writeBuffer.begin());
+        std::copy(m_ring, m_ring + (nbSamples - first), m_writeBuffer.begin() + first);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        bool overwritten = m_writeClaim.load(std::memory_order_relaxed) > pos + m_ringSize;
+
+        if (!overwritten) {
+            m_file.write(reinterpret_cast<const char*>(&m_writeBuffer[0]), nbSamples*sizeof(Sample));
+        }
+
+        mutexLocker.relock();
+        pos += nbSamples;
+
+        if (overwritten)
+        {
+            m_droppedSamples += nbSamples;
+        }
+        else if (m_file.fail())
+        {
+            m_errorMessage = QString("Write error on %1").arg(m_fileName);
+            qWarning("PreTriggerRecord::writeRecording: %s", qPrintable(m_errorMessage));
+            m_recordTo = pos; // ends it
+        }
+        else
+        {
+            m_writtenBytes += nbSamples*sizeof(Sample);
+        }
+    }
+
+    mutexLocker.unlock();
+
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+}
@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_PRETRIGGERRECORD_H_
+#define SDRBASE_DSP_PRETRIGGERRECORD_H_
+
+#include <atomic>
+#include <fstream>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QString>
+
+#include "dsp/basebandsamplesink.h"
+#include "util/export.h"
+
+/**
+ * Pre-trigger ("time machine") I/Q recorder. The baseband is continuously copied into a
+ * ring buffer allocated once when the recorder is created and large enough for the
+ * pre-trigger time. Nothing is written to disk until a trigger: the samples of the
+ * pre-trigger time are then written to a new .sdriq file (FileRecord format) followed by
+ * the incoming samples until the post-trigger time after the last trigger has elapsed
+ * or the recording is stopped. A trigger while recording extends the recording.
+ *
+ * The DSP thread only copies samples into the ring. Files are written by a writer thread
+ * that reads the ring behind it. If the writer falls behind by more than the ring size the
+ * overwritten samples are skipped and counted as dropped.
+ *
+ * A change of sample rate or center frequency ends the current file and discards the
+ * samples buffered before the change.
+ */
+class SDRANGEL_API PreTriggerRecord : public BasebandSampleSink {
+public:
+    struct Settings
+    {
+        QString m_fileBase;        //!< files are named <fileBase>_<yyyy-MM-ddTHH_mm_ss_zzz>.sdriq
+        float m_preTriggerTime;    //!< seconds kept in memory
+        float m_postTriggerTime;   //!< seconds recorded after the last trigger. 0 to record until stopped
+        bool m_hugePages;          //!< back the ring buffer with huge pages if possible (Linux)
+        int m_squelchChannelIndex; //!< index of the channel whose squelch opening triggers. -1 for none
+
+        Settings();
+        void resetToDefaults();
+    };
+
+    struct Report
+    {
+        bool m_recording;
+        float m_bufferTime;        //!< seconds of pre-trigger at the current sample rate
+        float m_bufferedTime;      //!< seconds currently available before now
+        quint64 m_bufferSize;      //!< bytes
+        bool m_hugePages;          //!< ring buffer is actually backed by huge pages
+        int m_nbTriggers;
+        int m_nbFiles;
+        quint64 m_writtenBytes;    //!< total of all files
+        quint64 m_droppedSamples;  //!< overwritten before they could be written
+        QString m_fileName;        //!< current or last file
+        QString m_errorMessage;    //!< last file error
+    };
+
+    PreTriggerRecord(const Settings& settings, int sampleRate, quint64 centerFrequency);
+    virtual ~PreTriggerRecord();
+
+    const Settings& getSettings() const { return m_settings; }
+    bool isAllocated() const { return m_ring != 0; }
+
+    void trigger();       //!< Start a recording or extend the current one. Thread safe.
+    void stopRecording(); //!< End the current recording now. Thread safe.
+    void getReport(Report& report);
+
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual void start();
+    virtual void stop();
+    virtual bool handleMessage(const Message& message);
+
+private:
+    class Writer : public QThread
+    {
+    public:
+        Writer(PreTriggerRecord *record);
+
+    protected:
+        virtual void run();
+
+    private:
+        PreTriggerRecord *m_record;
+    };
+
+    static const float m_marginTime;  //!< seconds of ring buffer above the pre-trigger time for the writer to catch up
+    static const int m_writeChunkSize = 65536; //!< samples copied out of the ring at once
+
+    Settings m_settings;
+    Sample *m_ring;
+    quint64 m_ringSize;               //!< samples
+    size_t m_allocatedBytes;
+    bool m_mapped;                    //!< allocated with mmap
+    bool m_hugePagesUsed;
+    std::atomic<quint64> m_writeClaim; //!< m_writeCount at the end of the block being copied into the ring
+    std::atomic<quint64> m_writeCount; //!< samples written to the ring since creation. Ring index is modulo m_ringSize.
+
+    QMutex m_stateMutex;              //!< guards the members below
+    QWaitCondition m_writerCondition;
+    bool m_running;                   //!< writer thread keeps going
+    int m_sampleRate;
+    quint64 m_centerFrequency;
+    quint64 m_validFrom;              //!< first sample at the current sample rate and center frequency
+    bool m_recording;
+    bool m_newFile;                   //!< writer must start a new file at m_recordFrom
+    quint64 m_recordFrom;
+    quint64 m_recordTo;               //!< end of the recording (excluded)
+    qint64 m_triggerTime;             //!< ms since epoch of the trigger that started the recording
+    quint64 m_triggerCount;           //!< m_writeCount at that trigger
+    int m_nbTriggers;
+    int m_nbFiles;
+    quint64 m_writtenBytes;
+    quint64 m_droppedSamples;
+    QString m_fileName;
+    QString m_errorMessage;
+
+    Writer m_writer;
+    std::ofstream m_file;             //!< writer thread only
+    std::vector<Sample> m_writeBuffer; //!< writer thread only
+
+    void allocate(quint64 nbSamples);
+    void release();
+    quint64 getPreTriggerSamples() const;
+    void writeRecording();
+};
+
+#endif /* SDRBASE_DSP_PRETRIGGERRECORD_H_ */
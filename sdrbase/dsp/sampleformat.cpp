@@ -0,0 +1,320 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <string.h>
+#include <stdint.h>
+#include <QtGlobal>
+#include <QDebug>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SAMPLEFORMAT_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+#include "dsp/sampleformat.h"
+
+namespace {
+
+// all functions convert n = 2*nbSamples components (I then Q)
+
+inline FixReal saturate(float v)
+{
+    v *= SDR_RX_SCALEF;
+    return v >= SDR_RX_SCALEF - 1.0f ? (FixReal) (SDR_RX_SCALEF - 1.0f) : v <= -SDR_RX_SCALEF ? (FixReal) -SDR_RX_SCALEF : (FixReal) lrintf(v);
+}
+
+void ci8Generic(const void *in, Sample *out, int nbSamples)
+{
+    const int8_t *src = (const int8_t *) in;
+    FixReal *dst = (FixReal *) out;
+
+    for (int i = 0; i < 2*nbSamples; i++) {
+        dst[i] = (FixReal) src[i] << (SDR_RX_SAMP_SZ - 8);
+    }
+}
+
+void ci16Generic(const void *in, Sample *out, int nbSamples)
+{
+#if SDR_RX_SAMP_SZ == 16
+    memcpy((void *) out, in, nbSamples*sizeof(Sample));
+#else
+    const int16_t *src = (const int16_t *) in;
+    FixReal *dst = (FixReal *) out;
+
+    for (int i = 0; i < 2*nbSamples; i++) {
+        dst[i] = (FixReal) src[i] << 8;
+    }
+#endif
+}
+
+void ci24Generic(const void *in, Sample *out, int nbSamples)
+{
+#if SDR_RX_SAMP_SZ == 24
+    memcpy((void *) out, in, nbSamples*sizeof(Sample));
+#else
+    const int32_t *src = (const int32_t *) in;
+    FixReal *dst = (FixReal *) out;
+
+    for (int i = 0; i < 2*nbSamples; i++) {
+        dst[i] = src[i] >> 8;
+    }
+#endif
+}
+
+void cf32Generic(const void *in, Sample *out, int nbSamples)
+{
+    const float *src = (const float *) in;
+    FixReal *dst = (FixReal *) out;
+
+    for (int i = 0; i < 2*nbSamples; i++) {
+        dst[i] = saturate(src[i]);
+    }
+}
+
+#ifdef SAMPLEFORMAT_X86_DISPATCH
+
+#if SDR_RX_SAMP_SZ == 16
+
+__attribute__((target("sse4.1")))
+void ci8SSE41(const void *in, Sample *out, int nbSamples)
+{
+    const int8_t *src = (const int8_t *) in;
+    FixReal *dst = (FixReal *) out;
+    int n = 2*nbSamples;
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*) &src[i]);
+        // interleaving with zeros puts each byte in the high byte of a 16 bit word: << 8
+        _mm_storeu_si128((__m128i*) &dst[i], _mm_unpacklo_epi8(_mm_setzero_si128(), v));
+        _mm_storeu_si128((__m128i*) &dst[i+8], _mm_unpackhi_epi8(_mm_setzero_si128(), v));
+    }
+
+    ci8Generic(src + i, (Sample *) (dst + i), (n - i) / 2);
+}
+
+__attribute__((target("sse4.1")))
+void ci24SSE41(const void *in, Sample *out, int nbSamples)
+{
+    const int32_t *src = (const int32_t *) in;
+    FixReal *dst = (FixReal *) out;
+    int n = 2*nbSamples;
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i a = _mm_srai_epi32(_mm_loadu_si128((const __m128i*) &src[i]), 8);
+        __m128i b = _mm_srai_epi32(_mm_loadu_si128((const __m128i*) &src[i+4]), 8);
+        _mm_storeu_si128((__m128i*) &dst[i], _mm_packs_epi32(a, b));
+    }
+
+    ci24Generic(src + i, (Sample *) (dst + i), (n - i) / 2);
+}
+
+__attribute__((target("sse4.1")))
+void cf32SSE41(const void *in, Sample *out, int nbSamples)
+{
+    const float *src = (const float *) in;
+    FixReal *dst = (FixReal *) out;
+    const __m128 scale = _mm_set1_ps(SDR_RX_SCALEF);
+    const __m128 hi = _mm_set1_ps(SDR_RX_SCALEF - 1.0f);
+    const __m128 lo = _mm_set1_ps(-SDR_RX_SCALEF);
+    int n = 2*nbSamples;
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128 a = _mm_max_ps(_mm_min_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), scale), hi), lo);
+        __m128 b = _mm_max_ps(_mm_min_ps(_mm_mul_ps(_mm_loadu_ps(&src[i+4]), scale), hi), lo);
+        _mm_storeu_si128((__m128i*) &dst[i], _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+
+    cf32Generic(src + i, (Sample *) (dst + i), (n - i) / 2);
+}
+
+#else // 24 bit samples
+
+__attribute__((target("sse4.1")))
+void ci8SSE41(const void *in, Sample *out, int nbSamples)
+{
+    const int8_t *src = (const int8_t *) in;
+    FixReal *dst = (FixReal *) out;
+    int n = 2*nbSamples;
+    int i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*) &src[i]);
+        _mm_storeu_si128((__m128i*) &dst[i], _mm_slli_epi32(_mm_cvtepi8_epi32(v), 16));
+        _mm_storeu_si128((__m128i*) &dst[i+4], _mm_slli_epi32(_mm_cvtepi8_epi32(_mm_srli_si128(v, 4)), 16));
+        _mm_storeu_si128((__m128i*) &dst[i+8], _mm_slli_epi32(_mm_cvtepi8_epi32(_mm_srli_si128(v, 8)), 16));
+        _mm_storeu_si128((__m128i*) &dst[i+12], _mm_slli_epi32(_mm_cvtepi8_epi32(_mm_srli_si128(v, 12)), 16));
+    }
+
+    ci8Generic(src + i, (Sample *) (dst + i), (n - i) / 2);
+}
+
+__attribute__((target("sse4.1")))
+void ci16SSE41(const void *in, Sample *out, int nbSamples)
+{
+    const int16_t *src = (const int16_t *) in;
+    FixReal *dst = (FixReal *) out;
+    int n = 2*nbSamples;
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*) &src[i]);
+        _mm_storeu_si128((__m128i*) &dst[i], _mm_slli_epi32(_mm_cvtepi16_epi32(v), 8));
+        _mm_storeu_si128((__m128i*) &dst[i+4], _mm_slli_epi32(_mm_cvtepi16_epi32(_mm_srli_si128(v, 8)), 8));
+    }
+
+    ci16Generic(src + i, (Sample *) (dst + i), (n - i) / 2);
+}
+
+__attribute__((target("sse4.1")))
+void cf32SSE41(const void *in, Sample *out, int nbSamples)
+{
+    const float *src = (const float *) in;
+    FixReal *dst = (FixReal *) out;
+    const __m128 scale = _mm_set1_ps(SDR_RX_SCALEF);
+    const __m128 hi = _mm_set1_ps(SDR_RX_SCALEF - 1.0f);
+    const __m128 lo = _mm_set1_ps(-SDR_RX_SCALEF);
+    int n = 2*nbSamples;
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m128 a = _mm_max_ps(_mm_min_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), scale), hi), lo);
+        _mm_storeu_si128((__m128i*) &dst[i], _mm_cvtps_epi32(a));
+    }
+
+    cf32Generic(src + i, (Sample *) (dst + i), (n - i) / 2);
+}
+
+#endif // SDR_RX_SAMP_SZ
+#endif // SAMPLEFORMAT_X86_DISPATCH
+
+} // namespace
+
+// the generic conversions are constant initialized so they are valid even before the selection
+SampleFormat::Convert SampleFormat::m_convert[4] = {
+    ci8Generic,
+    ci16Generic,
+    ci24Generic,
+    cf32Generic
+};
+
+bool SampleFormat::m_simd = false;
+bool SampleFormat::m_selected = SampleFormat::select(true);
+
+int SampleFormat::getComponentBytes(Format format)
+{
+    switch (format)
+    {
+    case FormatCI8:
+        return 1;
+    case FormatCI16:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
+int SampleFormat::getSampleBits(Format format)
+{
+    switch (format)
+    {
+    case FormatCI8:
+        return 8;
+    case FormatCI16:
+        return 16;
+    case FormatCI24:
+        return 24;
+    default:
+        return 32;
+    }
+}
+
+const char *SampleFormat::getSigMFDatatype(Format format)
+{
+    switch (format)
+    {
+    case FormatCI8:
+        return "ci8";
+    case FormatCI16:
+        return "ci16_le";
+    case FormatCI24:
+        return "ci32_le";
+    default:
+        return "cf32_le";
+    }
+}
+
+bool SampleFormat::fromSigMFDatatype(const QString& datatype, int sampleSize, Format& format)
+{
+    if ((datatype == "ci8") || (datatype == "ci8_le")) {
+        format = FormatCI8;
+    } else if (datatype == "ci16_le") {
+        format = FormatCI16;
+    } else if ((datatype == "ci32_le") && (sampleSize == 24)) { // full 32 bit range is not supported
+        format = FormatCI24;
+    } else if (datatype == "cf32_le") {
+        format = FormatCF32;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+bool SampleFormat::select(bool simd)
+{
+    m_convert[FormatCI8] = ci8Generic;
+    m_convert[FormatCI16] = ci16Generic;
+    m_convert[FormatCI24] = ci24Generic;
+    m_convert[FormatCF32] = cf32Generic;
+    m_simd = false;
+
+#ifdef SAMPLEFORMAT_X86_DISPATCH
+    __builtin_cpu_init(); // may run before the libgcc constructors
+
+    if (simd && __builtin_cpu_supports("sse4.1"))
+    {
+        m_convert[FormatCI8] = ci8SSE41;
+        m_convert[FormatCF32] = cf32SSE41;
+#if SDR_RX_SAMP_SZ == 16
+        m_convert[FormatCI24] = ci24SSE41;
+#else
+        m_convert[FormatCI16] = ci16SSE41;
+#endif
+        m_simd = true;
+    }
+#else
+    (void) simd;
+#endif
+
+    return true;
+}
+
+bool SampleFormat::useSIMD(bool use)
+{
+    select(use);
+    return m_simd == use;
+}
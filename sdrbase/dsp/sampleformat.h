@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_DSP_SAMPLEFORMAT_H_
+#define SDRBASE_DSP_SAMPLEFORMAT_H_
+
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "util/export.h"
+
+/**
+ * I/Q file sample formats and their conversion to the internal Sample format. Conversions
+ * are vectorized with SSE4.1 when the CPU supports it (selected at static initialization)
+ * and fall back to plain C that the compiler can vectorize on other architectures.
+ *
+ * Integer formats are scaled to the internal sample size by shifting so that full scale is
+ * kept. Float samples are full scale at 1.0 and saturated.
+ */
+class SDRANGEL_API SampleFormat
+{
+public:
+    typedef enum
+    {
+        FormatCI8,   //!< signed 8 bit I and Q
+        FormatCI16,  //!< signed 16 bit little endian I and Q (16 bit .sdriq)
+        FormatCI24,  //!< signed 24 bit in a 32 bit little endian container (24 bit .sdriq)
+        FormatCF32   //!< 32 bit float little endian I and Q
+    } Format;
+
+    typedef void (*Convert)(const void *in, Sample *out, int nbSamples);
+
+    static int getComponentBytes(Format format); //!< bytes used by I or Q
+    static int getSampleBits(Format format);     //!< effective bits of I or Q
+    static Format fromSampleSize(quint32 sampleSize) { return sampleSize > 16 ? FormatCI24 : FormatCI16; } //!< .sdriq header sample size
+    static Format getNativeFormat() { return fromSampleSize(SDR_RX_SAMP_SZ); }
+
+    /** SigMF core:datatype. The 24 bit format is stored as ci32_le with sdrangel:sample_size 24. */
+    static const char *getSigMFDatatype(Format format);
+    /** Returns false if the datatype is not supported. sampleSize is the sdrangel:sample_size field (0 if absent). */
+    static bool fromSigMFDatatype(const QString& datatype, int sampleSize, Format& format);
+
+    /** Converts nbSamples I/Q samples from format to out */
+    static void toSamples(Format format, const void *in, Sample *out, int nbSamples)
+    {
+        m_convert[format](in, out, nbSamples);
+    }
+
+    static bool useSIMD(bool use); //!< returns false if the CPU has no SSE4.1 support. For benchmarks only: not thread safe.
+    static bool isSIMD() { return m_simd; }
+
+private:
+    static Convert m_convert[4];
+    static bool m_simd;
+    static bool m_selected;
+
+    static bool select(bool simd);
+};
+
+#endif /* SDRBASE_DSP_SAMPLEFORMAT_H_ */
@@ -19,15 +19,47 @@
 
 #define MIN(x, y) (((x) < (y)) ? (x) : (y))
 
+namespace {
+
+// conversions to the storage format
+inline void convert(const Sample& in, Sample& out) { out = in; }
+inline void convert(const FSample& in, FSample& out) { out = in; }
+inline void convert(const Sample& in, FSample& out) { out = FSample(in); }
+inline void convert(const FSample& in, Sample& out) { out = in.toSample(); }
+
+template<typename InputIterator, typename OutputIterator>
+void copyConvert(InputIterator begin, InputIterator end, OutputIterator out)
+{
+	for (; begin != end; ++begin, ++out) {
+		convert(*begin, *out);
+	}
+}
+
+} // namespace
+
 void SampleSinkFifo::create(uint s)
 {
 	m_size = 0;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
-
-	m_data.resize(s);
-	m_size = m_data.size();
+	m_overflowCount = 0;
+	m_droppedSamples = 0;
+	m_maxFill = 0;
+	m_pendingTimer.invalidate();
+
+	if (m_float)
+	{
+		SampleVector().swap(m_data);
+		m_dataF.resize(s);
+		m_size = m_dataF.size();
+	}
+	else
+	{
+		FSampleVector().swap(m_dataF);
+		m_data.resize(s);
+		m_size = m_data.size();
+	}
 
 	if(m_size != s)
 		qCritical("SampleSinkFifo: out of memory");
@@ -35,18 +67,26 @@ void SampleSinkFifo::create(uint s)
 
 SampleSinkFifo::SampleSinkFifo(QObject* parent) :
 	QObject(parent),
-	m_data()
+	m_data(),
+	m_dataF(),
+	m_float(false)
 {
 	m_suppressed = -1;
 	m_size = 0;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_overflowCount = 0;
+	m_droppedSamples = 0;
+	m_maxFill = 0;
+	m_pendingTimer.invalidate();
 }
 
 SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
 	QObject(parent),
-	m_data()
+	m_data(),
+	m_dataF(),
+	m_float(false)
 {
 	m_suppressed = -1;
 
@@ -64,20 +104,52 @@ bool SampleSinkFifo::setSize(int size)
 {
 	create(size);
 
-	return m_data.size() == (uint)size;
+	return m_size == (uint)size;
 }
 
-uint SampleSinkFifo::write(const quint8* data, uint count)
+bool SampleSinkFifo::setFloat(bool floatSamples)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	if (floatSamples != m_float)
+	{
+		uint size = m_size;
+		m_float = floatSamples;
+		create(size);
+	}
+
+	return m_size != 0;
+}
+
+void SampleSinkFifo::resetCounters()
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	m_overflowCount = 0;
+	m_droppedSamples = 0;
+	m_maxFill = m_fill;
+}
+
+qint64 SampleSinkFifo::takeWriteLatency()
 {
 	QMutexLocker mutexLocker(&m_mutex);
-	uint total;
-	uint remaining;
-	uint len;
-	const Sample* begin = (const Sample*)data;
-	count /= sizeof(Sample);
 
-	total = MIN(count, m_size - m_fill);
+	if (!m_pendingTimer.isValid()) {
+		return -1;
+	}
+
+	qint64 latency = m_pendingTimer.nsecsElapsed();
+	m_pendingTimer.invalidate();
+	return latency;
+}
+
+uint SampleSinkFifo::writeSize(uint count)
+{
+	uint total = MIN(count, m_size - m_fill);
+
 	if(total < count) {
+		m_overflowCount++;
+		m_droppedSamples += count - total;
 		if(m_suppressed < 0) {
 			m_suppressed = 0;
 			m_msgRateTimer.start();
@@ -93,10 +165,24 @@ uint SampleSinkFifo::write(const quint8* data, uint count)
 		}
 	}
 
-	remaining = total;
+	return total;
+}
+
+template<typename Iterator>
+void SampleSinkFifo::store(Iterator begin, uint count)
+{
+	uint remaining = count;
+	uint len;
+
 	while(remaining > 0) {
 		len = MIN(remaining, m_size - m_tail);
-		std::copy(begin, begin + len, m_data.begin() + m_tail);
+
+		if (m_float) {
+			copyConvert(begin, begin + len, m_dataF.begin() + m_tail);
+		} else {
+			copyConvert(begin, begin + len, m_data.begin() + m_tail);
+		}
+
 		m_tail += len;
 		m_tail %= m_size;
 		m_fill += len;
@@ -104,50 +190,47 @@ uint SampleSinkFifo::write(const quint8* data, uint count)
 		remaining -= len;
 	}
 
+	if(m_fill > m_maxFill)
+		m_maxFill = m_fill;
+
+	if((count > 0) && !m_pendingTimer.isValid())
+		m_pendingTimer.start();
+
 	if(m_fill > 0)
 		emit dataReady();
+}
+
+uint SampleSinkFifo::write(const quint8* data, uint count)
+{
+	m_writerScheduling.check();
+
+	QMutexLocker mutexLocker(&m_mutex);
+	const Sample* begin = (const Sample*)data;
+	count /= sizeof(Sample);
+	uint total = writeSize(count);
+	store(begin, total);
 
 	return total;
 }
 
 uint SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVector::const_iterator end)
 {
+	m_writerScheduling.check();
+
 	QMutexLocker mutexLocker(&m_mutex);
-	uint count = end - begin;
-	uint total;
-	uint remaining;
-	uint len;
+	uint total = writeSize(end - begin);
+	store(begin, total);
 
-	total = MIN(count, m_size - m_fill);
-	if(total < count) {
-		if(m_suppressed < 0) {
-			m_suppressed = 0;
-			m_msgRateTimer.start();
-			qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
-		} else {
-			if(m_msgRateTimer.elapsed() > 2500) {
-				qCritical("SampleSinkFifo: %u messages dropped", m_suppressed);
-				qCritical("SampleSinkFifo: overflow - dropping %u samples", count - total);
-				m_suppressed = -1;
-			} else {
-				m_suppressed++;
-			}
-		}
-	}
+	return total;
+}
 
-	remaining = total;
-	while(remaining > 0) {
-		len = MIN(remaining, m_size - m_tail);
-		std::copy(begin, begin + len, m_data.begin() + m_tail);
-		m_tail += len;
-		m_tail %= m_size;
-		m_fill += len;
-		begin += len;
-		remaining -= len;
-	}
+uint SampleSinkFifo::write(FSampleVector::const_iterator begin, FSampleVector::const_iterator end)
+{
+	m_writerScheduling.check();
 
-	if(m_fill > 0)
-		emit dataReady();
+	QMutexLocker mutexLocker(&m_mutex);
+	uint total = writeSize(end - begin);
+	store(begin, total);
 
 	return total;
 }
@@ -167,7 +250,13 @@ uint SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::iterator e
 	remaining = total;
 	while(remaining > 0) {
 		len = MIN(remaining, m_size - m_head);
-		std::copy(m_data.begin() + m_head, m_data.begin() + m_head + len, begin);
+
+		if (m_float) {
+			copyConvert(m_dataF.begin() + m_head, m_dataF.begin() + m_head + len, begin);
+		} else {
+			std::copy(m_data.begin() + m_head, m_data.begin() + m_head + len, begin);
+		}
+
 		m_head += len;
 		m_head %= m_size;
 		m_fill -= len;
@@ -178,9 +267,10 @@ uint SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::iterator e
 	return total;
 }
 
-uint SampleSinkFifo::readBegin(uint count,
-	SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
-	SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
+template<typename Vector>
+uint SampleSinkFifo::readBegin(Vector& data, bool floatData, uint count,
+	typename Vector::iterator* part1Begin, typename Vector::iterator* part1End,
+	typename Vector::iterator* part2Begin, typename Vector::iterator* part2End)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 	uint total;
@@ -188,6 +278,15 @@ uint SampleSinkFifo::readBegin(uint count,
 	uint len;
 	uint head = m_head;
 
+	// the storage format is checked under the lock as the writer side may switch it
+	if (floatData != m_float)
+	{
+		qCritical("SampleSinkFifo: %s read from a %s FIFO",
+			floatData ? "floating point" : "fixed point",
+			m_float ? "floating point" : "fixed point");
+		count = 0;
+	}
+
 	total = MIN(count, m_fill);
 	if(total < count)
 		qCritical("SampleSinkFifo: underflow - missing %u samples", count - total);
@@ -195,27 +294,41 @@ uint SampleSinkFifo::readBegin(uint count,
 	remaining = total;
 	if(remaining > 0) {
 		len = MIN(remaining, m_size - head);
-		*part1Begin = m_data.begin() + head;
-		*part1End = m_data.begin() + head + len;
+		*part1Begin = data.begin() + head;
+		*part1End = data.begin() + head + len;
 		head += len;
 		head %= m_size;
 		remaining -= len;
 	} else {
-		*part1Begin = m_data.end();
-		*part1End = m_data.end();
+		*part1Begin = data.end();
+		*part1End = data.end();
 	}
 	if(remaining > 0) {
 		len = MIN(remaining, m_size - head);
-		*part2Begin = m_data.begin() + head;
-		*part2End = m_data.begin() + head + len;
+		*part2Begin = data.begin() + head;
+		*part2End = data.begin() + head + len;
 	} else {
-		*part2Begin = m_data.end();
-		*part2End = m_data.end();
+		*part2Begin = data.end();
+		*part2End = data.end();
 	}
 
 	return total;
 }
 
+uint SampleSinkFifo::readBegin(uint count,
+	SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
+	SampleVector::iterator* part2Begin, SampleVector::iterator* part2End)
+{
+	return readBegin(m_data, false, count, part1Begin, part1End, part2Begin, part2End);
+}
+
+uint SampleSinkFifo::readBegin(uint count,
+	FSampleVector::iterator* part1Begin, FSampleVector::iterator* part1End,
+	FSampleVector::iterator* part2Begin, FSampleVector::iterator* part2End)
+{
+	return readBegin(m_dataF, true, count, part1Begin, part1End, part2Begin, part2End);
+}
+
 uint SampleSinkFifo::readCommit(uint count)
 {
 	QMutexLocker mutexLocker(&m_mutex);
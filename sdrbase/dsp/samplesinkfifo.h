@@ -21,9 +21,16 @@
 #include <QObject>
 #include <QMutex>
 #include <QTime>
+#include <QElapsedTimer>
 #include "dsp/dsptypes.h"
+#include "util/threadscheduling.h"
 #include "util/export.h"
 
+/**
+ * Baseband samples FIFO. Samples are stored in fixed point (Sample) or in floating point (FSample)
+ * depending on setFloat(). Both kinds of samples can be written in either mode and are converted to
+ * the storage format. Reading returns the storage format so the reader must check isFloat().
+ */
 class SDRANGEL_API SampleSinkFifo : public QObject {
 	Q_OBJECT
 
@@ -33,13 +40,27 @@ private:
 	int m_suppressed;
 
 	SampleVector m_data;
+	FSampleVector m_dataF;
+	bool m_float;
 
 	uint m_size;
 	uint m_fill;
 	uint m_head;
 	uint m_tail;
 
+	quint64 m_overflowCount;   //!< number of writes that could not be fully stored
+	quint64 m_droppedSamples;  //!< total number of samples dropped on overflow
+	uint m_maxFill;            //!< fill high water mark since last reset of counters
+	QElapsedTimer m_pendingTimer; //!< started at the first write not yet seen by the reader
+
+	ThreadSchedulingHook m_writerScheduling;
+
 	void create(uint s);
+	uint writeSize(uint count); //!< number of samples that can be written and overflow reporting
+	template<typename Iterator> void store(Iterator begin, uint count);
+	template<typename Vector> uint readBegin(Vector& data, bool floatData, uint count,
+		typename Vector::iterator* part1Begin, typename Vector::iterator* part1End,
+		typename Vector::iterator* part2Begin, typename Vector::iterator* part2End);
 
 public:
 	SampleSinkFifo(QObject* parent = NULL);
@@ -47,17 +68,29 @@ public:
 	~SampleSinkFifo();
 
 	bool setSize(int size);
+	bool setFloat(bool floatSamples); //!< change storage format. This clears the FIFO.
+	inline bool isFloat() const { return m_float; }
 	inline uint size() const { return m_size; }
 	inline uint fill() { QMutexLocker mutexLocker(&m_mutex); uint fill = m_fill; return fill; }
+	inline quint64 getOverflowCount() { QMutexLocker mutexLocker(&m_mutex); return m_overflowCount; }
+	inline quint64 getDroppedSamples() { QMutexLocker mutexLocker(&m_mutex); return m_droppedSamples; }
+	inline uint getMaxFill() { QMutexLocker mutexLocker(&m_mutex); return m_maxFill; }
+	void resetCounters();
+	qint64 takeWriteLatency(); //!< ns since the oldest write not yet taken by the reader or -1 if none
+	ThreadSchedulingHook& getWriterScheduling() { return m_writerScheduling; } //!< applied to the threads that write
 
 	uint write(const quint8* data, uint count);
 	uint write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
+	uint write(FSampleVector::const_iterator begin, FSampleVector::const_iterator end);
 
 	uint read(SampleVector::iterator begin, SampleVector::iterator end);
 
 	uint readBegin(uint count,
 		SampleVector::iterator* part1Begin, SampleVector::iterator* part1End,
 		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
+	uint readBegin(uint count,
+		FSampleVector::iterator* part1Begin, FSampleVector::iterator* part1End,
+		FSampleVector::iterator* part2Begin, FSampleVector::iterator* part2End);
 	uint readCommit(uint count);
 
 signals:
@@ -20,9 +20,12 @@
 
 SampleSourceFifo::SampleSourceFifo(uint32_t size) :
     m_size(size),
-    m_init(false)
+    m_init(false),
+    m_underrunCount(0),
+    m_underrunSamples(0)
 {
     m_data.resize(2*m_size);
+    m_pendingTimer.invalidate();
     init();
 }
 
@@ -52,13 +55,43 @@ void SampleSourceFifo::readAdvance(SampleVector::iterator& readUntil, unsigned i
 {
 //    QMutexLocker mutexLocker(&m_mutex);
     assert(nbSamples <= m_size/2);
+    m_readerScheduling.check();
+
+    m_mutex.lock();
+
+    if (!m_pendingTimer.isValid()) {
+        m_pendingTimer.start();
+    }
+
+    m_mutex.unlock();
     emit dataWrite(nbSamples);
 
+    uint32_t written = fill();
+
+    if (nbSamples > written)
+    {
+        m_underrunCount++;
+        m_underrunSamples += nbSamples - written;
+    }
+
     m_ir = (m_ir + nbSamples) % m_size;
     readUntil =  m_data.begin() + m_size + m_ir;
     emit dataRead(nbSamples);
 }
 
+qint64 SampleSourceFifo::takeReadLatency()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_pendingTimer.isValid()) {
+        return -1;
+    }
+
+    qint64 latency = m_pendingTimer.nsecsElapsed();
+    m_pendingTimer.invalidate();
+    return latency;
+}
+
 void SampleSourceFifo::write(const Sample& sample)
 {
     m_data[m_iw] = sample;
@@ -19,9 +19,11 @@
 
 #include <QObject>
 #include <QMutex>
+#include <QElapsedTimer>
 #include <stdint.h>
 #include <assert.h>
 #include "util/export.h"
+#include "util/threadscheduling.h"
 #include "dsp/dsptypes.h"
 
 class SDRANGEL_API SampleSourceFifo : public QObject {
@@ -43,13 +45,24 @@ public:
 
     void write(const Sample& sample);                        //!< write directly - phase 1 + phase 2
 
+    uint32_t fill() const { return (m_iw + m_size - m_ir) % m_size; } //!< number of samples written ahead of the read pointer
+    quint64 getUnderrunCount() const { return m_underrunCount; }      //!< number of read advances past the write pointer
+    quint64 getUnderrunSamples() const { return m_underrunSamples; }  //!< number of samples read again because not written in time
+    void resetCounters() { m_underrunCount = 0; m_underrunSamples = 0; }
+    qint64 takeReadLatency(); //!< ns since the oldest read advance not yet taken by the writer or -1 if none
+    ThreadSchedulingHook& getReaderScheduling() { return m_readerScheduling; } //!< applied to the threads that read
+
 private:
     uint32_t m_size;
     SampleVector m_data;
     uint32_t m_iw;
     uint32_t m_ir;
     bool m_init;
+    quint64 m_underrunCount;
+    quint64 m_underrunSamples;
     QMutex m_mutex;
+    QElapsedTimer m_pendingTimer; //!< started at the first read advance not yet seen by the writer
+    ThreadSchedulingHook m_readerScheduling;
 
 signals:
     void dataWrite(int nbSamples); // signal data is read past a threshold and writing new samples to fill in is needed
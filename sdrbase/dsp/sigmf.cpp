@@ -0,0 +1,302 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <string.h>
+
+#include <QFile>
+#include <QDateTime>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QDebug>
+
+#include "dsp/sigmf.h"
+
+SigMFMeta::SigMFMeta() :
+    m_format(SampleFormat::getNativeFormat()),
+    m_sampleRate(0)
+{
+}
+
+bool SigMFMeta::write(const QString& fileName) const
+{
+    QJsonObject global;
+    global["core:datatype"] = QString(SampleFormat::getSigMFDatatype(m_format));
+    global["core:sample_rate"] = m_sampleRate;
+    global["core:version"] = QString("0.0.1");
+    global["core:recorder"] = QString("SDRangel");
+
+    if (!m_description.isEmpty()) {
+        global["core:description"] = m_description;
+    }
+
+    if (m_format == SampleFormat::FormatCI24) {
+        global["sdrangel:sample_size"] = 24;
+    }
+
+    QJsonArray captures;
+
+    for (QList<Capture>::const_iterator it = m_captures.begin(); it != m_captures.end(); ++it)
+    {
+        QJsonObject capture;
+        capture["core:sample_start"] = (qint64) it->m_sampleStart;
+        capture["core:frequency"] = (double) it->m_frequency;
+
+        if (it->m_dateTimeMs != 0) {
+            capture["core:datetime"] = QDateTime::fromMSecsSinceEpoch(it->m_dateTimeMs).toUTC().toString("yyyy-MM-ddTHH:mm:ss.zzzZ");
+        }
+
+        captures.append(capture);
+    }
+
+    QJsonArray annotations;
+
+    for (QList<Annotation>::const_iterator it = m_annotations.begin(); it != m_annotations.end(); ++it)
+    {
+        QJsonObject annotation;
+        annotation["core:sample_start"] = (qint64) it->m_sampleStart;
+
+        if (it->m_sampleCount != 0) {
+            annotation["core:sample_count"] = (qint64) it->m_sampleCount;
+        }
+
+        annotation["core:label"] = it->m_label;
+
+        if (!it->m_comment.isEmpty()) {
+            annotation["core:comment"] = it->m_comment;
+        }
+
+        annotations.append(annotation);
+    }
+
+    QJsonObject meta;
+    meta["global"] = global;
+    meta["captures"] = captures;
+    meta["annotations"] = annotations;
+
+    QString tmpFileName = fileName + ".tmp";
+    QFile file(tmpFileName);
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("SigMFMeta::write: cannot open %s", qPrintable(tmpFileName));
+        return false;
+    }
+
+    bool ok = file.write(QJsonDocument(meta).toJson()) >= 0;
+    file.close();
+    QFile::remove(fileName);
+
+    if (!ok || !QFile::rename(tmpFileName, fileName))
+    {
+        qWarning("SigMFMeta::write: cannot write %s", qPrintable(fileName));
+        return false;
+    }
+
+    return true;
+}
+
+bool SigMFMeta::read(const QString& fileName, QString& errorMessage)
+{
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        errorMessage = QString("Cannot open %1").arg(fileName);
+        return false;
+    }
+
+    QJsonParseError parseError;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+
+    if (!doc.isObject())
+    {
+        errorMessage = QString("%1: %2").arg(fileName).arg(parseError.errorString());
+        return false;
+    }
+
+    QJsonObject meta = doc.object();
+    QJsonObject global = meta["global"].toObject();
+    QString datatype = global["core:datatype"].toString();
+
+    if (!SampleFormat::fromSigMFDatatype(datatype, global["sdrangel:sample_size"].toInt(0), m_format))
+    {
+        errorMessage = QString("%1: unsupported datatype %2").arg(fileName).arg(datatype);
+        return false;
+    }
+
+    m_sampleRate = (int) global["core:sample_rate"].toDouble(0);
+    m_description = global["core:description"].toString();
+
+    if (m_sampleRate <= 0)
+    {
+        errorMessage = QString("%1: no sample rate").arg(fileName);
+        return false;
+    }
+
+    m_captures.clear();
+    QJsonArray captures = meta["captures"].toArray();
+
+    for (QJsonArray::const_iterator it = captures.begin(); it != captures.end(); ++it)
+    {
+        QJsonObject capture = (*it).toObject();
+        Capture c;
+        c.m_sampleStart = (quint64) capture["core:sample_start"].toDouble(0);
+        c.m_frequency = (quint64) capture["core:frequency"].toDouble(0);
+        QDateTime dateTime = QDateTime::fromString(capture["core:datetime"].toString(), Qt::ISODate);
+        c.m_dateTimeMs = dateTime.isValid() ? dateTime.toMSecsSinceEpoch() : 0;
+        m_captures.append(c);
+    }
+
+    if (m_captures.isEmpty()) // optional in SigMF
+    {
+        Capture c;
+        c.m_sampleStart = 0;
+        c.m_frequency = 0;
+        c.m_dateTimeMs = 0;
+        m_captures.append(c);
+    }
+
+    m_annotations.clear();
+    QJsonArray annotations = meta["annotations"].toArray();
+
+    for (QJsonArray::const_iterator it = annotations.begin(); it != annotations.end(); ++it)
+    {
+        QJsonObject annotation = (*it).toObject();
+        Annotation a;
+        a.m_sampleStart = (quint64) annotation["core:sample_start"].toDouble(0);
+        a.m_sampleCount = (quint64) annotation["core:sample_count"].toDouble(0);
+        a.m_label = annotation["core:label"].toString();
+        a.m_comment = annotation["core:comment"].toString();
+        m_annotations.append(a);
+    }
+
+    return true;
+}
+
+bool SigMFMeta::isSigMF(const QString& fileName)
+{
+    return fileName.endsWith(".sigmf-meta") || fileName.endsWith(".sigmf-data") || fileName.endsWith(".sigmf-idx");
+}
+
+QString SigMFMeta::getBaseName(const QString& fileName)
+{
+    int dot = fileName.lastIndexOf('.');
+
+    if ((dot > 0) && (isSigMF(fileName) || fileName.endsWith(".sdriq"))) {
+        return fileName.left(dot);
+    } else {
+        return fileName;
+    }
+}
+
+SigMFIndex::SigMFIndex() :
+    m_startMs(0),
+    m_periodMs(1000),
+    m_nbEntries(0)
+{
+}
+
+SigMFIndex::~SigMFIndex()
+{
+    close();
+}
+
+bool SigMFIndex::create(const QString& fileName, qint64 startMs, int periodMs)
+{
+    close();
+    m_file.open(fileName.toStdString().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!m_file.is_open()) {
+        return false;
+    }
+
+    m_startMs = startMs;
+    m_periodMs = periodMs;
+    m_nbEntries = 0;
+    qint32 reserved = 0;
+    m_file.write("SDRIDX1", 8); // with the terminating null
+    m_file.write((const char *) &m_startMs, sizeof(qint64));
+    m_file.write((const char *) &m_periodMs, sizeof(qint32));
+    m_file.write((const char *) &reserved, sizeof(qint32));
+    return !m_file.fail();
+}
+
+void SigMFIndex::update(quint64 sampleIndex, qint64 nowMs)
+{
+    // one entry per period started up to now: periods without samples get the next sample
+    while (m_startMs + (qint64) m_nbEntries * m_periodMs <= nowMs)
+    {
+        m_file.write((const char *) &sampleIndex, sizeof(quint64));
+        m_nbEntries++;
+    }
+}
+
+bool SigMFIndex::open(const QString& fileName)
+{
+    close();
+    m_file.open(fileName.toStdString().c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+
+    if (!m_file.is_open()) {
+        return false;
+    }
+
+    qint64 fileSize = m_file.tellg();
+    char magic[8];
+    m_file.seekg(0, std::ios::beg);
+    m_file.read(magic, 8);
+    m_file.read((char *) &m_startMs, sizeof(qint64));
+    m_file.read((char *) &m_periodMs, sizeof(qint32));
+
+    if (m_file.fail() || (memcmp(magic, "SDRIDX1", 8) != 0) || (m_periodMs <= 0))
+    {
+        qWarning("SigMFIndex::open: %s is not a valid index", qPrintable(fileName));
+        close();
+        return false;
+    }
+
+    m_nbEntries = (fileSize - m_headerSize) / sizeof(quint64);
+    return true;
+}
+
+void SigMFIndex::close()
+{
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+
+    m_file.clear();
+}
+
+bool SigMFIndex::lookup(qint64 timeMs, quint64& sampleIndex)
+{
+    if (!m_file.is_open() || (timeMs < 0)) {
+        return false;
+    }
+
+    quint64 entry = timeMs / m_periodMs;
+
+    if (entry >= m_nbEntries) {
+        return false;
+    }
+
+    m_file.clear();
+    m_file.seekg(m_headerSize + entry*sizeof(quint64), std::ios::beg);
+    m_file.read((char *) &sampleIndex, sizeof(quint64));
+    return !m_file.fail();
+}
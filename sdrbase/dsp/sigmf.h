@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_DSP_SIGMF_H_
+#define SDRBASE_DSP_SIGMF_H_
+
+#include <fstream>
+
+#include <QString>
+#include <QList>
+
+#include "dsp/sampleformat.h"
+#include "util/export.h"
+
+/**
+ * SigMF (https://github.com/gnuradio/SigMF) recording metadata. A recording is a set of files
+ * with the same base name: <base>.sigmf-data holds the raw samples, <base>.sigmf-meta the JSON
+ * metadata (global fields, capture segments and annotations) and <base>.sigmf-idx the time index
+ * (see SigMFIndex).
+ */
+class SDRANGEL_API SigMFMeta
+{
+public:
+    struct Capture
+    {
+        quint64 m_sampleStart;
+        quint64 m_frequency;  //!< Hz
+        qint64 m_dateTimeMs;  //!< ms since epoch of the first sample. 0 if unknown.
+    };
+
+    struct Annotation
+    {
+        quint64 m_sampleStart;
+        quint64 m_sampleCount; //!< 0 for a point in time
+        QString m_label;
+        QString m_comment;
+    };
+
+    SampleFormat::Format m_format;
+    int m_sampleRate;
+    QString m_description;
+    QList<Capture> m_captures;       //!< at least one when valid
+    QList<Annotation> m_annotations;
+
+    SigMFMeta();
+
+    /** Writes to a temporary file first so that a valid file is kept if it is interrupted */
+    bool write(const QString& fileName) const;
+    bool read(const QString& fileName, QString& errorMessage);
+
+    static bool isSigMF(const QString& fileName); //!< by extension
+    static QString getBaseName(const QString& fileName); //!< without SigMF or .sdriq extension
+    static QString getDataFileName(const QString& baseName) { return baseName + ".sigmf-data"; }
+    static QString getMetaFileName(const QString& baseName) { return baseName + ".sigmf-meta"; }
+    static QString getIndexFileName(const QString& baseName) { return baseName + ".sigmf-idx"; }
+};
+
+/**
+ * Time index of a recording: the number of the first sample received at or after each period
+ * from the start time. Seeking to a time is a direct read of one entry. It reflects the actual
+ * arrival time of the samples, including any gap or sample rate drift of the source.
+ *
+ * File layout: "SDRIDX1" and a null byte, start time (qint64 ms since epoch), period
+ * (qint32 ms), reserved (qint32) then one quint64 sample number per period. Little endian.
+ */
+class SDRANGEL_API SigMFIndex
+{
+public:
+    SigMFIndex();
+    ~SigMFIndex();
+
+    bool create(const QString& fileName, qint64 startMs, int periodMs);
+    void update(quint64 sampleIndex, qint64 nowMs); //!< adds an entry for each period started up to now
+    bool open(const QString& fileName);             //!< for reading
+    void close();
+    bool isOpen() const { return m_file.is_open(); }
+
+    qint64 getStartMs() const { return m_startMs; }
+    int getPeriodMs() const { return m_periodMs; }
+    /** Sample at time ms since the start. Returns false if there is no entry for that time. */
+    bool lookup(qint64 timeMs, quint64& sampleIndex);
+
+private:
+    static const int m_headerSize = 24;
+
+    std::fstream m_file;
+    qint64 m_startMs;
+    int m_periodMs;
+    quint64 m_nbEntries;
+};
+
+#endif /* SDRBASE_DSP_SIGMF_H_ */
@@ -0,0 +1,535 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+
+#include "spectrumarchive.h"
+
+const float SpectrumArchive::m_dbStep = 0.5f;
+
+namespace
+{
+    struct IndexEntry
+    {
+        qint64 m_firstMs;
+        qint64 m_lastMs;
+        quint64 m_offset;
+        quint32 m_nbSpectra;
+    };
+
+    bool readIndexEntry(QFile& indexFile, qint64 entryIndex, IndexEntry& entry)
+    {
+        if (!indexFile.seek(SpectrumArchive::m_indexHeaderSize + entryIndex * SpectrumArchive::m_indexEntrySize)) {
+            return false;
+        }
+
+        QByteArray data = indexFile.read(SpectrumArchive::m_indexEntrySize);
+
+        if (data.size() != SpectrumArchive::m_indexEntrySize) {
+            return false;
+        }
+
+        QDataStream stream(data);
+        stream.setByteOrder(QDataStream::LittleEndian);
+        stream >> entry.m_firstMs >> entry.m_lastMs >> entry.m_offset >> entry.m_nbSpectra;
+        return true;
+    }
+
+    const char indexMagic[SpectrumArchive::m_indexHeaderSize] = {'S', 'D', 'R', 'S', 'P', 'I', 'X', '1'};
+}
+
+SpectrumArchive::Settings::Settings()
+{
+    resetToDefaults();
+}
+
+void SpectrumArchive::Settings::resetToDefaults()
+{
+    m_fileBase = "spectrum";
+    m_fftSize = 1024;
+    m_period = 10.0f;
+    m_dbMin = -140.0f;
+    m_blockSpectra = 360;
+}
+
+SpectrumArchive::Writer::Writer(SpectrumArchive *archive) :
+    m_archive(archive)
+{
+}
+
+void SpectrumArchive::Writer::run()
+{
+    m_archive->writeFrames();
+}
+
+SpectrumArchive::SpectrumArchive(const Settings& settings, int deviceSetIndex, Real scalef) :
+    SpectrumStreamSink(deviceSetIndex, scalef, getStreamSettings(settings)),
+    m_settings(settings),
+    m_archiveFile(getArchiveFileName(settings.m_fileBase)),
+    m_indexFile(getIndexFileName(settings.m_fileBase)),
+    m_running(true),
+    m_writer(this),
+    m_blockStartMs(0),
+    m_blockCenterFrequency(0),
+    m_blockSampleRate(0),
+    m_blockNbBins(0)
+{
+    setObjectName("SpectrumArchive");
+
+    if (m_settings.m_blockSpectra < 1) {
+        m_settings.m_blockSpectra = 1;
+    }
+
+    m_report.m_fileName = m_archiveFile.fileName();
+    m_report.m_nbSpectra = 0;
+    m_report.m_nbBlocks = 0;
+    m_report.m_writtenBytes = 0;
+    m_report.m_rawBytes = 0;
+    m_report.m_droppedSpectra = 0;
+    m_report.m_lastTimeMs = 0;
+
+    connect(this, SIGNAL(frameReady(QByteArray)), this, SLOT(addFrame(QByteArray)), Qt::DirectConnection);
+
+    if (openFiles()) {
+        m_writer.start();
+    }
+}
+
+SpectrumArchive::~SpectrumArchive()
+{
+    if (m_writer.isRunning())
+    {
+        m_mutex.lock();
+        m_running = false;
+        m_writerCondition.wakeAll();
+        m_mutex.unlock();
+        m_writer.wait(); // writes the current block
+    }
+
+    m_archiveFile.close();
+    m_indexFile.close();
+}
+
+SpectrumStreamSink::Settings SpectrumArchive::getStreamSettings(const Settings& settings)
+{
+    SpectrumStreamSink::Settings streamSettings;
+    streamSettings.m_fftSize = settings.m_fftSize;
+    streamSettings.m_framePeriodMs = settings.m_period * 1000.0f;
+    streamSettings.m_binFormat = SpectrumStreamSink::BinFormatU8;
+    streamSettings.m_dbOffset = settings.m_dbMin;
+    streamSettings.m_dbRange = 255.0f * m_dbStep;
+    return streamSettings;
+}
+
+bool SpectrumArchive::openFiles()
+{
+    if (!m_archiveFile.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        m_report.m_errorMessage = QString("Cannot open %1: %2").arg(m_archiveFile.fileName()).arg(m_archiveFile.errorString());
+        return false;
+    }
+
+    if (!m_indexFile.open(QIODevice::ReadWrite))
+    {
+        m_report.m_errorMessage = QString("Cannot open %1: %2").arg(m_indexFile.fileName()).arg(m_indexFile.errorString());
+        m_archiveFile.close();
+        return false;
+    }
+
+    qint64 indexSize = m_indexFile.size();
+
+    if (indexSize < m_indexHeaderSize)
+    {
+        m_indexFile.resize(0);
+        m_indexFile.write(indexMagic, m_indexHeaderSize);
+    }
+    else if (m_indexFile.read(m_indexHeaderSize) != QByteArray(indexMagic, m_indexHeaderSize))
+    {
+        m_report.m_errorMessage = QString("%1 is not a spectrum archive index").arg(m_indexFile.fileName());
+        m_archiveFile.close();
+        m_indexFile.close();
+        return false;
+    }
+    else if ((indexSize - m_indexHeaderSize) % m_indexEntrySize != 0) // interrupted while writing an entry
+    {
+        m_indexFile.resize(indexSize - ((indexSize - m_indexHeaderSize) % m_indexEntrySize));
+    }
+
+    m_indexFile.seek(m_indexFile.size());
+    qDebug("SpectrumArchive::openFiles: %s: %lld bytes archived", qPrintable(m_archiveFile.fileName()), m_archiveFile.size());
+    return true;
+}
+
+void SpectrumArchive::addFrame(QByteArray frame)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_running) {
+        return;
+    }
+
+    if (m_pendingFrames.size() < m_maxPendingFrames)
+    {
+        m_pendingFrames.append(frame);
+        m_writerCondition.wakeAll();
+    }
+    else
+    {
+        m_report.m_droppedSpectra++;
+    }
+}
+
+void SpectrumArchive::getReport(Report& report)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    report = m_report;
+}
+
+void SpectrumArchive::writeFrames()
+{
+    QList<QByteArray> frames;
+    bool running = true;
+
+    while (running)
+    {
+        m_mutex.lock();
+
+        if (m_pendingFrames.isEmpty() && m_running) {
+            m_writerCondition.wait(&m_mutex, 1000);
+        }
+
+        frames.swap(m_pendingFrames);
+        running = m_running;
+        m_mutex.unlock();
+
+        for (int i = 0; i < frames.size(); i++) {
+            appendFrame(frames[i]);
+        }
+
+        frames.clear();
+
+        if (!m_blockTimes.empty() && (!running || (QDateTime::currentMSecsSinceEpoch() - m_blockStartMs >= m_maxBlockTimeMs))) {
+            writeBlock();
+        }
+    }
+}
+
+void SpectrumArchive::appendFrame(const QByteArray& frame)
+{
+    if (frame.size() < m_frameHeaderSize) {
+        return;
+    }
+
+    QDataStream stream(frame);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    quint32 magic, frameSize, sequence, sampleRate;
+    quint8 version, binFormat;
+    quint16 deviceSetIndex, nbBins, nbAverage;
+    quint64 timeMs;
+    qint64 centerFrequency;
+    stream >> magic >> version >> binFormat >> deviceSetIndex >> frameSize >> sequence >> timeMs >> centerFrequency >> sampleRate >> nbBins >> nbAverage;
+
+    if ((magic != m_frameMagic) || (binFormat != BinFormatU8) || (frame.size() != m_frameHeaderSize + nbBins)) {
+        return;
+    }
+
+    if (!m_blockTimes.empty()
+        && ((nbBins != m_blockNbBins)
+         || (centerFrequency != m_blockCenterFrequency)
+         || (sampleRate != m_blockSampleRate)
+         || ((int) m_blockTimes.size() >= m_settings.m_blockSpectra)
+         || ((qint64) timeMs - m_blockStartMs >= m_maxBlockTimeMs)
+         || ((qint64) timeMs < m_blockStartMs)))
+    {
+        writeBlock();
+    }
+
+    if (m_blockTimes.empty())
+    {
+        m_blockStartMs = timeMs;
+        m_blockCenterFrequency = centerFrequency;
+        m_blockSampleRate = sampleRate;
+        m_blockNbBins = nbBins;
+    }
+
+    const quint8 *codes = (const quint8 *) frame.constData() + m_frameHeaderSize;
+    m_blockTimes.push_back(timeMs - m_blockStartMs);
+    m_blockAverages.push_back(nbAverage);
+    m_blockCodes.insert(m_blockCodes.end(), codes, codes + nbBins);
+
+    QMutexLocker mutexLocker(&m_mutex);
+    m_report.m_nbSpectra++;
+    m_report.m_rawBytes += frame.size();
+    m_report.m_lastTimeMs = timeMs;
+}
+
+void SpectrumArchive::writeBlock()
+{
+    int nbSpectra = m_blockTimes.size();
+    int nbBins = m_blockNbBins;
+
+    // payload: times, averages then delta coded bins columns
+    QByteArray payload;
+    payload.reserve(nbSpectra * (6 + nbBins));
+    QDataStream payloadStream(&payload, QIODevice::WriteOnly);
+    payloadStream.setByteOrder(QDataStream::LittleEndian);
+
+    for (int i = 0; i < nbSpectra; i++) {
+        payloadStream << m_blockTimes[i];
+    }
+
+    for (int i = 0; i < nbSpectra; i++) {
+        payloadStream << m_blockAverages[i];
+    }
+
+    int columnsStart = payload.size();
+    payload.resize(columnsStart + nbSpectra * nbBins);
+    quint8 *columns = (quint8 *) payload.data() + columnsStart;
+
+    for (int bin = 0; bin < nbBins; bin++)
+    {
+        quint8 previous = 0;
+
+        for (int i = 0; i < nbSpectra; i++)
+        {
+            quint8 code = m_blockCodes[i * nbBins + bin];
+            *columns++ = code - previous;
+            previous = code;
+        }
+    }
+
+    QByteArray compressed = qCompress(payload, 9);
+
+    QByteArray header;
+    QDataStream headerStream(&header, QIODevice::WriteOnly);
+    headerStream.setByteOrder(QDataStream::LittleEndian);
+    headerStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    headerStream << m_blockMagic
+        << m_blockVersion
+        << (quint8) 0
+        << (quint16) nbBins
+        << (quint32) nbSpectra
+        << (quint32) compressed.size()
+        << m_blockStartMs
+        << m_blockCenterFrequency
+        << m_blockSampleRate
+        << m_settings.m_dbMin
+        << m_dbStep
+        << (quint32) 0;
+
+    quint64 offset = m_archiveFile.size();
+    bool ok = (m_archiveFile.write(header) == header.size())
+        && (m_archiveFile.write(compressed) == compressed.size())
+        && m_archiveFile.flush();
+
+    if (ok)
+    {
+        QByteArray entry;
+        QDataStream entryStream(&entry, QIODevice::WriteOnly);
+        entryStream.setByteOrder(QDataStream::LittleEndian);
+        entryStream << m_blockStartMs
+            << (qint64) (m_blockStartMs + m_blockTimes.back())
+            << offset
+            << (quint32) nbSpectra
+            << (quint32) 0;
+        ok = (m_indexFile.write(entry) == entry.size()) && m_indexFile.flush();
+    }
+
+    m_blockTimes.clear();
+    m_blockAverages.clear();
+    m_blockCodes.clear();
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (ok)
+    {
+        m_report.m_nbBlocks++;
+        m_report.m_writtenBytes += header.size() + compressed.size();
+    }
+    else
+    {
+        m_report.m_errorMessage = QString("Write error: %1 %2").arg(m_archiveFile.errorString()).arg(m_indexFile.errorString());
+        qWarning("SpectrumArchive::writeBlock: %s", qPrintable(m_report.m_errorMessage));
+    }
+}
+
+bool SpectrumArchive::query(
+        const QString& fileBase,
+        qint64 fromMs,
+        qint64 toMs,
+        int maxSpectra,
+        QList<Spectrum>& spectra,
+        QString& errorMessage)
+{
+    if (toMs < fromMs) {
+        return true;
+    }
+
+    QFile indexFile(getIndexFileName(fileBase));
+    QFile archiveFile(getArchiveFileName(fileBase));
+
+    if (!indexFile.open(QIODevice::ReadOnly) || !archiveFile.open(QIODevice::ReadOnly))
+    {
+        errorMessage = QString("Cannot open spectrum archive %1").arg(fileBase);
+        return false;
+    }
+
+    if (indexFile.read(m_indexHeaderSize) != QByteArray(indexMagic, m_indexHeaderSize))
+    {
+        errorMessage = QString("%1 is not a spectrum archive index").arg(indexFile.fileName());
+        return false;
+    }
+
+    qint64 nbEntries = (indexFile.size() - m_indexHeaderSize) / m_indexEntrySize;
+    IndexEntry entry;
+
+    // first block ending at or after fromMs
+    qint64 low = 0, high = nbEntries;
+
+    while (low < high)
+    {
+        qint64 middle = (low + high) / 2;
+
+        if (!readIndexEntry(indexFile, middle, entry))
+        {
+            errorMessage = QString("Cannot read %1").arg(indexFile.fileName());
+            return false;
+        }
+
+        if (entry.m_lastMs < fromMs) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    qint64 range = toMs - fromMs + 1;
+    qint64 lastBucket = -1;
+    std::vector<quint8> codes;
+
+    for (qint64 entryIndex = low; entryIndex < nbEntries; entryIndex++)
+    {
+        if (!readIndexEntry(indexFile, entryIndex, entry)) {
+            break;
+        }
+
+        if (entry.m_firstMs > toMs) {
+            break;
+        }
+
+        archiveFile.seek(entry.m_offset);
+        QByteArray header = archiveFile.read(m_blockHeaderSize);
+
+        if (header.size() != m_blockHeaderSize) {
+            break;
+        }
+
+        QDataStream headerStream(header);
+        headerStream.setByteOrder(QDataStream::LittleEndian);
+        headerStream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+        quint32 magic, nbSpectra, compressedSize, sampleRate, reserved;
+        quint8 version, reserved8;
+        quint16 nbBins;
+        qint64 startMs, centerFrequency;
+        float dbOffset, dbStep;
+        headerStream >> magic >> version >> reserved8 >> nbBins >> nbSpectra >> compressedSize
+            >> startMs >> centerFrequency >> sampleRate >> dbOffset >> dbStep >> reserved;
+
+        if ((magic != m_blockMagic) || (version != m_blockVersion))
+        {
+            errorMessage = QString("Invalid block at offset %1 of %2").arg(entry.m_offset).arg(archiveFile.fileName());
+            return false;
+        }
+
+        QByteArray payload = qUncompress(archiveFile.read(compressedSize));
+
+        if (payload.size() != (int) (nbSpectra * (6 + nbBins)))
+        {
+            errorMessage = QString("Corrupted block at offset %1 of %2").arg(entry.m_offset).arg(archiveFile.fileName());
+            return false;
+        }
+
+        QDataStream payloadStream(payload);
+        payloadStream.setByteOrder(QDataStream::LittleEndian);
+        std::vector<quint32> times(nbSpectra);
+
+        for (quint32 i = 0; i < nbSpectra; i++) {
+            payloadStream >> times[i];
+        }
+
+        // undo the delta coding into spectrum after spectrum order
+        const quint8 *columns = (const quint8 *) payload.constData() + nbSpectra * 6;
+        codes.resize(nbSpectra * nbBins);
+
+        for (int bin = 0; bin < nbBins; bin++)
+        {
+            quint8 code = 0;
+
+            for (quint32 i = 0; i < nbSpectra; i++)
+            {
+                code += *columns++;
+                codes[i * nbBins + bin] = code;
+            }
+        }
+
+        for (quint32 i = 0; i < nbSpectra; i++)
+        {
+            qint64 timeMs = startMs + times[i];
+
+            if ((timeMs < fromMs) || (timeMs > toMs)) {
+                continue;
+            }
+
+            const quint8 *spectrumCodes = &codes[i * nbBins];
+            qint64 bucket = maxSpectra > 0 ? ((timeMs - fromMs) * maxSpectra) / range : -1;
+
+            if ((bucket >= 0) && (bucket == lastBucket)
+                && (spectra.back().m_codes.size() == nbBins)
+                && (spectra.back().m_centerFrequency == centerFrequency)
+                && (spectra.back().m_sampleRate == (int) sampleRate))
+            {
+                quint8 *merged = (quint8 *) spectra.back().m_codes.data();
+
+                for (int bin = 0; bin < nbBins; bin++) {
+                    merged[bin] = std::max(merged[bin], spectrumCodes[bin]);
+                }
+
+                spectra.back().m_nbMerged++;
+            }
+            else
+            {
+                spectra.append(Spectrum());
+                Spectrum& spectrum = spectra.back();
+                spectrum.m_timeMs = timeMs;
+                spectrum.m_centerFrequency = centerFrequency;
+                spectrum.m_sampleRate = sampleRate;
+                spectrum.m_dbOffset = dbOffset;
+                spectrum.m_dbStep = dbStep;
+                spectrum.m_nbMerged = 1;
+                spectrum.m_codes = QByteArray((const char *) spectrumCodes, nbBins);
+                lastBucket = bucket;
+            }
+        }
+    }
+
+    return true;
+}
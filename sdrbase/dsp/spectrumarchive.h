@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_DSP_SPECTRUMARCHIVE_H_
+#define SDRBASE_DSP_SPECTRUMARCHIVE_H_
+
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QByteArray>
+#include <QList>
+#include <QFile>
+#include <QString>
+
+#include "dsp/spectrumstreamsink.h"
+#include "util/export.h"
+
+/**
+ * Long term spectrum archive. The baseband power spectrum is averaged over a period of typically
+ * seconds to minutes (SpectrumStreamSink) and each averaged spectrum is quantized to 8 bit dB codes
+ * in 0.5 dB steps. Spectra are grouped in blocks stored column wise: the codes of one bin over time
+ * are contiguous and delta coded from one spectrum to the next so that a stable band gives runs of
+ * zeros. Each block is then zlib compressed (qCompress).
+ *
+ * The archive is <fileBase>.sdrspec, a sequence of blocks with a 48 byte little endian header:
+ *
+ * | offset | type   | content                                             |
+ * |--------|--------|-----------------------------------------------------|
+ * | 0      | uint32 | magic 0x42505344 ("DSPB" in memory)                 |
+ * | 4      | uint8  | block version (1)                                   |
+ * | 5      | uint8  | reserved                                            |
+ * | 6      | uint16 | number of bins                                      |
+ * | 8      | uint32 | number of spectra                                   |
+ * | 12     | uint32 | compressed payload size in bytes                    |
+ * | 16     | int64  | time of the first spectrum in ms since epoch        |
+ * | 24     | int64  | center frequency (Hz)                               |
+ * | 32     | uint32 | sample rate (S/s)                                   |
+ * | 36     | float  | dB value of code 0                                  |
+ * | 40     | float  | dB per code step                                    |
+ * | 44     | uint32 | reserved                                            |
+ *
+ * The uncompressed payload is one uint32 time offset in ms from the first spectrum and one uint16
+ * number of FFTs averaged per spectrum, then for each bin from the lowest frequency the code of the
+ * first spectrum followed by the differences modulo 256 with the previous spectrum.
+ *
+ * The time index <fileBase>.sdrspec-idx is "SDRSPIX1" followed by one 32 byte entry per block:
+ * time of the first and last spectra (int64 ms), offset of the block in the archive (uint64), number of
+ * spectra (uint32) and reserved (uint32). Entries are written after their block so a reader never sees
+ * an incomplete block. A block ends when it is full, after m_maxBlockTimeMs, when the center frequency,
+ * sample rate or FFT size changes or when archiving stops. An existing archive is appended to.
+ *
+ * Quantization and storage run in a writer thread. The DSP thread only computes the spectra.
+ */
+class SDRANGEL_API SpectrumArchive : public SpectrumStreamSink {
+    Q_OBJECT
+
+public:
+    struct Settings
+    {
+        QString m_fileBase;   //!< archive is <fileBase>.sdrspec and its index <fileBase>.sdrspec-idx
+        int m_fftSize;        //!< bins per spectrum (power of two from 64 to 4096)
+        float m_period;       //!< seconds of averaging per spectrum
+        float m_dbMin;        //!< dB of code 0. Codes cover m_dbMin to m_dbMin + 127.5 dB
+        int m_blockSpectra;   //!< spectra per compressed block
+
+        Settings();
+        void resetToDefaults();
+    };
+
+    struct Report
+    {
+        QString m_fileName;
+        quint64 m_nbSpectra;      //!< written in this session
+        quint32 m_nbBlocks;
+        quint64 m_writtenBytes;   //!< compressed blocks with headers
+        quint64 m_rawBytes;       //!< size of the same spectra as uint8 stream frames (SpectrumStreamSink)
+        quint64 m_droppedSpectra; //!< writer did not keep up
+        qint64 m_lastTimeMs;      //!< time of the last spectrum received. 0 if none
+        QString m_errorMessage;
+    };
+
+    /** Spectrum read back from the archive */
+    struct Spectrum
+    {
+        qint64 m_timeMs;          //!< ms since epoch of the first merged spectrum
+        qint64 m_centerFrequency;
+        int m_sampleRate;
+        float m_dbOffset;         //!< dB of code 0
+        float m_dbStep;           //!< dB per code
+        int m_nbMerged;           //!< archived spectra merged by maximum in this one
+        QByteArray m_codes;       //!< one code per bin from the lowest frequency
+    };
+
+    static const quint32 m_blockMagic = 0x42505344;
+    static const quint8 m_blockVersion = 1;
+    static const int m_blockHeaderSize = 48;
+    static const int m_indexHeaderSize = 8;
+    static const int m_indexEntrySize = 32;
+    static const float m_dbStep;
+
+    SpectrumArchive(const Settings& settings, int deviceSetIndex, Real scalef);
+    virtual ~SpectrumArchive();
+
+    bool isOpen() const { return m_archiveFile.isOpen(); }
+    const Settings& getSettings() const { return m_settings; }
+    void getReport(Report& report);
+
+    static QString getArchiveFileName(const QString& fileBase) { return fileBase + ".sdrspec"; }
+    static QString getIndexFileName(const QString& fileBase) { return fileBase + ".sdrspec-idx"; }
+
+    /**
+     * Reads the spectra from fromMs to toMs (ms since epoch, included) with a binary search in the
+     * index. If maxSpectra is more than 0 the time range is divided in maxSpectra intervals and the
+     * spectra of each interval are merged keeping the maximum of each bin, which shows occupancy.
+     * Can be used while the archive is being written.
+     */
+    static bool query(
+            const QString& fileBase,
+            qint64 fromMs,
+            qint64 toMs,
+            int maxSpectra,
+            QList<Spectrum>& spectra,
+            QString& errorMessage);
+
+private slots:
+    void addFrame(QByteArray frame); //!< called in the DSP thread
+
+private:
+    class Writer : public QThread
+    {
+    public:
+        Writer(SpectrumArchive *archive);
+
+    protected:
+        virtual void run();
+
+    private:
+        SpectrumArchive *m_archive;
+    };
+
+    static const int m_maxPendingFrames = 4096;
+    static const qint64 m_maxBlockTimeMs = 600000; //!< a block is written at least every 10 minutes
+
+    Settings m_settings;
+    QFile m_archiveFile; //!< writer thread only after construction
+    QFile m_indexFile;
+
+    QMutex m_mutex;      //!< guards the members below
+    QWaitCondition m_writerCondition;
+    bool m_running;
+    QList<QByteArray> m_pendingFrames;
+    Report m_report;
+
+    Writer m_writer;
+
+    // current block (writer thread only)
+    std::vector<quint32> m_blockTimes;
+    std::vector<quint16> m_blockAverages;
+    std::vector<quint8> m_blockCodes; //!< spectrum after spectrum
+    qint64 m_blockStartMs;
+    qint64 m_blockCenterFrequency;
+    quint32 m_blockSampleRate;
+    int m_blockNbBins;
+
+    static SpectrumStreamSink::Settings getStreamSettings(const Settings& settings);
+    bool openFiles();
+    void writeFrames();
+    void appendFrame(const QByteArray& frame);
+    void writeBlock();
+};
+
+#endif /* SDRBASE_DSP_SPECTRUMARCHIVE_H_ */
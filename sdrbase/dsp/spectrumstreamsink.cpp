@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Baseband spectrum computed without GUI and serialized in a compact binary     //
+// format for streaming to remote displays                                       //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+
+#include "dsp/fftengine.h"
+#include "dsp/dspcommands.h"
+#include "spectrumstreamsink.h"
+
+#define MAX_FFT_SIZE 4096
+
+MESSAGE_CLASS_DEFINITION(SpectrumStreamSink::MsgConfigureSpectrumStreamSink, Message)
+
+SpectrumStreamSink::SpectrumStreamSink(int deviceSetIndex, Real scalef) :
+    BasebandSampleSink(),
+    m_deviceSetIndex(deviceSetIndex),
+    m_scalef(scalef),
+    m_fft(FFTEngine::create()),
+    m_fftBuffer(MAX_FFT_SIZE),
+    m_powerSum(MAX_FFT_SIZE),
+    m_fftBufferFill(0),
+    m_nbAverage(1),
+    m_averageCount(0),
+    m_sequence(0),
+    m_sampleRate(0),
+    m_centerFrequency(0)
+{
+    setObjectName("SpectrumStreamSink");
+    applySettings(m_settings);
+}
+
+SpectrumStreamSink::SpectrumStreamSink(int deviceSetIndex, Real scalef, const Settings& settings) :
+    BasebandSampleSink(),
+    m_deviceSetIndex(deviceSetIndex),
+    m_scalef(scalef),
+    m_settings(settings),
+    m_fft(FFTEngine::create()),
+    m_fftBuffer(MAX_FFT_SIZE),
+    m_powerSum(MAX_FFT_SIZE),
+    m_fftBufferFill(0),
+    m_nbAverage(1),
+    m_averageCount(0),
+    m_sequence(0),
+    m_sampleRate(0),
+    m_centerFrequency(0)
+{
+    setObjectName("SpectrumStreamSink");
+    applySettings(m_settings);
+}
+
+SpectrumStreamSink::~SpectrumStreamSink()
+{
+    delete m_fft;
+}
+
+void SpectrumStreamSink::start()
+{
+}
+
+void SpectrumStreamSink::stop()
+{
+}
+
+void SpectrumStreamSink::feed(const SampleVector::const_iterator& cbegin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    SampleVector::const_iterator begin(cbegin);
+    std::size_t fftSize = m_settings.m_fftSize;
+
+    while (begin < end)
+    {
+        std::size_t todo = end - begin;
+        std::size_t samplesNeeded = fftSize - m_fftBufferFill;
+        std::size_t count = todo < samplesNeeded ? todo : samplesNeeded;
+        std::vector<Complex>::iterator it = m_fftBuffer.begin() + m_fftBufferFill;
+
+        for (std::size_t i = 0; i < count; ++i, ++begin) {
+            *it++ = Complex(begin->real() / m_scalef, begin->imag() / m_scalef);
+        }
+
+        m_fftBufferFill += count;
+
+        if (m_fftBufferFill == fftSize)
+        {
+            accumulate(positiveOnly);
+            m_fftBufferFill = 0;
+
+            if (++m_averageCount >= m_nbAverage)
+            {
+                emitFrame();
+                std::fill(m_powerSum.begin(), m_powerSum.begin() + fftSize, 0.0);
+                m_averageCount = 0;
+            }
+        }
+    }
+}
+
+void SpectrumStreamSink::accumulate(bool positiveOnly)
+{
+    m_window.apply(&m_fftBuffer[0], m_fft->in());
+    m_fft->transform();
+
+    const Complex* fftOut = m_fft->out();
+    std::size_t fftSize = m_settings.m_fftSize;
+    std::size_t halfSize = fftSize / 2;
+    Complex c;
+
+    if (positiveOnly)
+    {
+        for (std::size_t i = 0; i < halfSize; i++)
+        {
+            c = fftOut[i];
+            double v = c.real() * c.real() + c.imag() * c.imag();
+            m_powerSum[i * 2] += v;
+            m_powerSum[i * 2 + 1] += v;
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < halfSize; i++)
+        {
+            c = fftOut[i + halfSize];
+            m_powerSum[i] += c.real() * c.real() + c.imag() * c.imag();
+            c = fftOut[i];
+            m_powerSum[i + halfSize] += c.real() * c.real() + c.imag() * c.imag();
+        }
+    }
+}
+
+void SpectrumStreamSink::emitFrame()
+{
+    int fftSize = m_settings.m_fftSize;
+    bool s16 = m_settings.m_binFormat == BinFormatS16;
+    int frameSize = m_frameHeaderSize + fftSize * (s16 ? 2 : 1);
+    float dbOffset = s16 ? 0.0f : m_settings.m_dbOffset;
+    float dbStep = s16 ? 0.01f : m_settings.m_dbRange / 255.0f;
+    // power normalized to full scale and averaged: same dB reference as the GUI spectrum
+    double norm = 1.0 / ((double) fftSize * (double) fftSize * (double) m_averageCount);
+
+    QByteArray frame;
+    frame.reserve(frameSize);
+    QDataStream stream(&frame, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    stream << m_frameMagic
+        << m_frameVersion
+        << (quint8) m_settings.m_binFormat
+        << (quint16) m_deviceSetIndex
+        << (quint32) frameSize
+        << m_sequence++
+        << (quint64) QDateTime::currentMSecsSinceEpoch()
+        << m_centerFrequency
+        << (quint32) m_sampleRate
+        << (quint16) fftSize
+        << (quint16) (m_averageCount > 65535 ? 65535 : m_averageCount)
+        << dbOffset
+        << dbStep;
+
+    for (int i = 0; i < fftSize; i++)
+    {
+        double p = m_powerSum[i] * norm;
+        float db = p > 1e-20 ? 10.0f * log10(p) : -200.0f;
+        float code = roundf((db - dbOffset) / dbStep);
+
+        if (s16) {
+            stream << (qint16) (code < -32768.0f ? -32768 : code > 32767.0f ? 32767 : (int) code);
+        } else {
+            stream << (quint8) (code < 0.0f ? 0 : code > 255.0f ? 255 : (int) code);
+        }
+    }
+
+    emit frameReady(frame);
+}
+
+bool SpectrumStreamSink::handleMessage(const Message& message)
+{
+    if (DSPSignalNotification::match(message))
+    {
+        DSPSignalNotification& notif = (DSPSignalNotification&) message;
+        QMutexLocker mutexLocker(&m_mutex);
+        m_centerFrequency = notif.getCenterFrequency();
+        applySampleRate(notif.getSampleRate());
+        return true;
+    }
+    else if (MsgConfigureSpectrumStreamSink::match(message))
+    {
+        MsgConfigureSpectrumStreamSink& conf = (MsgConfigureSpectrumStreamSink&) message;
+        QMutexLocker mutexLocker(&m_mutex);
+        applySettings(conf.getSettings());
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void SpectrumStreamSink::applySettings(const Settings& settings)
+{
+    m_settings = settings;
+
+    if (m_settings.m_fftSize > MAX_FFT_SIZE) {
+        m_settings.m_fftSize = MAX_FFT_SIZE;
+    } else if (m_settings.m_fftSize < 64) {
+        m_settings.m_fftSize = 64;
+    }
+
+    if (m_settings.m_framesPerSecond < 1) {
+        m_settings.m_framesPerSecond = 1;
+    }
+
+    if (m_settings.m_framePeriodMs < 0) {
+        m_settings.m_framePeriodMs = 0;
+    }
+
+    if (m_settings.m_dbRange <= 0.0f) {
+        m_settings.m_dbRange = 120.0f;
+    }
+
+    m_fft->configure(m_settings.m_fftSize, false);
+    m_window.create(m_settings.m_fftWindow, m_settings.m_fftSize);
+    applySampleRate(m_sampleRate);
+
+    qDebug() << "SpectrumStreamSink::applySettings:"
+            << " m_fftSize: " << m_settings.m_fftSize
+            << " m_framesPerSecond: " << m_settings.m_framesPerSecond
+            << " m_framePeriodMs: " << m_settings.m_framePeriodMs
+            << " m_binFormat: " << m_settings.m_binFormat
+            << " m_dbOffset: " << m_settings.m_dbOffset
+            << " m_dbRange: " << m_settings.m_dbRange;
+}
+
+void SpectrumStreamSink::applySampleRate(int sampleRate)
+{
+    m_sampleRate = sampleRate;
+
+    if (m_settings.m_framePeriodMs > 0)
+    {
+        qint64 nbAverage = ((qint64) sampleRate * m_settings.m_framePeriodMs) / ((qint64) m_settings.m_fftSize * 1000);
+        m_nbAverage = nbAverage < 1 ? 1 : nbAverage > (1<<24) ? (1<<24) : (int) nbAverage;
+    }
+    else
+    {
+        int nbAverage = sampleRate / (m_settings.m_fftSize * m_settings.m_framesPerSecond);
+        m_nbAverage = nbAverage < 1 ? 1 : nbAverage > 65535 ? 65535 : nbAverage;
+    }
+
+    // restart the current frame
+    std::fill(m_powerSum.begin(), m_powerSum.end(), 0.0);
+    m_averageCount = 0;
+    m_fftBufferFill = 0;
+}
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Baseband spectrum computed without GUI and serialized in a compact binary     //
+// format for streaming to remote displays                                       //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SPECTRUMSTREAMSINK_H_
+#define SDRBASE_DSP_SPECTRUMSTREAMSINK_H_
+
+#include <QMutex>
+#include <QByteArray>
+#include <vector>
+
+#include "dsp/basebandsamplesink.h"
+#include "dsp/fftwindow.h"
+#include "util/message.h"
+#include "util/export.h"
+
+class FFTEngine;
+
+/**
+ * Baseband sample sink that computes power spectra averaged to a target frame rate and emits
+ * each frame serialized with a fixed size little endian header followed by one quantized dB
+ * value per bin, lowest frequency first:
+ *
+ * | offset | type   | content                                                        |
+ * |--------|--------|----------------------------------------------------------------|
+ * | 0      | uint32 | magic 0x53524453 ("SDRS" in memory)                            |
+ * | 4      | uint8  | header version (1)                                             |
+ * | 5      | uint8  | bins format: 0 uint8, 1 int16                                  |
+ * | 6      | uint16 | device set index                                               |
+ * | 8      | uint32 | total frame size in bytes (header + bins)                      |
+ * | 12     | uint32 | frame sequence number                                          |
+ * | 16     | uint64 | timestamp in milliseconds since epoch                          |
+ * | 24     | int64  | center frequency (Hz)                                          |
+ * | 32     | uint32 | sample rate (S/s)                                              |
+ * | 36     | uint16 | number of bins (FFT size)                                      |
+ * | 38     | uint16 | number of FFTs averaged in the frame (saturates at 65535)      |
+ * | 40     | float  | dB value of code 0                                             |
+ * | 44     | float  | dB per code step                                               |
+ *
+ * Bin value in dB is then offset + code * step.
+ */
+class SDRANGEL_API SpectrumStreamSink : public BasebandSampleSink {
+    Q_OBJECT
+
+public:
+    enum BinFormat
+    {
+        BinFormatU8,
+        BinFormatS16
+    };
+
+    struct Settings
+    {
+        int m_fftSize;
+        FFTWindow::Function m_fftWindow;
+        int m_framesPerSecond;
+        int m_framePeriodMs; //!< frame period for slow rates (archiving). Overrides m_framesPerSecond if not 0
+        BinFormat m_binFormat;
+        float m_dbOffset;   //!< dB value of code 0 in uint8 format
+        float m_dbRange;    //!< dB range covered by the 256 codes of uint8 format
+
+        Settings() :
+            m_fftSize(1024),
+            m_fftWindow(FFTWindow::BlackmanHarris),
+            m_framesPerSecond(10),
+            m_framePeriodMs(0),
+            m_binFormat(BinFormatU8),
+            m_dbOffset(-120.0f),
+            m_dbRange(120.0f)
+        {}
+    };
+
+    class SDRANGEL_API MsgConfigureSpectrumStreamSink : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const Settings& getSettings() const { return m_settings; }
+
+        static MsgConfigureSpectrumStreamSink* create(const Settings& settings) {
+            return new MsgConfigureSpectrumStreamSink(settings);
+        }
+
+    private:
+        Settings m_settings;
+
+        MsgConfigureSpectrumStreamSink(const Settings& settings) :
+            Message(),
+            m_settings(settings)
+        { }
+    };
+
+    static const quint32 m_frameMagic = 0x53524453;
+    static const quint8 m_frameVersion = 1;
+    static const int m_frameHeaderSize = 48;
+
+    SpectrumStreamSink(int deviceSetIndex, Real scalef);
+    SpectrumStreamSink(int deviceSetIndex, Real scalef, const Settings& settings);
+    virtual ~SpectrumStreamSink();
+
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual void start();
+    virtual void stop();
+    virtual bool handleMessage(const Message& message);
+
+signals:
+    void frameReady(QByteArray frame); //!< emitted from the DSP thread: connect with a queued connection
+
+private:
+    int m_deviceSetIndex;
+    Real m_scalef;
+    Settings m_settings;
+
+    FFTEngine* m_fft;
+    FFTWindow m_window;
+    std::vector<Complex> m_fftBuffer;
+    std::vector<double> m_powerSum;   //!< power accumulated over FFTs in natural bin order (lowest frequency first)
+    std::size_t m_fftBufferFill;
+    int m_nbAverage;                  //!< number of FFTs averaged per frame
+    int m_averageCount;
+    quint32 m_sequence;
+
+    int m_sampleRate;
+    qint64 m_centerFrequency;
+
+    QMutex m_mutex;
+
+    void applySettings(const Settings& settings);
+    void applySampleRate(int sampleRate);
+    void accumulate(bool positiveOnly);
+    void emitFrame();
+};
+
+#endif /* SDRBASE_DSP_SPECTRUMSTREAMSINK_H_ */
@@ -1,65 +1,184 @@
 #include "threadedbasebandsamplesink.h"
 
 #include <QThread>
+#include <QEvent>
 #include <QDebug>
 #include "dsp/dspcommands.h"
+#include "dsp/dspengine.h"
 #include "util/message.h"
 
-ThreadedBasebandSampleSinkFifo::ThreadedBasebandSampleSinkFifo(BasebandSampleSink *sampleSink, std::size_t size) :
-	m_sampleSink(sampleSink)
+ThreadedBasebandSampleSinkFifo::ThreadedBasebandSampleSinkFifo(BasebandSampleSink *sampleSink, DSPExecutor *executor, std::size_t size) :
+	m_sampleSink(sampleSink),
+	m_processingTime(0),
+	m_processedSamples(0),
+	m_strand(0),
+	m_ownerThread(QThread::currentThread())
 {
-	connect(&m_sampleFifo, SIGNAL(dataReady()), this, SLOT(handleFifoData()));
+	if (executor)
+	{
+		m_strand = new Strand(executor, this);
+		connect(&m_sampleFifo, SIGNAL(dataReady()), this, SLOT(scheduleFifoData()), Qt::DirectConnection);
+	}
+	else
+	{
+		connect(&m_sampleFifo, SIGNAL(dataReady()), this, SLOT(handleFifoData()));
+	}
+
 	m_sampleFifo.setSize(size);
 }
 
 ThreadedBasebandSampleSinkFifo::~ThreadedBasebandSampleSinkFifo()
 {
+	if (m_strand)
+	{
+		m_strand->setEnabled(false); // waits for the processing queued or in progress while process() is still there
+		delete m_strand;
+	}
+
 	m_sampleFifo.readCommit(m_sampleFifo.fill());
 }
 
+void ThreadedBasebandSampleSinkFifo::scheduleFifoData()
+{
+	m_strand->schedule();
+}
+
+bool ThreadedBasebandSampleSinkFifo::eventFilter(QObject *object, QEvent *event)
+{
+	if (m_strand && (object == m_sampleSink) && (event->type() == QEvent::MetaCall))
+	{
+		QMutexLocker strandLocker(m_strand->getMutex());
+		object->event(event);
+		return true;
+	}
+
+	return QObject::eventFilter(object, event);
+}
+
+void ThreadedBasebandSampleSinkFifo::detachSink()
+{
+	// runs between two deliveries of the messages of the sink so none is in progress
+	m_sampleSink->removeEventFilter(this);
+	m_sampleSink->moveToThread(m_ownerThread); // with its pending messages
+	moveToThread(m_ownerThread);
+}
+
 void ThreadedBasebandSampleSinkFifo::writeToFifo(SampleVector::const_iterator& begin, SampleVector::const_iterator& end)
 {
 	m_sampleFifo.write(begin, end);
 }
 
-void ThreadedBasebandSampleSinkFifo::handleFifoData() // FIXME: Fixed? Move it to the new threadable sink class
+void ThreadedBasebandSampleSinkFifo::writeToFifo(FSampleVector::const_iterator& begin, FSampleVector::const_iterator& end)
+{
+	m_sampleFifo.write(begin, end);
+}
+
+void ThreadedBasebandSampleSinkFifo::setFloat(bool floatSamples)
+{
+	if (floatSamples == m_sampleFifo.isFloat()) {
+		return;
+	}
+
+	if (m_strand) {
+		m_strand->getMutex()->lock();
+	}
+
+	handleFifoData(); // flush what is stored in the previous format
+	m_sampleFifo.setFloat(floatSamples);
+
+	if (m_strand) {
+		m_strand->getMutex()->unlock();
+	}
+
+	qDebug("ThreadedBasebandSampleSinkFifo::setFloat: %s", floatSamples ? "float" : "fixed point");
+}
+
+void ThreadedBasebandSampleSinkFifo::getProcessingCounters(quint64& processingTime, quint64& processedSamples)
+{
+	QMutexLocker mutexLocker(&m_countersMutex);
+	processingTime = m_processingTime;
+	processedSamples = m_processedSamples;
+}
+
+void ThreadedBasebandSampleSinkFifo::getFeedTime(ProfileHistogram& feedTime)
+{
+	QMutexLocker mutexLocker(&m_countersMutex);
+	feedTime = m_feedTime;
+}
+
+template<typename Vector>
+std::size_t ThreadedBasebandSampleSinkFifo::feedSink()
 {
 	bool positiveOnly = false;
+	typename Vector::iterator part1begin;
+	typename Vector::iterator part1end;
+	typename Vector::iterator part2begin;
+	typename Vector::iterator part2end;
 
-	while ((m_sampleFifo.fill() > 0) && (m_sampleSink->getInputMessageQueue()->size() == 0))
+	std::size_t count = m_sampleFifo.readBegin(m_sampleFifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+	// first part of FIFO data
+
+	if (count > 0)
 	{
-		SampleVector::iterator part1begin;
-		SampleVector::iterator part1end;
-		SampleVector::iterator part2begin;
-		SampleVector::iterator part2end;
+		// handle data
+		if(m_sampleSink != NULL)
+		{
+			m_feedTimer.start();
+			feedSink(part1begin, part1end, positiveOnly);
+			m_pendingFeedTime.add(m_feedTimer.nsecsElapsed());
+		}
 
-		std::size_t count = m_sampleFifo.readBegin(m_sampleFifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
+		m_sampleFifo.readCommit(part1end - part1begin);
+	}
 
-		// first part of FIFO data
+	// second part of FIFO data (used when block wraps around)
 
-		if (count > 0)
+	if(part2begin != part2end)
+	{
+		// handle data
+		if(m_sampleSink != NULL)
 		{
-			// handle data
-			if(m_sampleSink != NULL)
-			{
-				m_sampleSink->feed(part1begin, part1end, positiveOnly);
-			}
-
-			m_sampleFifo.readCommit(part1end - part1begin);
+			m_feedTimer.start();
+			feedSink(part2begin, part2end, positiveOnly);
+			m_pendingFeedTime.add(m_feedTimer.nsecsElapsed());
 		}
 
-		// second part of FIFO data (used when block wraps around)
+		m_sampleFifo.readCommit(part2end - part2begin);
+	}
 
-		if(part2begin != part2end)
-		{
-			// handle data
-			if(m_sampleSink != NULL)
-			{
-				m_sampleSink->feed(part2begin, part2end, positiveOnly);
-			}
+	return count;
+}
+
+void ThreadedBasebandSampleSinkFifo::handleFifoData() // FIXME: Fixed? Move it to the new threadable sink class
+{
+	quint64 processedSamples = 0;
+	m_processingTimer.start();
+
+	while ((m_sampleFifo.fill() > 0) && (m_sampleSink->getInputMessageQueue()->size() == 0))
+	{
+		std::size_t count;
 
-			m_sampleFifo.readCommit(part2end - part2begin);
+		if (m_sampleFifo.isFloat()) {
+			count = feedSink<FSampleVector>();
+		} else {
+			count = feedSink<SampleVector>();
 		}
+
+		if (count == 0) {
+			break;
+		}
+
+		processedSamples += count;
+	}
+
+	if (processedSamples > 0)
+	{
+		QMutexLocker mutexLocker(&m_countersMutex);
+		m_processingTime += m_processingTimer.nsecsElapsed();
+		m_processedSamples += processedSamples;
+		m_feedTime.merge(m_pendingFeedTime);
+		m_pendingFeedTime.reset();
 	}
 }
 
@@ -71,6 +190,21 @@ ThreadedBasebandSampleSink::ThreadedBasebandSampleSink(BasebandSampleSink* sampl
 
 	qDebug() << "ThreadedBasebandSampleSink::ThreadedBasebandSampleSink: " << name;
 
+	DSPExecutor *executor = DSPEngine::instance()->getExecutor();
+
+	if (executor)
+	{
+		// the sink and the FIFO live in the home thread of the strand that processes the samples
+		m_thread = 0;
+		m_threadedBasebandSampleSinkFifo = new ThreadedBasebandSampleSinkFifo(m_basebandSampleSink, executor);
+		QThread *homeThread = m_threadedBasebandSampleSinkFifo->m_strand->getHomeThread();
+		m_basebandSampleSink->moveToThread(homeThread);
+		m_threadedBasebandSampleSinkFifo->moveToThread(homeThread);
+		m_basebandSampleSink->installEventFilter(m_threadedBasebandSampleSinkFifo);
+		qDebug() << "ThreadedBasebandSampleSink::ThreadedBasebandSampleSink: executor thread: " << homeThread;
+		return;
+	}
+
 	m_thread = new QThread(parent);
 	m_threadedBasebandSampleSinkFifo = new ThreadedBasebandSampleSinkFifo(m_basebandSampleSink);
 	//moveToThread(m_thread); // FIXME: Fixed? the intermediate FIFO should be handled within the sink. Define a new type of sink that is compatible with threading
@@ -85,6 +219,22 @@ ThreadedBasebandSampleSink::ThreadedBasebandSampleSink(BasebandSampleSink* sampl
 
 ThreadedBasebandSampleSink::~ThreadedBasebandSampleSink()
 {
+	if (m_threadedBasebandSampleSinkFifo->m_strand)
+	{
+		// no pool thread may feed the sink past this point
+		m_threadedBasebandSampleSinkFifo->m_strand->setEnabled(false);
+
+		// The home thread keeps delivering the messages of the sink and of the FIFO. Both are
+		// handed back to this thread by the home thread itself before they are deleted here.
+		QThread *homeThread = m_threadedBasebandSampleSinkFifo->thread();
+
+		if ((homeThread != QThread::currentThread()) && homeThread->isRunning()) {
+			QMetaObject::invokeMethod(m_threadedBasebandSampleSinkFifo, "detachSink", Qt::BlockingQueuedConnection);
+		} else { // nothing delivers the messages concurrently
+			m_basebandSampleSink->removeEventFilter(m_threadedBasebandSampleSinkFifo);
+		}
+	}
+
 	delete m_threadedBasebandSampleSinkFifo; // Valgrind memcheck
 	delete m_thread;
 }
@@ -92,7 +242,13 @@ ThreadedBasebandSampleSink::~ThreadedBasebandSampleSink()
 void ThreadedBasebandSampleSink::start()
 {
 	qDebug() << "ThreadedBasebandSampleSink::start";
-	m_thread->start();
+
+	if (m_thread) {
+		m_thread->start();
+	} else {
+		m_threadedBasebandSampleSinkFifo->m_strand->setEnabled(true);
+	}
+
 	m_basebandSampleSink->start();
 }
 
@@ -100,8 +256,17 @@ void ThreadedBasebandSampleSink::stop()
 {
 	qDebug() << "ThreadedBasebandSampleSink::stop";
 	m_basebandSampleSink->stop();
-	m_thread->exit();
-	m_thread->wait();
+
+	if (m_thread)
+	{
+		m_thread->exit();
+		m_thread->wait();
+	}
+	else
+	{
+		// the messages of the sink are still handled in the home thread with the strand mutex held
+		m_threadedBasebandSampleSinkFifo->m_strand->setEnabled(false);
+	}
 }
 
 void ThreadedBasebandSampleSink::feed(SampleVector::const_iterator begin, SampleVector::const_iterator end, bool positiveOnly __attribute__((unused)))
@@ -111,6 +276,16 @@ void ThreadedBasebandSampleSink::feed(SampleVector::const_iterator begin, Sample
 	m_threadedBasebandSampleSinkFifo->writeToFifo(begin, end);
 }
 
+void ThreadedBasebandSampleSink::feedFloat(FSampleVector::const_iterator begin, FSampleVector::const_iterator end, bool positiveOnly __attribute__((unused)))
+{
+	m_threadedBasebandSampleSinkFifo->writeToFifo(begin, end);
+}
+
+void ThreadedBasebandSampleSink::setFloat(bool floatSamples)
+{
+	QMetaObject::invokeMethod(m_threadedBasebandSampleSinkFifo, "setFloat", Qt::QueuedConnection, Q_ARG(bool, floatSamples));
+}
+
 bool ThreadedBasebandSampleSink::handleSinkMessage(const Message& cmd)
 {
 	return m_basebandSampleSink->handleMessage(cmd);
@@ -120,3 +295,17 @@ QString ThreadedBasebandSampleSink::getSampleSinkObjectName() const
 {
 	return m_basebandSampleSink->objectName();
 }
+
+void ThreadedBasebandSampleSink::getReport(Report& report)
+{
+	report.m_name = m_basebandSampleSink->objectName();
+	report.m_fifoSize = m_threadedBasebandSampleSinkFifo->m_sampleFifo.size();
+	report.m_fifoFill = m_threadedBasebandSampleSinkFifo->m_sampleFifo.fill();
+	report.m_fifoMaxFill = m_threadedBasebandSampleSinkFifo->m_sampleFifo.getMaxFill();
+	report.m_fifoOverflowCount = m_threadedBasebandSampleSinkFifo->m_sampleFifo.getOverflowCount();
+	report.m_fifoDroppedSamples = m_threadedBasebandSampleSinkFifo->m_sampleFifo.getDroppedSamples();
+	m_threadedBasebandSampleSinkFifo->getProcessingCounters(report.m_processingTime, report.m_processedSamples);
+	m_threadedBasebandSampleSinkFifo->getFeedTime(report.m_feedTime);
+	report.m_direct = false;
+	report.m_samplesIn = report.m_processedSamples + report.m_fifoDroppedSamples + report.m_fifoFill;
+}
@@ -20,9 +20,12 @@
 
 #include <dsp/basebandsamplesink.h>
 #include <QMutex>
+#include <QElapsedTimer>
 
 #include "samplesinkfifo.h"
+#include "dspexecutor.h"
 #include "util/messagequeue.h"
+#include "util/profilehistogram.h"
 #include "util/export.h"
 
 class BasebandSampleSink;
@@ -36,40 +39,106 @@ class ThreadedBasebandSampleSinkFifo : public QObject {
 	Q_OBJECT
 
 public:
-	ThreadedBasebandSampleSinkFifo(BasebandSampleSink* sampleSink, std::size_t size = 1<<18);
+	/** Processing runs in the thread of the FIFO object or in a strand of the executor if not null */
+	ThreadedBasebandSampleSinkFifo(BasebandSampleSink* sampleSink, DSPExecutor *executor = 0, std::size_t size = 1<<18);
 	~ThreadedBasebandSampleSinkFifo();
 	void writeToFifo(SampleVector::const_iterator& begin, SampleVector::const_iterator& end);
+	void writeToFifo(FSampleVector::const_iterator& begin, FSampleVector::const_iterator& end);
+
+	void getProcessingCounters(quint64& processingTime, quint64& processedSamples);
+	void getFeedTime(ProfileHistogram& feedTime);
 
 	BasebandSampleSink* m_sampleSink;
 	SampleSinkFifo m_sampleFifo;
+	QMutex m_countersMutex;
+	QElapsedTimer m_processingTimer;
+	QElapsedTimer m_feedTimer;
+
+	class Strand : public DSPExecutor::Strand {
+	public:
+		Strand(DSPExecutor *executor, ThreadedBasebandSampleSinkFifo *fifo) : DSPExecutor::Strand(executor), m_fifo(fifo) {}
+	protected:
+		virtual void process() { m_fifo->handleFifoData(); }
+	private:
+		ThreadedBasebandSampleSinkFifo *m_fifo;
+	};
+
+	Strand *m_strand;           //!< null when the FIFO has its own thread
+	QThread *m_ownerThread;     //!< thread that created the FIFO
+	quint64 m_processingTime;   //!< cumulated time spent in the sink feed method (ns)
+	quint64 m_processedSamples; //!< cumulated number of samples fed to the sink
+	ProfileHistogram m_feedTime;        //!< durations of the sink feed method calls. Protected by m_countersMutex.
+	ProfileHistogram m_pendingFeedTime; //!< feed calls of the current handleFifoData() not yet in m_feedTime
+
+	template<typename Vector> std::size_t feedSink(); //!< one FIFO read in the storage format. Returns the number of samples.
+	void feedSink(SampleVector::const_iterator begin, SampleVector::const_iterator end, bool positiveOnly) { m_sampleSink->feed(begin, end, positiveOnly); }
+	void feedSink(FSampleVector::const_iterator begin, FSampleVector::const_iterator end, bool positiveOnly) { m_sampleSink->feedFloat(begin, end, positiveOnly); }
+
+	/** In strand mode the messages of the sink are handled with the strand mutex held so that they do not run concurrently with the feed */
+	virtual bool eventFilter(QObject *object, QEvent *event);
 
 public slots:
 	void handleFifoData();
+	void scheduleFifoData(); //!< strand mode: called in the writer thread
+	void setFloat(bool floatSamples); //!< change the FIFO storage format in the sink thread
+	void detachSink(); //!< strand mode: called in the home thread to give the sink and the FIFO back to the owner thread
 };
 
 /**
  * This class is a wrapper for SampleSink that runs the SampleSink object in its own thread
+ * or, when the DSP engine has an executor, in the shared thread pool
  */
 class SDRANGEL_API ThreadedBasebandSampleSink : public QObject {
 	Q_OBJECT
 
 public:
+	/** Also used by the DSP engine for the sinks it feeds in its own thread (direct sinks) that have no FIFO */
+	struct Report
+	{
+		QString m_name;
+		bool m_direct;              //!< fed in the DSP engine thread
+		uint m_fifoSize;
+		uint m_fifoFill;
+		uint m_fifoMaxFill;
+		quint64 m_fifoOverflowCount;
+		quint64 m_fifoDroppedSamples;
+		quint64 m_processingTime;   //!< ns
+		quint64 m_processedSamples; //!< samples out: fed to the sink
+		quint64 m_samplesIn;        //!< samples given to the sink by the DSP engine including the dropped ones
+		ProfileHistogram m_feedTime; //!< durations of the sink feed method calls
+
+		Report() :
+			m_direct(false),
+			m_fifoSize(0),
+			m_fifoFill(0),
+			m_fifoMaxFill(0),
+			m_fifoOverflowCount(0),
+			m_fifoDroppedSamples(0),
+			m_processingTime(0),
+			m_processedSamples(0),
+			m_samplesIn(0)
+		{}
+	};
+
 	ThreadedBasebandSampleSink(BasebandSampleSink* sampleSink, QObject *parent = 0);
 	~ThreadedBasebandSampleSink();
 
 	const BasebandSampleSink *getSink() const { return m_basebandSampleSink; }
 
-	void start(); //!< this thread start()
-	void stop();  //!< this thread exit() and wait()
+	void start(); //!< this thread start() or enable the strand
+	void stop();  //!< this thread exit() and wait() or disable the strand and wait for it to complete
 
 	bool handleSinkMessage(const Message& cmd); //!< Send message to sink synchronously
 	void feed(SampleVector::const_iterator begin, SampleVector::const_iterator end, bool positiveOnly); //!< Feed sink with samples
+	void feedFloat(FSampleVector::const_iterator begin, FSampleVector::const_iterator end, bool positiveOnly); //!< Feed sink with floating point samples
+	void setFloat(bool floatSamples); //!< Baseband format fed from now on. The FIFO follows asynchronously and converts meanwhile.
 
 	QString getSampleSinkObjectName() const;
+	void getReport(Report& report); //!< Get FIFO and processing counters
 
 protected:
 
-	QThread *m_thread; //!< The thead object
+	QThread *m_thread; //!< The thead object. Null when the shared DSP executor is used.
 	ThreadedBasebandSampleSinkFifo *m_threadedBasebandSampleSinkFifo;
 	BasebandSampleSink* m_basebandSampleSink;
 };
@@ -19,6 +19,7 @@
 #include <QThread>
 
 #include "dsp/threadedbasebandsamplesource.h"
+#include "dsp/dspengine.h"
 
 ThreadedBasebandSampleSource::ThreadedBasebandSampleSource(BasebandSampleSource* sampleSource, QObject *parent) :
         m_basebandSampleSource(sampleSource)
@@ -28,8 +29,18 @@ ThreadedBasebandSampleSource::ThreadedBasebandSampleSource(BasebandSampleSource*
 
     qDebug() << "ThreadedBasebandSampleSource::ThreadedBasebandSampleSource: " << name;
 
-    m_thread = new QThread(parent);
-    m_basebandSampleSource->moveToThread(m_thread);
+    DSPExecutor *executor = DSPEngine::instance()->getExecutor();
+
+    if (executor)
+    {
+        m_thread = 0;
+        m_basebandSampleSource->moveToThread(executor->allocateThread());
+    }
+    else
+    {
+        m_thread = new QThread(parent);
+        m_basebandSampleSource->moveToThread(m_thread);
+    }
 
     qDebug() << "ThreadedBasebandSampleSource::ThreadedBasebandSampleSource: thread: " << thread() << " m_thread: " << m_thread;
 }
@@ -42,7 +53,11 @@ ThreadedBasebandSampleSource::~ThreadedBasebandSampleSource()
 void ThreadedBasebandSampleSource::start()
 {
     qDebug() << "ThreadedBasebandSampleSource::start";
-    m_thread->start();
+
+    if (m_thread) {
+        m_thread->start();
+    }
+
     m_basebandSampleSource->start();
 }
 
@@ -50,8 +65,12 @@ void ThreadedBasebandSampleSource::stop()
 {
     qDebug() << "ThreadedBasebandSampleSource::stop";
     m_basebandSampleSource->stop();
-    m_thread->exit();
-    m_thread->wait();
+
+    if (m_thread)
+    {
+        m_thread->exit();
+        m_thread->wait();
+    }
 }
 
 void ThreadedBasebandSampleSource::pull(Sample& sample)
@@ -29,6 +29,7 @@ class QThread;
 
 /**
  * This class is a wrapper for BasebandSampleSource that runs the BasebandSampleSource object in its own thread
+ * or, when the DSP engine has an executor, in one of the threads of the shared pool
  */
 class SDRANGEL_API ThreadedBasebandSampleSource : public QObject {
 	Q_OBJECT
@@ -56,7 +57,7 @@ public:
 	QString getSampleSourceObjectName() const;
 
 protected:
-	QThread *m_thread; //!< The thead object
+	QThread *m_thread; //!< The thead object. Null when the shared DSP executor is used.
 	BasebandSampleSource* m_basebandSampleSource;
 };
 
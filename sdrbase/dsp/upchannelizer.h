@@ -23,11 +23,7 @@
 #include <QMutex>
 #include "util/export.h"
 #include "util/message.h"
-#ifdef USE_SSE4_1
-#include "dsp/inthalfbandfiltereo1.h"
-#else
-#include "dsp/inthalfbandfilterdb.h"
-#endif
+#include "dsp/inthalfbandfilterng.h"
 
 #define UPCHANNELIZER_HB_FILTER_ORDER 96
 
@@ -83,13 +79,9 @@ protected:
             ModeUpperHalf
         };
 
-#ifdef USE_SSE4_1
-        typedef bool (IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
-        IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#else
-        typedef bool (IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
-        IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
-#endif
+        typedef IntHalfbandFilterNG<qint32, UPCHANNELIZER_HB_FILTER_ORDER> Filter;
+        typedef bool (Filter::*WorkFunction)(Sample* sIn, Sample *sOut);
+        Filter* m_filter;
         WorkFunction m_workFunction;
 
         FilterStage(Mode mode);
@@ -29,10 +29,40 @@ MainParser::MainParser() :
     m_serverPortOption(QStringList() << "p" << "api-port",
         "Web API server port.",
         "port",
-        "8091")
+        "8091"),
+    m_spectrumAddressOption("spectrum-address",
+        "Spectrum streaming address. Listening address with TCP, destination address with UDP.",
+        "address",
+        "127.0.0.1"),
+    m_spectrumPortOption("spectrum-port",
+        "Spectrum streaming port of the first device set (server only). Device set N uses this port + N. 0 disables spectrum streaming.",
+        "port",
+        "0"),
+    m_spectrumProtocolOption("spectrum-protocol",
+        "Spectrum streaming protocol: tcp or udp.",
+        "protocol",
+        "tcp"),
+    m_spectrumFFTSizeOption("spectrum-fft",
+        "Spectrum streaming FFT size (64 to 4096).",
+        "size",
+        "1024"),
+    m_spectrumFPSOption("spectrum-fps",
+        "Spectrum streaming frames per second (1 to 100).",
+        "fps",
+        "10"),
+    m_spectrumFormatOption("spectrum-format",
+        "Spectrum streaming bins format: u8 (0.47 dB steps from -120 dB) or s16 (0.01 dB steps).",
+        "format",
+        "u8")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
+    m_spectrumAddress = "127.0.0.1";
+    m_spectrumPort = 0;
+    m_spectrumUDP = false;
+    m_spectrumFFTSize = 1024;
+    m_spectrumFPS = 10;
+    m_spectrumS16 = false;
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -40,6 +70,12 @@ MainParser::MainParser() :
 
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
+    m_parser.addOption(m_spectrumAddressOption);
+    m_parser.addOption(m_spectrumPortOption);
+    m_parser.addOption(m_spectrumProtocolOption);
+    m_parser.addOption(m_spectrumFFTSizeOption);
+    m_parser.addOption(m_spectrumFPSOption);
+    m_parser.addOption(m_spectrumFormatOption);
 }
 
 MainParser::~MainParser()
@@ -79,4 +115,67 @@ void MainParser::parse(const QCoreApplication& app)
     } else {
         qWarning() << "MainParser::parse: server port invalid. Defaulting to " << m_serverPort;
     }
+
+    // spectrum streaming address
+
+    QString spectrumAddress = m_parser.value(m_spectrumAddressOption);
+
+    if (ipValidator.validate(spectrumAddress, pos) == QValidator::Acceptable) {
+        m_spectrumAddress = spectrumAddress;
+    } else {
+        qWarning() << "MainParser::parse: spectrum address invalid. Defaulting to " << m_spectrumAddress;
+    }
+
+    // spectrum streaming port
+
+    QString spectrumPortStr = m_parser.value(m_spectrumPortOption);
+    int spectrumPort = spectrumPortStr.toInt(&ok);
+
+    if (ok && ((spectrumPort == 0) || ((spectrumPort > 1023) && (spectrumPort < 65536)))) {
+        m_spectrumPort = spectrumPort;
+    } else {
+        qWarning() << "MainParser::parse: spectrum port invalid. Defaulting to " << m_spectrumPort;
+    }
+
+    // spectrum streaming protocol
+
+    QString spectrumProtocol = m_parser.value(m_spectrumProtocolOption);
+
+    if ((spectrumProtocol == "tcp") || (spectrumProtocol == "udp")) {
+        m_spectrumUDP = spectrumProtocol == "udp";
+    } else {
+        qWarning() << "MainParser::parse: spectrum protocol invalid. Defaulting to tcp";
+    }
+
+    // spectrum streaming FFT size
+
+    QString spectrumFFTSizeStr = m_parser.value(m_spectrumFFTSizeOption);
+    int spectrumFFTSize = spectrumFFTSizeStr.toInt(&ok);
+
+    if (ok && (spectrumFFTSize >= 64) && (spectrumFFTSize <= 4096) && ((spectrumFFTSize & (spectrumFFTSize - 1)) == 0)) {
+        m_spectrumFFTSize = spectrumFFTSize;
+    } else {
+        qWarning() << "MainParser::parse: spectrum FFT size invalid (must be a power of two). Defaulting to " << m_spectrumFFTSize;
+    }
+
+    // spectrum streaming frames per second
+
+    QString spectrumFPSStr = m_parser.value(m_spectrumFPSOption);
+    int spectrumFPS = spectrumFPSStr.toInt(&ok);
+
+    if (ok && (spectrumFPS >= 1) && (spectrumFPS <= 100)) {
+        m_spectrumFPS = spectrumFPS;
+    } else {
+        qWarning() << "MainParser::parse: spectrum frames per second invalid. Defaulting to " << m_spectrumFPS;
+    }
+
+    // spectrum streaming bins format
+
+    QString spectrumFormat = m_parser.value(m_spectrumFormatOption);
+
+    if ((spectrumFormat == "u8") || (spectrumFormat == "s16")) {
+        m_spectrumS16 = spectrumFormat == "s16";
+    } else {
+        qWarning() << "MainParser::parse: spectrum format invalid. Defaulting to u8";
+    }
 }
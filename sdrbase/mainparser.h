@@ -31,14 +31,32 @@ public:
 
     const QString& getServerAddress() const { return m_serverAddress; }
     uint16_t getServerPort() const { return m_serverPort; }
+    const QString& getSpectrumAddress() const { return m_spectrumAddress; }
+    uint16_t getSpectrumPort() const { return m_spectrumPort; }
+    bool getSpectrumUDP() const { return m_spectrumUDP; }
+    int getSpectrumFFTSize() const { return m_spectrumFFTSize; }
+    int getSpectrumFPS() const { return m_spectrumFPS; }
+    bool getSpectrumS16() const { return m_spectrumS16; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
+    QString  m_spectrumAddress;
+    uint16_t m_spectrumPort; //!< base port of spectrum streaming (port of device set 0). 0 disables streaming
+    bool     m_spectrumUDP;
+    int      m_spectrumFFTSize;
+    int      m_spectrumFPS;
+    bool     m_spectrumS16;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
+    QCommandLineOption m_spectrumAddressOption;
+    QCommandLineOption m_spectrumPortOption;
+    QCommandLineOption m_spectrumProtocolOption;
+    QCommandLineOption m_spectrumFFTSizeOption;
+    QCommandLineOption m_spectrumFPSOption;
+    QCommandLineOption m_spectrumFormatOption;
 };
 
 
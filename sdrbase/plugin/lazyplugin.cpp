@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QMutexLocker>
+
+#include "plugin/pluginmanager.h"
+#include "plugin/lazyplugin.h"
+
+LazyPlugin::LazyPlugin(const QString& fileName, const PluginDescriptor& pluginDescriptor, bool deviceEnumerationCacheable, PluginManager *pluginManager) :
+    m_fileName(fileName),
+    m_pluginDescriptor(pluginDescriptor),
+    m_deviceEnumerationCacheable(deviceEnumerationCacheable),
+    m_pluginManager(pluginManager),
+    m_plugin(0),
+    m_loadFailed(false)
+{}
+
+LazyPlugin::~LazyPlugin()
+{}
+
+bool LazyPlugin::isLoaded() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_plugin != 0;
+}
+
+PluginInterface *LazyPlugin::plugin()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_plugin && !m_loadFailed)
+    {
+        m_plugin = m_pluginManager->loadDeferredPlugin(m_fileName);
+        m_loadFailed = m_plugin == 0;
+    }
+
+    return m_plugin;
+}
+
+PluginInstanceGUI* LazyPlugin::createRxChannelGUI(DeviceUISet *deviceUISet, BasebandSampleSink *rxChannel)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createRxChannelGUI(deviceUISet, rxChannel) : 0;
+}
+
+BasebandSampleSink* LazyPlugin::createRxChannelBS(DeviceSourceAPI *deviceAPI)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createRxChannelBS(deviceAPI) : 0;
+}
+
+ChannelSinkAPI* LazyPlugin::createRxChannelCS(DeviceSourceAPI *deviceAPI)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createRxChannelCS(deviceAPI) : 0;
+}
+
+PluginInstanceGUI* LazyPlugin::createTxChannelGUI(DeviceUISet *deviceUISet, BasebandSampleSource *txChannel)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createTxChannelGUI(deviceUISet, txChannel) : 0;
+}
+
+BasebandSampleSource* LazyPlugin::createTxChannelBS(DeviceSinkAPI *deviceAPI)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createTxChannelBS(deviceAPI) : 0;
+}
+
+ChannelSourceAPI* LazyPlugin::createTxChannelCS(DeviceSinkAPI *deviceAPI)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createTxChannelCS(deviceAPI) : 0;
+}
+
+PluginInterface::SamplingDevices LazyPlugin::enumSampleSources()
+{
+    PluginInterface *p = plugin();
+    return p ? p->enumSampleSources() : SamplingDevices();
+}
+
+PluginInstanceGUI* LazyPlugin::createSampleSourcePluginInstanceGUI(const QString& sourceId, QWidget **widget, DeviceUISet *deviceUISet)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createSampleSourcePluginInstanceGUI(sourceId, widget, deviceUISet) : 0;
+}
+
+DeviceSampleSource* LazyPlugin::createSampleSourcePluginInstanceInput(const QString& sourceId, DeviceSourceAPI *deviceAPI)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createSampleSourcePluginInstanceInput(sourceId, deviceAPI) : 0;
+}
+
+void LazyPlugin::deleteSampleSourcePluginInstanceGUI(PluginInstanceGUI *ui)
+{
+    PluginInterface *p = plugin();
+
+    if (p) {
+        p->deleteSampleSourcePluginInstanceGUI(ui);
+    } else {
+        PluginInterface::deleteSampleSourcePluginInstanceGUI(ui);
+    }
+}
+
+void LazyPlugin::deleteSampleSourcePluginInstanceInput(DeviceSampleSource *source)
+{
+    PluginInterface *p = plugin();
+
+    if (p) {
+        p->deleteSampleSourcePluginInstanceInput(source);
+    } else {
+        PluginInterface::deleteSampleSourcePluginInstanceInput(source);
+    }
+}
+
+PluginInterface::SamplingDevices LazyPlugin::enumSampleSinks()
+{
+    PluginInterface *p = plugin();
+    return p ? p->enumSampleSinks() : SamplingDevices();
+}
+
+PluginInstanceGUI* LazyPlugin::createSampleSinkPluginInstanceGUI(const QString& sinkId, QWidget **widget, DeviceUISet *deviceUISet)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createSampleSinkPluginInstanceGUI(sinkId, widget, deviceUISet) : 0;
+}
+
+DeviceSampleSink* LazyPlugin::createSampleSinkPluginInstanceOutput(const QString& sinkId, DeviceSinkAPI *deviceAPI)
+{
+    PluginInterface *p = plugin();
+    return p ? p->createSampleSinkPluginInstanceOutput(sinkId, deviceAPI) : 0;
+}
+
+void LazyPlugin::deleteSampleSinkPluginInstanceGUI(PluginInstanceGUI *ui)
+{
+    PluginInterface *p = plugin();
+
+    if (p) {
+        p->deleteSampleSinkPluginInstanceGUI(ui);
+    } else {
+        PluginInterface::deleteSampleSinkPluginInstanceGUI(ui);
+    }
+}
+
+void LazyPlugin::deleteSampleSinkPluginInstanceOutput(DeviceSampleSink *sink)
+{
+    PluginInterface *p = plugin();
+
+    if (p) {
+        p->deleteSampleSinkPluginInstanceOutput(sink);
+    } else {
+        PluginInterface::deleteSampleSinkPluginInstanceOutput(sink);
+    }
+}
@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_PLUGIN_LAZYPLUGIN_H_
+#define SDRBASE_PLUGIN_LAZYPLUGIN_H_
+
+#include <QString>
+#include <QMutex>
+
+#include "plugin/plugininterface.h"
+#include "util/export.h"
+
+class PluginManager;
+
+/**
+ * Stands for a plugin described in the plugins manifest. The descriptor and the registrations
+ * are known from the manifest so the shared library is only loaded when the plugin is actually
+ * used. Any call other than the descriptor queries loads it and is forwarded to the real plugin.
+ * Loading may happen in the device enumeration threads so it is protected by a mutex.
+ */
+class SDRANGEL_API LazyPlugin : public PluginInterface
+{
+public:
+    LazyPlugin(const QString& fileName, const PluginDescriptor& pluginDescriptor, bool deviceEnumerationCacheable, PluginManager *pluginManager);
+    virtual ~LazyPlugin();
+
+    const QString& getFileName() const { return m_fileName; }
+    bool isLoaded() const;
+
+    virtual const PluginDescriptor& getPluginDescriptor() const { return m_pluginDescriptor; }
+    virtual void initPlugin(PluginAPI* pluginAPI __attribute__((unused))) {} //!< registrations are done from the manifest
+
+    virtual PluginInstanceGUI* createRxChannelGUI(DeviceUISet *deviceUISet, BasebandSampleSink *rxChannel);
+    virtual BasebandSampleSink* createRxChannelBS(DeviceSourceAPI *deviceAPI);
+    virtual ChannelSinkAPI* createRxChannelCS(DeviceSourceAPI *deviceAPI);
+
+    virtual PluginInstanceGUI* createTxChannelGUI(DeviceUISet *deviceUISet, BasebandSampleSource *txChannel);
+    virtual BasebandSampleSource* createTxChannelBS(DeviceSinkAPI *deviceAPI);
+    virtual ChannelSourceAPI* createTxChannelCS(DeviceSinkAPI *deviceAPI);
+
+    virtual bool isDeviceEnumerationCacheable() const { return m_deviceEnumerationCacheable; }
+
+    virtual SamplingDevices enumSampleSources();
+    virtual PluginInstanceGUI* createSampleSourcePluginInstanceGUI(const QString& sourceId, QWidget **widget, DeviceUISet *deviceUISet);
+    virtual DeviceSampleSource* createSampleSourcePluginInstanceInput(const QString& sourceId, DeviceSourceAPI *deviceAPI);
+    virtual void deleteSampleSourcePluginInstanceGUI(PluginInstanceGUI *ui);
+    virtual void deleteSampleSourcePluginInstanceInput(DeviceSampleSource *source);
+
+    virtual SamplingDevices enumSampleSinks();
+    virtual PluginInstanceGUI* createSampleSinkPluginInstanceGUI(const QString& sinkId, QWidget **widget, DeviceUISet *deviceUISet);
+    virtual DeviceSampleSink* createSampleSinkPluginInstanceOutput(const QString& sinkId, DeviceSinkAPI *deviceAPI);
+    virtual void deleteSampleSinkPluginInstanceGUI(PluginInstanceGUI *ui);
+    virtual void deleteSampleSinkPluginInstanceOutput(DeviceSampleSink *sink);
+
+private:
+    QString m_fileName;
+    PluginDescriptor m_pluginDescriptor;
+    bool m_deviceEnumerationCacheable;
+    PluginManager *m_pluginManager;
+    PluginInterface *m_plugin;
+    bool m_loadFailed;
+    mutable QMutex m_mutex;
+
+    PluginInterface *plugin(); //!< the real plugin loaded on first call or 0 if it cannot be loaded
+};
+
+#endif /* SDRBASE_PLUGIN_LAZYPLUGIN_H_ */
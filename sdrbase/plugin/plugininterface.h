@@ -106,6 +106,11 @@ public:
             DeviceSinkAPI *deviceAPI __attribute__((unused)) )
     { return 0; }
 
+    // device source and sink plugins
+
+    /** False if a device cannot be opened without the state built by a fresh enumeration so the cached enumeration is not used */
+    virtual bool isDeviceEnumerationCacheable() const { return true; }
+
     // device source plugins only
 
 	virtual SamplingDevices enumSampleSources() { return SamplingDevices(); }
@@ -16,11 +16,22 @@
 
 #include <QCoreApplication>
 #include <QPluginLoader>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QSettings>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QFile>
+#include <QScopedPointer>
 //#include <QComboBox>
 #include <QDebug>
 
 #include <cstdio>
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 #include <plugin/plugininstancegui.h>
 #include "device/devicesourceapi.h"
 #include "device/devicesinkapi.h"
@@ -30,6 +41,7 @@
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 
+#include "plugin/lazyplugin.h"
 #include "plugin/pluginmanager.h"
 
 const QString PluginManager::m_sdrDaemonSourceHardwareID = "SDRdaemonSource";
@@ -42,9 +54,41 @@ const QString PluginManager::m_sdrDaemonSinkDeviceTypeID = "sdrangel.samplesink.
 const QString PluginManager::m_fileSinkHardwareID = "FileSink";
 const QString PluginManager::m_fileSinkDeviceTypeID = "sdrangel.samplesink.filesink";
 
+namespace {
+
+QSettings *createManifestSettings()
+{
+    return new QSettings(QSettings::IniFormat, QSettings::UserScope,
+            QCoreApplication::organizationName(),
+            QCoreApplication::applicationName() + "-plugins");
+}
+
+/** Resident set size in kB or -1 if not known */
+long getResidentMemory()
+{
+#ifdef __linux__
+    QFile statm("/proc/self/statm");
+
+    if (statm.open(QIODevice::ReadOnly))
+    {
+        QList<QByteArray> fields = statm.readAll().split(' ');
+
+        if (fields.size() > 1) {
+            return fields[1].toLong() * (sysconf(_SC_PAGESIZE) / 1024);
+        }
+    }
+#endif
+    return -1;
+}
+
+} // namespace
+
 PluginManager::PluginManager(QObject* parent) :
 	QObject(parent),
-    m_pluginAPI(this)
+    m_pluginAPI(this),
+    m_lazyLoading(true),
+    m_registeringEntry(0),
+    m_loadingDeferred(false)
 {
 }
 
@@ -63,18 +107,157 @@ void PluginManager::loadPlugins(const QString& pluginsSubDir)
     QDir pluginsLibDir = QDir(applicationLibPath);
     QDir pluginsBuildDir = QDir(applicationBuildPath);
 
-    loadPluginsDir(pluginsLibDir);
-    loadPluginsDir(pluginsBuildDir);
+    QElapsedTimer loadTimer;
+    loadTimer.start();
+    long residentMemoryStart = getResidentMemory();
+    Manifest previousManifest;
+
+    if (m_lazyLoading) {
+        loadManifest(previousManifest);
+    }
+
+    m_manifest.clear();
+    loadPluginsDir(pluginsLibDir, previousManifest);
+    loadPluginsDir(pluginsBuildDir, previousManifest);
 
 	qSort(m_plugins);
+	int nbDeferred = 0;
 
 	for (Plugins::const_iterator it = m_plugins.begin(); it != m_plugins.end(); ++it)
 	{
-		it->pluginInterface->initPlugin(&m_pluginAPI);
+		ManifestEntry& entry = m_manifest[it->filePath];
+
+		if (it->deferred)
+		{
+			registerFromManifest(entry, it->pluginInterface);
+			nbDeferred++;
+		}
+		else
+		{
+			m_registeringEntry = &entry;
+			it->pluginInterface->initPlugin(&m_pluginAPI);
+			m_registeringEntry = 0;
+		}
+	}
+
+	saveManifest();
+	qint64 loadTime = loadTimer.elapsed();
+
+	DeviceEnumerator::instance()->enumerateDevices(this);
+
+	qInfo("PluginManager::loadPlugins: %d plugins (%d deferred) in %lld ms, with devices enumeration %lld ms. Resident memory: %ld kB (+%ld kB)",
+	        m_plugins.size(), nbDeferred, loadTime, loadTimer.elapsed(),
+	        getResidentMemory(), getResidentMemory() - residentMemoryStart);
+}
+
+PluginInterface *PluginManager::loadDeferredPlugin(const QString& filePath)
+{
+	QPluginLoader loader(filePath);
+	QObject *instance = loader.instance();
+	PluginInterface *plugin = qobject_cast<PluginInterface*>(instance);
+
+	if (!plugin)
+	{
+		qWarning("PluginManager::loadDeferredPlugin: %s: %s", qPrintable(filePath), qPrintable(loader.errorString()));
+		return 0;
+	}
+
+	if (instance->thread() != thread()) { // loaded from a devices enumeration thread
+		instance->moveToThread(thread());
+	}
+
+	QMutexLocker mutexLocker(&m_deferredMutex);
+	m_loadingDeferred = true;
+	plugin->initPlugin(&m_pluginAPI);
+	m_loadingDeferred = false;
+
+	qInfo("PluginManager::loadDeferredPlugin: loaded plugin %s", qPrintable(filePath));
+	return plugin;
+}
+
+void PluginManager::registerFromManifest(const ManifestEntry& entry, PluginInterface* plugin)
+{
+	for (int i = 0; i < entry.m_rxChannelURIs.size() && i < entry.m_rxChannelIds.size(); i++) {
+		registerRxChannel(entry.m_rxChannelURIs[i], entry.m_rxChannelIds[i], plugin);
+	}
+
+	for (int i = 0; i < entry.m_txChannelURIs.size() && i < entry.m_txChannelIds.size(); i++) {
+		registerTxChannel(entry.m_txChannelURIs[i], entry.m_txChannelIds[i], plugin);
+	}
+
+	for (int i = 0; i < entry.m_sampleSources.size(); i++) {
+		registerSampleSource(entry.m_sampleSources[i], plugin);
+	}
+
+	for (int i = 0; i < entry.m_sampleSinks.size(); i++) {
+		registerSampleSink(entry.m_sampleSinks[i], plugin);
+	}
+}
+
+void PluginManager::loadManifest(Manifest& manifest) const
+{
+	QScopedPointer<QSettings> settings(createManifestSettings());
+
+	if (settings->value("applicationVersion").toString() != QCoreApplication::applicationVersion()) {
+		return; // plugins may rely on a different API
+	}
+
+	int size = settings->beginReadArray("plugins");
+
+	for (int i = 0; i < size; i++)
+	{
+		settings->setArrayIndex(i);
+		ManifestEntry& entry = manifest[settings->value("file").toString()];
+		entry.m_size = settings->value("size").toLongLong();
+		entry.m_lastModified = settings->value("lastModified").toLongLong();
+		entry.m_displayedName = settings->value("displayedName").toString();
+		entry.m_version = settings->value("version").toString();
+		entry.m_copyright = settings->value("copyright").toString();
+		entry.m_website = settings->value("website").toString();
+		entry.m_licenseIsGPL = settings->value("licenseIsGPL").toBool();
+		entry.m_sourceCodeURL = settings->value("sourceCodeURL").toString();
+		entry.m_deviceEnumerationCacheable = settings->value("deviceEnumerationCacheable", true).toBool();
+		entry.m_rxChannelURIs = settings->value("rxChannelURIs").toStringList();
+		entry.m_rxChannelIds = settings->value("rxChannelIds").toStringList();
+		entry.m_txChannelURIs = settings->value("txChannelURIs").toStringList();
+		entry.m_txChannelIds = settings->value("txChannelIds").toStringList();
+		entry.m_sampleSources = settings->value("sampleSources").toStringList();
+		entry.m_sampleSinks = settings->value("sampleSinks").toStringList();
+	}
+
+	settings->endArray();
+}
+
+void PluginManager::saveManifest() const
+{
+	QScopedPointer<QSettings> settings(createManifestSettings());
+	settings->clear();
+	settings->setValue("applicationVersion", QCoreApplication::applicationVersion());
+	settings->beginWriteArray("plugins");
+	int i = 0;
+
+	for (Manifest::const_iterator it = m_manifest.begin(); it != m_manifest.end(); ++it, i++)
+	{
+		settings->setArrayIndex(i);
+		settings->setValue("file", it.key());
+		settings->setValue("size", it->m_size);
+		settings->setValue("lastModified", it->m_lastModified);
+		settings->setValue("displayedName", it->m_displayedName);
+		settings->setValue("version", it->m_version);
+		settings->setValue("copyright", it->m_copyright);
+		settings->setValue("website", it->m_website);
+		settings->setValue("licenseIsGPL", it->m_licenseIsGPL);
+		settings->setValue("sourceCodeURL", it->m_sourceCodeURL);
+		settings->setValue("deviceEnumerationCacheable", it->m_deviceEnumerationCacheable);
+		settings->setValue("rxChannelURIs", it->m_rxChannelURIs);
+		settings->setValue("rxChannelIds", it->m_rxChannelIds);
+		settings->setValue("txChannelURIs", it->m_txChannelURIs);
+		settings->setValue("txChannelIds", it->m_txChannelIds);
+		settings->setValue("sampleSources", it->m_sampleSources);
+		settings->setValue("sampleSinks", it->m_sampleSinks);
 	}
 
-	DeviceEnumerator::instance()->enumerateRxDevices(this);
-	DeviceEnumerator::instance()->enumerateTxDevices(this);
+	settings->endArray();
 }
 
 void PluginManager::registerRxChannel(const QString& channelIdURI, const QString& channelId, PluginInterface* plugin)
@@ -83,7 +266,17 @@ void PluginManager::registerRxChannel(const QString& channelIdURI, const QString
             << plugin->getPluginDescriptor().displayedName.toStdString().c_str()
             << " with channel name " << channelIdURI;
 
+	if (m_loadingDeferred) {
+		return; // registered from the manifest
+	}
+
 	m_rxChannelRegistrations.append(PluginAPI::ChannelRegistration(channelIdURI, channelId, plugin));
+
+	if (m_registeringEntry)
+	{
+		m_registeringEntry->m_rxChannelURIs.append(channelIdURI);
+		m_registeringEntry->m_rxChannelIds.append(channelId);
+	}
 }
 
 void PluginManager::registerTxChannel(const QString& channelIdURI, const QString& channelId, PluginInterface* plugin)
@@ -92,7 +285,17 @@ void PluginManager::registerTxChannel(const QString& channelIdURI, const QString
             << plugin->getPluginDescriptor().displayedName.toStdString().c_str()
             << " with channel name " << channelIdURI;
 
+	if (m_loadingDeferred) {
+		return; // registered from the manifest
+	}
+
 	m_txChannelRegistrations.append(PluginAPI::ChannelRegistration(channelIdURI, channelId, plugin));
+
+	if (m_registeringEntry)
+	{
+		m_registeringEntry->m_txChannelURIs.append(channelIdURI);
+		m_registeringEntry->m_txChannelIds.append(channelId);
+	}
 }
 
 void PluginManager::registerSampleSource(const QString& sourceName, PluginInterface* plugin)
@@ -101,7 +304,15 @@ void PluginManager::registerSampleSource(const QString& sourceName, PluginInterf
 			<< plugin->getPluginDescriptor().displayedName.toStdString().c_str()
 			<< " with source name " << sourceName.toStdString().c_str();
 
+	if (m_loadingDeferred) {
+		return; // registered from the manifest
+	}
+
 	m_sampleSourceRegistrations.append(PluginAPI::SamplingDeviceRegistration(sourceName, plugin));
+
+	if (m_registeringEntry) {
+		m_registeringEntry->m_sampleSources.append(sourceName);
+	}
 }
 
 void PluginManager::registerSampleSink(const QString& sinkName, PluginInterface* plugin)
@@ -110,10 +321,18 @@ void PluginManager::registerSampleSink(const QString& sinkName, PluginInterface*
 			<< plugin->getPluginDescriptor().displayedName.toStdString().c_str()
 			<< " with sink name " << sinkName.toStdString().c_str();
 
+	if (m_loadingDeferred) {
+		return; // registered from the manifest
+	}
+
 	m_sampleSinkRegistrations.append(PluginAPI::SamplingDeviceRegistration(sinkName, plugin));
+
+	if (m_registeringEntry) {
+		m_registeringEntry->m_sampleSinks.append(sinkName);
+	}
 }
 
-void PluginManager::loadPluginsDir(const QDir& dir)
+void PluginManager::loadPluginsDir(const QDir& dir, const Manifest& previousManifest)
 {
 	QDir pluginsDir(dir);
 
@@ -123,6 +342,27 @@ void PluginManager::loadPluginsDir(const QDir& dir)
 		{
 			qDebug() << "PluginManager::loadPluginsDir: fileName: " << qPrintable(fileName);
 
+			QFileInfo fileInfo(pluginsDir.absoluteFilePath(fileName));
+			QString filePath = fileInfo.absoluteFilePath();
+			Manifest::const_iterator previousEntry = previousManifest.find(filePath);
+
+			if ((previousEntry != previousManifest.end())
+			 && (previousEntry->m_size == fileInfo.size())
+			 && (previousEntry->m_lastModified == fileInfo.lastModified().toMSecsSinceEpoch()))
+			{
+				PluginDescriptor descriptor = {
+					previousEntry->m_displayedName,
+					previousEntry->m_version,
+					previousEntry->m_copyright,
+					previousEntry->m_website,
+					previousEntry->m_licenseIsGPL,
+					previousEntry->m_sourceCodeURL
+				};
+				m_manifest.insert(filePath, *previousEntry);
+				m_plugins.append(Plugin(fileName, 0, new LazyPlugin(filePath, descriptor, previousEntry->m_deviceEnumerationCacheable, this), filePath, true));
+				continue;
+			}
+
 			QPluginLoader* loader = new QPluginLoader(pluginsDir.absoluteFilePath(fileName));
 			PluginInterface* plugin = qobject_cast<PluginInterface*>(loader->instance());
 
@@ -137,7 +377,18 @@ void PluginManager::loadPluginsDir(const QDir& dir)
 
 			if (plugin != 0)
 			{
-				m_plugins.append(Plugin(fileName, loader, plugin));
+				const PluginDescriptor& descriptor = plugin->getPluginDescriptor();
+				ManifestEntry& entry = m_manifest[filePath];
+				entry.m_size = fileInfo.size();
+				entry.m_lastModified = fileInfo.lastModified().toMSecsSinceEpoch();
+				entry.m_displayedName = descriptor.displayedName;
+				entry.m_version = descriptor.version;
+				entry.m_copyright = descriptor.copyright;
+				entry.m_website = descriptor.website;
+				entry.m_licenseIsGPL = descriptor.licenseIsGPL;
+				entry.m_sourceCodeURL = descriptor.sourceCodeURL;
+				entry.m_deviceEnumerationCacheable = plugin->isDeviceEnumerationCacheable();
+				m_plugins.append(Plugin(fileName, loader, plugin, filePath));
 			}
 			else
 			{
@@ -152,7 +403,7 @@ void PluginManager::loadPluginsDir(const QDir& dir)
 
 	foreach (QString dirName, pluginsDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot))
 	{
-		loadPluginsDir(pluginsDir.absoluteFilePath(dirName));
+		loadPluginsDir(pluginsDir.absoluteFilePath(dirName), previousManifest);
 	}
 }
 
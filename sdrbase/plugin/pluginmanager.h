@@ -5,7 +5,10 @@
 #include <QObject>
 #include <QDir>
 #include <QList>
+#include <QMap>
+#include <QMutex>
 #include <QString>
+#include <QStringList>
 
 #include "plugin/plugininterface.h"
 #include "plugin/pluginapi.h"
@@ -28,11 +31,15 @@ public:
 		QString filename;
 		QPluginLoader* loader;
 		PluginInterface* pluginInterface;
+		QString filePath;  //!< absolute path of the library
+		bool deferred;     //!< pluginInterface is a LazyPlugin built from the manifest
 
-		Plugin(const QString& _filename, QPluginLoader* pluginLoader, PluginInterface* _plugin) :
+		Plugin(const QString& _filename, QPluginLoader* pluginLoader, PluginInterface* _plugin, const QString& _filePath = QString(), bool _deferred = false) :
 			filename(_filename),
 			loader(pluginLoader),
-			pluginInterface(_plugin)
+			pluginInterface(_plugin),
+			filePath(_filePath),
+			deferred(_deferred)
 		{ }
 	};
 
@@ -43,6 +50,8 @@ public:
 
 	PluginAPI *getPluginAPI() { return &m_pluginAPI; }
 	void loadPlugins(const QString& pluginsSubDir);
+	PluginInterface *loadDeferredPlugin(const QString& filePath); //!< loads a plugin registered from the manifest on its first use
+	void setLazyLoading(bool lazyLoading) { m_lazyLoading = lazyLoading; }
 	const Plugins& getPlugins() const { return m_plugins; }
 
 	// Callbacks from the plugins
@@ -91,8 +100,41 @@ private:
 
 	typedef QList<SamplingDevice> SamplingDevices;
 
+	struct ManifestEntry //!< What is known of a plugin library without loading it
+	{
+		qint64 m_size;
+		qint64 m_lastModified;          //!< ms since epoch
+		QString m_displayedName;
+		QString m_version;
+		QString m_copyright;
+		QString m_website;
+		bool m_licenseIsGPL;
+		QString m_sourceCodeURL;
+		bool m_deviceEnumerationCacheable;
+		QStringList m_rxChannelURIs;
+		QStringList m_rxChannelIds;
+		QStringList m_txChannelURIs;
+		QStringList m_txChannelIds;
+		QStringList m_sampleSources;
+		QStringList m_sampleSinks;
+
+		ManifestEntry() :
+			m_size(0),
+			m_lastModified(0),
+			m_licenseIsGPL(false),
+			m_deviceEnumerationCacheable(true)
+		{ }
+	};
+
+	typedef QMap<QString, ManifestEntry> Manifest; //!< by library absolute path
+
 	PluginAPI m_pluginAPI;
 	Plugins m_plugins;
+	bool m_lazyLoading;                 //!< plugins unchanged since the manifest was written are loaded on first use
+	Manifest m_manifest;                //!< plugins found at this start
+	ManifestEntry *m_registeringEntry;  //!< collects the registrations of the plugin being initialized
+	bool m_loadingDeferred;             //!< registrations are already done from the manifest
+	QMutex m_deferredMutex;
 
 	PluginAPI::ChannelRegistrations m_rxChannelRegistrations;           //!< Channel plugins register here
 	PluginAPI::SamplingDeviceRegistrations m_sampleSourceRegistrations; //!< Input source plugins (one per device kind) register here
@@ -112,7 +154,10 @@ private:
     static const QString m_fileSinkHardwareID;        //!< FileSource source hardware ID
     static const QString m_fileSinkDeviceTypeID;      //!< FileSink sink plugin ID
 
-	void loadPluginsDir(const QDir& dir);
+	void loadPluginsDir(const QDir& dir, const Manifest& previousManifest);
+	void registerFromManifest(const ManifestEntry& entry, PluginInterface* plugin);
+	void loadManifest(Manifest& manifest) const;
+	void saveManifest() const;
 };
 
 static inline bool operator<(const PluginManager::Plugin& a, const PluginManager::Plugin& b)
@@ -4,7 +4,7 @@
 #
 #--------------------------------------------------------
 
-QT += core multimedia
+QT += core multimedia network
 greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 
 TEMPLATE = lib
@@ -63,12 +63,14 @@ SOURCES += audio/audiodeviceinfo.cpp\
         dsp/downchannelizer.cpp\
         dsp/upchannelizer.cpp\
         dsp/channelmarker.cpp\
+        dsp/channelrecord.cpp\
         dsp/ctcssdetector.cpp\
         dsp/cwkeyer.cpp\
         dsp/cwkeyersettings.cpp\
         dsp/decimatorsf.cpp\
         dsp/dspcommands.cpp\
         dsp/dspengine.cpp\
+        dsp/dspexecutor.cpp\
         dsp/dspdevicesourceengine.cpp\
         dsp/dspdevicesinkengine.cpp\
         dsp/fftengine.cpp\
@@ -78,19 +80,26 @@ SOURCES += audio/audiodeviceinfo.cpp\
         dsp/filterrc.cpp\
         dsp/filtermbe.cpp\
         dsp/filerecord.cpp\
+        dsp/firfilter.cpp\
         dsp/interpolator.cpp\
         dsp/hbfiltertraits.cpp\
+        dsp/inthalfbandfilterng.cpp\
         dsp/lowpass.cpp\
         dsp/nco.cpp\
         dsp/ncof.cpp\
         dsp/phaselock.cpp\
+        dsp/pretriggerrecord.cpp\
         dsp/recursivefilters.cpp\
+        dsp/sampleformat.cpp\
         dsp/samplesinkfifo.cpp\
         dsp/samplesourcefifo.cpp\
+        dsp/spectrumarchive.cpp\
+        dsp/spectrumstreamsink.cpp\
         dsp/samplesinkfifodoublebuffered.cpp\
         dsp/basebandsamplesink.cpp\
         dsp/basebandsamplesource.cpp\
         dsp/nullsink.cpp\
+        dsp/sigmf.cpp\
         dsp/threadedbasebandsamplesink.cpp\
         dsp/threadedbasebandsamplesource.cpp\
         dsp/wfir.cpp\
@@ -98,20 +107,27 @@ SOURCES += audio/audiodeviceinfo.cpp\
         dsp/devicesamplesink.cpp\
         settings/preferences.cpp\
         settings/preset.cpp\
+        settings/presetstore.cpp\
         settings/mainsettings.cpp\
         util/CRC64.cpp\
         util/db.cpp\
         util/message.cpp\
+        util/messagepool.cpp\
         util/messagequeue.cpp\
         util/prettyprint.cpp\
+        util/profilehistogram.cpp\
         util/syncmessenger.cpp\
         util/samplesourceserializer.cpp\
         util/simpleserializer.cpp\
+        util/spectrumstreamserver.cpp\
+        util/threadscheduling.cpp\
         util/uid.cpp\
         plugin/plugininterface.cpp\
         plugin/pluginapi.cpp\        
         plugin/pluginmanager.cpp\
+        plugin/lazyplugin.cpp\
         webapi/webapiadapterinterface.cpp\
+        webapi/webapimetrics.cpp\
         webapi/webapirequestmapper.cpp\
         webapi/webapiserver.cpp\
         mainparser.cpp
@@ -131,6 +147,7 @@ HEADERS  += audio/audiodeviceinfo.h\
         dsp/downchannelizer.h\
         dsp/upchannelizer.h\
         dsp/channelmarker.h\
+        dsp/channelrecord.h\
         dsp/cwkeyer.h\
         dsp/cwkeyersettings.h\
         dsp/complex.h\
@@ -139,6 +156,7 @@ HEADERS  += audio/audiodeviceinfo.h\
         dsp/interpolators.h\
         dsp/dspcommands.h\
         dsp/dspengine.h\
+        dsp/dspexecutor.h\
         dsp/dspdevicesourceengine.h\
         dsp/dspdevicesinkengine.h\
         dsp/dsptypes.h\
@@ -149,6 +167,7 @@ HEADERS  += audio/audiodeviceinfo.h\
         dsp/filterrc.h\
         dsp/filtermbe.h\
         dsp/filerecord.h\
+        dsp/firfilter.h\
         dsp/gfft.h\
         dsp/hbfiltertraits.h\
         dsp/iirfilter.h\
@@ -157,6 +176,7 @@ HEADERS  += audio/audiodeviceinfo.h\
         dsp/inthalfbandfilterdb.h\
         dsp/inthalfbandfiltereo1.h\
         dsp/inthalfbandfiltereo1i.h\
+        dsp/inthalfbandfilterng.h\
         dsp/inthalfbandfilterst.h\
         dsp/inthalfbandfiltersti.h\
         dsp/kissfft.h\
@@ -168,14 +188,19 @@ HEADERS  += audio/audiodeviceinfo.h\
         dsp/ncof.h\
         dsp/phasediscri.h\
         dsp/phaselock.h\
+        dsp/pretriggerrecord.h\
         dsp/recursivefilters.h\
+        dsp/sampleformat.h\
         dsp/samplesinkfifo.h\
         dsp/samplesourcefifo.h\
+        dsp/spectrumarchive.h\
+        dsp/spectrumstreamsink.h\
         dsp/samplesinkfifodoublebuffered.h\
         dsp/samplesinkfifodecimator.h\
         dsp/basebandsamplesink.h\
         dsp/basebandsamplesource.h\
         dsp/nullsink.h\
+        dsp/sigmf.h\
         dsp/threadedbasebandsamplesink.h\
         dsp/threadedbasebandsamplesource.h\
         dsp/wfir.h\
@@ -185,20 +210,28 @@ HEADERS  += audio/audiodeviceinfo.h\
         plugin/plugininterface.h\   
         plugin/pluginapi.h\   
         plugin/pluginmanager.h\   
+        plugin/lazyplugin.h\
         settings/preferences.h\
         settings/preset.h\
+        settings/presetstore.h\
         settings/mainsettings.h\
         util/CRC64.h\
         util/db.h\
         util/export.h\
         util/message.h\
+        util/messagedispatcher.h\
+        util/messagepool.h\
         util/messagequeue.h\
         util/prettyprint.h\
+        util/profilehistogram.h\
         util/syncmessenger.h\
         util/samplesourceserializer.h\
         util/simpleserializer.h\
+        util/spectrumstreamserver.h\
+        util/threadscheduling.h\
         util/uid.h\
         webapi/webapiadapterinterface.h\
+        webapi/webapimetrics.h\
         webapi/webapirequestmapper.h\
         webapi/webapiserver.h\
         mainparser.h
@@ -1,5 +1,7 @@
 #include <QSettings>
 #include <QStringList>
+#include <QFileInfo>
+#include <QCoreApplication>
 
 #include "settings/mainsettings.h"
 #include "commands/command.h"
@@ -34,6 +36,27 @@ void MainSettings::load()
 	    m_audioDeviceInfo->deserialize(qUncompress(QByteArray::fromBase64(s.value("audio").toByteArray())));
 	}
 
+	m_presetStore.setFileName(QFileInfo(s.fileName()).absolutePath() + "/" + QCoreApplication::applicationName() + "-presets.bin");
+
+	if (m_presetStore.exists())
+	{
+		m_presetStore.load(m_presets, m_commands);
+	}
+	else // migrate
+	{
+		loadSettingsPresets(s);
+
+		if (m_presetStore.save(m_presets, m_commands))
+		{
+			qDebug("MainSettings::load: %d presets and %d commands moved to %s",
+					m_presets.size(), m_commands.size(), qPrintable(m_presetStore.getFileName()));
+			removeSettingsPresets(s);
+		}
+	}
+}
+
+void MainSettings::loadSettingsPresets(QSettings& s)
+{
 	QStringList groups = s.childGroups();
 
 	for(int i = 0; i < groups.size(); ++i)
@@ -85,6 +108,13 @@ void MainSettings::save() const
 	    s.setValue("audio", qCompress(m_audioDeviceInfo->serialize()).toBase64());
 	}
 
+	if (!m_presetStore.getFileName().isEmpty()) {
+		m_presetStore.save(m_presets, m_commands);
+	}
+}
+
+void MainSettings::removeSettingsPresets(QSettings& s)
+{
 	QStringList groups = s.childGroups();
 
 	for(int i = 0; i < groups.size(); ++i)
@@ -94,22 +124,6 @@ void MainSettings::save() const
 			s.remove(groups[i]);
 		}
 	}
-
-	for (int i = 0; i < m_presets.count(); ++i)
-	{
-		QString group = QString("preset-%1").arg(i + 1);
-		s.beginGroup(group);
-		s.setValue("data", qCompress(m_presets[i]->serialize()).toBase64());
-		s.endGroup();
-	}
-
-    for (int i = 0; i < m_commands.count(); ++i)
-    {
-        QString group = QString("command-%1").arg(i + 1);
-        s.beginGroup(group);
-        s.setValue("data", qCompress(m_commands[i]->serialize()).toBase64());
-        s.endGroup();
-    }
 }
 
 void MainSettings::resetToDefaults()
@@ -4,9 +4,11 @@
 #include <QString>
 #include "preferences.h"
 #include "preset.h"
+#include "presetstore.h"
 #include "audio/audiodeviceinfo.h"
 
 class Command;
+class QSettings;
 
 class MainSettings {
 public:
@@ -56,6 +58,16 @@ public:
     bool getUseLogFile() const { return m_preferences.getUseLogFile(); }
     const QString& getLogFileName() const { return m_preferences.getLogFileName(); }
 
+    void setUseDSPThreadPool(bool use) { m_preferences.setUseDSPThreadPool(use); }
+    void setDSPThreadPoolSize(int size) { m_preferences.setDSPThreadPoolSize(size); }
+    bool getUseDSPThreadPool() const { return m_preferences.getUseDSPThreadPool(); }
+    int getDSPThreadPoolSize() const { return m_preferences.getDSPThreadPoolSize(); }
+    void setRecordSigMF(bool recordSigMF) { m_preferences.setRecordSigMF(recordSigMF); }
+    bool getRecordSigMF() const { return m_preferences.getRecordSigMF(); }
+
+    void setThreadScheduling(int deviceSetIndex, const ThreadSchedulingSettings& settings) { m_preferences.setThreadScheduling(deviceSetIndex, settings); }
+    ThreadSchedulingSettings getThreadScheduling(int deviceSetIndex) const { return m_preferences.getThreadScheduling(deviceSetIndex); }
+
 	const AudioDeviceInfo *getAudioDeviceInfo() const { return m_audioDeviceInfo; }
 	void setAudioDeviceInfo(AudioDeviceInfo *audioDeviceInfo) { m_audioDeviceInfo = audioDeviceInfo; }
 
@@ -67,6 +79,10 @@ protected:
 	Presets m_presets;
     typedef QList<Command*> Commands;
     Commands m_commands;
+    mutable PresetStore m_presetStore;
+
+    void loadSettingsPresets(QSettings& s); //!< presets and commands as they were stored before the preset store
+    static void removeSettingsPresets(QSettings& s);
 };
 
 #endif // INCLUDE_SETTINGS_H
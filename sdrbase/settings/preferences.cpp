@@ -19,6 +19,10 @@ void Preferences::resetToDefaults()
 	m_logFileName = "sdrangel.log";
 	m_consoleMinLogLevel = QtDebugMsg;
     m_fileMinLogLevel = QtDebugMsg;
+	m_useDSPThreadPool = false;
+	m_dspThreadPoolSize = 0;
+	m_recordSigMF = false;
+	m_threadScheduling.clear();
 }
 
 QByteArray Preferences::serialize() const
@@ -35,6 +39,15 @@ QByteArray Preferences::serialize() const
 	s.writeBool(9, m_useLogFile);
 	s.writeString(10, m_logFileName);
     s.writeS32(11, (int) m_fileMinLogLevel);
+	s.writeBool(12, m_useDSPThreadPool);
+	s.writeS32(13, m_dspThreadPoolSize);
+	s.writeS32(14, m_threadScheduling.size());
+	s.writeBool(15, m_recordSigMF);
+
+	for (int i = 0; i < m_threadScheduling.size(); i++) {
+		s.writeBlob(100 + i, m_threadScheduling[i].serialize());
+	}
+
 	return s.final();
 }
 
@@ -86,6 +99,27 @@ bool Preferences::deserialize(const QByteArray& data)
             m_fileMinLogLevel = QtDebugMsg;
         }
 
+        d.readBool(12, &m_useDSPThreadPool, false);
+        d.readS32(13, &m_dspThreadPoolSize, 0);
+
+        if (m_dspThreadPoolSize < 0) {
+            m_dspThreadPoolSize = 0;
+        }
+
+        int nbThreadScheduling;
+        d.readS32(14, &nbThreadScheduling, 0);
+        m_threadScheduling.clear();
+
+        for (int i = 0; i < nbThreadScheduling; i++)
+        {
+            QByteArray blob;
+            d.readBlob(100 + i, &blob);
+            m_threadScheduling.append(ThreadSchedulingSettings());
+            m_threadScheduling.back().deserialize(blob);
+        }
+
+        d.readBool(15, &m_recordSigMF, false);
+
 		return true;
 	} else
 	{
@@ -93,3 +127,25 @@ bool Preferences::deserialize(const QByteArray& data)
 		return false;
 	}
 }
+
+void Preferences::setThreadScheduling(int deviceSetIndex, const ThreadSchedulingSettings& settings)
+{
+	if (deviceSetIndex < 0) {
+		return;
+	}
+
+	while (m_threadScheduling.size() <= deviceSetIndex) {
+		m_threadScheduling.append(ThreadSchedulingSettings());
+	}
+
+	m_threadScheduling[deviceSetIndex] = settings;
+}
+
+ThreadSchedulingSettings Preferences::getThreadScheduling(int deviceSetIndex) const
+{
+	if ((deviceSetIndex < 0) || (deviceSetIndex >= m_threadScheduling.size())) {
+		return ThreadSchedulingSettings();
+	}
+
+	return m_threadScheduling[deviceSetIndex];
+}
@@ -2,6 +2,9 @@
 #define INCLUDE_PREFERENCES_H
 
 #include <QString>
+#include <QList>
+
+#include "util/threadscheduling.h"
 
 class Preferences {
 public:
@@ -37,6 +40,17 @@ public:
 	bool getUseLogFile() const { return m_useLogFile; }
 	const QString& getLogFileName() const { return m_logFileName; }
 
+	void setUseDSPThreadPool(bool use) { m_useDSPThreadPool = use; }
+	void setDSPThreadPoolSize(int size) { m_dspThreadPoolSize = size; }
+	bool getUseDSPThreadPool() const { return m_useDSPThreadPool; }
+	int getDSPThreadPoolSize() const { return m_dspThreadPoolSize; }
+
+	void setRecordSigMF(bool recordSigMF) { m_recordSigMF = recordSigMF; }
+	bool getRecordSigMF() const { return m_recordSigMF; }
+
+	void setThreadScheduling(int deviceSetIndex, const ThreadSchedulingSettings& settings);
+	ThreadSchedulingSettings getThreadScheduling(int deviceSetIndex) const; //!< defaults if not set for this device set
+
 protected:
 	QString m_sourceType;
 	QString m_sourceDevice;
@@ -52,6 +66,13 @@ protected:
     QtMsgType m_fileMinLogLevel;
 	bool m_useLogFile;
 	QString m_logFileName;
+
+	bool m_useDSPThreadPool;  //!< channels run in a shared pool of threads instead of one thread each
+	int m_dspThreadPoolSize;  //!< number of threads of the pool, 0 for the number of CPU cores
+
+	bool m_recordSigMF;       //!< device recordings in SigMF format instead of .sdriq
+
+	QList<ThreadSchedulingSettings> m_threadScheduling; //!< DSP engine and device threads scheduling by device set index
 };
 
 #endif // INCLUDE_PREFERENCES_H
@@ -10,6 +10,7 @@ Preset::Preset()
 
 void Preset::resetToDefaults()
 {
+    m_deferredData.clear();
     m_sourcePreset = true;
 	m_group = "default";
 	m_description = "no name";
@@ -27,6 +28,8 @@ void Preset::resetToDefaults()
 
 QByteArray Preset::serialize() const
 {
+	loadDeferredData();
+
 //	qDebug("Preset::serialize: m_group: %s mode: %s m_description: %s m_centerFrequency: %llu",
 //			qPrintable(m_group),
 //			m_sourcePreset ? "Rx" : "Tx",
@@ -78,6 +81,7 @@ QByteArray Preset::serialize() const
 
 bool Preset::deserialize(const QByteArray& data)
 {
+	m_deferredData.clear();
 	SimpleDeserializer d(data);
 
 	if (!d.isValid())
@@ -159,11 +163,33 @@ bool Preset::deserialize(const QByteArray& data)
 	}
 }
 
+void Preset::deserializeDeferredData()
+{
+	QByteArray data = qUncompress(m_deferredData);
+	m_deferredData.clear();
+
+	// the header may have been changed (group renamed) since the preset was stored
+	QString group = m_group;
+	QString description = m_description;
+	quint64 centerFrequency = m_centerFrequency;
+	bool sourcePreset = m_sourcePreset;
+
+	if (!deserialize(data)) {
+		qWarning("Preset::deserializeDeferredData: invalid data for preset %s: %s", qPrintable(group), qPrintable(description));
+	}
+
+	m_group = group;
+	m_description = description;
+	m_centerFrequency = centerFrequency;
+	m_sourcePreset = sourcePreset;
+}
+
 void Preset::addOrUpdateDeviceConfig(const QString& sourceId,
 		const QString& sourceSerial,
 		int sourceSequence,
 		const QByteArray& config)
 {
+	loadDeferredData();
 	DeviceeConfigs::iterator it = m_deviceConfigs.begin();
 
 	for (; it != m_deviceConfigs.end(); ++it)
@@ -201,6 +227,7 @@ const QByteArray* Preset::findBestDeviceConfig(const QString& sourceId,
 		const QString& sourceSerial,
 		int sourceSequence) const
 {
+	loadDeferredData();
 	DeviceeConfigs::const_iterator it = m_deviceConfigs.begin();
 	DeviceeConfigs::const_iterator itFirstOfKind = m_deviceConfigs.end();
 	DeviceeConfigs::const_iterator itMatchSequence = m_deviceConfigs.end();
@@ -48,6 +48,10 @@ public:
 	QByteArray serialize() const;
 	bool deserialize(const QByteArray& data);
 
+	/** Group, description, center frequency and direction are set. The rest is deserialized from the compressed data on first use. */
+	void setDeferredData(const QByteArray& compressedData) { m_deferredData = compressedData; }
+	bool hasDeferredData() const { return !m_deferredData.isEmpty(); }
+
 	void setGroup(const QString& group) { m_group = group; }
 	const QString& getGroup() const { return m_group; }
 	void setDescription(const QString& description) { m_description = description; }
@@ -55,16 +59,16 @@ public:
 	void setCenterFrequency(const quint64 centerFrequency) { m_centerFrequency = centerFrequency; }
 	quint64 getCenterFrequency() const { return m_centerFrequency; }
 
-	void setSpectrumConfig(const QByteArray& data) { m_spectrumConfig = data; }
-	const QByteArray& getSpectrumConfig() const { return m_spectrumConfig; }
+	void setSpectrumConfig(const QByteArray& data) { loadDeferredData(); m_spectrumConfig = data; }
+	const QByteArray& getSpectrumConfig() const { loadDeferredData(); return m_spectrumConfig; }
 
-	void setLayout(const QByteArray& data) { m_layout = data; }
-	const QByteArray& getLayout() const { return m_layout; }
+	void setLayout(const QByteArray& data) { loadDeferredData(); m_layout = data; }
+	const QByteArray& getLayout() const { loadDeferredData(); return m_layout; }
 
-	void clearChannels() { m_channelConfigs.clear(); }
-	void addChannel(const QString& channel, const QByteArray& config) { m_channelConfigs.append(ChannelConfig(channel, config)); }
-	int getChannelCount() const { return m_channelConfigs.count(); }
-	const ChannelConfig& getChannelConfig(int index) const { return m_channelConfigs.at(index); }
+	void clearChannels() { loadDeferredData(); m_channelConfigs.clear(); }
+	void addChannel(const QString& channel, const QByteArray& config) { loadDeferredData(); m_channelConfigs.append(ChannelConfig(channel, config)); }
+	int getChannelCount() const { loadDeferredData(); return m_channelConfigs.count(); }
+	const ChannelConfig& getChannelConfig(int index) const { loadDeferredData(); return m_channelConfigs.at(index); }
 
 	void setDeviceConfig(const QString& deviceId, const QString& deviceSerial, int deviceSequence, const QByteArray& config)
 	{
@@ -125,6 +129,18 @@ protected:
 
 	// screen and dock layout
 	QByteArray m_layout;
+
+	// compressed serialized preset not deserialized yet
+	QByteArray m_deferredData;
+
+	void loadDeferredData() const
+	{
+		if (!m_deferredData.isEmpty()) {
+			const_cast<Preset*>(this)->deserializeDeferredData(); // the preset is logically unchanged
+		}
+	}
+
+	void deserializeDeferredData();
 };
 
 Q_DECLARE_METATYPE(const Preset*);
@@ -0,0 +1,396 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <string.h>
+#include <algorithm>
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QCryptographicHash>
+#include <QtEndian>
+#include <QSet>
+#include <QDebug>
+
+#include "settings/preset.h"
+#include "commands/command.h"
+#include "settings/presetstore.h"
+
+const char PresetStore::m_fileMagic[8] = {'S', 'D', 'R', 'P', 'R', 'S', 'E', 'T'};
+const quint32 PresetStore::m_fileVersion = 1;
+const int PresetStore::m_fileHeaderSize = 12;
+
+PresetStore::PresetStore() :
+    m_nextId(1),
+    m_fileSize(0),
+    m_nbFileRecords(0)
+{}
+
+PresetStore::~PresetStore()
+{}
+
+bool PresetStore::exists() const
+{
+    return QFileInfo(m_fileName).exists();
+}
+
+bool PresetStore::load(QList<Preset*>& presets, QList<Command*>& commands)
+{
+    m_ids.clear();
+    m_records.clear();
+    m_nextId = 1;
+    m_fileSize = 0;
+    m_nbFileRecords = 0;
+
+    QFile file(m_fileName);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("PresetStore::load: cannot open %s: %s", qPrintable(m_fileName), qPrintable(file.errorString()));
+        return false;
+    }
+
+    QByteArray content = file.readAll();
+    file.close();
+
+    if ((content.size() < m_fileHeaderSize)
+     || (memcmp(content.constData(), m_fileMagic, sizeof(m_fileMagic)) != 0)
+     || (qFromBigEndian<quint32>((const uchar*) content.constData() + sizeof(m_fileMagic)) != m_fileVersion))
+    {
+        qWarning("PresetStore::load: %s is not a presets file of version %u: moved to .invalid", qPrintable(m_fileName), m_fileVersion);
+        QFile::remove(m_fileName + ".invalid");
+        QFile::rename(m_fileName, m_fileName + ".invalid");
+        return false;
+    }
+
+    qint64 pos = m_fileHeaderSize;
+
+    while (pos + 4 <= content.size())
+    {
+        quint32 payloadSize = qFromBigEndian<quint32>((const uchar*) content.constData() + pos);
+
+        if (pos + 4 + (qint64) payloadSize + 2 > content.size()) {
+            break; // interrupted write
+        }
+
+        const char *payload = content.constData() + pos + 4;
+
+        if (qFromBigEndian<quint16>((const uchar*) payload + payloadSize) != qChecksum(payload, payloadSize)) {
+            break;
+        }
+
+        QByteArray payloadBytes = QByteArray::fromRawData(payload, payloadSize);
+        QDataStream stream(payloadBytes);
+        stream.setVersion(QDataStream::Qt_5_0);
+        quint8 type;
+        quint32 id;
+        StoredRecord record;
+        stream >> type >> id;
+        record.m_type = (RecordType) type;
+
+        if (record.m_type == RecordPreset) {
+            stream >> record.m_group >> record.m_description >> record.m_centerFrequency >> record.m_sourcePreset >> record.m_data;
+        } else if (record.m_type == RecordCommand) {
+            stream >> record.m_data;
+        }
+
+        if (stream.status() != QDataStream::Ok) {
+            break;
+        }
+
+        if (record.m_type == RecordRemoved) {
+            m_records.remove(id);
+        } else {
+            m_records[id] = record;
+        }
+
+        m_nextId = std::max(m_nextId, id + 1);
+        m_nbFileRecords++;
+        pos += 4 + payloadSize + 2;
+    }
+
+    m_fileSize = pos;
+
+    if (pos != content.size()) {
+        qWarning("PresetStore::load: %s: %lld bytes after the last valid record are ignored", qPrintable(m_fileName), content.size() - pos);
+    }
+
+    StoredRecords::iterator it = m_records.begin();
+
+    while (it != m_records.end())
+    {
+        if (it->m_type == RecordPreset)
+        {
+            Preset *preset = new Preset();
+            preset->setGroup(it->m_group);
+            preset->setDescription(it->m_description);
+            preset->setCenterFrequency(it->m_centerFrequency);
+            preset->setSourcePreset(it->m_sourcePreset);
+            preset->setDeferredData(it->m_data);
+            presets.append(preset);
+            m_ids.insert(preset, it.key());
+            ++it;
+        }
+        else
+        {
+            Command *command = new Command();
+            QByteArray data = qUncompress(it->m_data);
+
+            if (command->deserialize(data))
+            {
+                it->m_digest = digest(data);
+                commands.append(command);
+                m_ids.insert(command, it.key());
+                ++it;
+            }
+            else
+            {
+                delete command;
+                it = m_records.erase(it); // removed at next save
+            }
+        }
+    }
+
+    qDebug("PresetStore::load: %s: %d records, %d presets and commands",
+            qPrintable(m_fileName), m_nbFileRecords, m_records.size());
+    return true;
+}
+
+bool PresetStore::save(const QList<Preset*>& presets, const QList<Command*>& commands)
+{
+    QHash<const void*, quint32> ids;
+    QByteArray records;
+    int nbRecords = 0;
+
+    for (int i = 0; i < presets.size(); i++)
+    {
+        const Preset *preset = presets[i];
+        quint32 id = m_ids.value(preset, 0);
+
+        if ((id == 0) || ids.contains(preset)) {
+            id = m_nextId++;
+        }
+
+        ids.insert(preset, id);
+        StoredRecord& record = m_records[id];
+        bool changed = (record.m_type != RecordPreset)
+            || (record.m_group != preset->getGroup())
+            || (record.m_description != preset->getDescription())
+            || (record.m_centerFrequency != preset->getCenterFrequency())
+            || (record.m_sourcePreset != preset->isSourcePreset());
+
+        if (!preset->hasDeferredData() || record.m_data.isEmpty()) // else the stored data is still the preset data
+        {
+            QByteArray data = preset->serialize();
+            QByteArray dataDigest = digest(data);
+
+            if (record.m_data.isEmpty() || (dataDigest != getDigest(record)))
+            {
+                record.m_data = qCompress(data);
+                record.m_digest = dataDigest;
+                changed = true;
+            }
+        }
+
+        if (changed)
+        {
+            record.m_type = RecordPreset;
+            record.m_group = preset->getGroup();
+            record.m_description = preset->getDescription();
+            record.m_centerFrequency = preset->getCenterFrequency();
+            record.m_sourcePreset = preset->isSourcePreset();
+            records.append(encodeRecord(id, record));
+            nbRecords++;
+        }
+    }
+
+    for (int i = 0; i < commands.size(); i++)
+    {
+        const Command *command = commands[i];
+        quint32 id = m_ids.value(command, 0);
+
+        if ((id == 0) || ids.contains(command)) {
+            id = m_nextId++;
+        }
+
+        ids.insert(command, id);
+        StoredRecord& record = m_records[id];
+        QByteArray data = command->serialize();
+        QByteArray dataDigest = digest(data);
+
+        if ((record.m_type != RecordCommand) || record.m_data.isEmpty() || (dataDigest != getDigest(record)))
+        {
+            record = StoredRecord();
+            record.m_type = RecordCommand;
+            record.m_data = qCompress(data);
+            record.m_digest = dataDigest;
+            records.append(encodeRecord(id, record));
+            nbRecords++;
+        }
+    }
+
+    QSet<quint32> liveIds = QSet<quint32>::fromList(ids.values());
+    StoredRecords::iterator it = m_records.begin();
+
+    while (it != m_records.end())
+    {
+        if (liveIds.contains(it.key()))
+        {
+            ++it;
+        }
+        else
+        {
+            records.append(encodeRemoved(it.key()));
+            nbRecords++;
+            it = m_records.erase(it);
+        }
+    }
+
+    m_ids.swap(ids);
+
+    if (nbRecords == 0) {
+        return true;
+    }
+
+    if (!exists() || (m_nbFileRecords + nbRecords > 2*m_records.size() + 32)) {
+        return rewrite();
+    } else {
+        return append(records, nbRecords);
+    }
+}
+
+bool PresetStore::append(const QByteArray& records, int nbRecords)
+{
+    if (m_fileSize < m_fileHeaderSize) {
+        return rewrite();
+    }
+
+    QFile file(m_fileName);
+
+    if (!file.open(QIODevice::ReadWrite))
+    {
+        qWarning("PresetStore::append: cannot open %s: %s", qPrintable(m_fileName), qPrintable(file.errorString()));
+        return rewrite();
+    }
+
+    if (file.size() != m_fileSize) {
+        file.resize(m_fileSize); // drop what follows the last valid record
+    }
+
+    if (!file.seek(m_fileSize) || (file.write(records) != records.size()) || !file.flush())
+    {
+        qWarning("PresetStore::append: cannot write %s: %s", qPrintable(m_fileName), qPrintable(file.errorString()));
+        file.resize(m_fileSize);
+        return false;
+    }
+
+    m_fileSize += records.size();
+    m_nbFileRecords += nbRecords;
+    return true;
+}
+
+bool PresetStore::rewrite()
+{
+    QDir().mkpath(QFileInfo(m_fileName).absolutePath());
+    QSaveFile file(m_fileName);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qWarning("PresetStore::rewrite: cannot open %s: %s", qPrintable(m_fileName), qPrintable(file.errorString()));
+        return false;
+    }
+
+    QByteArray content = fileHeader();
+
+    for (StoredRecords::const_iterator it = m_records.begin(); it != m_records.end(); ++it) {
+        content.append(encodeRecord(it.key(), *it));
+    }
+
+    file.write(content);
+
+    if (!file.commit())
+    {
+        qWarning("PresetStore::rewrite: cannot write %s: %s", qPrintable(m_fileName), qPrintable(file.errorString()));
+        return false;
+    }
+
+    m_fileSize = content.size();
+    m_nbFileRecords = m_records.size();
+    return true;
+}
+
+QByteArray PresetStore::fileHeader()
+{
+    QByteArray header(m_fileMagic, sizeof(m_fileMagic));
+    uchar version[4];
+    qToBigEndian<quint32>(m_fileVersion, version);
+    header.append((const char*) version, 4);
+    return header;
+}
+
+QByteArray PresetStore::encodeRecord(quint32 id, const StoredRecord& record)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << (quint8) record.m_type << id;
+
+    if (record.m_type == RecordPreset) {
+        stream << record.m_group << record.m_description << record.m_centerFrequency << record.m_sourcePreset << record.m_data;
+    } else {
+        stream << record.m_data;
+    }
+
+    return frameRecord(payload);
+}
+
+QByteArray PresetStore::encodeRemoved(quint32 id)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_0);
+    stream << (quint8) RecordRemoved << id;
+    return frameRecord(payload);
+}
+
+/** payload size (32 bits), payload, CRC-16 of the payload. Big endian. */
+QByteArray PresetStore::frameRecord(const QByteArray& payload)
+{
+    QByteArray record(4 + payload.size() + 2, 0);
+    uchar *p = (uchar*) record.data();
+    qToBigEndian<quint32>(payload.size(), p);
+    memcpy(p + 4, payload.constData(), payload.size());
+    qToBigEndian<quint16>(qChecksum(payload.constData(), payload.size()), p + 4 + payload.size());
+    return record;
+}
+
+QByteArray PresetStore::digest(const QByteArray& data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Md5);
+}
+
+const QByteArray& PresetStore::getDigest(StoredRecord& record)
+{
+    if (record.m_digest.isEmpty() && !record.m_data.isEmpty()) {
+        record.m_digest = digest(qUncompress(record.m_data));
+    }
+
+    return record.m_digest;
+}
@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_SETTINGS_PRESETSTORE_H_
+#define SDRBASE_SETTINGS_PRESETSTORE_H_
+
+#include <QString>
+#include <QByteArray>
+#include <QList>
+#include <QHash>
+#include <QMap>
+
+#include "util/export.h"
+
+class Preset;
+class Command;
+
+/**
+ * Presets and commands file.
+ *
+ * The file is a log of records. Each record holds one preset or command, compressed serialized
+ * as in the settings, or the removal of one. The last record of an id wins.
+ * - Loading reads the file sequentially. Presets are created with their group, description,
+ *   frequency and direction only. The rest is deserialized on first use (Preset::setDeferredData).
+ * - Saving appends the records of what changed since the last load or save. A record cut by an
+ *   interrupted write fails its checksum and is dropped with anything after it.
+ * - When superseded records outnumber the live ones the file is rewritten through a temporary
+ *   file renamed in place of the old one.
+ */
+class SDRANGEL_API PresetStore
+{
+public:
+    PresetStore();
+    ~PresetStore();
+
+    void setFileName(const QString& fileName) { m_fileName = fileName; }
+    const QString& getFileName() const { return m_fileName; }
+    bool exists() const;
+
+    /** Appends the stored presets and commands to the lists. Returns false if the file cannot be read. */
+    bool load(QList<Preset*>& presets, QList<Command*>& commands);
+    /** Stores what changed. Presets and commands not in the lists are removed from the store. */
+    bool save(const QList<Preset*>& presets, const QList<Command*>& commands);
+
+private:
+    enum RecordType
+    {
+        RecordNone,
+        RecordPreset,
+        RecordCommand,
+        RecordRemoved
+    };
+
+    struct StoredRecord
+    {
+        RecordType m_type;
+        QString m_group;          //!< preset header
+        QString m_description;
+        quint64 m_centerFrequency;
+        bool m_sourcePreset;
+        QByteArray m_data;        //!< compressed serialized preset or command
+        QByteArray m_digest;      //!< of the uncompressed data, computed when first needed
+
+        StoredRecord() :
+            m_type(RecordNone),
+            m_centerFrequency(0),
+            m_sourcePreset(true)
+        {}
+    };
+
+    typedef QMap<quint32, StoredRecord> StoredRecords;
+
+    QString m_fileName;
+    QHash<const void*, quint32> m_ids; //!< id of the presets and commands in the store
+    StoredRecords m_records;           //!< last record of the live ids
+    quint32 m_nextId;
+    qint64 m_fileSize;                 //!< end of the last valid record
+    int m_nbFileRecords;               //!< including the superseded ones
+
+    static const char m_fileMagic[8];
+    static const quint32 m_fileVersion;
+    static const int m_fileHeaderSize;
+
+    bool append(const QByteArray& records, int nbRecords);
+    bool rewrite();
+    static QByteArray fileHeader();
+    static QByteArray encodeRecord(quint32 id, const StoredRecord& record);
+    static QByteArray encodeRemoved(quint32 id);
+    static QByteArray frameRecord(const QByteArray& payload);
+    static QByteArray digest(const QByteArray& data);
+    static const QByteArray& getDigest(StoredRecord& record);
+};
+
+#endif /* SDRBASE_SETTINGS_PRESETSTORE_H_ */
@@ -19,6 +19,7 @@
 #include <QMutex>
 #include "util/message.h"
 #include "util/messagequeue.h"
+#include "util/messagepool.h"
 
 const char* Message::m_identifier = 0;
 
@@ -45,3 +46,13 @@ bool Message::match(const Message* message)
 {
 	return message->matchIdentifier(m_identifier);
 }
+
+void* Message::operator new(std::size_t size)
+{
+	return MessagePool::allocate(size);
+}
+
+void Message::operator delete(void* ptr, std::size_t size)
+{
+	MessagePool::deallocate(ptr, size);
+}
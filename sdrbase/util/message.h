@@ -19,6 +19,7 @@
 #define INCLUDE_MESSAGE_H
 
 #include <stdlib.h>
+#include <cstddef>
 #include "util/export.h"
 
 class SDRANGEL_API Message {
@@ -29,6 +30,11 @@ public:
 	virtual const char* getIdentifier() const;
 	virtual bool matchIdentifier(const char* identifier) const;
 	static bool match(const Message* message);
+	static const char* getClassIdentifier() { return m_identifier; } //!< Unique per class: can be used as a type id
+
+	// messages are allocated and freed very often from different threads so they are recycled through the MessagePool
+	static void* operator new(std::size_t size);
+	static void operator delete(void* ptr, std::size_t size);
 
 	void* getDestination() const { return m_destination; }
 	void setDestination(void *destination) { m_destination = destination; }
@@ -44,6 +50,7 @@ protected:
 		const char* getIdentifier() const; \
 		bool matchIdentifier(const char* identifier) const; \
 		static bool match(const Message& message); \
+		static const char* getClassIdentifier(); \
 	protected: \
 		static const char* m_identifier; \
 	private:
@@ -54,6 +61,7 @@ protected:
 	bool Name::matchIdentifier(const char* identifier) const {\
 		return (m_identifier == identifier) ? true : BaseClass::matchIdentifier(identifier); \
 	} \
-	bool Name::match(const Message& message) { return message.matchIdentifier(m_identifier); }
+	bool Name::match(const Message& message) { return message.matchIdentifier(m_identifier); } \
+	const char* Name::getClassIdentifier() { return m_identifier; }
 
 #endif // INCLUDE_MESSAGE_H
@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MESSAGEDISPATCHER_H
+#define INCLUDE_MESSAGEDISPATCHER_H
+
+#include <QHash>
+#include "util/message.h"
+
+/**
+ * Table of message handlers of class T indexed by message class identifier. This replaces
+ * the chain of Msg::match() tests in a handleMessage() method by a single hash lookup on
+ * the identifier of the actual message class:
+ *
+ * bool MyObject::handleMessage(const Message& message)
+ * {
+ *     static const MessageDispatcher<MyObject> dispatcher = MessageDispatcher<MyObject>()
+ *         .add<MsgConfigureMyObject>(&MyObject::handleConfigure)
+ *         .add<DSPSignalNotification>(&MyObject::handleSignalNotification);
+ *
+ *     return dispatcher.dispatch(this, message);
+ * }
+ *
+ * Only the exact message class is matched. Messages deriving from a registered class are
+ * not dispatched to its handler contrary to Msg::match().
+ */
+template<class T>
+class MessageDispatcher
+{
+public:
+    typedef bool (T::*Handler)(const Message& message);
+
+    template<class M>
+    MessageDispatcher& add(Handler handler)
+    {
+        m_handlers.insert(M::getClassIdentifier(), handler);
+        return *this;
+    }
+
+    /** Returns false if there is no handler for this message or if the handler returned false */
+    bool dispatch(T *object, const Message& message) const
+    {
+        typename QHash<const char*, Handler>::const_iterator it = m_handlers.constFind(message.getIdentifier());
+
+        if (it == m_handlers.constEnd()) {
+            return false;
+        } else {
+            return (object->*(it.value()))(message);
+        }
+    }
+
+private:
+    QHash<const char*, Handler> m_handlers;
+};
+
+#endif // INCLUDE_MESSAGEDISPATCHER_H
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <new>
+#include "util/messagepool.h"
+
+MessagePool::SizeClass MessagePool::m_sizeClasses[MessagePool::m_nbSizeClasses];
+
+int MessagePool::getSizeClassIndex(std::size_t size)
+{
+    std::size_t blockSize = m_minBlockSize;
+
+    for (int i = 0; i < m_nbSizeClasses; i++, blockSize <<= 1)
+    {
+        if (size <= blockSize) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+void* MessagePool::allocate(std::size_t size)
+{
+    int index = getSizeClassIndex(size);
+
+    if (index < 0) {
+        return ::operator new(size);
+    }
+
+    SizeClass& sizeClass = m_sizeClasses[index];
+    FreeBlock *block;
+
+    {
+        SpinlockHolder holder(&sizeClass.m_lock);
+        block = sizeClass.m_head;
+
+        if (block)
+        {
+            sizeClass.m_head = block->m_next;
+            sizeClass.m_count--;
+        }
+    }
+
+    if (block) {
+        return block;
+    } else {
+        return ::operator new(m_minBlockSize << index);
+    }
+}
+
+void MessagePool::deallocate(void* ptr, std::size_t size)
+{
+    if (!ptr) {
+        return;
+    }
+
+    int index = getSizeClassIndex(size);
+
+    if (index < 0)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    SizeClass& sizeClass = m_sizeClasses[index];
+
+    {
+        SpinlockHolder holder(&sizeClass.m_lock);
+
+        if (sizeClass.m_count < m_maxFreeBlocks)
+        {
+            FreeBlock *block = static_cast<FreeBlock*>(ptr);
+            block->m_next = sizeClass.m_head;
+            sizeClass.m_head = block;
+            sizeClass.m_count++;
+            return;
+        }
+    }
+
+    ::operator delete(ptr);
+}
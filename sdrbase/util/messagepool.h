@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MESSAGEPOOL_H
+#define INCLUDE_MESSAGEPOOL_H
+
+#include <cstddef>
+#include "util/spinlock.h"
+#include "util/export.h"
+
+/**
+ * Recycles the memory blocks of messages and message queue nodes. Blocks are sorted
+ * in a few size classes each with a free list protected by a spinlock that is only
+ * held to link or unlink one block. Blocks larger than the largest class are allocated
+ * and freed directly. Each free list is capped so that a burst of messages does not
+ * keep memory forever.
+ */
+class SDRANGEL_API MessagePool
+{
+public:
+    static void* allocate(std::size_t size);
+    static void deallocate(void* ptr, std::size_t size);
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock *m_next;
+    };
+
+    struct SizeClass
+    {
+        Spinlock m_lock;
+        FreeBlock *m_head;
+        int m_count;
+    };
+
+    static const int m_nbSizeClasses = 4;       //!< 64, 128, 256 and 512 bytes
+    static const std::size_t m_minBlockSize = 64;
+    static const int m_maxFreeBlocks = 1024;    //!< per size class
+    static SizeClass m_sizeClasses[m_nbSizeClasses];
+
+    static int getSizeClassIndex(std::size_t size);
+};
+
+#endif // INCLUDE_MESSAGEPOOL_H
@@ -16,15 +16,26 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QDebug>
-#include <QMutexLocker>
 #include "util/messagequeue.h"
+#include "util/messagepool.h"
 #include "util/message.h"
 
+void* MessageQueue::Node::operator new(std::size_t size)
+{
+	return MessagePool::allocate(size);
+}
+
+void MessageQueue::Node::operator delete(void* ptr, std::size_t size)
+{
+	MessagePool::deallocate(ptr, size);
+}
+
 MessageQueue::MessageQueue(QObject* parent) :
 	QObject(parent),
-	m_lock(QMutex::Recursive),
-	m_queue()
+	m_size(0)
 {
+	m_tail = new Node(0); // stub
+	m_head.store(m_tail);
 }
 
 MessageQueue::~MessageQueue()
@@ -36,15 +47,18 @@ MessageQueue::~MessageQueue()
 		qDebug() << "MessageQueue::~MessageQueue: message: " << message->getIdentifier() << " was still in queue";
 		delete message;
 	}
+
+	delete m_tail;
 }
 
 void MessageQueue::push(Message* message, bool emitSignal)
 {
 	if (message)
 	{
-		m_lock.lock();
-		m_queue.append(message);
-		m_lock.unlock();
+		Node *node = new Node(message);
+		Node *prev = m_head.fetchAndStoreOrdered(node);
+		prev->m_next.storeRelease(node); // until this is done the consumer sees the queue as ending at prev
+		m_size.ref();
 	}
 
 	if (emitSignal)
@@ -55,27 +69,31 @@ void MessageQueue::push(Message* message, bool emitSignal)
 
 Message* MessageQueue::pop()
 {
-	QMutexLocker locker(&m_lock);
+	SpinlockHolder holder(&m_popLock);
+	Node *tail = m_tail;
+	Node *next = tail->m_next.loadAcquire();
 
-	if (m_queue.isEmpty())
+	if (next == 0)
 	{
 		return 0;
 	}
-	else
-	{
-		return m_queue.takeFirst();
-	}
+
+	Message *message = next->m_message;
+	next->m_message = 0; // next becomes the stub
+	m_tail = next;
+	m_size.deref();
+	delete tail;
+
+	return message;
 }
 
 int MessageQueue::size()
 {
-	QMutexLocker locker(&m_lock);
-
-	return m_queue.size();
+	int size = m_size.load(); // may be transiently negative if a pop overtakes the push count
+	return size < 0 ? 0 : size;
 }
 
 void MessageQueue::clear()
 {
-	QMutexLocker locker(&m_lock);
-	m_queue.clear();
+	while (pop() != 0) {}
 }
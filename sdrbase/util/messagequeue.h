@@ -18,13 +18,22 @@
 #ifndef INCLUDE_MESSAGEQUEUE_H
 #define INCLUDE_MESSAGEQUEUE_H
 
+#include <cstddef>
 #include <QObject>
-#include <QQueue>
-#include <QMutex>
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include "util/spinlock.h"
 #include "util/export.h"
 
 class Message;
 
+/**
+ * Multiple producers queue of messages. Pushing never locks: the message is linked at
+ * the head of a singly linked list with one atomic exchange (Vyukov's MPSC queue) so that
+ * a thread posting messages at high rate cannot stall the thread consuming them.
+ * Popping is serialized by a spinlock that is uncontended when the queue is consumed by
+ * one thread only which is the normal case.
+ */
 class SDRANGEL_API MessageQueue : public QObject {
 	Q_OBJECT
 
@@ -42,8 +51,20 @@ signals:
 	void messageEnqueued();
 
 private:
-	QMutex m_lock;
-	QQueue<Message*> m_queue;
+	struct Node
+	{
+		QAtomicPointer<Node> m_next;
+		Message *m_message;
+
+		Node(Message *message) : m_next(0), m_message(message) {}
+		static void* operator new(std::size_t size);
+		static void operator delete(void* ptr, std::size_t size);
+	};
+
+	QAtomicPointer<Node> m_head; //!< last pushed node (producers side)
+	Node *m_tail;                //!< node preceding the next one to pop (consumer side)
+	Spinlock m_popLock;
+	QAtomicInt m_size;
 };
 
 #endif // INCLUDE_MESSAGEQUEUE_H
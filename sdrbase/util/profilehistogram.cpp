@@ -0,0 +1,60 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "util/profilehistogram.h"
+
+void ProfileHistogram::reset()
+{
+    std::fill(m_buckets, m_buckets + m_nbBuckets, 0);
+    m_count = 0;
+    m_sum = 0;
+    m_max = 0;
+}
+
+void ProfileHistogram::merge(const ProfileHistogram& other)
+{
+    for (int i = 0; i < m_nbBuckets; i++) {
+        m_buckets[i] += other.m_buckets[i];
+    }
+
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_max = std::max(m_max, other.m_max);
+}
+
+quint64 ProfileHistogram::getPercentile(double percent) const
+{
+    if (m_count == 0) {
+        return 0;
+    }
+
+    quint64 rank = (quint64) ((percent / 100.0) * (m_count - 1)) + 1;
+    quint64 cumulated = 0;
+
+    for (int i = 0; i < m_nbBuckets; i++)
+    {
+        cumulated += m_buckets[i];
+
+        if (cumulated >= rank) {
+            return std::min(getBucketUpperBound(i), m_max); // the maximum is exact
+        }
+    }
+
+    return m_max;
+}
@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_PROFILEHISTOGRAM_H_
+#define SDRBASE_UTIL_PROFILEHISTOGRAM_H_
+
+#include <QtGlobal>
+
+#include "util/export.h"
+
+/**
+ * Histogram of durations in nanoseconds with power of two buckets: bucket n counts the
+ * durations below 2^(n+1) ns and not counted by bucket n-1. Adding a duration is a handful
+ * of instructions so that it can be done for every call in the DSP paths. It is not thread
+ * safe: the owner adds to a private histogram and merges it into the one it reports under
+ * its own lock.
+ */
+class SDRANGEL_API ProfileHistogram
+{
+public:
+    static const int m_nbBuckets = 36; //!< the last bucket counts everything above 34 s
+
+    ProfileHistogram() { reset(); }
+
+    void add(quint64 ns)
+    {
+        int bucket = ns < 2 ? 0 : 63 - __builtin_clzll(ns);
+
+        if (bucket >= m_nbBuckets) {
+            bucket = m_nbBuckets - 1;
+        }
+
+        m_buckets[bucket]++;
+        m_count++;
+        m_sum += ns;
+
+        if (ns > m_max) {
+            m_max = ns;
+        }
+    }
+
+    void reset();
+    void merge(const ProfileHistogram& other);
+
+    quint64 getCount() const { return m_count; }
+    quint64 getSum() const { return m_sum; }    //!< ns
+    quint64 getMax() const { return m_max; }    //!< ns
+    quint64 getBucketCount(int bucket) const { return m_buckets[bucket]; }
+    quint64 getPercentile(double percent) const; //!< upper bound of the bucket holding the percentile (ns) or 0 if empty
+
+    static quint64 getBucketUpperBound(int bucket) { return 2ULL << bucket; } //!< ns excluded
+
+private:
+    quint64 m_buckets[m_nbBuckets];
+    quint64 m_count;
+    quint64 m_sum;
+    quint64 m_max;
+};
+
+#endif /* SDRBASE_UTIL_PROFILEHISTOGRAM_H_ */
@@ -1,4 +1,5 @@
 #include <stdint.h>
+#include <algorithm>
 #include "util/simpleserializer.h"
 
 #if __WORDSIZE == 64
@@ -295,14 +296,25 @@ bool SimpleSerializer::writeTag(Type type, quint32 id, quint32 length)
 }
 
 SimpleDeserializer::SimpleDeserializer(const QByteArray& data) :
-	m_data(data)
+	m_data(data),
+	m_ptr((const uchar*) m_data.constData()),
+	m_size(m_data.size())
 {
+	init();
+}
+
+void SimpleDeserializer::init()
+{
+	m_elements = m_inlineElements;
+	m_nbElements = 0;
+	m_nextElement = 0;
+	m_version = 0;
 	m_valid = parseAll();
 
 	// read version information
 	uint readOfs;
-	Elements::const_iterator it = m_elements.constFind(0);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(0);
+	if(!it)
 		goto setInvalid;
 	if(it->type != TVersion)
 		goto setInvalid;
@@ -323,8 +335,8 @@ bool SimpleDeserializer::readS32(quint32 id, qint32* result, qint32 def) const
 {
 	uint readOfs;
 	qint32 tmp;
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TSigned32)
 		goto returnDefault;
@@ -351,8 +363,8 @@ bool SimpleDeserializer::readU32(quint32 id, quint32* result, quint32 def) const
 {
 	uint readOfs;
 	quint32 tmp;
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TUnsigned32)
 		goto returnDefault;
@@ -375,8 +387,8 @@ bool SimpleDeserializer::readS64(quint32 id, qint64* result, qint64 def) const
 {
 	uint readOfs;
 	qint64 tmp;
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TSigned64)
 		goto returnDefault;
@@ -403,8 +415,8 @@ bool SimpleDeserializer::readU64(quint32 id, quint64* result, quint64 def) const
 {
 	uint readOfs;
 	quint64 tmp;
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TUnsigned64)
 		goto returnDefault;
@@ -427,8 +439,8 @@ bool SimpleDeserializer::readFloat(quint32 id, float* result, float def) const
 {
 	uint readOfs;
 	union floatasint tmp;
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TFloat)
 		goto returnDefault;
@@ -451,8 +463,8 @@ bool SimpleDeserializer::readDouble(quint32 id, double* result, double def) cons
 {
 	uint readOfs;
 	union doubleasint tmp;
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TDouble)
 		goto returnDefault;
@@ -486,8 +498,8 @@ bool SimpleDeserializer::readReal(quint32 id, Real* result, Real def) const
 	if(sizeof(Real) == 4) {
 		uint readOfs;
 		union real4asint tmp;
-		Elements::const_iterator it = m_elements.constFind(id);
-		if(it == m_elements.constEnd())
+		const Element *it = findElement(id);
+		if(!it)
 			goto returnDefault32;
 		if(it->type != TFloat)
 			goto returnDefault32;
@@ -507,8 +519,8 @@ bool SimpleDeserializer::readReal(quint32 id, Real* result, Real def) const
 	} else {
 		uint readOfs;
 		union real8asint tmp;
-		Elements::const_iterator it = m_elements.constFind(id);
-		if(it == m_elements.constEnd())
+		const Element *it = findElement(id);
+		if(!it)
 			goto returnDefault64;
 		if(it->type != TDouble)
 			goto returnDefault64;
@@ -532,8 +544,8 @@ bool SimpleDeserializer::readBool(quint32 id, bool* result, bool def) const
 {
 	uint readOfs;
 	quint8 tmp;
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TBool)
 		goto returnDefault;
@@ -554,13 +566,13 @@ returnDefault:
 
 bool SimpleDeserializer::readString(quint32 id, QString* result, const QString& def) const
 {
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TString)
 		goto returnDefault;
 
-	*result = QString::fromUtf8(m_data.data() + it->ofs, it->length);
+	*result = QString::fromUtf8((const char*) m_ptr + it->ofs, it->length);
 	return true;
 
 returnDefault:
@@ -570,13 +582,13 @@ returnDefault:
 
 bool SimpleDeserializer::readBlob(quint32 id, QByteArray* result, const QByteArray& def) const
 {
-	Elements::const_iterator it = m_elements.constFind(id);
-	if(it == m_elements.constEnd())
+	const Element *it = findElement(id);
+	if(!it)
 		goto returnDefault;
 	if(it->type != TBlob)
 		goto returnDefault;
 
-	*result = QByteArray(m_data.data() + it->ofs, it->length);
+	*result = QByteArray((const char*) m_ptr + it->ofs, it->length);
 	return true;
 
 returnDefault:
@@ -593,68 +605,69 @@ void SimpleDeserializer::dump() const
 		qDebug("SimpleDeserializer dump: version %u", m_version);
 	}
 
-	for(Elements::const_iterator it = m_elements.constBegin(); it != m_elements.constEnd(); ++it) {
+	for(int i = 0; i < m_nbElements; i++) {
+		const Element *it = &m_elements[i];
 		switch(it->type) {
 			case TSigned32: {
 				qint32 tmp;
-				readS32(it.key(), &tmp);
-				qDebug("id %d, S32, len %d: " PRINTF_FORMAT_S32, it.key(), it->length, tmp);
+				readS32(it->id, &tmp);
+				qDebug("id %d, S32, len %d: " PRINTF_FORMAT_S32, it->id, it->length, tmp);
 				break;
 			}
 			case TUnsigned32: {
 				quint32 tmp;
-				readU32(it.key(), &tmp);
-				qDebug("id %d, U32, len %d: " PRINTF_FORMAT_U32, it.key(), it->length, tmp);
+				readU32(it->id, &tmp);
+				qDebug("id %d, U32, len %d: " PRINTF_FORMAT_U32, it->id, it->length, tmp);
 				break;
 			}
 			case TSigned64: {
 				qint64 tmp;
-				readS64(it.key(), &tmp);
-//				qDebug("id %d, S64, len %d: " PRINTF_FORMAT_S64, it.key(), it->length, (int)tmp);
+				readS64(it->id, &tmp);
+//				qDebug("id %d, S64, len %d: " PRINTF_FORMAT_S64, it->id, it->length, (int)tmp);
 				break;
 			}
 			case TUnsigned64: {
 				quint64 tmp;
-				readU64(it.key(), &tmp);
-//				qDebug("id %d, U64, len %d: " PRINTF_FORMAT_U64, it.key(), it->length, (uint)tmp);
+				readU64(it->id, &tmp);
+//				qDebug("id %d, U64, len %d: " PRINTF_FORMAT_U64, it->id, it->length, (uint)tmp);
 				break;
 			}
 			case TFloat: {
 				float tmp;
-				readFloat(it.key(), &tmp);
-				qDebug("id %d, FLOAT, len %d: %f", it.key(), it->length, tmp);
+				readFloat(it->id, &tmp);
+				qDebug("id %d, FLOAT, len %d: %f", it->id, it->length, tmp);
 				break;
 			}
 			case TDouble: {
 				double tmp;
-				readDouble(it.key(), &tmp);
-				qDebug("id %d, DOUBLE, len %d: %f", it.key(), it->length, tmp);
+				readDouble(it->id, &tmp);
+				qDebug("id %d, DOUBLE, len %d: %f", it->id, it->length, tmp);
 				break;
 			}
 			case TBool: {
 				bool tmp;
-				readBool(it.key(), &tmp);
-				qDebug("id %d, BOOL, len %d: %s", it.key(), it->length, tmp ? "true" : "false");
+				readBool(it->id, &tmp);
+				qDebug("id %d, BOOL, len %d: %s", it->id, it->length, tmp ? "true" : "false");
 				break;
 			}
 			case TString: {
 				QString tmp;
-				readString(it.key(), &tmp);
-				qDebug("id %d, STRING, len %d: \"%s\"", it.key(), it->length, qPrintable(tmp));
+				readString(it->id, &tmp);
+				qDebug("id %d, STRING, len %d: \"%s\"", it->id, it->length, qPrintable(tmp));
 				break;
 			}
 			case TBlob: {
 				QByteArray tmp;
-				readBlob(it.key(), &tmp);
-				qDebug("id %d, BLOB, len %d", it.key(), it->length);
+				readBlob(it->id, &tmp);
+				qDebug("id %d, BLOB, len %d", it->id, it->length);
 				break;
 			}
 			case TVersion: {
-				qDebug("id %d, VERSION, len %d", it.key(), it->length);
+				qDebug("id %d, VERSION, len %d", it->id, it->length);
 				break;
 			}
 			default: {
-				qDebug("id %d, UNKNOWN TYPE 0x%02x, len %d", it.key(), it->type, it->length);
+				qDebug("id %d, UNKNOWN TYPE 0x%02x, len %d", it->id, it->type, it->length);
 				break;
 			}
 		}
@@ -676,25 +689,79 @@ bool SimpleDeserializer::parseAll()
 	qDebug("==");
 	*/
 
-	while(readOfs < (uint)m_data.size()) {
-		if(!readTag(&readOfs, m_data.size(), &type, &id, &length))
+	bool sorted = true;
+
+	while(readOfs < m_size) {
+		if(!readTag(&readOfs, m_size, &type, &id, &length))
 			return false;
 
 		//qDebug("-- id %d, TYPE 0x%02x, len %d", id, type, length);
 
-		if(m_elements.contains(id)) {
-			qDebug("SimpleDeserializer: same ID found twice (id %u)", id);
-			return false;
-		}
+		if((m_nbElements > 0) && (id <= m_elements[m_nbElements - 1].id))
+			sorted = false;
 
-		m_elements.insert(id, Element(type, readOfs, length));
+		addElement(id, type, readOfs, length);
 
 		readOfs += length;
 
-		if(readOfs == (uint)m_data.size())
-			return true;
+		if(readOfs == m_size)
+			break;
 	}
-	return false;
+
+	if(readOfs != m_size)
+		return false;
+
+	if(!sorted) {
+		std::sort(m_elements, m_elements + m_nbElements);
+
+		for(int i = 1; i < m_nbElements; i++) {
+			if(m_elements[i].id == m_elements[i - 1].id) {
+				qDebug("SimpleDeserializer: same ID found twice (id %u)", m_elements[i].id);
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void SimpleDeserializer::addElement(quint32 id, Type type, quint32 ofs, quint32 length)
+{
+	Element element;
+	element.id = id;
+	element.type = type;
+	element.ofs = ofs;
+	element.length = length;
+
+	if(m_nbElements < m_nbInlineElements) {
+		m_inlineElements[m_nbElements] = element;
+	} else {
+		if(m_nbElements == m_nbInlineElements) {
+			m_moreElements.reserve(4 * m_nbInlineElements);
+			m_moreElements.assign(m_inlineElements, m_inlineElements + m_nbInlineElements);
+		}
+
+		m_moreElements.push_back(element);
+		m_elements = &m_moreElements[0];
+	}
+
+	m_nbElements++;
+}
+
+const SimpleDeserializer::Element *SimpleDeserializer::findElement(quint32 id) const
+{
+	if((m_nextElement < m_nbElements) && (m_elements[m_nextElement].id == id))
+		return &m_elements[m_nextElement++];
+
+	Element key;
+	key.id = id;
+	const Element *it = std::lower_bound(m_elements, m_elements + m_nbElements, key);
+
+	if((it == m_elements + m_nbElements) || (it->id != id))
+		return 0;
+
+	m_nextElement = (it - m_elements) + 1;
+	return it;
 }
 
 bool SimpleDeserializer::readTag(uint* readOfs, uint readEnd, Type* type, quint32* id, quint32* length) const
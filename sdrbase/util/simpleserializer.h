@@ -2,7 +2,8 @@
 #define INCLUDE_SIMPLESERIALIZER_H
 
 #include <QString>
-#include <QMap>
+#include <QByteArray>
+#include <vector>
 #include "dsp/dsptypes.h"
 #include "util/export.h"
 
@@ -48,6 +49,11 @@ protected:
 	bool writeTag(Type type, quint32 id, quint32 length);
 };
 
+/**
+ * Fields are indexed in a flat array sorted by id over the original data which is not copied.
+ * Reads in increasing id order, as deserialize() methods usually do, find their field at once.
+ * Up to m_nbInlineElements fields are indexed without any allocation.
+ */
 class SDRANGEL_API SimpleDeserializer {
 public:
 	SimpleDeserializer(const QByteArray& data);
@@ -82,28 +88,38 @@ private:
 	};
 
 	struct Element {
+		quint32 id;
 		Type type;
 		quint32 ofs;
 		quint32 length;
 
-		Element(Type _type, quint32 _ofs, quint32 _length) :
-			type(_type),
-			ofs(_ofs),
-			length(_length)
-		{ }
+		bool operator<(const Element& other) const { return id < other.id; }
 	};
-	typedef QMap<quint32, Element> Elements;
 
-	QByteArray m_data;
+	static const int m_nbInlineElements = 64;
+
+	QByteArray m_data;     //!< shares the data given as a QByteArray
+	const uchar *m_ptr;
+	uint m_size;
 	bool m_valid;
-	Elements m_elements;
+	Element m_inlineElements[m_nbInlineElements];
+	std::vector<Element> m_moreElements; //!< used instead of the inline elements when there are more fields
+	Element *m_elements;
+	int m_nbElements;
+	mutable int m_nextElement; //!< following the last element found
 	quint32 m_version;
 
+	SimpleDeserializer(const SimpleDeserializer&);
+	SimpleDeserializer& operator=(const SimpleDeserializer&);
+
+	void init();
 	bool parseAll();
+	void addElement(quint32 id, Type type, quint32 ofs, quint32 length);
+	const Element *findElement(quint32 id) const;
 	bool readTag(uint* readOfs, uint readEnd, Type* type, quint32* id, quint32* length) const;
 	quint8 readByte(uint* readOfs) const
 	{
-		quint8 res = m_data[*readOfs];
+		quint8 res = m_ptr[*readOfs];
 		(*readOfs)++;
 		return res;
 	}
@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Sends the binary spectrum frames of a SpectrumStreamSink to TCP clients or    //
+// to an UDP destination                                                         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QUdpSocket>
+#include <QDebug>
+
+#include "spectrumstreamserver.h"
+
+SpectrumStreamServer::SpectrumStreamServer(const QString& address, quint16 port, Protocol protocol, QObject *parent) :
+    QObject(parent),
+    m_address(address),
+    m_port(port),
+    m_protocol(protocol),
+    m_tcpServer(0),
+    m_udpSocket(0)
+{
+}
+
+SpectrumStreamServer::~SpectrumStreamServer()
+{
+    stop();
+}
+
+bool SpectrumStreamServer::start()
+{
+    if (m_protocol == ProtocolTCP)
+    {
+        m_tcpServer = new QTcpServer(this);
+        connect(m_tcpServer, SIGNAL(newConnection()), this, SLOT(handleNewConnection()));
+
+        if (!m_tcpServer->listen(m_address, m_port))
+        {
+            qWarning("SpectrumStreamServer::start: cannot listen on %s:%d: %s",
+                    qPrintable(m_address.toString()), m_port, qPrintable(m_tcpServer->errorString()));
+            delete m_tcpServer;
+            m_tcpServer = 0;
+            return false;
+        }
+
+        qDebug("SpectrumStreamServer::start: listening on TCP %s:%d", qPrintable(m_address.toString()), m_port);
+    }
+    else
+    {
+        m_udpSocket = new QUdpSocket(this);
+        qDebug("SpectrumStreamServer::start: sending UDP to %s:%d", qPrintable(m_address.toString()), m_port);
+    }
+
+    return true;
+}
+
+void SpectrumStreamServer::stop()
+{
+    for (QList<QTcpSocket*>::iterator it = m_clients.begin(); it != m_clients.end(); ++it)
+    {
+        disconnect(*it, SIGNAL(disconnected()), this, SLOT(handleClientDisconnected()));
+        (*it)->abort();
+    }
+
+    m_clients.clear(); // client sockets are children of the TCP server
+
+    if (m_tcpServer)
+    {
+        m_tcpServer->close();
+        delete m_tcpServer;
+        m_tcpServer = 0;
+    }
+
+    if (m_udpSocket)
+    {
+        delete m_udpSocket;
+        m_udpSocket = 0;
+    }
+}
+
+void SpectrumStreamServer::sendFrame(QByteArray frame)
+{
+    if (m_udpSocket)
+    {
+        m_udpSocket->writeDatagram(frame, m_address, m_port);
+        return;
+    }
+
+    for (QList<QTcpSocket*>::iterator it = m_clients.begin(); it != m_clients.end(); ++it)
+    {
+        if ((*it)->bytesToWrite() < m_maxPendingBytes) {
+            (*it)->write(frame);
+        }
+    }
+}
+
+void SpectrumStreamServer::handleNewConnection()
+{
+    while (m_tcpServer->hasPendingConnections())
+    {
+        QTcpSocket *client = m_tcpServer->nextPendingConnection();
+        client->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+        connect(client, SIGNAL(disconnected()), this, SLOT(handleClientDisconnected()));
+        m_clients.append(client);
+        qDebug("SpectrumStreamServer::handleNewConnection: client %s:%d connected",
+                qPrintable(client->peerAddress().toString()), client->peerPort());
+    }
+}
+
+void SpectrumStreamServer::handleClientDisconnected()
+{
+    QTcpSocket *client = qobject_cast<QTcpSocket*>(sender());
+
+    if (client)
+    {
+        qDebug("SpectrumStreamServer::handleClientDisconnected: client %s:%d disconnected",
+                qPrintable(client->peerAddress().toString()), client->peerPort());
+        m_clients.removeAll(client);
+        client->deleteLater();
+    }
+}
@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// Sends the binary spectrum frames of a SpectrumStreamSink to TCP clients or    //
+// to an UDP destination                                                         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_SPECTRUMSTREAMSERVER_H_
+#define SDRBASE_UTIL_SPECTRUMSTREAMSERVER_H_
+
+#include <QObject>
+#include <QList>
+#include <QByteArray>
+#include <QHostAddress>
+
+#include "util/export.h"
+
+class QTcpServer;
+class QTcpSocket;
+class QUdpSocket;
+
+/**
+ * Lives in the main thread. With TCP any number of clients can connect to the listening
+ * port and each receives the frames back to back (frames are self delimited by their
+ * size field). Frames are dropped for a client that does not read fast enough so that
+ * a slow client never stalls the others. With UDP each frame is one datagram sent to
+ * the given address and port.
+ */
+class SDRANGEL_API SpectrumStreamServer : public QObject {
+    Q_OBJECT
+
+public:
+    enum Protocol
+    {
+        ProtocolTCP,
+        ProtocolUDP
+    };
+
+    SpectrumStreamServer(const QString& address, quint16 port, Protocol protocol, QObject *parent = 0);
+    ~SpectrumStreamServer();
+
+    bool start();
+    void stop();
+
+public slots:
+    void sendFrame(QByteArray frame);
+
+private slots:
+    void handleNewConnection();
+    void handleClientDisconnected();
+
+private:
+    static const qint64 m_maxPendingBytes = 1<<20; //!< pending output above which frames are dropped for a TCP client
+
+    QHostAddress m_address;
+    quint16 m_port;
+    Protocol m_protocol;
+    QTcpServer *m_tcpServer;
+    QList<QTcpSocket*> m_clients;
+    QUdpSocket *m_udpSocket;
+};
+
+#endif /* SDRBASE_UTIL_SPECTRUMSTREAMSERVER_H_ */
@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+
+#include <QThread>
+#include <QStringList>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
+#include "util/simpleserializer.h"
+#include "util/threadscheduling.h"
+
+ThreadSchedulingSettings::ThreadSchedulingSettings()
+{
+    resetToDefaults();
+}
+
+void ThreadSchedulingSettings::resetToDefaults()
+{
+    m_policy = PolicyDefault;
+    m_rtPriority = 50;
+    m_nice = -10;
+    m_cpuMask = 0;
+}
+
+QByteArray ThreadSchedulingSettings::serialize() const
+{
+    SimpleSerializer s(1);
+    s.writeS32(1, (int) m_policy);
+    s.writeS32(2, m_rtPriority);
+    s.writeS32(3, m_nice);
+    s.writeU64(4, m_cpuMask);
+    return s.final();
+}
+
+bool ThreadSchedulingSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid() || (d.getVersion() != 1))
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    int tmp;
+    d.readS32(1, &tmp, (int) PolicyDefault);
+    m_policy = (tmp >= (int) PolicyDefault) && (tmp <= (int) PolicyRR) ? (Policy) tmp : PolicyDefault;
+    d.readS32(2, &tmp, 50);
+    m_rtPriority = tmp < 1 ? 1 : tmp > 99 ? 99 : tmp;
+    d.readS32(3, &tmp, -10);
+    m_nice = tmp < -20 ? -20 : tmp > 19 ? 19 : tmp;
+    d.readU64(4, &m_cpuMask, 0);
+
+    return true;
+}
+
+QString ThreadSchedulingSettings::policyToString(Policy policy)
+{
+    switch (policy)
+    {
+    case PolicyNice:
+        return "nice";
+    case PolicyFIFO:
+        return "fifo";
+    case PolicyRR:
+        return "rr";
+    default:
+        return "default";
+    }
+}
+
+bool ThreadSchedulingSettings::policyFromString(const QString& str, Policy& policy)
+{
+    if (str == "default") {
+        policy = PolicyDefault;
+    } else if (str == "nice") {
+        policy = PolicyNice;
+    } else if (str == "fifo") {
+        policy = PolicyFIFO;
+    } else if (str == "rr") {
+        policy = PolicyRR;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+QString ThreadSchedulingSettings::cpuMaskToString(quint64 cpuMask)
+{
+    QStringList ranges;
+    int cpu = 0;
+
+    while (cpu < 64)
+    {
+        if ((cpuMask & (1ULL << cpu)) == 0)
+        {
+            cpu++;
+            continue;
+        }
+
+        int last = cpu;
+
+        while ((last + 1 < 64) && (cpuMask & (1ULL << (last + 1)))) {
+            last++;
+        }
+
+        ranges.append(last == cpu ? QString::number(cpu) : QString("%1-%2").arg(cpu).arg(last));
+        cpu = last + 1;
+    }
+
+    return ranges.join(",");
+}
+
+bool ThreadSchedulingSettings::cpuMaskFromString(const QString& str, quint64& cpuMask)
+{
+    quint64 mask = 0;
+    QStringList ranges = str.split(',', QString::SkipEmptyParts);
+
+    for (int i = 0; i < ranges.size(); i++)
+    {
+        QStringList bounds = ranges[i].trimmed().split('-');
+        bool ok1, ok2 = true;
+        int first = bounds[0].toInt(&ok1);
+        int last = bounds.size() > 1 ? bounds[1].toInt(&ok2) : first;
+
+        if (!ok1 || !ok2 || (bounds.size() > 2) || (first < 0) || (last > 63) || (first > last)) {
+            return false;
+        }
+
+        for (int cpu = first; cpu <= last; cpu++) {
+            mask |= 1ULL << cpu;
+        }
+    }
+
+    cpuMask = mask;
+    return true;
+}
+
+ThreadSchedulingSettings::Policy ThreadScheduling::applyToCurrentThread(const ThreadSchedulingSettings& settings, QString& errorMessage)
+{
+    ThreadSchedulingSettings::Policy applied = settings.m_policy;
+    errorMessage.clear();
+
+#if defined(__linux__)
+    pthread_t thread = pthread_self();
+    pid_t tid = (pid_t) syscall(SYS_gettid);
+    bool realTime = (settings.m_policy == ThreadSchedulingSettings::PolicyFIFO) || (settings.m_policy == ThreadSchedulingSettings::PolicyRR);
+    struct sched_param param;
+    int ret;
+
+    if (realTime)
+    {
+        int policy = settings.m_policy == ThreadSchedulingSettings::PolicyFIFO ? SCHED_FIFO : SCHED_RR;
+        param.sched_priority = std::min(std::max(settings.m_rtPriority, sched_get_priority_min(policy)), sched_get_priority_max(policy));
+
+        if ((ret = pthread_setschedparam(thread, policy, &param)) != 0)
+        {
+            errorMessage = QString("real time scheduling not permitted (%1): using nice %2").arg(strerror(ret)).arg(settings.m_nice);
+            applied = ThreadSchedulingSettings::PolicyNice;
+        }
+    }
+
+    if (!realTime || (applied == ThreadSchedulingSettings::PolicyNice))
+    {
+        param.sched_priority = 0;
+        pthread_setschedparam(thread, SCHED_OTHER, &param); // back from a real time policy if any
+
+        // the nice value of a Linux thread is set through its thread id
+        int nice = settings.m_policy == ThreadSchedulingSettings::PolicyDefault ? 0 : settings.m_nice;
+
+        if (setpriority(PRIO_PROCESS, tid, nice) != 0)
+        {
+            errorMessage += QString(errorMessage.isEmpty() ? "" : ", ") + QString("cannot set nice %1 (%2)").arg(nice).arg(strerror(errno));
+            applied = ThreadSchedulingSettings::PolicyDefault;
+        }
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    int nbCPUs = std::min((int) sysconf(_SC_NPROCESSORS_CONF), std::min(64, (int) CPU_SETSIZE));
+
+    for (int cpu = 0; cpu < nbCPUs; cpu++)
+    {
+        if ((settings.m_cpuMask == 0) || (settings.m_cpuMask & (1ULL << cpu))) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+
+    if (CPU_COUNT(&cpuSet) == 0) {
+        errorMessage += QString(errorMessage.isEmpty() ? "" : ", ") + QString("no CPU of the affinity mask is present");
+    } else if ((ret = pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuSet)) != 0) {
+        errorMessage += QString(errorMessage.isEmpty() ? "" : ", ") + QString("cannot set CPU affinity (%1)").arg(strerror(ret));
+    }
+#else
+    QThread::Priority priority;
+
+    switch (settings.m_policy)
+    {
+    case ThreadSchedulingSettings::PolicyFIFO:
+    case ThreadSchedulingSettings::PolicyRR:
+        priority = QThread::TimeCriticalPriority;
+        break;
+    case ThreadSchedulingSettings::PolicyNice:
+        priority = settings.m_nice < 0 ? QThread::HighestPriority : settings.m_nice > 0 ? QThread::LowPriority : QThread::NormalPriority;
+        break;
+    default:
+        priority = QThread::NormalPriority;
+        break;
+    }
+
+    QThread::currentThread()->setPriority(priority);
+
+    if (settings.m_cpuMask != 0) {
+        errorMessage = "CPU affinity is not supported on this system";
+    }
+#endif
+
+    return applied;
+}
+
+namespace {
+
+QAtomicInt lastGeneration(0);                 //!< generations are unique across the hooks
+thread_local int currentThreadGeneration = 0; //!< generation last applied by the calling thread
+
+}
+
+ThreadSchedulingHook::ThreadSchedulingHook() :
+    m_generation(0),
+    m_nextThreadEntry(0),
+    m_hasResult(false),
+    m_applied(ThreadSchedulingSettings::PolicyDefault)
+{
+    for (int i = 0; i < m_nbThreadEntries; i++)
+    {
+        m_threads[i].m_threadId = 0;
+        m_threads[i].m_generation = 0;
+    }
+}
+
+void ThreadSchedulingHook::setSettings(const ThreadSchedulingSettings& settings)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_settings = settings;
+    m_hasResult = false;
+    m_generation.storeRelease(lastGeneration.fetchAndAddOrdered(1) + 1);
+}
+
+bool ThreadSchedulingHook::getResult(ThreadSchedulingSettings::Policy& applied, QString& errorMessage)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    applied = m_applied;
+    errorMessage = m_errorMessage;
+    return m_hasResult;
+}
+
+void ThreadSchedulingHook::checkCurrentThread()
+{
+    // Fast path without locking: the settings were applied by this thread already
+    if (currentThreadGeneration == m_generation.loadAcquire()) {
+        return;
+    }
+
+    Qt::HANDLE threadId = QThread::currentThreadId();
+    ThreadSchedulingSettings settings;
+    int generation;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        generation = m_generation.load();
+        int i = 0;
+
+        while ((i < m_nbThreadEntries) && (m_threads[i].m_threadId != threadId)) {
+            i++;
+        }
+
+        if (i == m_nbThreadEntries) // new thread: replace the oldest entry
+        {
+            i = m_nextThreadEntry;
+            m_nextThreadEntry = (m_nextThreadEntry + 1) % m_nbThreadEntries;
+            m_threads[i].m_threadId = threadId;
+        }
+        else if (m_threads[i].m_generation == generation)
+        {
+            currentThreadGeneration = generation; // this thread alternates between hooks
+            return;
+        }
+
+        m_threads[i].m_generation = generation;
+        currentThreadGeneration = generation;
+        settings = m_settings;
+    }
+
+    // system calls are made without holding the lock
+    QString errorMessage;
+    ThreadSchedulingSettings::Policy applied = ThreadScheduling::applyToCurrentThread(settings, errorMessage);
+
+    if (errorMessage.isEmpty()) {
+        qDebug("ThreadSchedulingHook::checkCurrentThread: %s applied to thread %p",
+                qPrintable(ThreadSchedulingSettings::policyToString(applied)), threadId);
+    } else {
+        qWarning("ThreadSchedulingHook::checkCurrentThread: thread %p: %s", threadId, qPrintable(errorMessage));
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_generation.load() != generation) { // settings changed meanwhile: this result is stale
+        return;
+    }
+
+    m_hasResult = true;
+    m_applied = applied;
+    m_errorMessage = errorMessage;
+}
@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRBASE_UTIL_THREADSCHEDULING_H_
+#define SDRBASE_UTIL_THREADSCHEDULING_H_
+
+#include <QString>
+#include <QByteArray>
+#include <QMutex>
+#include <QAtomicInt>
+
+#include "util/export.h"
+
+/**
+ * Scheduling of the threads of a device set: the DSP engine thread and the device threads
+ * that write to (Rx) or read from (Tx) the device FIFO.
+ *
+ * Real time policies (SCHED_FIFO, SCHED_RR) need the CAP_SYS_NICE capability or an rtprio
+ * limit on Linux. When they are not permitted the nice value is applied instead and the
+ * thread runs with the normal policy. CPU affinity is supported on Linux only. On other
+ * systems the policy is approximated with the Qt thread priority.
+ */
+struct SDRANGEL_API ThreadSchedulingSettings
+{
+    enum Policy
+    {
+        PolicyDefault, //!< normal policy, nice 0, all CPUs: undoes what was applied before
+        PolicyNice,    //!< normal policy with m_nice
+        PolicyFIFO,    //!< SCHED_FIFO with m_rtPriority, m_nice otherwise
+        PolicyRR       //!< SCHED_RR with m_rtPriority, m_nice otherwise
+    };
+
+    Policy m_policy;
+    int m_rtPriority;   //!< 1 (lowest) to 99
+    int m_nice;         //!< -20 (highest priority) to 19
+    quint64 m_cpuMask;  //!< bit n set to run on CPU n, 0 for all CPUs
+
+    ThreadSchedulingSettings();
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+    bool isDefault() const { return (m_policy == PolicyDefault) && (m_cpuMask == 0); }
+
+    static QString policyToString(Policy policy);
+    static bool policyFromString(const QString& str, Policy& policy);
+    static QString cpuMaskToString(quint64 cpuMask);          //!< e.g. "0,2-3", empty for all CPUs
+    static bool cpuMaskFromString(const QString& str, quint64& cpuMask);
+};
+
+class SDRANGEL_API ThreadScheduling
+{
+public:
+    /**
+     * Apply the settings to the calling thread. Returns the policy actually in effect
+     * (PolicyNice or PolicyDefault when real time is not permitted) and a description
+     * of what failed in errorMessage (empty if all went well).
+     */
+    static ThreadSchedulingSettings::Policy applyToCurrentThread(const ThreadSchedulingSettings& settings, QString& errorMessage);
+};
+
+/**
+ * Applies scheduling settings lazily to the threads that call check(). Device threads are
+ * created by the plugins so they cannot be set up from outside: the FIFOs they write to or
+ * read from call check() and the settings are applied the first time a thread comes by
+ * after they were changed. Nothing is applied as long as setSettings() was never called.
+ * A thread that already applied the current settings returns without locking: it keeps the
+ * last generation it applied and generations are unique across all the hooks.
+ */
+class SDRANGEL_API ThreadSchedulingHook
+{
+public:
+    ThreadSchedulingHook();
+
+    void setSettings(const ThreadSchedulingSettings& settings); //!< may be called from any thread
+    inline void check()
+    {
+        if (m_generation.load() != 0) {
+            checkCurrentThread();
+        }
+    }
+    bool getResult(ThreadSchedulingSettings::Policy& applied, QString& errorMessage); //!< false if not applied since the last setSettings()
+
+private:
+    struct ThreadEntry
+    {
+        Qt::HANDLE m_threadId;
+        int m_generation;
+    };
+
+    static const int m_nbThreadEntries = 4; //!< threads tracked: a device may use more than one thread over time
+
+    QMutex m_mutex;
+    QAtomicInt m_generation; //!< new value at each setSettings(), 0 before
+    ThreadSchedulingSettings m_settings;
+    ThreadEntry m_threads[m_nbThreadEntries];
+    int m_nextThreadEntry;
+    bool m_hasResult;
+    ThreadSchedulingSettings::Policy m_applied;
+    QString m_errorMessage;
+
+    void checkCurrentThread();
+};
+
+/**
+ * Scheduling counters of a device set. Latency is the time between the device thread
+ * making samples available (Rx) or requesting samples (Tx) and the DSP engine thread
+ * picking up the request.
+ */
+struct SDRANGEL_API ThreadSchedulingCounters
+{
+    quint64 m_latencySum;     //!< ns
+    quint64 m_latencyCount;
+    quint64 m_latencyMax;     //!< ns
+    quint64 m_overflowCount;  //!< device FIFO overflows (Rx) or underruns (Tx)
+    quint64 m_droppedSamples; //!< samples dropped (Rx) or sent again (Tx)
+    quint64 m_runningTime;    //!< ns during which the counters were accumulated
+
+    ThreadSchedulingCounters() { reset(); }
+
+    void reset()
+    {
+        m_latencySum = 0;
+        m_latencyCount = 0;
+        m_latencyMax = 0;
+        m_overflowCount = 0;
+        m_droppedSamples = 0;
+        m_runningTime = 0;
+    }
+
+    void addLatency(qint64 latency)
+    {
+        if (latency >= 0)
+        {
+            m_latencySum += latency;
+            m_latencyCount++;
+            m_latencyMax = (quint64) latency > m_latencyMax ? latency : m_latencyMax;
+        }
+    }
+
+    quint64 getLatencyAvg() const { return m_latencyCount == 0 ? 0 : m_latencySum / m_latencyCount; }
+};
+
+/**
+ * What a DSP engine reports: the settings, their result in the engine and device threads
+ * and the counters since they were applied (current) and before (previous) for comparison.
+ */
+struct SDRANGEL_API ThreadSchedulingReport
+{
+    ThreadSchedulingSettings m_settings;
+    bool m_engineApplied;                            //!< false until the engine thread has run with the settings
+    ThreadSchedulingSettings::Policy m_enginePolicy;
+    bool m_deviceApplied;                            //!< false until a device thread has run with the settings
+    ThreadSchedulingSettings::Policy m_devicePolicy;
+    QString m_errorMessage;
+    ThreadSchedulingCounters m_counters;
+    ThreadSchedulingCounters m_previousCounters;
+};
+
+#endif /* SDRBASE_UTIL_THREADSCHEDULING_H_ */
@@ -19,11 +19,13 @@
 #include "webapiadapterinterface.h"
 
 QString WebAPIAdapterInterface::instanceSummaryURL = "/sdrangel";
+QString WebAPIAdapterInterface::instanceMetricsURL = "/sdrangel/metrics";
 QString WebAPIAdapterInterface::instanceDevicesURL = "/sdrangel/devices";
 QString WebAPIAdapterInterface::instanceChannelsURL = "/sdrangel/channels";
 QString WebAPIAdapterInterface::instanceLoggingURL = "/sdrangel/logging";
 QString WebAPIAdapterInterface::instanceAudioURL = "/sdrangel/audio";
 QString WebAPIAdapterInterface::instanceLocationURL = "/sdrangel/location";
+QString WebAPIAdapterInterface::instanceDSPThreadsURL = "/sdrangel/dspthreads";
 QString WebAPIAdapterInterface::instanceDVSerialURL = "/sdrangel/dvserial";
 QString WebAPIAdapterInterface::instancePresetsURL = "/sdrangel/presets";
 QString WebAPIAdapterInterface::instancePresetURL = "/sdrangel/preset";
@@ -36,6 +38,13 @@ std::regex WebAPIAdapterInterface::devicesetFocusURLRe("^/sdrangel/deviceset/([0
 std::regex WebAPIAdapterInterface::devicesetDeviceURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device$");
 std::regex WebAPIAdapterInterface::devicesetDeviceSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/settings$");
 std::regex WebAPIAdapterInterface::devicesetDeviceRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/run");
+std::regex WebAPIAdapterInterface::devicesetDeviceReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/report$");
+std::regex WebAPIAdapterInterface::devicesetDeviceSchedulingURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/scheduling$");
+std::regex WebAPIAdapterInterface::devicesetDevicePreTriggerURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/pretrigger$");
+std::regex WebAPIAdapterInterface::devicesetDeviceSpectrumArchiveURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/spectrumarchive$");
+std::regex WebAPIAdapterInterface::devicesetDeviceSpectrumArchiveQueryURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/spectrumarchive/query$");
 std::regex WebAPIAdapterInterface::devicesetChannelURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel$");
 std::regex WebAPIAdapterInterface::devicesetChannelIndexURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})$");
 std::regex WebAPIAdapterInterface::devicesetChannelSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/settings$");
+std::regex WebAPIAdapterInterface::devicesetChannelReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/report$");
+std::regex WebAPIAdapterInterface::devicesetChannelRecordURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/record$");
@@ -33,6 +33,7 @@ namespace SWGSDRangel
     class SWGAudioDevices;
     class SWGAudioDevicesSelect;
     class SWGLocationInformation;
+    class SWGDSPThreadsInfo;
     class SWGDVSeralDevices;
     class SWGPresets;
     class SWGPresetTransfer;
@@ -45,6 +46,13 @@ namespace SWGSDRangel
     class SWGDeviceSettings;
     class SWGDeviceState;
     class SWGChannelSettings;
+    class SWGChannelReport;
+    class SWGDeviceReport;
+    class SWGDeviceScheduling;
+    class SWGPreTriggerRecord;
+    class SWGSpectrumArchive;
+    class SWGSpectrumArchiveQuery;
+    class SWGChannelRecord;
     class SWGSuccessResponse;
 }
 
@@ -79,6 +87,20 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/metrics (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceMetrics
+     * response is the metrics of all device sets and channels in Prometheus text exposition format
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetrics(
+            QString& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
     /**
      * Handler of /sdrangel/devices (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceDevices
      * returns the Http status code (default 501: not implemented)
@@ -186,6 +208,33 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/dspthreads (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceDSPThreadsGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceDSPThreadsGet(
+            SWGSDRangel::SWGDSPThreadsInfo& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/dspthreads (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceDSPThreadsPut
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceDSPThreadsPut(
+            SWGSDRangel::SWGDSPThreadsInfo& query __attribute__((unused)),
+            SWGSDRangel::SWGDSPThreadsInfo& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
     /**
      * Handler of /sdrangel/location (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -451,6 +500,156 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/report (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDeviceReportGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceReportGet(
+            int deviceSetIndex __attribute__((unused)),
+            SWGSDRangel::SWGDeviceReport& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/scheduling (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDeviceSchedulingGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceSchedulingGet(
+            int deviceSetIndex __attribute__((unused)),
+            SWGSDRangel::SWGDeviceScheduling& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/scheduling (PUT, PATCH) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDeviceSchedulingPut
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceSchedulingPutPatch(
+            int deviceSetIndex __attribute__((unused)),
+            bool force __attribute__((unused)),
+            const QStringList& schedulingKeys __attribute__((unused)),
+            SWGSDRangel::SWGDeviceScheduling& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/pretrigger (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDevicePreTriggerGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDevicePreTriggerGet(
+            int deviceSetIndex __attribute__((unused)),
+            SWGSDRangel::SWGPreTriggerRecord& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/pretrigger (PUT, PATCH) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDevicePreTriggerPut
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDevicePreTriggerPutPatch(
+            int deviceSetIndex __attribute__((unused)),
+            bool force __attribute__((unused)),
+            const QStringList& preTriggerKeys __attribute__((unused)),
+            SWGSDRangel::SWGPreTriggerRecord& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/pretrigger (POST) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDevicePreTriggerPost
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDevicePreTriggerPost(
+            int deviceSetIndex __attribute__((unused)),
+            SWGSDRangel::SWGPreTriggerRecord& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/pretrigger (DELETE) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDevicePreTriggerDelete
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDevicePreTriggerDelete(
+            int deviceSetIndex __attribute__((unused)),
+            SWGSDRangel::SWGPreTriggerRecord& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/spectrumarchive (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDeviceSpectrumArchiveGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceSpectrumArchiveGet(
+            int deviceSetIndex __attribute__((unused)),
+            SWGSDRangel::SWGSpectrumArchive& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/spectrumarchive (PUT, PATCH) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDeviceSpectrumArchivePut
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceSpectrumArchivePutPatch(
+            int deviceSetIndex __attribute__((unused)),
+            bool force __attribute__((unused)),
+            const QStringList& archiveKeys __attribute__((unused)),
+            SWGSDRangel::SWGSpectrumArchive& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/spectrumarchive/query (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetDeviceSpectrumArchiveQueryGet
+     * Only the archive of the device set settings can be read
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceSpectrumArchiveQueryGet(
+            int deviceSetIndex __attribute__((unused)),
+            qint64 fromMs __attribute__((unused)),
+            qint64 toMs __attribute__((unused)),
+            int maxSpectra __attribute__((unused)),
+            SWGSDRangel::SWGSpectrumArchiveQuery& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel (POST) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -513,12 +712,61 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/report (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetChannelReportGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelReportGet(
+            int deviceSetIndex __attribute__((unused)),
+            int channelIndex __attribute__((unused)),
+            SWGSDRangel::SWGChannelReport& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/record (GET) swagger/sdrangel/code/html2/index.html#api-Default-devicesetChannelRecordGet
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelRecordGet(
+            int deviceSetIndex __attribute__((unused)),
+            int channelIndex __attribute__((unused)),
+            SWGSDRangel::SWGChannelRecord& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/record (PUT, PATCH) swagger/sdrangel/code/html2/index.html#api-Default-devicesetChannelRecordPut
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelRecordPutPatch(
+            int deviceSetIndex __attribute__((unused)),
+            int channelIndex __attribute__((unused)),
+            bool force __attribute__((unused)),
+            const QStringList& recordKeys __attribute__((unused)),
+            SWGSDRangel::SWGChannelRecord& response __attribute__((unused)),
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
     static QString instanceSummaryURL;
+    static QString instanceMetricsURL;
     static QString instanceDevicesURL;
     static QString instanceChannelsURL;
     static QString instanceLoggingURL;
     static QString instanceAudioURL;
     static QString instanceLocationURL;
+    static QString instanceDSPThreadsURL;
     static QString instanceDVSerialURL;
     static QString instancePresetsURL;
     static QString instancePresetURL;
@@ -530,9 +778,16 @@ public:
     static std::regex devicesetDeviceURLRe;
     static std::regex devicesetDeviceSettingsURLRe;
     static std::regex devicesetDeviceRunURLRe;
+    static std::regex devicesetDeviceReportURLRe;
+    static std::regex devicesetDeviceSchedulingURLRe;
+    static std::regex devicesetDevicePreTriggerURLRe;
+    static std::regex devicesetDeviceSpectrumArchiveURLRe;
+    static std::regex devicesetDeviceSpectrumArchiveQueryURLRe;
     static std::regex devicesetChannelURLRe;
     static std::regex devicesetChannelIndexURLRe;
     static std::regex devicesetChannelSettingsURLRe;
+    static std::regex devicesetChannelReportURLRe;
+    static std::regex devicesetChannelRecordURLRe;
 };
 
 
@@ -0,0 +1,703 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Runtime reports and metrics common to GUI and server web API adapters         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "SWGDeviceReport.h"
+#include "SWGBasebandSinkReport.h"
+#include "SWGChannelReport.h"
+#include "SWGNFMDemodReport.h"
+#include "SWGNFMModReport.h"
+#include "SWGDeviceScheduling.h"
+#include "SWGProfileHistogram.h"
+#include "SWGProfileBucket.h"
+#include "SWGPreTriggerRecord.h"
+#include "SWGPreTriggerRecordStatus.h"
+#include "SWGChannelRecord.h"
+#include "SWGChannelRecordStatus.h"
+#include "SWGSpectrumArchive.h"
+#include "SWGSpectrumArchiveStatus.h"
+#include "SWGSpectrumArchiveQuery.h"
+#include "SWGSpectrumArchiveSpectrum.h"
+
+#include "dsp/dspengine.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/dspdevicesinkengine.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/devicesamplesink.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/samplesourcefifo.h"
+#include "dsp/threadedbasebandsamplesink.h"
+#include "dsp/pretriggerrecord.h"
+#include "dsp/channelrecord.h"
+#include "dsp/spectrumarchive.h"
+#include "device/devicesourceapi.h"
+#include "util/threadscheduling.h"
+#include "util/profilehistogram.h"
+
+#include "webapimetrics.h"
+
+WebAPIMetrics::WebAPIMetrics()
+{
+}
+
+WebAPIMetrics::~WebAPIMetrics()
+{
+}
+
+void WebAPIMetrics::formatDeviceReport(
+        SWGSDRangel::SWGDeviceReport& response,
+        DSPDeviceSourceEngine *deviceSourceEngine,
+        DeviceSampleSource *deviceSampleSource)
+{
+    quint64 busyTime, runningTime, processedSamples;
+    deviceSourceEngine->getBusyCounters(busyTime, runningTime, processedSamples);
+
+    response.setTx(0);
+    response.setSampleRate(deviceSourceEngine->getSampleRate());
+    response.setCenterFrequency(deviceSourceEngine->getCenterFrequency());
+    response.setDspBusyTime(busyTime);
+    response.setDspRunningTime(runningTime);
+    response.setDspLoad(runningTime == 0 ? 0.0f : (float) busyTime / (float) runningTime);
+    response.setProcessedSamples(processedSamples);
+
+    ProfileHistogram workTime;
+    deviceSourceEngine->getWorkTime(workTime);
+    formatProfileHistogram(*response.getDspWorkTime(), workTime);
+
+    if (deviceSampleSource)
+    {
+        SampleSinkFifo *sampleFifo = deviceSampleSource->getSampleFifo();
+        response.setFifoSize(sampleFifo->size());
+        response.setFifoFill(sampleFifo->fill());
+        response.setFifoMaxFill(sampleFifo->getMaxFill());
+        response.setFifoOverflowCount(sampleFifo->getOverflowCount());
+        response.setFifoDroppedSamples(sampleFifo->getDroppedSamples());
+    }
+
+    std::vector<ThreadedBasebandSampleSink::Report> sinkReports;
+    std::vector<ThreadedBasebandSampleSink::Report> directSinkReports;
+    deviceSourceEngine->getThreadedSinksReports(sinkReports);
+    deviceSourceEngine->getDirectSinksReports(directSinkReports);
+    sinkReports.insert(sinkReports.end(), directSinkReports.begin(), directSinkReports.end());
+
+    for (std::vector<ThreadedBasebandSampleSink::Report>::const_iterator it = sinkReports.begin(); it != sinkReports.end(); ++it)
+    {
+        SWGSDRangel::SWGBasebandSinkReport *sinkReport = new SWGSDRangel::SWGBasebandSinkReport();
+        sinkReport->init();
+        *sinkReport->getName() = it->m_name;
+        sinkReport->setDirect(it->m_direct ? 1 : 0);
+        sinkReport->setFifoSize(it->m_fifoSize);
+        sinkReport->setFifoFill(it->m_fifoFill);
+        sinkReport->setFifoMaxFill(it->m_fifoMaxFill);
+        sinkReport->setFifoOverflowCount(it->m_fifoOverflowCount);
+        sinkReport->setFifoDroppedSamples(it->m_fifoDroppedSamples);
+        sinkReport->setProcessingTime(it->m_processingTime);
+        sinkReport->setProcessedSamples(it->m_processedSamples);
+        sinkReport->setSamplesIn(it->m_samplesIn);
+        formatProfileHistogram(*sinkReport->getFeedTime(), it->m_feedTime);
+        response.getBasebandSinks()->append(sinkReport);
+    }
+}
+
+void WebAPIMetrics::formatProfileHistogram(
+        SWGSDRangel::SWGProfileHistogram& response,
+        const ProfileHistogram& histogram)
+{
+    response.setCount(histogram.getCount());
+    response.setSum(histogram.getSum());
+    response.setMax(histogram.getMax());
+    response.setP50(histogram.getPercentile(50.0));
+    response.setP99(histogram.getPercentile(99.0));
+
+    for (int i = 0; i < ProfileHistogram::m_nbBuckets; i++)
+    {
+        if (histogram.getBucketCount(i) == 0) {
+            continue;
+        }
+
+        SWGSDRangel::SWGProfileBucket *bucket = new SWGSDRangel::SWGProfileBucket();
+        bucket->setUpperBound(ProfileHistogram::getBucketUpperBound(i));
+        bucket->setCount(histogram.getBucketCount(i));
+        response.getBuckets()->append(bucket);
+    }
+}
+
+void WebAPIMetrics::formatDeviceReport(
+        SWGSDRangel::SWGDeviceReport& response,
+        DSPDeviceSinkEngine *deviceSinkEngine,
+        DeviceSampleSink *deviceSampleSink)
+{
+    quint64 busyTime, runningTime, processedSamples;
+    deviceSinkEngine->getBusyCounters(busyTime, runningTime, processedSamples);
+
+    response.setTx(1);
+    response.setSampleRate(deviceSinkEngine->getSampleRate());
+    response.setCenterFrequency(deviceSinkEngine->getCenterFrequency());
+    response.setDspBusyTime(busyTime);
+    response.setDspRunningTime(runningTime);
+    response.setDspLoad(runningTime == 0 ? 0.0f : (float) busyTime / (float) runningTime);
+    response.setProcessedSamples(processedSamples);
+
+    if (deviceSampleSink)
+    {
+        SampleSourceFifo *sampleFifo = deviceSampleSink->getSampleFifo();
+        response.setFifoSize(sampleFifo->size());
+        response.setFifoFill(sampleFifo->fill());
+        response.setFifoUnderrunCount(sampleFifo->getUnderrunCount());
+        response.setFifoUnderrunSamples(sampleFifo->getUnderrunSamples());
+    }
+}
+
+void WebAPIMetrics::formatDeviceScheduling(
+        SWGSDRangel::SWGDeviceScheduling& response,
+        const ThreadSchedulingReport& report)
+{
+    response.setPolicy(new QString(ThreadSchedulingSettings::policyToString(report.m_settings.m_policy)));
+    response.setRtPriority(report.m_settings.m_rtPriority);
+    response.setNice(report.m_settings.m_nice);
+    response.setCpuAffinity(new QString(ThreadSchedulingSettings::cpuMaskToString(report.m_settings.m_cpuMask)));
+    response.setDspAppliedPolicy(new QString(report.m_engineApplied ? ThreadSchedulingSettings::policyToString(report.m_enginePolicy) : ""));
+    response.setDeviceAppliedPolicy(new QString(report.m_deviceApplied ? ThreadSchedulingSettings::policyToString(report.m_devicePolicy) : ""));
+    response.setError(new QString(report.m_errorMessage));
+
+    response.setLatencyAvg(report.m_counters.getLatencyAvg());
+    response.setLatencyMax(report.m_counters.m_latencyMax);
+    response.setOverflowCount(report.m_counters.m_overflowCount);
+    response.setDroppedSamples(report.m_counters.m_droppedSamples);
+    response.setRunningTime(report.m_counters.m_runningTime);
+
+    response.setPreviousLatencyAvg(report.m_previousCounters.getLatencyAvg());
+    response.setPreviousLatencyMax(report.m_previousCounters.m_latencyMax);
+    response.setPreviousOverflowCount(report.m_previousCounters.m_overflowCount);
+    response.setPreviousDroppedSamples(report.m_previousCounters.m_droppedSamples);
+    response.setPreviousRunningTime(report.m_previousCounters.m_runningTime);
+}
+
+bool WebAPIMetrics::updateThreadScheduling(
+        ThreadSchedulingSettings& settings,
+        const QStringList& schedulingKeys,
+        SWGSDRangel::SWGDeviceScheduling& query,
+        QString& errorMessage)
+{
+    if (schedulingKeys.contains("policy") && query.getPolicy())
+    {
+        if (!ThreadSchedulingSettings::policyFromString(*query.getPolicy(), settings.m_policy))
+        {
+            errorMessage = QString("Invalid policy %1: use default, nice, fifo or rr").arg(*query.getPolicy());
+            return false;
+        }
+    }
+
+    if (schedulingKeys.contains("rtPriority"))
+    {
+        if ((query.getRtPriority() < 1) || (query.getRtPriority() > 99))
+        {
+            errorMessage = QString("Invalid real time priority %1: must be between 1 and 99").arg(query.getRtPriority());
+            return false;
+        }
+
+        settings.m_rtPriority = query.getRtPriority();
+    }
+
+    if (schedulingKeys.contains("nice"))
+    {
+        if ((query.getNice() < -20) || (query.getNice() > 19))
+        {
+            errorMessage = QString("Invalid nice value %1: must be between -20 and 19").arg(query.getNice());
+            return false;
+        }
+
+        settings.m_nice = query.getNice();
+    }
+
+    if (schedulingKeys.contains("cpuAffinity") && query.getCpuAffinity())
+    {
+        if (!ThreadSchedulingSettings::cpuMaskFromString(*query.getCpuAffinity(), settings.m_cpuMask))
+        {
+            errorMessage = QString("Invalid CPU affinity %1: use a list of CPUs or ranges of CPUs e.g. 0,2-3").arg(*query.getCpuAffinity());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void WebAPIMetrics::formatPreTriggerRecord(
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        DeviceSourceAPI *deviceSourceAPI)
+{
+    const PreTriggerRecord::Settings& settings = deviceSourceAPI->getPreTriggerRecordSettings();
+    PreTriggerRecord::Report report;
+    bool armed = deviceSourceAPI->getPreTriggerRecordReport(report);
+
+    response.setArmed(armed ? 1 : 0);
+    response.setFileBase(new QString(settings.m_fileBase));
+    response.setPreTriggerTime(settings.m_preTriggerTime);
+    response.setPostTriggerTime(settings.m_postTriggerTime);
+    response.setHugePages(settings.m_hugePages ? 1 : 0);
+    response.setSquelchChannelIndex(settings.m_squelchChannelIndex);
+
+    if (armed)
+    {
+        SWGSDRangel::SWGPreTriggerRecordStatus *status = response.getStatus();
+        status->setRecording(report.m_recording ? 1 : 0);
+        status->setBufferTime(report.m_bufferTime);
+        status->setBufferedTime(report.m_bufferedTime);
+        status->setBufferSize(report.m_bufferSize);
+        status->setHugePages(report.m_hugePages ? 1 : 0);
+        status->setNbTriggers(report.m_nbTriggers);
+        status->setNbFiles(report.m_nbFiles);
+        status->setWrittenBytes(report.m_writtenBytes);
+        status->setDroppedSamples(report.m_droppedSamples);
+        status->setFileName(new QString(report.m_fileName));
+        status->setErrorMessage(new QString(report.m_errorMessage));
+    }
+}
+
+bool WebAPIMetrics::updatePreTriggerRecord(
+        DeviceSourceAPI *deviceSourceAPI,
+        bool force,
+        const QStringList& preTriggerKeys,
+        SWGSDRangel::SWGPreTriggerRecord& query,
+        QString& errorMessage)
+{
+    PreTriggerRecord::Settings settings = force ? PreTriggerRecord::Settings() : deviceSourceAPI->getPreTriggerRecordSettings();
+    bool armed = deviceSourceAPI->isPreTriggerRecordArmed();
+
+    if (preTriggerKeys.contains("armed")) {
+        armed = query.getArmed() != 0;
+    }
+
+    if (preTriggerKeys.contains("fileBase") && query.getFileBase())
+    {
+        if (query.getFileBase()->isEmpty())
+        {
+            errorMessage = "File base name must not be empty";
+            return false;
+        }
+
+        settings.m_fileBase = *query.getFileBase();
+    }
+
+    if (preTriggerKeys.contains("preTriggerTime"))
+    {
+        if ((query.getPreTriggerTime() <= 0.0f) || (query.getPreTriggerTime() > 3600.0f))
+        {
+            errorMessage = QString("Invalid pre-trigger time %1: must be more than 0 and up to 3600 s").arg(query.getPreTriggerTime());
+            return false;
+        }
+
+        settings.m_preTriggerTime = query.getPreTriggerTime();
+    }
+
+    if (preTriggerKeys.contains("postTriggerTime"))
+    {
+        if ((query.getPostTriggerTime() < 0.0f) || (query.getPostTriggerTime() > 3600.0f))
+        {
+            errorMessage = QString("Invalid post-trigger time %1: must be between 0 and 3600 s").arg(query.getPostTriggerTime());
+            return false;
+        }
+
+        settings.m_postTriggerTime = query.getPostTriggerTime();
+    }
+
+    if (preTriggerKeys.contains("hugePages")) {
+        settings.m_hugePages = query.getHugePages() != 0;
+    }
+
+    if (preTriggerKeys.contains("squelchChannelIndex")) {
+        settings.m_squelchChannelIndex = query.getSquelchChannelIndex() < 0 ? -1 : query.getSquelchChannelIndex();
+    }
+
+    if (armed)
+    {
+        return deviceSourceAPI->armPreTriggerRecord(settings, errorMessage); // buffer is reallocated for the new settings
+    }
+    else
+    {
+        deviceSourceAPI->disarmPreTriggerRecord();
+        deviceSourceAPI->setPreTriggerRecordSettings(settings);
+        return true;
+    }
+}
+
+void WebAPIMetrics::formatSpectrumArchive(
+        SWGSDRangel::SWGSpectrumArchive& response,
+        DeviceSourceAPI *deviceSourceAPI)
+{
+    const SpectrumArchive::Settings& settings = deviceSourceAPI->getSpectrumArchiveSettings();
+    SpectrumArchive::Report report;
+    bool archiving = deviceSourceAPI->getSpectrumArchiveReport(report);
+
+    response.setArchiving(archiving ? 1 : 0);
+    response.setFileBase(new QString(settings.m_fileBase));
+    response.setFftSize(settings.m_fftSize);
+    response.setPeriod(settings.m_period);
+    response.setDbMin(settings.m_dbMin);
+    response.setBlockSpectra(settings.m_blockSpectra);
+
+    if (archiving)
+    {
+        SWGSDRangel::SWGSpectrumArchiveStatus *status = response.getStatus();
+        status->setFileName(new QString(report.m_fileName));
+        status->setNbSpectra(report.m_nbSpectra);
+        status->setNbBlocks(report.m_nbBlocks);
+        status->setWrittenBytes(report.m_writtenBytes);
+        status->setRawBytes(report.m_rawBytes);
+        status->setDroppedSpectra(report.m_droppedSpectra);
+        status->setLastTime(report.m_lastTimeMs);
+        status->setErrorMessage(new QString(report.m_errorMessage));
+    }
+}
+
+bool WebAPIMetrics::updateSpectrumArchive(
+        DeviceSourceAPI *deviceSourceAPI,
+        bool force,
+        const QStringList& archiveKeys,
+        SWGSDRangel::SWGSpectrumArchive& query,
+        QString& errorMessage)
+{
+    SpectrumArchive::Settings settings = force ? SpectrumArchive::Settings() : deviceSourceAPI->getSpectrumArchiveSettings();
+    bool archiving = deviceSourceAPI->isSpectrumArchiveRunning();
+
+    if (archiveKeys.contains("archiving")) {
+        archiving = query.getArchiving() != 0;
+    }
+
+    if (archiveKeys.contains("fileBase") && query.getFileBase())
+    {
+        if (query.getFileBase()->isEmpty())
+        {
+            errorMessage = "File base name must not be empty";
+            return false;
+        }
+
+        settings.m_fileBase = *query.getFileBase();
+    }
+
+    if (archiveKeys.contains("fftSize"))
+    {
+        int fftSize = query.getFftSize();
+
+        if ((fftSize < 64) || (fftSize > 4096) || ((fftSize & (fftSize - 1)) != 0))
+        {
+            errorMessage = QString("Invalid FFT size %1: must be a power of two from 64 to 4096").arg(fftSize);
+            return false;
+        }
+
+        settings.m_fftSize = fftSize;
+    }
+
+    if (archiveKeys.contains("period"))
+    {
+        if ((query.getPeriod() < 0.1f) || (query.getPeriod() > 3600.0f))
+        {
+            errorMessage = QString("Invalid period %1: must be between 0.1 and 3600 s").arg(query.getPeriod());
+            return false;
+        }
+
+        settings.m_period = query.getPeriod();
+    }
+
+    if (archiveKeys.contains("dbMin")) {
+        settings.m_dbMin = query.getDbMin();
+    }
+
+    if (archiveKeys.contains("blockSpectra"))
+    {
+        if ((query.getBlockSpectra() < 1) || (query.getBlockSpectra() > 65536))
+        {
+            errorMessage = QString("Invalid number of spectra per block %1: must be between 1 and 65536").arg(query.getBlockSpectra());
+            return false;
+        }
+
+        settings.m_blockSpectra = query.getBlockSpectra();
+    }
+
+    if (archiving)
+    {
+        return deviceSourceAPI->startSpectrumArchive(settings, errorMessage); // a new session of the same or another archive
+    }
+    else
+    {
+        deviceSourceAPI->stopSpectrumArchive();
+        deviceSourceAPI->setSpectrumArchiveSettings(settings);
+        return true;
+    }
+}
+
+bool WebAPIMetrics::querySpectrumArchive(
+        const QString& fileBase,
+        qint64 fromMs,
+        qint64 toMs,
+        int maxSpectra,
+        SWGSDRangel::SWGSpectrumArchiveQuery& response,
+        QString& errorMessage)
+{
+    QList<SpectrumArchive::Spectrum> spectra;
+
+    if (!SpectrumArchive::query(fileBase, fromMs, toMs, maxSpectra, spectra, errorMessage)) {
+        return false;
+    }
+
+    response.setFileBase(new QString(fileBase));
+    response.setFrom(fromMs);
+    response.setTo(toMs);
+    QList<SWGSDRangel::SWGSpectrumArchiveSpectrum*> *responseSpectra = response.getSpectra();
+
+    for (int i = 0; i < spectra.size(); i++)
+    {
+        const SpectrumArchive::Spectrum& spectrum = spectra[i];
+        responseSpectra->append(new SWGSDRangel::SWGSpectrumArchiveSpectrum());
+        responseSpectra->back()->setTime(spectrum.m_timeMs);
+        responseSpectra->back()->setCenterFrequency(spectrum.m_centerFrequency);
+        responseSpectra->back()->setSampleRate(spectrum.m_sampleRate);
+        responseSpectra->back()->setDbOffset(spectrum.m_dbOffset);
+        responseSpectra->back()->setDbStep(spectrum.m_dbStep);
+        responseSpectra->back()->setNbMerged(spectrum.m_nbMerged);
+        responseSpectra->back()->setCodes(new QString(QString::fromLatin1(spectrum.m_codes.toBase64())));
+    }
+
+    return true;
+}
+
+void WebAPIMetrics::formatChannelRecord(
+        SWGSDRangel::SWGChannelRecord& response,
+        ChannelRecord *channelRecord)
+{
+    ChannelRecord::Report report;
+    channelRecord->getReport(report);
+
+    response.setRecording(report.m_recording ? 1 : 0);
+    response.setFileBase(new QString(report.m_fileBase));
+    SWGSDRangel::SWGChannelRecordStatus *status = response.getStatus();
+    status->setFileName(new QString(report.m_fileName));
+    status->setSampleRate(report.m_sampleRate);
+    status->setCenterFrequency(report.m_centerFrequency);
+    status->setNbFiles(report.m_nbFiles);
+    status->setWrittenBytes(report.m_writtenBytes);
+    status->setDroppedSamples(report.m_droppedSamples);
+    status->setErrorMessage(new QString(report.m_errorMessage));
+}
+
+bool WebAPIMetrics::updateChannelRecord(
+        ChannelRecord *channelRecord,
+        bool force,
+        const QStringList& recordKeys,
+        SWGSDRangel::SWGChannelRecord& query,
+        QString& errorMessage)
+{
+    ChannelRecord::Report report;
+    channelRecord->getReport(report);
+    bool recording = force ? false : report.m_recording;
+    QString fileBase = force ? QString() : report.m_fileBase;
+
+    if (recordKeys.contains("recording")) {
+        recording = query.getRecording() != 0;
+    }
+
+    if (recordKeys.contains("fileBase") && query.getFileBase()) {
+        fileBase = *query.getFileBase();
+    }
+
+    if (!recording)
+    {
+        channelRecord->stopRecording();
+        return true;
+    }
+
+    if (fileBase.isEmpty())
+    {
+        errorMessage = "File base name must be given to record";
+        return false;
+    }
+
+    if (!report.m_recording || (fileBase != report.m_fileBase)) {
+        channelRecord->startRecording(fileBase); // a new file base starts a new file
+    }
+
+    return true;
+}
+
+void WebAPIMetrics::addDeviceReport(int deviceSetIndex, SWGSDRangel::SWGDeviceReport& report)
+{
+    bool tx = report.getTx() != 0;
+    QString labels = QString("deviceset=\"%1\",tx=\"%2\"").arg(deviceSetIndex).arg(tx ? 1 : 0);
+
+    addSample("sdrangel_device_sample_rate", "gauge", "Baseband sample rate (S/s)", labels, report.getSampleRate());
+    addSample("sdrangel_device_center_frequency_hz", "gauge", "Device center frequency (Hz)", labels, report.getCenterFrequency());
+    addSample("sdrangel_device_fifo_size_samples", "gauge", "Size of the device sample FIFO", labels, report.getFifoSize());
+    addSample("sdrangel_device_fifo_fill_samples", "gauge", "Samples currently in the device sample FIFO", labels, report.getFifoFill());
+
+    if (tx)
+    {
+        addSample("sdrangel_device_fifo_underruns_total", "counter", "Reads past the write pointer of the device sample FIFO", labels, report.getFifoUnderrunCount());
+        addSample("sdrangel_device_fifo_underrun_samples_total", "counter", "Samples read again from the device sample FIFO", labels, report.getFifoUnderrunSamples());
+    }
+    else
+    {
+        addSample("sdrangel_device_fifo_max_fill_samples", "gauge", "Highest device sample FIFO fill since start", labels, report.getFifoMaxFill());
+        addSample("sdrangel_device_fifo_overflows_total", "counter", "Writes to the device sample FIFO that overflowed", labels, report.getFifoOverflowCount());
+        addSample("sdrangel_device_fifo_dropped_samples_total", "counter", "Samples dropped by device sample FIFO overflows", labels, report.getFifoDroppedSamples());
+    }
+
+    addSample("sdrangel_dsp_busy_seconds_total", "counter", "Time spent by the DSP engine thread moving samples", labels, report.getDspBusyTime() / 1e9);
+    addSample("sdrangel_dsp_running_seconds", "gauge", "Time since the device was started", labels, report.getDspRunningTime() / 1e9);
+    addSample("sdrangel_dsp_load_ratio", "gauge", "Ratio of DSP engine busy time to running time", labels, report.getDspLoad());
+    addSample("sdrangel_dsp_processed_samples_total", "counter", "Samples processed by the DSP engine", labels, report.getProcessedSamples());
+
+    if (report.getDspWorkTime() && report.getDspWorkTime()->isSet()) {
+        addHistogram("sdrangel_dsp_work_seconds", "Durations of the DSP engine transfers from the device FIFO to the sinks", labels, *report.getDspWorkTime());
+    }
+
+    QList<SWGSDRangel::SWGBasebandSinkReport*> *sinkReports = report.getBasebandSinks();
+
+    for (int i = 0; i < sinkReports->size(); i++)
+    {
+        SWGSDRangel::SWGBasebandSinkReport *sinkReport = sinkReports->at(i);
+        QString sinkLabels = QString("deviceset=\"%1\",sink=\"%2\"")
+                .arg(QString::number(deviceSetIndex), escapeLabel(*sinkReport->getName()));
+
+        if (sinkReport->getDirect() == 0) // direct sinks have no FIFO
+        {
+            addSample("sdrangel_sink_fifo_size_samples", "gauge", "Size of the sink input FIFO", sinkLabels, sinkReport->getFifoSize());
+            addSample("sdrangel_sink_fifo_fill_samples", "gauge", "Samples currently in the sink input FIFO", sinkLabels, sinkReport->getFifoFill());
+            addSample("sdrangel_sink_fifo_max_fill_samples", "gauge", "Highest sink input FIFO fill since start", sinkLabels, sinkReport->getFifoMaxFill());
+            addSample("sdrangel_sink_fifo_overflows_total", "counter", "Writes to the sink input FIFO that overflowed", sinkLabels, sinkReport->getFifoOverflowCount());
+            addSample("sdrangel_sink_fifo_dropped_samples_total", "counter", "Samples dropped by sink input FIFO overflows", sinkLabels, sinkReport->getFifoDroppedSamples());
+        }
+
+        addSample("sdrangel_sink_processing_seconds_total", "counter", "Time spent processing samples in the sink", sinkLabels, sinkReport->getProcessingTime() / 1e9);
+        addSample("sdrangel_sink_processed_samples_total", "counter", "Samples processed by the sink", sinkLabels, sinkReport->getProcessedSamples());
+        addSample("sdrangel_sink_input_samples_total", "counter", "Samples given to the sink by the DSP engine including dropped ones", sinkLabels, sinkReport->getSamplesIn());
+
+        if (sinkReport->getFeedTime() && sinkReport->getFeedTime()->isSet()) {
+            addHistogram("sdrangel_sink_feed_seconds", "Durations of the sink feed method calls", sinkLabels, *sinkReport->getFeedTime());
+        }
+    }
+}
+
+void WebAPIMetrics::addChannelReport(int deviceSetIndex, int channelIndex, SWGSDRangel::SWGChannelReport& report)
+{
+    QString labels = QString("deviceset=\"%1\",channel=\"%2\",type=\"%3\",tx=\"%4\"")
+            .arg(QString::number(deviceSetIndex),
+                 QString::number(channelIndex),
+                 escapeLabel(report.getChannelType() ? *report.getChannelType() : QString("")),
+                 QString::number(report.getTx()));
+
+    if (report.getNfmDemodReport())
+    {
+        SWGSDRangel::SWGNFMDemodReport *nfmDemodReport = report.getNfmDemodReport();
+        addSample("sdrangel_channel_power_db", "gauge", "Channel power (dB)", labels, nfmDemodReport->getChannelPowerDb());
+        addSample("sdrangel_channel_squelch_open", "gauge", "Squelch status (1 if open)", labels, nfmDemodReport->getSquelch());
+        addSample("sdrangel_channel_sample_rate", "gauge", "Channel sample rate (S/s)", labels, nfmDemodReport->getChannelSampleRate());
+        addSample("sdrangel_channel_audio_sample_rate", "gauge", "Channel audio sample rate (S/s)", labels, nfmDemodReport->getAudioSampleRate());
+    }
+    else if (report.getNfmModReport())
+    {
+        SWGSDRangel::SWGNFMModReport *nfmModReport = report.getNfmModReport();
+        addSample("sdrangel_channel_power_db", "gauge", "Channel power (dB)", labels, nfmModReport->getChannelPowerDb());
+        addSample("sdrangel_channel_sample_rate", "gauge", "Channel sample rate (S/s)", labels, nfmModReport->getChannelSampleRate());
+        addSample("sdrangel_channel_audio_sample_rate", "gauge", "Channel audio sample rate (S/s)", labels, nfmModReport->getAudioSampleRate());
+    }
+}
+
+void WebAPIMetrics::addAudioOutput(DSPEngine *dspEngine)
+{
+    AudioOutput::Counters counters;
+    dspEngine->getAudioOutputCounters(counters);
+
+    addSample("sdrangel_audio_output_fifos", "gauge", "Channel audio FIFOs mixed into the audio output", "", counters.m_nbFifos);
+    addSample("sdrangel_audio_output_overruns_total", "counter", "Channel writes to the audio FIFOs that overflowed", "", counters.m_overrunCount);
+    addSample("sdrangel_audio_output_dropped_samples_total", "counter", "Samples dropped by audio FIFO overflows", "", counters.m_droppedSamples);
+    addSample("sdrangel_audio_output_underruns_total", "counter", "Audio device reads that could not be completed from the audio FIFOs", "", counters.m_underrunCount);
+}
+
+QString WebAPIMetrics::serialize() const
+{
+    QString text;
+
+    for (QList<Family>::const_iterator it = m_families.begin(); it != m_families.end(); ++it)
+    {
+        text += QString("# HELP %1 %2\n").arg(it->m_name, it->m_help);
+        text += QString("# TYPE %1 %2\n").arg(it->m_name, it->m_type);
+        text += it->m_samples.join("\n");
+        text += "\n";
+    }
+
+    return text;
+}
+
+void WebAPIMetrics::addSample(const QString& name, const QString& type, const QString& help, const QString& labels, double value)
+{
+    addFamilySample(name, type, help, name, labels, value);
+}
+
+void WebAPIMetrics::addFamilySample(const QString& name, const QString& type, const QString& help, const QString& sampleName, const QString& labels, double value)
+{
+    QHash<QString, int>::const_iterator indexIt = m_familyIndexes.find(name);
+    int index;
+
+    if (indexIt == m_familyIndexes.end())
+    {
+        index = m_families.size();
+        m_families.append(Family());
+        m_families.back().m_name = name;
+        m_families.back().m_type = type;
+        m_families.back().m_help = help;
+        m_familyIndexes.insert(name, index);
+    }
+    else
+    {
+        index = indexIt.value();
+    }
+
+    if (labels.isEmpty()) {
+        m_families[index].m_samples.append(QString("%1 %2").arg(sampleName, QString::number(value, 'g', 16)));
+    } else {
+        m_families[index].m_samples.append(QString("%1{%2} %3").arg(sampleName, labels, QString::number(value, 'g', 16)));
+    }
+}
+
+void WebAPIMetrics::addHistogram(const QString& name, const QString& help, const QString& labels, SWGSDRangel::SWGProfileHistogram& histogram)
+{
+    // Prometheus buckets are cumulative and end with +Inf. Empty buckets are not listed by the report.
+    QList<SWGSDRangel::SWGProfileBucket*> *buckets = histogram.getBuckets();
+    quint64 cumulated = 0;
+
+    for (int i = 0; i < buckets->size(); i++)
+    {
+        cumulated += buckets->at(i)->getCount();
+        QString bucketLabels = QString("%1,le=\"%2\"").arg(labels, QString::number(buckets->at(i)->getUpperBound() / 1e9, 'g', 16));
+        addFamilySample(name, "histogram", help, name + "_bucket", bucketLabels, cumulated);
+    }
+
+    addFamilySample(name, "histogram", help, name + "_bucket", QString("%1,le=\"+Inf\"").arg(labels), histogram.getCount());
+    addFamilySample(name, "histogram", help, name + "_sum", labels, histogram.getSum() / 1e9);
+    addFamilySample(name, "histogram", help, name + "_count", labels, histogram.getCount());
+}
+
+QString WebAPIMetrics::escapeLabel(const QString& value)
+{
+    QString escaped = value;
+    escaped.replace("\\", "\\\\");
+    escaped.replace("\"", "\\\"");
+    escaped.replace("\n", "\\n");
+    return escaped;
+}
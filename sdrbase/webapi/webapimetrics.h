@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Runtime reports and metrics common to GUI and server web API adapters         //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBAPI_WEBAPIMETRICS_H_
+#define SDRBASE_WEBAPI_WEBAPIMETRICS_H_
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+#include <QHash>
+
+#include "util/export.h"
+
+namespace SWGSDRangel
+{
+    class SWGDeviceReport;
+    class SWGChannelReport;
+    class SWGDeviceScheduling;
+    class SWGProfileHistogram;
+    class SWGPreTriggerRecord;
+    class SWGChannelRecord;
+    class SWGSpectrumArchive;
+    class SWGSpectrumArchiveQuery;
+}
+
+struct ThreadSchedulingSettings;
+struct ThreadSchedulingReport;
+class ProfileHistogram;
+class DSPEngine;
+
+class DSPDeviceSourceEngine;
+class DSPDeviceSinkEngine;
+class DeviceSampleSource;
+class DeviceSampleSink;
+class DeviceSourceAPI;
+class ChannelRecord;
+
+/**
+ * Builds device reports from the DSP engines counters and collects device and channel
+ * reports and the audio output counters into a Prometheus text exposition (version 0.0.4) document. Duration histograms
+ * of the DSP engine and of the sinks are exported as Prometheus histograms. Also converts
+ * the threads scheduling settings and report of the DSP engines, the pre-trigger recorder and
+ * spectrum archive settings and status of the device sets and the channels I/Q recording from
+ * and to the web API.
+ */
+class SDRANGEL_API WebAPIMetrics
+{
+public:
+    WebAPIMetrics();
+    ~WebAPIMetrics();
+
+    static void formatDeviceReport(
+            SWGSDRangel::SWGDeviceReport& response,
+            DSPDeviceSourceEngine *deviceSourceEngine,
+            DeviceSampleSource *deviceSampleSource);
+
+    static void formatDeviceReport(
+            SWGSDRangel::SWGDeviceReport& response,
+            DSPDeviceSinkEngine *deviceSinkEngine,
+            DeviceSampleSink *deviceSampleSink);
+
+    static void formatDeviceScheduling(
+            SWGSDRangel::SWGDeviceScheduling& response,
+            const ThreadSchedulingReport& report);
+
+    /** Update settings with the keys given in query. Returns false with an error message if a value is invalid. */
+    static bool updateThreadScheduling(
+            ThreadSchedulingSettings& settings,
+            const QStringList& schedulingKeys,
+            SWGSDRangel::SWGDeviceScheduling& query,
+            QString& errorMessage);
+
+    static void formatPreTriggerRecord(
+            SWGSDRangel::SWGPreTriggerRecord& response,
+            DeviceSourceAPI *deviceSourceAPI);
+
+    /** Update the pre-trigger recorder with the keys given in query and arm or disarm it. Returns false with an error message if it fails. */
+    static bool updatePreTriggerRecord(
+            DeviceSourceAPI *deviceSourceAPI,
+            bool force,
+            const QStringList& preTriggerKeys,
+            SWGSDRangel::SWGPreTriggerRecord& query,
+            QString& errorMessage);
+
+    static void formatSpectrumArchive(
+            SWGSDRangel::SWGSpectrumArchive& response,
+            DeviceSourceAPI *deviceSourceAPI);
+
+    /** Update the spectrum archive with the keys given in query and start or stop it. Returns false with an error message if it fails. */
+    static bool updateSpectrumArchive(
+            DeviceSourceAPI *deviceSourceAPI,
+            bool force,
+            const QStringList& archiveKeys,
+            SWGSDRangel::SWGSpectrumArchive& query,
+            QString& errorMessage);
+
+    /** Read the spectra of the archive fileBase. Returns false with an error message if it cannot be read. */
+    static bool querySpectrumArchive(
+            const QString& fileBase,
+            qint64 fromMs,
+            qint64 toMs,
+            int maxSpectra,
+            SWGSDRangel::SWGSpectrumArchiveQuery& response,
+            QString& errorMessage);
+
+    static void formatChannelRecord(
+            SWGSDRangel::SWGChannelRecord& response,
+            ChannelRecord *channelRecord);
+
+    /** Start or stop the channel recording with the keys given in query. Returns false with an error message if it fails. */
+    static bool updateChannelRecord(
+            ChannelRecord *channelRecord,
+            bool force,
+            const QStringList& recordKeys,
+            SWGSDRangel::SWGChannelRecord& query,
+            QString& errorMessage);
+
+    static void formatProfileHistogram(
+            SWGSDRangel::SWGProfileHistogram& response,
+            const ProfileHistogram& histogram);
+
+    void addDeviceReport(int deviceSetIndex, SWGSDRangel::SWGDeviceReport& report);
+    void addChannelReport(int deviceSetIndex, int channelIndex, SWGSDRangel::SWGChannelReport& report);
+    void addAudioOutput(DSPEngine *dspEngine);
+
+    QString serialize() const; //!< Prometheus text format
+
+private:
+    struct Family
+    {
+        QString m_name;
+        QString m_help;
+        QString m_type;
+        QStringList m_samples;
+    };
+
+    QList<Family> m_families;           //!< in order of first appearance
+    QHash<QString, int> m_familyIndexes;
+
+    void addSample(const QString& name, const QString& type, const QString& help, const QString& labels, double value);
+    void addFamilySample(const QString& name, const QString& type, const QString& help, const QString& sampleName, const QString& labels, double value);
+    void addHistogram(const QString& name, const QString& help, const QString& labels, SWGSDRangel::SWGProfileHistogram& histogram); //!< Prometheus histogram in seconds
+    static QString escapeLabel(const QString& value);
+};
+
+#endif /* SDRBASE_WEBAPI_WEBAPIMETRICS_H_ */
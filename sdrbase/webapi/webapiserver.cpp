@@ -28,6 +28,10 @@ WebAPIServer::WebAPIServer(const QString& host, uint16_t port, WebAPIRequestMapp
 {
     m_settings.host = host;
     m_settings.port = port;
+    // connections are served by a small fixed pool of event driven threads instead of one thread per connection
+    m_settings.workerThreads = 2;
+    m_settings.maxConnections = 256;
+    m_settings.maxRequestSize = 65536;
 }
 
 WebAPIServer::~WebAPIServer()
@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_ALLOCATIONCOUNTER_H_
+#define SDRBENCH_ALLOCATIONCOUNTER_H_
+
+#include <stdint.h>
+
+#include "util/export.h"
+
+/**
+ * Counts the heap allocations of the whole process (all threads) so that a benchmark can
+ * check that a processing path does not allocate once it runs. With glibc malloc, calloc
+ * and realloc are interposed by the sdrbench library and forward to the glibc implementation.
+ * Elsewhere nothing is counted and isAvailable() returns false.
+ */
+class SDRANGEL_API AllocationCounter
+{
+public:
+    static bool isAvailable();
+    static void reset();
+    static uint64_t getCount();  //!< number of allocations since the last reset
+    static uint64_t getBytes();  //!< bytes requested since the last reset
+};
+
+#endif /* SDRBENCH_ALLOCATIONCOUNTER_H_ */
@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "loggerwithfile.h"
+#include "mainbench.h"
+
+MainBench *MainBench::m_instance = 0;
+
+MainBench::MainBench(qtwebapp::LoggerWithFile *logger, const ParserBench& parser, QObject *parent) :
+    QObject(parent),
+    m_logger(logger),
+    m_parser(parser)
+{
+    qDebug() << "MainBench::MainBench: start";
+    m_instance = this;
+    qDebug() << "MainBench::MainBench: end";
+}
+
+MainBench::~MainBench()
+{}
+
+void MainBench::run()
+{
+    qDebug() << "MainBench::run: parameters:"
+        << " test: " << m_parser.getTestType()
+        << " nbItems: " << m_parser.getNbItems()
+        << " repetition: " << m_parser.getRepetition()
+        << " threads: " << m_parser.getNbThreads();
+
+    if (m_parser.getTestType() == ParserBench::TestMessage) {
+        testMessage();
+    } else if (m_parser.getTestType() == ParserBench::TestHalfband) {
+        testHalfband();
+    } else if (m_parser.getTestType() == ParserBench::TestFloat) {
+        testFloat();
+    } else if (m_parser.getTestType() == ParserBench::TestSerializer) {
+        testSerializer();
+    } else if (m_parser.getTestType() == ParserBench::TestExecutor) {
+        testExecutor();
+    } else if (m_parser.getTestType() == ParserBench::TestPipeline) {
+        testPipeline();
+    } else if (m_parser.getTestType() == ParserBench::TestPlugins) {
+        testPlugins();
+    } else {
+        qDebug() << "MainBench::run: unimplemented test";
+    }
+
+    emit finished();
+}
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QCommandLineOption>
+#include <QDebug>
+
+#include "parserbench.h"
+
+ParserBench::ParserBench() :
+    m_testOption(QStringList() << "t" << "test",
+        "Test type: message, halfband, float, serializer, executor, pipeline, plugins.",
+        "test",
+        "message"),
+    m_nbItemsOption(QStringList() << "n" << "nb-items",
+        "Number of items (samples, messages...) processed per run.",
+        "items",
+        "1000000"),
+    m_repetitionOption(QStringList() << "r" << "repeat",
+        "Number of runs.",
+        "repetition",
+        "1"),
+    m_nbThreadsOption(QStringList() << "T" << "threads",
+        "Number of concurrent threads when relevant (e.g. message producers).",
+        "threads",
+        "2"),
+    m_fileOption(QStringList() << "f" << "file",
+        "Pipeline: .sdriq file to play instead of the synthetic signal.",
+        "file",
+        ""),
+    m_channelsOption(QStringList() << "c" << "channels",
+        "Pipeline: comma separated list of Rx channel ids (e.g. NFMDemod,AMDemod).",
+        "channels",
+        "NFMDemod"),
+    m_sampleRateOption(QStringList() << "s" << "sample-rate",
+        "Pipeline: sample rate of the synthetic signal in S/s.",
+        "rate",
+        "2000000")
+{
+    m_testType = TestMessage;
+    m_nbItems = 1000000;
+    m_repetition = 1;
+    m_nbThreads = 2;
+    m_channelIds << "NFMDemod";
+    m_sampleRate = 2000000;
+
+    m_parser.setApplicationDescription("Software Defined Radio application benchmarks");
+    m_parser.addHelpOption();
+    m_parser.addVersionOption();
+
+    m_parser.addOption(m_testOption);
+    m_parser.addOption(m_nbItemsOption);
+    m_parser.addOption(m_repetitionOption);
+    m_parser.addOption(m_nbThreadsOption);
+    m_parser.addOption(m_fileOption);
+    m_parser.addOption(m_channelsOption);
+    m_parser.addOption(m_sampleRateOption);
+}
+
+ParserBench::~ParserBench()
+{ }
+
+void ParserBench::parse(const QCoreApplication& app)
+{
+    m_parser.process(app);
+
+    bool ok;
+
+    // test type
+
+    QString test = m_parser.value(m_testOption);
+
+    if (test == "message") {
+        m_testType = TestMessage;
+    } else if (test == "halfband") {
+        m_testType = TestHalfband;
+    } else if (test == "float") {
+        m_testType = TestFloat;
+    } else if (test == "serializer") {
+        m_testType = TestSerializer;
+    } else if (test == "executor") {
+        m_testType = TestExecutor;
+    } else if (test == "pipeline") {
+        m_testType = TestPipeline;
+    } else if (test == "plugins") {
+        m_testType = TestPlugins;
+    } else {
+        qWarning() << "ParserBench::parse: unknown test type. Defaulting to message";
+    }
+
+    // number of items
+
+    QString nbItemsStr = m_parser.value(m_nbItemsOption);
+    int nbItems = nbItemsStr.toInt(&ok);
+
+    if (ok && (nbItems > 0)) {
+        m_nbItems = nbItems;
+    } else {
+        qWarning() << "ParserBench::parse: number of items invalid. Defaulting to " << m_nbItems;
+    }
+
+    // repetition
+
+    QString repetitionStr = m_parser.value(m_repetitionOption);
+    int repetition = repetitionStr.toInt(&ok);
+
+    if (ok && (repetition > 0)) {
+        m_repetition = repetition;
+    } else {
+        qWarning() << "ParserBench::parse: repetition invalid. Defaulting to " << m_repetition;
+    }
+
+    // threads
+
+    QString nbThreadsStr = m_parser.value(m_nbThreadsOption);
+    int nbThreads = nbThreadsStr.toInt(&ok);
+
+    if (ok && (nbThreads > 0) && (nbThreads <= 64)) {
+        m_nbThreads = nbThreads;
+    } else {
+        qWarning() << "ParserBench::parse: number of threads invalid. Defaulting to " << m_nbThreads;
+    }
+
+    // pipeline source file
+
+    m_fileName = m_parser.value(m_fileOption);
+
+    // pipeline channels
+
+    QStringList channelIds = m_parser.value(m_channelsOption).split(",", QString::SkipEmptyParts);
+
+    if (channelIds.size() > 0) {
+        m_channelIds = channelIds;
+    } else {
+        qWarning() << "ParserBench::parse: channel list empty. Defaulting to " << m_channelIds;
+    }
+
+    // pipeline synthetic signal sample rate
+
+    QString sampleRateStr = m_parser.value(m_sampleRateOption);
+    int sampleRate = sampleRateStr.toInt(&ok);
+
+    if (ok && (sampleRate >= 48000)) {
+        m_sampleRate = sampleRate;
+    } else {
+        qWarning() << "ParserBench::parse: sample rate invalid. Defaulting to " << m_sampleRate;
+    }
+}
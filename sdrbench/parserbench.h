@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_PARSERBENCH_H_
+#define SDRBENCH_PARSERBENCH_H_
+
+#include <QCommandLineParser>
+#include <stdint.h>
+
+#include "util/export.h"
+
+class SDRANGEL_API ParserBench
+{
+public:
+    typedef enum
+    {
+        TestMessage,
+        TestHalfband,
+        TestFloat,
+        TestSerializer,
+        TestExecutor,
+        TestPipeline,
+        TestPlugins
+    } TestType;
+
+    ParserBench();
+    ~ParserBench();
+
+    void parse(const QCoreApplication& app);
+
+    TestType getTestType() const { return m_testType; }
+    uint32_t getNbItems() const { return m_nbItems; }
+    uint32_t getRepetition() const { return m_repetition; }
+    uint32_t getNbThreads() const { return m_nbThreads; }
+    const QString& getFileName() const { return m_fileName; }
+    const QStringList& getChannelIds() const { return m_channelIds; }
+    uint32_t getSampleRate() const { return m_sampleRate; }
+
+private:
+    TestType m_testType;
+    uint32_t m_nbItems;
+    uint32_t m_repetition;
+    uint32_t m_nbThreads;
+    QString m_fileName;       //!< .sdriq file played by the pipeline test. Synthetic signal if empty.
+    QStringList m_channelIds; //!< Rx channels attached by the pipeline test
+    uint32_t m_sampleRate;    //!< Sample rate of the synthetic signal
+
+    QCommandLineParser m_parser;
+    QCommandLineOption m_testOption;
+    QCommandLineOption m_nbItemsOption;
+    QCommandLineOption m_repetitionOption;
+    QCommandLineOption m_nbThreadsOption;
+    QCommandLineOption m_fileOption;
+    QCommandLineOption m_channelsOption;
+    QCommandLineOption m_sampleRateOption;
+};
+
+#endif /* SDRBENCH_PARSERBENCH_H_ */
@@ -0,0 +1,221 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <vector>
+#include <algorithm>
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <QAtomicInt>
+#include <QDebug>
+
+#include "dsp/dsptypes.h"
+#include "dsp/lowpass.h"
+#include "dsp/nco.h"
+#include "dsp/dspexecutor.h"
+#include "dsp/threadedbasebandsamplesink.h"
+#include "mainbench.h"
+
+namespace {
+
+const int blockSize = 4096; //!< samples written by the device engine at a time
+
+/** Stands for a channel: frequency shift and low pass filter. Measures the delay between the write and the processing. */
+class BenchSink : public BasebandSampleSink
+{
+public:
+    BenchSink(const QElapsedTimer *timer) :
+        m_timer(timer),
+        m_writeTime(-1),
+        m_processed(0),
+        m_sum(0.0f, 0.0f)
+    {
+        m_nco.setFreq(12500.0, 384000.0);
+        m_lowpass.create(33, 384000.0, 10000.0);
+    }
+
+    virtual void start() {}
+    virtual void stop() {}
+    virtual bool handleMessage(const Message& cmd __attribute__((unused))) { return false; }
+
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly __attribute__((unused)))
+    {
+        int writeTime = m_writeTime.fetchAndStoreOrdered(-1);
+
+        if (writeTime >= 0) {
+            m_latencies.push_back(m_timer->nsecsElapsed() / 1000 - writeTime);
+        }
+
+        for (SampleVector::const_iterator it = begin; it != end; ++it)
+        {
+            Complex c(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
+            m_sum += m_lowpass.filter(c * m_nco.nextIQ());
+        }
+
+        m_processed.fetchAndAddRelaxed(end - begin);
+    }
+
+    /** Called by the writer before writing, the first write not yet processed is timed */
+    void markWrite() { m_writeTime.testAndSetOrdered(-1, m_timer->nsecsElapsed() / 1000); }
+    int getProcessed() const { return m_processed.load(); }
+    std::vector<int>& getLatencies() { return m_latencies; } //!< us
+
+private:
+    const QElapsedTimer *m_timer;
+    QAtomicInt m_writeTime;   //!< us
+    QAtomicInt m_processed;
+    std::vector<int> m_latencies;
+    NCO m_nco;
+    Lowpass<Complex> m_lowpass;
+    Complex m_sum;
+};
+
+struct BenchResult
+{
+    int m_nbThreads;
+    double m_throughput;  //!< MS/s all channels
+    int m_latencyP50;     //!< us
+    int m_latencyP99;
+    int m_latencyMax;
+};
+
+/** Writes nbSamples in all channels like DSPDeviceSourceEngine does and waits until everything is processed */
+void runChannels(DSPExecutor *executor, int nbChannels, int nbSamples, BenchResult& result)
+{
+    QElapsedTimer timer;
+    std::vector<BenchSink*> sinks;
+    std::vector<ThreadedBasebandSampleSinkFifo*> fifos;
+    std::vector<QThread*> threads;
+    SampleVector block(blockSize);
+
+    for (int i = 0; i < blockSize; i++) {
+        block[i] = Sample((i % 64) * 256 - 8192, (i % 50) * 300 - 7500);
+    }
+
+    timer.start();
+
+    for (int i = 0; i < nbChannels; i++)
+    {
+        sinks.push_back(new BenchSink(&timer));
+        fifos.push_back(new ThreadedBasebandSampleSinkFifo(sinks.back(), executor));
+
+        if (executor)
+        {
+            sinks.back()->moveToThread(fifos.back()->m_strand->getHomeThread());
+            fifos.back()->moveToThread(fifos.back()->m_strand->getHomeThread());
+        }
+        else
+        {
+            threads.push_back(new QThread());
+            sinks.back()->moveToThread(threads.back());
+            fifos.back()->moveToThread(threads.back());
+            threads.back()->start();
+        }
+    }
+
+    timer.restart();
+
+    for (int written = 0; written < nbSamples; written += blockSize)
+    {
+        for (int i = 0; i < nbChannels; i++)
+        {
+            // a device delivering samples as fast as the channels can process them
+            while (fifos[i]->m_sampleFifo.fill() > fifos[i]->m_sampleFifo.size() / 2) {
+                QThread::usleep(50);
+            }
+
+            SampleVector::const_iterator begin = block.begin();
+            SampleVector::const_iterator end = block.end();
+            sinks[i]->markWrite();
+            fifos[i]->writeToFifo(begin, end);
+        }
+    }
+
+    int nbWritten = ((nbSamples + blockSize - 1) / blockSize) * blockSize;
+
+    for (int i = 0; i < nbChannels; i++)
+    {
+        while (sinks[i]->getProcessed() < nbWritten) {
+            QThread::usleep(50);
+        }
+    }
+
+    qint64 elapsedNs = timer.nsecsElapsed();
+    std::vector<int> latencies;
+
+    for (int i = 0; i < nbChannels; i++)
+    {
+        if (!executor)
+        {
+            threads[i]->exit();
+            threads[i]->wait();
+            delete threads[i];
+        }
+
+        delete fifos[i];
+        latencies.insert(latencies.end(), sinks[i]->getLatencies().begin(), sinks[i]->getLatencies().end());
+        delete sinks[i];
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    result.m_nbThreads = executor ? executor->getNbThreads() : nbChannels;
+    result.m_throughput = ((double) nbWritten * nbChannels) / (elapsedNs / 1e3);
+    result.m_latencyP50 = latencies.size() > 0 ? latencies[latencies.size() / 2] : 0;
+    result.m_latencyP99 = latencies.size() > 0 ? latencies[(latencies.size() * 99) / 100] : 0;
+    result.m_latencyMax = latencies.size() > 0 ? latencies.back() : 0;
+}
+
+void printResult(const char *name, const BenchResult& result)
+{
+    qInfo("MainBench::testExecutor: %-18s %3d threads: %8.2f MS/s latency: p50 %6d us p99 %6d us max %6d us",
+        name,
+        result.m_nbThreads,
+        result.m_throughput,
+        result.m_latencyP50,
+        result.m_latencyP99,
+        result.m_latencyMax);
+}
+
+} // namespace
+
+void MainBench::testExecutor()
+{
+    int nbChannels = m_parser.getNbThreads();
+    int nbSamples = m_parser.getNbItems();
+    DSPExecutor executor;
+    BenchResult result;
+
+    qInfo("MainBench::testExecutor: %d channels, %d samples per channel, %d CPU cores",
+        nbChannels, nbSamples, QThread::idealThreadCount());
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        runChannels(0, nbChannels, nbSamples, result);
+        printResult("thread per channel", result);
+        runChannels(&executor, nbChannels, nbSamples, result);
+        printResult("executor", result);
+    }
+
+    DSPExecutor::Stats stats;
+    executor.getStats(stats);
+    qInfo("MainBench::testExecutor: executor: %llu runs, %llu steals, queue to run delay: average %llu ns max %llu ns",
+        stats.m_nbRuns,
+        stats.m_nbSteals,
+        stats.m_nbRuns > 0 ? stats.m_latencySum / stats.m_nbRuns : 0,
+        stats.m_latencyMax);
+}
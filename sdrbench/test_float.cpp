@@ -0,0 +1,227 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include "dsp/dsptypes.h"
+#include "dsp/decimatorsf.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/inthalfbandfilterng.h"
+#include "dsp/inthalfbandfilterdbf.h"
+#include "mainbench.h"
+
+namespace {
+
+const int nbStages = 3;       //!< channelizer decimation by 8
+const int blockSize = 16384;  //!< complex samples delivered by the device at a time
+
+/** Device samples to channel samples through the fixed point baseband: the default path */
+class FixedChain
+{
+public:
+    FixedChain() :
+        m_fifo(4*blockSize),
+        m_deviceBuffer(blockSize),
+        m_channelBuffer(blockSize)
+    {}
+
+    double run(const float *buf, int nbSamples, std::vector<Complex>& out)
+    {
+        // device thread
+        SampleVector::iterator it = m_deviceBuffer.begin();
+        m_decimators.decimate1(&it, buf, 2*nbSamples);
+        m_fifo.write(m_deviceBuffer.begin(), it);
+
+        // DSP engine and channelizer
+        SampleVector::iterator part1Begin, part1End, part2Begin, part2End;
+        uint count = m_fifo.readBegin(m_fifo.fill(), &part1Begin, &part1End, &part2Begin, &part2End);
+        int nbChannel = work(&(*part1Begin), part1End - part1Begin, 0);
+
+        if (part2Begin != part2End) {
+            nbChannel = work(&(*part2Begin), part2End - part2Begin, nbChannel);
+        }
+
+        m_fifo.readCommit(count);
+        double power = 0.0;
+        Real scale = SDR_RX_SCALEF * (1<<nbStages);
+        out.resize(nbChannel);
+
+        // channel
+        for (int i = 0; i < nbChannel; i++)
+        {
+            out[i] = Complex(m_channelBuffer[i].real() / scale, m_channelBuffer[i].imag() / scale);
+            power += std::norm(out[i]);
+        }
+
+        return power;
+    }
+
+private:
+    DecimatorsF m_decimators;
+    SampleSinkFifo m_fifo;
+    SampleVector m_deviceBuffer;
+    SampleVector m_channelBuffer;
+    IntHalfbandFilterNG<qint32, 48> m_filters[nbStages];
+
+    int work(Sample *begin, int nbIn, int nbChannel)
+    {
+        std::copy(begin, begin + nbIn, &m_channelBuffer[nbChannel]);
+        Sample *samples = &m_channelBuffer[nbChannel];
+
+        for (int stage = 0; stage < nbStages; stage++) {
+            nbIn = m_filters[stage].decimateCenter(samples, samples, nbIn);
+        }
+
+        return nbChannel + nbIn;
+    }
+};
+
+/** Device samples to channel samples through the floating point baseband */
+class FloatChain
+{
+public:
+    FloatChain() :
+        m_fifo(4*blockSize),
+        m_deviceBuffer(blockSize)
+    {
+        m_fifo.setFloat(true);
+        m_channelBuffer.reserve(blockSize);
+    }
+
+    double run(const float *buf, int nbSamples, std::vector<Complex>& out)
+    {
+        // device thread
+        FSampleVector::iterator it = m_deviceBuffer.begin();
+        m_decimators.decimate1(&it, buf, 2*nbSamples);
+        m_fifo.write(m_deviceBuffer.begin(), it);
+
+        // DSP engine and channelizer
+        FSampleVector::iterator part1Begin, part1End, part2Begin, part2End;
+        uint count = m_fifo.readBegin(m_fifo.fill(), &part1Begin, &part1End, &part2Begin, &part2End);
+        m_channelBuffer.clear();
+        work(part1Begin, part1End);
+        work(part2Begin, part2End);
+        m_fifo.readCommit(count);
+        double power = 0.0;
+        out.resize(m_channelBuffer.size());
+
+        // channel
+        for (unsigned int i = 0; i < m_channelBuffer.size(); i++)
+        {
+            out[i] = Complex(m_channelBuffer[i].real(), m_channelBuffer[i].imag());
+            power += std::norm(out[i]);
+        }
+
+        return power;
+    }
+
+private:
+    DecimatorsF m_decimators;
+    SampleSinkFifo m_fifo;
+    FSampleVector m_deviceBuffer;
+    FSampleVector m_channelBuffer;
+    IntHalfbandFilterDBF<double, float, 48> m_filters[nbStages];
+
+    void work(FSampleVector::iterator begin, FSampleVector::iterator end)
+    {
+        for (FSampleVector::iterator it = begin; it != end; ++it)
+        {
+            FSample s = *it;
+            int stage = 0;
+
+            while ((stage < nbStages) && m_filters[stage].workDecimateCenter(&s)) {
+                stage++;
+            }
+
+            if (stage == nbStages) {
+                m_channelBuffer.push_back(s);
+            }
+        }
+    }
+};
+
+template<class Chain>
+void benchChain(const char *name, const std::vector<float>& buf, uint32_t repetition, std::vector<Complex>& out)
+{
+    Chain chain;
+    QElapsedTimer timer;
+    qint64 elapsedNs = 0;
+    double power = 0.0;
+    int nbSamples = buf.size() / 2;
+    std::vector<Complex> block;
+    out.clear();
+
+    for (uint32_t r = 0; r < repetition; r++)
+    {
+        timer.start();
+
+        for (int i = 0; i < nbSamples; i += blockSize)
+        {
+            power += chain.run(&buf[2*i], std::min(blockSize, nbSamples - i), block);
+
+            if (r == 0) {
+                out.insert(out.end(), block.begin(), block.end());
+            }
+        }
+
+        elapsedNs += timer.nsecsElapsed();
+    }
+
+    qInfo("MainBench::testFloat: %-16s %7.1f MS/s (power %.6f)",
+        name,
+        ((double) nbSamples * repetition * 1e3) / elapsedNs,
+        power);
+}
+
+} // namespace
+
+void MainBench::testFloat()
+{
+    // AirspyHF-like input: a weak tone in the channel over low level noise, full scale 1.0
+    std::vector<float> buf(2*m_parser.getNbItems());
+
+    for (unsigned int i = 0; i < buf.size() / 2; i++)
+    {
+        double phi = 2.0 * M_PI * 0.01 * i;
+        buf[2*i]   = 1e-3 * cos(phi) + 1e-4 * ((qrand() % 2048) - 1024) / 1024.0;
+        buf[2*i+1] = 1e-3 * sin(phi) + 1e-4 * ((qrand() % 2048) - 1024) / 1024.0;
+    }
+
+    qInfo("MainBench::testFloat: device to channel decimation by %d:", 1<<nbStages);
+    std::vector<Complex> fixedOut, floatOut;
+    benchChain<FixedChain>("fixed point", buf, m_parser.getRepetition(), fixedOut);
+    benchChain<FloatChain>("floating point", buf, m_parser.getRepetition(), floatOut);
+
+    // the float path is the reference. Both filters have the same delay.
+    unsigned int nb = std::min(fixedOut.size(), floatOut.size());
+    double signal = 0.0, error = 0.0;
+
+    for (unsigned int i = 0; i < nb; i++)
+    {
+        signal += std::norm(floatOut[i]);
+        error += std::norm(fixedOut[i] - floatOut[i]);
+    }
+
+    if (error > 0.0) {
+        qInfo("MainBench::testFloat: fixed point path SNR relative to floating point: %.1f dB", 10.0 * log10(signal / error));
+    }
+}
@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+#include <vector>
+#include <algorithm>
+
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include "dsp/inthalfbandfilter.h"
+#include "dsp/inthalfbandfilterdb.h"
+#include "dsp/inthalfbandfilterdbf.h"
+#include "dsp/inthalfbandfiltereo1.h"
+#include "dsp/inthalfbandfilterst.h"
+#include "dsp/inthalfbandfilterng.h"
+#include "mainbench.h"
+
+namespace {
+
+/** IntHalfbandFilterDBF is only used through its floating point pair API (DecimatorsF) */
+template<uint32_t HBFilterOrder>
+class DBFAdapter
+{
+public:
+    DBFAdapter() : m_state(0), m_x1(0.0), m_y1(0.0) {}
+
+    bool workDecimateCenter(Sample* sample)
+    {
+        if (m_state == 0)
+        {
+            m_x1 = sample->real();
+            m_y1 = sample->imag();
+            m_state = 1;
+            return false;
+        }
+
+        double x2 = sample->real();
+        double y2 = sample->imag();
+        m_filter.myDecimate(m_x1, m_y1, &x2, &y2);
+        sample->setReal((FixReal) x2);
+        sample->setImag((FixReal) y2);
+        m_state = 0;
+        return true;
+    }
+
+private:
+    IntHalfbandFilterDBF<double, float, HBFilterOrder> m_filter;
+    int m_state;
+    double m_x1;
+    double m_y1;
+};
+
+/** Complex tone at frequency f (fraction of the sample rate) */
+void generateTone(std::vector<Sample>& samples, double f, double amplitude)
+{
+    for (unsigned int i = 0; i < samples.size(); i++)
+    {
+        samples[i].setReal((FixReal) (amplitude * cos(2.0 * M_PI * f * i)));
+        samples[i].setImag((FixReal) (amplitude * sin(2.0 * M_PI * f * i)));
+    }
+}
+
+/** Mean power of the decimated output of a tone once the filter has settled */
+template<class Filter>
+double decimatedPower(const std::vector<Sample>& samples)
+{
+    Filter filter;
+    double power = 0.0;
+    int nbOut = 0;
+
+    for (unsigned int i = 0; i < samples.size(); i++)
+    {
+        Sample s = samples[i];
+
+        if (filter.workDecimateCenter(&s) && (i > 512))
+        {
+            power += (double) s.real() * s.real() + (double) s.imag() * s.imag();
+            nbOut++;
+        }
+    }
+
+    return nbOut == 0 ? 0.0 : power / nbOut;
+}
+
+/** Worst attenuation of tones in the stop band [0.3, 0.5] on both sides relative to a tone in the pass band */
+template<class Filter>
+double stopbandAttenuation()
+{
+    std::vector<Sample> samples(8192);
+    generateTone(samples, 0.05, 16384.0);
+    double passbandPower = decimatedPower<Filter>(samples);
+    double maxStopbandPower = 1e-9;
+
+    for (int i = 30; i <= 50; i++)
+    {
+        generateTone(samples, i / 100.0, 16384.0);
+        maxStopbandPower = std::max(maxStopbandPower, decimatedPower<Filter>(samples));
+        generateTone(samples, -i / 100.0, 16384.0);
+        maxStopbandPower = std::max(maxStopbandPower, decimatedPower<Filter>(samples));
+    }
+
+    return 10.0 * log10(passbandPower / maxStopbandPower);
+}
+
+template<class Filter>
+void benchDecimator(const char *name, const std::vector<Sample>& noise, uint32_t repetition)
+{
+    Filter filter;
+    QElapsedTimer timer;
+    qint64 checksum = 0;
+    qint64 elapsedNs = 0;
+
+    for (uint32_t r = 0; r < repetition; r++)
+    {
+        timer.start();
+
+        for (unsigned int i = 0; i < noise.size(); i++)
+        {
+            Sample s = noise[i];
+
+            if (filter.workDecimateCenter(&s)) {
+                checksum += s.real();
+            }
+        }
+
+        elapsedNs += timer.nsecsElapsed();
+    }
+
+    qInfo("MainBench::testHalfband: %-28s %7.1f MS/s stop band %5.1f dB (checksum %lld)",
+        name,
+        ((double) noise.size() * repetition * 1e3) / elapsedNs,
+        stopbandAttenuation<Filter>(),
+        checksum);
+}
+
+template<uint32_t HBFilterOrder>
+void benchNG(const std::vector<Sample>& noise, uint32_t repetition)
+{
+    HBFilterKernels::ISA defaultISA = HBFilterKernels::getISA();
+    HBFilterKernels::ISA isas[3] = {HBFilterKernels::ISAGeneric, HBFilterKernels::ISASSE41, HBFilterKernels::ISAAVX2};
+
+    for (int i = 0; i < 3; i++)
+    {
+        if (!HBFilterKernels::setISA(isas[i])) {
+            continue;
+        }
+
+        QByteArray name = QByteArray("IntHalfbandFilterNG ") + HBFilterKernels::getISAName(isas[i]);
+        benchDecimator<IntHalfbandFilterNG<qint32, HBFilterOrder> >(name.constData(), noise, repetition);
+    }
+
+    // block API with the best kernel, in chunks of the size the DSP engine typically delivers
+    const unsigned int chunkSize = 4096;
+    HBFilterKernels::setISA(defaultISA);
+    IntHalfbandFilterNG<qint32, HBFilterOrder> filter;
+    std::vector<Sample> buffer(noise.size());
+    QElapsedTimer timer;
+    qint64 elapsedNs = 0;
+
+    for (uint32_t r = 0; r < repetition; r++)
+    {
+        timer.start();
+
+        for (unsigned int i = 0; i < noise.size(); i += chunkSize) {
+            filter.decimateCenter(&noise[i], &buffer[i/2], std::min(chunkSize, (unsigned int) noise.size() - i));
+        }
+
+        elapsedNs += timer.nsecsElapsed();
+    }
+
+    qInfo("MainBench::testHalfband: %-28s %7.1f MS/s",
+        "IntHalfbandFilterNG block",
+        ((double) noise.size() * repetition * 1e3) / elapsedNs);
+}
+
+template<uint32_t HBFilterOrder>
+void benchOrder(const std::vector<Sample>& noise, uint32_t repetition)
+{
+    qInfo("MainBench::testHalfband: decimation by 2 order %u:", HBFilterOrder);
+    benchDecimator<IntHalfbandFilter<qint32, HBFilterOrder> >("IntHalfbandFilter", noise, repetition);
+    benchDecimator<IntHalfbandFilterDB<qint32, HBFilterOrder> >("IntHalfbandFilterDB", noise, repetition);
+    benchDecimator<DBFAdapter<HBFilterOrder> >("IntHalfbandFilterDBF (float)", noise, repetition);
+    benchDecimator<IntHalfbandFilterEO1<HBFilterOrder> >("IntHalfbandFilterEO1", noise, repetition);
+    benchDecimator<IntHalfbandFilterST<HBFilterOrder> >("IntHalfbandFilterST", noise, repetition);
+    benchNG<HBFilterOrder>(noise, repetition);
+}
+
+} // namespace
+
+void MainBench::testHalfband()
+{
+    std::vector<Sample> noise(m_parser.getNbItems());
+
+    for (unsigned int i = 0; i < noise.size(); i++)
+    {
+        noise[i].setReal((FixReal) ((qrand() % 32768) - 16384));
+        noise[i].setImag((FixReal) ((qrand() % 32768) - 16384));
+    }
+
+#ifdef USE_SSE4_1
+    qInfo("MainBench::testHalfband: built with SSE4.1 (IntHalfbandFilterEO1 and ST use it)");
+#endif
+
+    // orders of the DownChannelizer and the UpChannelizer
+    benchOrder<48>(noise, m_parser.getRepetition());
+    benchOrder<96>(noise, m_parser.getRepetition());
+}
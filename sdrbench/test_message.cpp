@@ -0,0 +1,277 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <vector>
+
+#include <QElapsedTimer>
+#include <QThread>
+#include <QDebug>
+
+#include "util/message.h"
+#include "util/messagequeue.h"
+#include "util/messagedispatcher.h"
+#include "mainbench.h"
+
+namespace {
+
+#define BENCH_MESSAGE_CLASS(Name) \
+    class Name : public Message { \
+        MESSAGE_CLASS_DECLARATION \
+    public: \
+        Name() : Message(), m_timestamp(0) {} \
+        qint64 m_timestamp; \
+    };
+
+BENCH_MESSAGE_CLASS(MsgBench0)
+BENCH_MESSAGE_CLASS(MsgBench1)
+BENCH_MESSAGE_CLASS(MsgBench2)
+BENCH_MESSAGE_CLASS(MsgBench3)
+BENCH_MESSAGE_CLASS(MsgBench4)
+BENCH_MESSAGE_CLASS(MsgBench5)
+BENCH_MESSAGE_CLASS(MsgBench6)
+BENCH_MESSAGE_CLASS(MsgBench7)
+
+MESSAGE_CLASS_DEFINITION(MsgBench0, Message)
+MESSAGE_CLASS_DEFINITION(MsgBench1, Message)
+MESSAGE_CLASS_DEFINITION(MsgBench2, Message)
+MESSAGE_CLASS_DEFINITION(MsgBench3, Message)
+MESSAGE_CLASS_DEFINITION(MsgBench4, Message)
+MESSAGE_CLASS_DEFINITION(MsgBench5, Message)
+MESSAGE_CLASS_DEFINITION(MsgBench6, Message)
+MESSAGE_CLASS_DEFINITION(MsgBench7, Message)
+
+/** Handles the 8 message types the way handleMessage methods do: chained match() or dispatch table */
+class BenchHandler
+{
+public:
+    BenchHandler() : m_count(0) {}
+
+    bool handleMessageChained(const Message& cmd)
+    {
+        if (MsgBench0::match(cmd)) {
+            return handle0(cmd);
+        } else if (MsgBench1::match(cmd)) {
+            return handle1(cmd);
+        } else if (MsgBench2::match(cmd)) {
+            return handle2(cmd);
+        } else if (MsgBench3::match(cmd)) {
+            return handle3(cmd);
+        } else if (MsgBench4::match(cmd)) {
+            return handle4(cmd);
+        } else if (MsgBench5::match(cmd)) {
+            return handle5(cmd);
+        } else if (MsgBench6::match(cmd)) {
+            return handle6(cmd);
+        } else if (MsgBench7::match(cmd)) {
+            return handle7(cmd);
+        } else {
+            return false;
+        }
+    }
+
+    bool handleMessageDispatched(const Message& cmd)
+    {
+        static const MessageDispatcher<BenchHandler> dispatcher = MessageDispatcher<BenchHandler>()
+            .add<MsgBench0>(&BenchHandler::handle0)
+            .add<MsgBench1>(&BenchHandler::handle1)
+            .add<MsgBench2>(&BenchHandler::handle2)
+            .add<MsgBench3>(&BenchHandler::handle3)
+            .add<MsgBench4>(&BenchHandler::handle4)
+            .add<MsgBench5>(&BenchHandler::handle5)
+            .add<MsgBench6>(&BenchHandler::handle6)
+            .add<MsgBench7>(&BenchHandler::handle7);
+
+        return dispatcher.dispatch(this, cmd);
+    }
+
+    qint64 m_count;
+
+private:
+    bool handle0(const Message&) { m_count += 0; return true; }
+    bool handle1(const Message&) { m_count += 1; return true; }
+    bool handle2(const Message&) { m_count += 2; return true; }
+    bool handle3(const Message&) { m_count += 3; return true; }
+    bool handle4(const Message&) { m_count += 4; return true; }
+    bool handle5(const Message&) { m_count += 5; return true; }
+    bool handle6(const Message&) { m_count += 6; return true; }
+    bool handle7(const Message&) { m_count += 7; return true; }
+};
+
+/** Pushes messages stamped with the push time as fast as possible */
+class MessageProducer : public QThread
+{
+public:
+    MessageProducer(MessageQueue *messageQueue, const QElapsedTimer *timer, uint32_t nbMessages) :
+        m_messageQueue(messageQueue),
+        m_timer(timer),
+        m_nbMessages(nbMessages)
+    {}
+
+protected:
+    void run()
+    {
+        for (uint32_t i = 0; i < m_nbMessages; i++)
+        {
+            MsgBench0 *message = new MsgBench0();
+            message->m_timestamp = m_timer->nsecsElapsed();
+            m_messageQueue->push(message, false);
+        }
+    }
+
+private:
+    MessageQueue *m_messageQueue;
+    const QElapsedTimer *m_timer;
+    uint32_t m_nbMessages;
+};
+
+} // namespace
+
+void MainBench::testMessage()
+{
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        testMessageDispatch();
+        testMessageAllocation();
+        testMessageQueue();
+    }
+}
+
+void MainBench::testMessageDispatch()
+{
+    Message *messages[8] = {
+        new MsgBench0(), new MsgBench1(), new MsgBench2(), new MsgBench3(),
+        new MsgBench4(), new MsgBench5(), new MsgBench6(), new MsgBench7()
+    };
+    BenchHandler handler;
+    QElapsedTimer timer;
+    uint32_t nbItems = m_parser.getNbItems();
+
+    timer.start();
+
+    for (uint32_t i = 0; i < nbItems; i++) {
+        handler.handleMessageChained(*messages[i & 7]);
+    }
+
+    qint64 chainedNs = timer.nsecsElapsed();
+    timer.restart();
+
+    for (uint32_t i = 0; i < nbItems; i++) {
+        handler.handleMessageDispatched(*messages[i & 7]);
+    }
+
+    qint64 dispatchedNs = timer.nsecsElapsed();
+
+    qInfo("MainBench::testMessageDispatch: 8 message types: chained match: %.1f ns/message dispatch table: %.1f ns/message (checksum %lld)",
+        (double) chainedNs / nbItems,
+        (double) dispatchedNs / nbItems,
+        handler.m_count);
+
+    for (int i = 0; i < 8; i++) {
+        delete messages[i];
+    }
+}
+
+void MainBench::testMessageAllocation()
+{
+    QElapsedTimer timer;
+    uint32_t nbItems = m_parser.getNbItems();
+    std::vector<Message*> messages(64);
+
+    // messages are usually created in bursts then deleted by the consumer
+    timer.start();
+
+    for (uint32_t i = 0; i < nbItems; i += 64)
+    {
+        for (int j = 0; j < 64; j++) {
+            messages[j] = new MsgBench0();
+        }
+        for (int j = 0; j < 64; j++) {
+            delete messages[j];
+        }
+    }
+
+    qint64 pooledNs = timer.nsecsElapsed();
+    timer.restart();
+
+    for (uint32_t i = 0; i < nbItems; i += 64)
+    {
+        for (int j = 0; j < 64; j++) {
+            messages[j] = ::new MsgBench0();
+        }
+        for (int j = 0; j < 64; j++) {
+            ::delete messages[j];
+        }
+    }
+
+    qint64 heapNs = timer.nsecsElapsed();
+
+    qInfo("MainBench::testMessageAllocation: new+delete: pool: %.1f ns/message heap: %.1f ns/message",
+        (double) pooledNs / nbItems,
+        (double) heapNs / nbItems);
+}
+
+void MainBench::testMessageQueue()
+{
+    MessageQueue messageQueue;
+    QElapsedTimer timer;
+    uint32_t nbThreads = m_parser.getNbThreads();
+    uint32_t nbPerThread = std::max(1u, m_parser.getNbItems() / nbThreads);
+    uint32_t nbTotal = nbPerThread * nbThreads;
+    std::vector<MessageProducer*> producers;
+    std::vector<qint64> latencies;
+    latencies.reserve(nbTotal);
+
+    for (uint32_t i = 0; i < nbThreads; i++) {
+        producers.push_back(new MessageProducer(&messageQueue, &timer, nbPerThread));
+    }
+
+    timer.start();
+
+    for (uint32_t i = 0; i < nbThreads; i++) {
+        producers[i]->start();
+    }
+
+    // single consumer as in the DSP threads
+    while (latencies.size() < nbTotal)
+    {
+        Message *message = messageQueue.pop();
+
+        if (message)
+        {
+            latencies.push_back(timer.nsecsElapsed() - ((MsgBench0*) message)->m_timestamp);
+            delete message;
+        }
+    }
+
+    qint64 elapsedNs = timer.nsecsElapsed();
+
+    for (uint32_t i = 0; i < nbThreads; i++)
+    {
+        producers[i]->wait();
+        delete producers[i];
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    qInfo("MainBench::testMessageQueue: %u producers: %.0f messages/s latency: p50 %lld ns p99 %lld ns max %lld ns",
+        nbThreads,
+        nbTotal / (elapsedNs / 1e9),
+        latencies[nbTotal / 2],
+        latencies[((quint64) nbTotal * 99) / 100],
+        latencies.back());
+}
@@ -0,0 +1,472 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <sys/resource.h>
+#include <stdint.h>
+#include <math.h>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QAtomicInt>
+#include <QDebug>
+
+#include "dsp/dsptypes.h"
+#include "dsp/dspcommands.h"
+#include "dsp/dspengine.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/filerecord.h"
+#include "device/devicesourceapi.h"
+#include "channel/channelsinkapi.h"
+#include "plugin/pluginmanager.h"
+#include "plugin/plugininterface.h"
+#include "allocationcounter.h"
+#include "mainbench.h"
+
+namespace {
+
+const int blockSize = 16384;              //!< samples written to the device FIFO at a time
+const int synthSize = 1<<16;              //!< period of the synthetic signal in samples
+const quint64 maxFileSamples = 1<<24;     //!< file samples loaded in memory, the rest is not played
+const qint64 stallTimeout = 5000;         //!< ms without progress before the run is abandoned
+
+/**
+ * Writes the samples to the device FIFO in a loop until the number of samples is reached.
+ * There is no pacing: the next block is written as soon as the device FIFO and the FIFOs of
+ * the channels are less than half full so that the pipeline runs as fast as its slowest
+ * channel without losing samples.
+ */
+class BenchSourceThread : public QThread
+{
+public:
+    BenchSourceThread(const SampleVector& samples, SampleSinkFifo *sampleFifo) :
+        m_samples(samples),
+        m_sampleFifo(sampleFifo),
+        m_engine(0),
+        m_nbSamples(0),
+        m_written(0),
+        m_running(0)
+    {}
+
+    void startWork(DSPDeviceSourceEngine *engine, quint64 nbSamples)
+    {
+        m_engine = engine;
+        m_nbSamples = nbSamples;
+        m_written = 0;
+        m_running.storeRelease(1);
+        start();
+    }
+
+    void stopWork()
+    {
+        m_running.storeRelease(0);
+        wait();
+    }
+
+private:
+    const SampleVector& m_samples;
+    SampleSinkFifo *m_sampleFifo;
+    DSPDeviceSourceEngine *m_engine;
+    quint64 m_nbSamples;
+    quint64 m_written;
+    QAtomicInt m_running;
+    std::vector<ThreadedBasebandSampleSink::Report> m_reports;
+
+    bool sinksReady()
+    {
+        m_engine->getThreadedSinksReports(m_reports); // no allocation once the vector has grown
+
+        for (std::vector<ThreadedBasebandSampleSink::Report>::const_iterator it = m_reports.begin(); it != m_reports.end(); ++it)
+        {
+            if (it->m_fifoFill > it->m_fifoSize / 2) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    virtual void run()
+    {
+        std::size_t pos = 0;
+
+        while (m_running.loadAcquire() && (m_written < m_nbSamples))
+        {
+            if ((m_sampleFifo->fill() + blockSize > m_sampleFifo->size() / 2) || !sinksReady())
+            {
+                QThread::usleep(50);
+                continue;
+            }
+
+            std::size_t count = std::min((quint64) blockSize, m_nbSamples - m_written);
+            count = std::min(count, m_samples.size() - pos);
+            m_sampleFifo->write(m_samples.begin() + pos, m_samples.begin() + pos + count);
+            pos = (pos + count) % m_samples.size();
+            m_written += count;
+        }
+    }
+};
+
+/** Device plays the samples given by the benchmark */
+class BenchSampleSource : public DeviceSampleSource
+{
+public:
+    BenchSampleSource(DeviceSourceAPI *deviceAPI, const SampleVector& samples, int sampleRate, quint64 centerFrequency, quint64 nbSamples) :
+        m_deviceAPI(deviceAPI),
+        m_deviceDescription("Benchmark source"),
+        m_sampleRate(sampleRate),
+        m_centerFrequency(centerFrequency),
+        m_nbSamples(nbSamples),
+        m_thread(samples, &m_sampleFifo)
+    {
+        m_sampleFifo.setSize(8*blockSize);
+    }
+
+    virtual void destroy() { delete this; }
+    virtual void init() {}
+
+    virtual bool start()
+    {
+        DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+        m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+        m_thread.startWork(m_deviceAPI->getDeviceSourceEngine(), m_nbSamples);
+        return true;
+    }
+
+    virtual void stop() { m_thread.stopWork(); }
+
+    virtual QByteArray serialize() const { return QByteArray(); }
+    virtual bool deserialize(const QByteArray& data __attribute__((unused))) { return false; }
+    virtual const QString& getDeviceDescription() const { return m_deviceDescription; }
+    virtual int getSampleRate() const { return m_sampleRate; }
+    virtual quint64 getCenterFrequency() const { return m_centerFrequency; }
+    virtual void setCenterFrequency(qint64 centerFrequency __attribute__((unused))) {}
+    virtual bool handleMessage(const Message& message __attribute__((unused))) { return false; }
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+
+private:
+    DeviceSourceAPI *m_deviceAPI;
+    QString m_deviceDescription;
+    int m_sampleRate;
+    quint64 m_centerFrequency;
+    quint64 m_nbSamples;
+    BenchSourceThread m_thread;
+};
+
+/** Two tones and some noise, one period of synthSize samples */
+void generateSamples(SampleVector& samples)
+{
+    samples.resize(synthSize);
+    uint32_t seed = 1;
+
+    for (int i = 0; i < synthSize; i++)
+    {
+        double phase1 = (2.0 * M_PI * 1638 * i) / synthSize;  // about Fs/40
+        double phase2 = (-2.0 * M_PI * 9362 * i) / synthSize; // about -Fs/7
+        seed = seed * 1664525 + 1013904223;
+        double noiseI = ((int) (seed >> 16) - 32768) / 32768.0;
+        seed = seed * 1664525 + 1013904223;
+        double noiseQ = ((int) (seed >> 16) - 32768) / 32768.0;
+        double re = 0.3 * cos(phase1) + 0.1 * cos(phase2) + 0.01 * noiseI;
+        double im = 0.3 * sin(phase1) + 0.1 * sin(phase2) + 0.01 * noiseQ;
+        samples[i].setReal(re * SDR_RX_SCALEF);
+        samples[i].setImag(im * SDR_RX_SCALEF);
+    }
+}
+
+/** Loads the beginning of a .sdriq file in memory converting to the DSP sample size */
+bool loadFile(const QString& fileName, quint64 nbSamples, SampleVector& samples, FileRecord::Header& header)
+{
+    std::ifstream ifs(qPrintable(fileName), std::ios::binary);
+
+    if (!ifs.is_open()) {
+        return false;
+    }
+
+    FileRecord::readHeader(ifs, header);
+
+    if (!ifs.good() || (header.sampleRate <= 0)) {
+        return false;
+    }
+
+    int componentBytes = header.sampleSize == 24 ? 4 : 2;
+    std::vector<char> buf(std::min(nbSamples, maxFileSamples) * 2 * componentBytes);
+    ifs.read(&buf[0], buf.size());
+    int count = ifs.gcount() / (2 * componentBytes);
+
+    if (count == 0) {
+        return false;
+    }
+
+    samples.resize(count);
+
+    if (componentBytes == 2)
+    {
+        const int16_t *fileBuf = (const int16_t *) &buf[0];
+
+        for (int is = 0; is < count; is++)
+        {
+            samples[is].setReal(SDR_RX_SAMP_SZ == 24 ? fileBuf[2*is] << 8 : fileBuf[2*is]);
+            samples[is].setImag(SDR_RX_SAMP_SZ == 24 ? fileBuf[2*is+1] << 8 : fileBuf[2*is+1]);
+        }
+    }
+    else
+    {
+        const int32_t *fileBuf = (const int32_t *) &buf[0];
+
+        for (int is = 0; is < count; is++)
+        {
+            samples[is].setReal(SDR_RX_SAMP_SZ == 16 ? fileBuf[2*is] >> 8 : fileBuf[2*is]);
+            samples[is].setImag(SDR_RX_SAMP_SZ == 16 ? fileBuf[2*is+1] >> 8 : fileBuf[2*is+1]);
+        }
+    }
+
+    return true;
+}
+
+qint64 cpuTimeMs(const struct timeval& tv)
+{
+    return tv.tv_sec * 1000LL + tv.tv_usec / 1000;
+}
+
+/** One run: the engine, the source and the channels are created and destroyed as in MainCore */
+void runPipeline(
+        uint32_t run,
+        const SampleVector& samples,
+        int sampleRate,
+        quint64 centerFrequency,
+        quint64 nbSamples,
+        const std::vector<PluginInterface*>& plugins)
+{
+    DSPEngine *dspEngine = DSPEngine::instance();
+    DSPDeviceSourceEngine *engine = dspEngine->addDeviceSourceEngine();
+    engine->start();
+    DeviceSourceAPI *deviceAPI = new DeviceSourceAPI(0, engine);
+    BenchSampleSource *source = new BenchSampleSource(deviceAPI, samples, sampleRate, centerFrequency, nbSamples);
+    deviceAPI->setSampleSource(source);
+    std::vector<ChannelSinkAPI*> channels;
+
+    for (std::vector<PluginInterface*>::const_iterator it = plugins.begin(); it != plugins.end(); ++it) {
+        channels.push_back((*it)->createRxChannelCS(deviceAPI));
+    }
+
+    std::vector<ThreadedBasebandSampleSink::Report> reports;
+    reports.reserve(2*plugins.size());
+    struct rusage usageStart, usageEnd;
+    getrusage(RUSAGE_SELF, &usageStart);
+    AllocationCounter::reset();
+    QElapsedTimer timer;
+    timer.start();
+
+    if (deviceAPI->initAcquisition() && deviceAPI->startAcquisition())
+    {
+        quint64 done = 0, lastDone = 0, steadyDone = 0;
+        qint64 lastProgressTime = 0;
+        uint64_t steadyCount = 0, steadyBytes = 0;
+        bool steady = false;
+
+        // the slowest channel tells when the run is complete
+        while (done < nbSamples)
+        {
+            QCoreApplication::processEvents(); // the channels handle their notifications in this thread
+            dspEngine->flushAudioSinks();      // there is no audio device to consume the audio
+            engine->getThreadedSinksReports(reports);
+            done = nbSamples;
+
+            if (reports.empty())
+            {
+                quint64 busyTime, runningTime;
+                engine->getBusyCounters(busyTime, runningTime, done);
+            }
+
+            for (std::vector<ThreadedBasebandSampleSink::Report>::const_iterator it = reports.begin(); it != reports.end(); ++it) {
+                done = std::min(done, it->m_processedSamples + it->m_fifoDroppedSamples);
+            }
+
+            // allocations of the set up are left out of the steady state
+            if (!steady && (done >= nbSamples / 10))
+            {
+                steady = true;
+                steadyDone = done;
+                steadyCount = AllocationCounter::getCount();
+                steadyBytes = AllocationCounter::getBytes();
+            }
+
+            if (done != lastDone)
+            {
+                lastDone = done;
+                lastProgressTime = timer.elapsed();
+            }
+            else if (timer.elapsed() - lastProgressTime > stallTimeout)
+            {
+                qWarning("MainBench::testPipeline: run %u: stalled at %llu samples", run, done);
+                break;
+            }
+
+            QThread::usleep(200);
+        }
+
+        qint64 elapsedNs = timer.nsecsElapsed();
+        uint64_t allocCount = AllocationCounter::getCount();
+        uint64_t allocBytes = AllocationCounter::getBytes();
+        getrusage(RUSAGE_SELF, &usageEnd);
+
+        quint64 busyTime, runningTime, processed;
+        engine->getBusyCounters(busyTime, runningTime, processed);
+        engine->getThreadedSinksReports(reports);
+
+        double elapsedS = elapsedNs / 1e9;
+        qint64 userMs = cpuTimeMs(usageEnd.ru_utime) - cpuTimeMs(usageStart.ru_utime);
+        qint64 systemMs = cpuTimeMs(usageEnd.ru_stime) - cpuTimeMs(usageStart.ru_stime);
+
+        qInfo("MainBench::testPipeline: run %u: %llu samples in %.1f ms: %.2f MS/s (%.1f x real time)",
+                run, done, elapsedNs / 1e6, done / (elapsedS * 1e6), done / (elapsedS * sampleRate));
+        qInfo("MainBench::testPipeline: run %u: CPU time user: %lld ms system: %lld ms (%.0f%% of one core) engine busy: %.1f%%",
+                run, userMs, systemMs, (userMs + systemMs) / (elapsedS * 10.0),
+                runningTime == 0 ? 0.0 : (busyTime * 100.0) / runningTime);
+
+        for (unsigned int i = 0; i < reports.size(); i++)
+        {
+            const ThreadedBasebandSampleSink::Report& report = reports[i];
+
+            // wall time: it includes the time the thread was preempted while feeding the sink
+            qInfo("MainBench::testPipeline: run %u: %s: feed wall time %.1f ms (%.1f%%) %.1f ns/sample, FIFO max fill: %u/%u dropped: %llu",
+                    run,
+                    qPrintable(report.m_name),
+                    report.m_processingTime / 1e6,
+                    report.m_processingTime / (elapsedNs / 100.0),
+                    report.m_processedSamples == 0 ? 0.0 : report.m_processingTime / (double) report.m_processedSamples,
+                    report.m_fifoMaxFill,
+                    report.m_fifoSize,
+                    report.m_fifoDroppedSamples);
+        }
+
+        if (!AllocationCounter::isAvailable())
+        {
+            qInfo("MainBench::testPipeline: run %u: allocations: not counted on this platform", run);
+        }
+        else if (steady && (done > steadyDone))
+        {
+            qInfo("MainBench::testPipeline: run %u: allocations: %llu (%llu bytes) steady state: %.1f (%.0f bytes) per million samples",
+                    run,
+                    (unsigned long long) allocCount,
+                    (unsigned long long) allocBytes,
+                    (allocCount - steadyCount) * 1e6 / (done - steadyDone),
+                    (allocBytes - steadyBytes) * 1e6 / (done - steadyDone));
+        }
+        else
+        {
+            qInfo("MainBench::testPipeline: run %u: allocations: %llu (%llu bytes)",
+                    run, (unsigned long long) allocCount, (unsigned long long) allocBytes);
+        }
+    }
+    else
+    {
+        qWarning("MainBench::testPipeline: run %u: cannot start acquisition: %s", run, qPrintable(engine->errorMessage()));
+    }
+
+    // tear down as MainCore::removeLastDevice
+    deviceAPI->stopAcquisition();
+
+    for (std::vector<ChannelSinkAPI*>::iterator it = channels.begin(); it != channels.end(); ++it) {
+        (*it)->destroy();
+    }
+
+    source->destroy();
+    engine->stop();
+    dspEngine->removeLastDeviceSourceEngine();
+    delete deviceAPI;
+}
+
+}
+
+void MainBench::testPipeline()
+{
+    qDebug() << "MainBench::testPipeline";
+
+    SampleVector samples;
+    int sampleRate;
+    quint64 centerFrequency;
+    QString sourceName;
+
+    if (m_parser.getFileName().isEmpty())
+    {
+        generateSamples(samples);
+        sampleRate = m_parser.getSampleRate();
+        centerFrequency = 100000000;
+        sourceName = "synthetic";
+    }
+    else
+    {
+        FileRecord::Header header;
+
+        if (!loadFile(m_parser.getFileName(), m_parser.getNbItems(), samples, header))
+        {
+            qWarning("MainBench::testPipeline: cannot read %s", qPrintable(m_parser.getFileName()));
+            return;
+        }
+
+        sampleRate = header.sampleRate;
+        centerFrequency = header.centerFrequency;
+        sourceName = QString("%1 (%2 bits, %3 samples loaded)").arg(m_parser.getFileName()).arg(header.sampleSize).arg(samples.size());
+    }
+
+    PluginManager pluginManager(this);
+    pluginManager.loadPlugins(QString("pluginssrv"));
+    PluginAPI::ChannelRegistrations *rxChannels = pluginManager.getPluginAPI()->getRxChannelRegistrations();
+    std::vector<PluginInterface*> plugins;
+    QStringList channelNames;
+
+    foreach (const QString& channelId, m_parser.getChannelIds())
+    {
+        int i = 0;
+
+        for (; i < rxChannels->size(); i++)
+        {
+            if (((*rxChannels)[i].m_channelId == channelId) || ((*rxChannels)[i].m_channelIdURI == channelId)) {
+                break;
+            }
+        }
+
+        if (i < rxChannels->size())
+        {
+            plugins.push_back((*rxChannels)[i].m_plugin);
+            channelNames.append((*rxChannels)[i].m_channelId);
+        }
+        else
+        {
+            qWarning("MainBench::testPipeline: unknown channel %s", qPrintable(channelId));
+        }
+    }
+
+    if (plugins.size() == 0)
+    {
+        qWarning("MainBench::testPipeline: no channel to run");
+        return;
+    }
+
+    qInfo("MainBench::testPipeline: source: %s at %d S/s channels: %s",
+            qPrintable(sourceName), sampleRate, qPrintable(channelNames.join(",")));
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++) {
+        runPipeline(i, samples, sampleRate, centerFrequency, m_parser.getNbItems(), plugins);
+    }
+}
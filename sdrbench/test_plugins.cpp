@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <QCoreApplication>
+#include <QProcess>
+#include <QProcessEnvironment>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QDebug>
+
+#include "plugin/pluginmanager.h"
+#include "mainbench.h"
+
+namespace {
+
+const char *modeVariable = "SDRBENCH_PLUGINS_MODE"; //!< set in the child process: "eager" or "lazy"
+
+/** Resident set size in kB or -1 if not known */
+long getResidentMemory()
+{
+    QFile statm("/proc/self/statm");
+
+    if (statm.open(QIODevice::ReadOnly))
+    {
+        QList<QByteArray> fields = statm.readAll().split(' ');
+
+        if (fields.size() > 1) {
+            return fields[1].toLong() * (sysconf(_SC_PAGESIZE) / 1024);
+        }
+    }
+
+    return -1;
+}
+
+struct PluginsResult
+{
+    int m_nbPlugins;
+    int m_nbDeferred;
+    qint64 m_loadTime;      //!< loadPlugins including devices enumeration in ms
+    long m_rssStart;        //!< resident memory before loadPlugins in kB
+    long m_rssEnd;          //!< resident memory after loadPlugins in kB
+    qint64 m_processTime;   //!< from the start of the process to its exit in ms
+
+    PluginsResult() :
+        m_nbPlugins(0),
+        m_nbDeferred(0),
+        m_loadTime(0),
+        m_rssStart(0),
+        m_rssEnd(0),
+        m_processTime(0)
+    {}
+};
+
+/**
+ * Runs this benchmark in a new process so that the plugin libraries loaded by a previous
+ * run are not already mapped. The child prints a single line with its measurements on
+ * its standard output.
+ */
+bool runChild(bool lazy, PluginsResult& result)
+{
+    QProcess process;
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert(modeVariable, lazy ? "lazy" : "eager");
+    process.setProcessEnvironment(environment);
+    process.setProcessChannelMode(QProcess::SeparateChannels);
+
+    QElapsedTimer timer;
+    timer.start();
+    process.start(QCoreApplication::applicationFilePath(), QStringList() << "-t" << "plugins" << "-r" << "1");
+
+    if (!process.waitForFinished(60000) || (process.exitCode() != 0))
+    {
+        qWarning("MainBench::testPlugins: child process failed: %s", qPrintable(process.errorString()));
+        return false;
+    }
+
+    result.m_processTime = timer.elapsed();
+
+    foreach (const QByteArray& line, process.readAllStandardOutput().split('\n'))
+    {
+        if (sscanf(line.constData(), "plugins %d %d %lld %ld %ld",
+                &result.m_nbPlugins, &result.m_nbDeferred, &result.m_loadTime, &result.m_rssStart, &result.m_rssEnd) == 5) {
+            return true;
+        }
+    }
+
+    qWarning("MainBench::testPlugins: no result from the child process");
+    return false;
+}
+
+void printResult(const char *name, const PluginsResult& result)
+{
+    qInfo("MainBench::testPlugins: %-5s %3d plugins (%3d deferred): load %5lld ms process %5lld ms RSS %7ld kB (+%6ld kB)",
+        name,
+        result.m_nbPlugins,
+        result.m_nbDeferred,
+        result.m_loadTime,
+        result.m_processTime,
+        result.m_rssEnd,
+        result.m_rssEnd - result.m_rssStart);
+}
+
+} // namespace
+
+void MainBench::testPlugins()
+{
+    QByteArray mode = qgetenv(modeVariable);
+
+    if (!mode.isEmpty()) // child process: one load and print the result for the parent
+    {
+        PluginManager pluginManager(this);
+        pluginManager.setLazyLoading(mode == "lazy");
+        long rssStart = getResidentMemory();
+        QElapsedTimer timer;
+        timer.start();
+        pluginManager.loadPlugins(QString("pluginssrv"));
+        qint64 loadTime = timer.elapsed();
+        int nbDeferred = 0;
+
+        for (PluginManager::Plugins::const_iterator it = pluginManager.getPlugins().begin(); it != pluginManager.getPlugins().end(); ++it) {
+            nbDeferred += it->deferred ? 1 : 0;
+        }
+
+        printf("plugins %d %d %lld %ld %ld\n", pluginManager.getPlugins().size(), nbDeferred, loadTime, rssStart, getResidentMemory());
+        fflush(stdout);
+        return;
+    }
+
+    qDebug() << "MainBench::testPlugins";
+
+    // The eager run comes first: it writes the manifest the lazy run starts from
+    PluginsResult eagerSum, lazySum;
+    uint32_t nbRuns = 0;
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        PluginsResult eager, lazy;
+
+        if (!runChild(false, eager) || !runChild(true, lazy)) {
+            return;
+        }
+
+        printResult("eager", eager);
+        printResult("lazy", lazy);
+        eagerSum.m_loadTime += eager.m_loadTime;
+        eagerSum.m_processTime += eager.m_processTime;
+        eagerSum.m_rssEnd += eager.m_rssEnd;
+        lazySum.m_loadTime += lazy.m_loadTime;
+        lazySum.m_processTime += lazy.m_processTime;
+        lazySum.m_rssEnd += lazy.m_rssEnd;
+        nbRuns++;
+    }
+
+    if (nbRuns == 0) {
+        return;
+    }
+
+    qInfo("MainBench::testPlugins: average of %u runs: load %lld ms -> %lld ms process %lld ms -> %lld ms RSS %ld kB -> %ld kB",
+        nbRuns,
+        eagerSum.m_loadTime / nbRuns,
+        lazySum.m_loadTime / nbRuns,
+        eagerSum.m_processTime / nbRuns,
+        lazySum.m_processTime / nbRuns,
+        eagerSum.m_rssEnd / (long) nbRuns,
+        lazySum.m_rssEnd / (long) nbRuns);
+}
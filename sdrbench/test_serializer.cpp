@@ -0,0 +1,307 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QElapsedTimer>
+#include <QMap>
+#include <QDebug>
+
+#include "util/simpleserializer.h"
+#include "settings/preset.h"
+#include "mainbench.h"
+
+namespace {
+
+const int nbChannels = 64;       //!< channels in the preset
+const int nbChannelFields = 40;  //!< fields of a channel settings blob
+const int nbDevices = 4;
+
+/** Settings blob of a channel with a nested spectrum settings blob like a channel analyzer */
+QByteArray makeChannelSettings(int channelIndex)
+{
+    SimpleSerializer spectrum(1);
+
+    for (int i = 1; i <= 20; i++) {
+        spectrum.writeS32(i, channelIndex * 100 + i);
+    }
+
+    SimpleSerializer s(1);
+
+    for (int i = 1; i < nbChannelFields; i++)
+    {
+        switch (i % 4)
+        {
+        case 0:
+            s.writeS32(i, channelIndex * 1000 + i);
+            break;
+        case 1:
+            s.writeReal(i, channelIndex + i / 10.0f);
+            break;
+        case 2:
+            s.writeBool(i, i & 1);
+            break;
+        default:
+            s.writeString(i, QString("channel %1 field %2").arg(channelIndex).arg(i));
+            break;
+        }
+    }
+
+    s.writeBlob(nbChannelFields, spectrum.final());
+    return s.final();
+}
+
+QByteArray makePreset()
+{
+    Preset preset;
+    preset.setGroup("bench");
+    preset.setDescription("large preset");
+    preset.setCenterFrequency(435000000);
+    preset.setLayout(QByteArray(2048, 'l'));
+    preset.setSpectrumConfig(makeChannelSettings(-1));
+
+    for (int i = 0; i < nbDevices; i++) {
+        preset.setDeviceConfig(QString("sdrangel.samplesource.bench%1").arg(i), QString("serial%1").arg(i), 0, makeChannelSettings(1000 + i));
+    }
+
+    for (int i = 0; i < nbChannels; i++) {
+        preset.addChannel("sdrangel.channel.bench", makeChannelSettings(i));
+    }
+
+    return preset.serialize();
+}
+
+/** The fields of a channel settings blob as a channel deserialize() method reads them */
+template <class Deserializer>
+qint64 readChannelSettings(const QByteArray& data)
+{
+    Deserializer d(data);
+    qint64 checksum = 0;
+    qint32 s32;
+    Real real;
+    bool b;
+    QString str;
+    QByteArray blob;
+
+    for (int i = 1; i < nbChannelFields; i++)
+    {
+        switch (i % 4)
+        {
+        case 0:
+            d.readS32(i, &s32);
+            checksum += s32;
+            break;
+        case 1:
+            d.readReal(i, &real);
+            checksum += (qint64) real;
+            break;
+        case 2:
+            d.readBool(i, &b);
+            checksum += b ? 1 : 0;
+            break;
+        default:
+            d.readString(i, &str);
+            checksum += str.size();
+            break;
+        }
+    }
+
+    d.readBlob(nbChannelFields, &blob);
+    Deserializer spectrum(blob);
+
+    for (int i = 1; i <= 20; i++)
+    {
+        spectrum.readS32(i, &s32);
+        checksum += s32;
+    }
+
+    return checksum;
+}
+
+/** The preset as MainWindow loads it: preset fields then the device and channels settings */
+template <class Deserializer>
+qint64 readPreset(const QByteArray& data)
+{
+    Deserializer d(data);
+    qint64 checksum = 0;
+    qint32 nbDevicesRead, nbChannelsRead, s32;
+    QString str;
+    QByteArray blob;
+
+    d.readString(1, &str);
+    d.readString(2, &str);
+    d.readBlob(4, &blob);
+    d.readBlob(5, &blob);
+    checksum += readChannelSettings<Deserializer>(blob);
+    d.readS32(20, &nbDevicesRead);
+
+    for (int i = 0; i < nbDevicesRead; i++)
+    {
+        d.readString(24 + i*4, &str);
+        d.readString(25 + i*4, &str);
+        d.readS32(26 + i*4, &s32);
+        d.readBlob(27 + i*4, &blob);
+        checksum += readChannelSettings<Deserializer>(blob);
+    }
+
+    d.readS32(200, &nbChannelsRead);
+
+    for (int i = 0; i < nbChannelsRead; i++)
+    {
+        d.readString(201 + i*2, &str);
+        d.readBlob(202 + i*2, &blob);
+        checksum += readChannelSettings<Deserializer>(blob);
+    }
+
+    return checksum;
+}
+
+/** Reference: fields indexed in a QMap and blobs copied as SimpleDeserializer used to do */
+class MapDeserializer
+{
+public:
+    MapDeserializer(const QByteArray& data) :
+        m_data(data)
+    {
+        int ofs = 0;
+
+        while (ofs < m_data.size())
+        {
+            quint8 tag = m_data[ofs++];
+            int idLen = ((tag >> 2) & 0x03) + 1;
+            int lengthLen = (tag & 0x03) + 1;
+            quint32 id = 0, length = 0;
+
+            for (int i = 0; i < idLen; i++) {
+                id = (id << 8) | (quint8) m_data[ofs++];
+            }
+
+            for (int i = 0; i < lengthLen; i++) {
+                length = (length << 8) | (quint8) m_data[ofs++];
+            }
+
+            m_elements.insert(id, Element(ofs, length));
+            ofs += length;
+        }
+    }
+
+    void readS32(quint32 id, qint32 *result) const { *result = (qint32) readInt(id, true); }
+    void readBool(quint32 id, bool *result) const { *result = readInt(id, false) != 0; }
+
+    void readReal(quint32 id, Real *result) const
+    {
+        union { quint32 u; float f; } tmp;
+        tmp.u = (quint32) readInt(id, false);
+        *result = tmp.f;
+    }
+
+    void readString(quint32 id, QString *result) const
+    {
+        Elements::const_iterator it = m_elements.constFind(id);
+        *result = it == m_elements.constEnd() ? QString() : QString::fromUtf8(m_data.data() + it->ofs, it->length);
+    }
+
+    void readBlob(quint32 id, QByteArray *result) const
+    {
+        Elements::const_iterator it = m_elements.constFind(id);
+        *result = it == m_elements.constEnd() ? QByteArray() : QByteArray(m_data.data() + it->ofs, it->length);
+    }
+
+private:
+    struct Element
+    {
+        quint32 ofs;
+        quint32 length;
+        Element(quint32 _ofs, quint32 _length) : ofs(_ofs), length(_length) {}
+    };
+
+    typedef QMap<quint32, Element> Elements;
+
+    QByteArray m_data;
+    Elements m_elements;
+
+    qint64 readInt(quint32 id, bool isSigned) const
+    {
+        Elements::const_iterator it = m_elements.constFind(id);
+
+        if (it == m_elements.constEnd()) {
+            return 0;
+        }
+
+        qint64 tmp = 0;
+
+        for (quint32 i = 0; i < it->length; i++)
+        {
+            quint8 byte = m_data[it->ofs + i];
+
+            if (isSigned && (i == 0) && (byte & 0x80)) {
+                tmp = -1;
+            }
+
+            tmp = (tmp << 8) | byte;
+        }
+
+        return tmp;
+    }
+};
+
+template <class Deserializer>
+void benchPreset(const char *name, const QByteArray& data, int nbPresets, int repetition)
+{
+    QElapsedTimer timer;
+    qint64 checksum = 0;
+    qint64 elapsedNs = 0;
+
+    for (int r = 0; r < repetition; r++)
+    {
+        timer.start();
+
+        for (int i = 0; i < nbPresets; i++) {
+            checksum += readPreset<Deserializer>(data);
+        }
+
+        elapsedNs += timer.nsecsElapsed();
+    }
+
+    qInfo("MainBench::testSerializer: %-22s %8.1f us/preset (checksum %lld)",
+        name,
+        elapsedNs / (1e3 * nbPresets * repetition),
+        checksum);
+}
+
+} // namespace
+
+void MainBench::testSerializer()
+{
+    QByteArray data = makePreset();
+    int nbPresets = std::max(1u, m_parser.getNbItems() / 1000);
+
+    qInfo("MainBench::testSerializer: preset of %d bytes with %d devices and %d channels of %d fields, %d presets per run",
+        data.size(), nbDevices, nbChannels, nbChannelFields + 20, nbPresets);
+    benchPreset<MapDeserializer>("QMap index (previous)", data, nbPresets, m_parser.getRepetition());
+    benchPreset<SimpleDeserializer>("SimpleDeserializer", data, nbPresets, m_parser.getRepetition());
+
+    // the complete Preset class including its own copies of the blobs
+    QElapsedTimer timer;
+    timer.start();
+
+    for (int i = 0; i < nbPresets; i++)
+    {
+        Preset preset;
+        preset.deserialize(data);
+    }
+
+    qInfo("MainBench::testSerializer: %-22s %8.1f us/preset", "Preset::deserialize", timer.nsecsElapsed() / (1e3 * nbPresets));
+}
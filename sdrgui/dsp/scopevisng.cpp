@@ -63,7 +63,7 @@ ScopeVisNG::ScopeVisNG(GLScopeNG* glScope) :
 {
     setObjectName("ScopeVisNG");
     m_traceDiscreteMemory.resize(m_traceChunkSize); // arbitrary
-    m_glScope->setTraces(&m_traces.m_tracesData, &m_traces.m_traces[0]);
+    m_glScope->setTraces(&m_traces.m_tracesData, &m_traces.m_traces[0], &m_traces.m_tracesLOD[0]);
 }
 
 ScopeVisNG::~ScopeVisNG()
@@ -522,7 +522,8 @@ int ScopeVisNG::processTraces(const SampleVector::const_iterator& cbegin, const
     if (m_nbSamples == 0) // finished
     {
         //sqDebug("ScopeVisNG::processTraces: m_traceCount: %d", m_traces.m_tracesControl.begin()->m_traceCount[m_traces.currentBufferIndex()]);
-        m_glScope->newTraces(&m_traces.m_traces[m_traces.currentBufferIndex()]);
+        computeTracesLOD();
+        m_glScope->newTraces(&m_traces.m_traces[m_traces.currentBufferIndex()], &m_traces.m_tracesLOD[m_traces.currentBufferIndex()]);
         m_traces.switchBuffer();
         return end - begin; // return remainder count
     }
@@ -828,6 +829,65 @@ void ScopeVisNG::updateMaxTraceDelay()
     m_maxTraceDelay = maxTraceDelay;
 }
 
+void ScopeVisNG::computeTracesLOD()
+{
+    int width = m_glScope->getTraceLODWidth();
+    // same display window as GLScopeNG
+    int start = (m_timeOfsProMill / 1000.0) * m_traceSize;
+    int end = std::min(start + (int) (m_traceSize / m_timeBase), (int) m_traceSize);
+
+    if ((end - start < 2) && (start > 0)) {
+        start--;
+    }
+
+    int length = end - start;
+    std::vector<float *>::iterator itTrace = m_traces.m_traces[m_traces.currentBufferIndex()].begin();
+    std::vector<TraceLOD>::iterator itLOD = m_traces.m_tracesLOD[m_traces.currentBufferIndex()].begin();
+
+    for (; itLOD != m_traces.m_tracesLOD[m_traces.currentBufferIndex()].end(); ++itTrace, ++itLOD)
+    {
+        itLOD->m_start = start;
+        itLOD->m_end = end;
+
+        if ((width <= 0) || (length <= 2*width)) // the full window is not larger
+        {
+            itLOD->m_nbVertices = 0;
+            continue;
+        }
+
+        const float *trace = *itTrace;
+        itLOD->m_vertices.resize(4*width);
+        float *vertices = &itLOD->m_vertices[0];
+        int columnStart = start;
+
+        for (int column = 0; column < width; column++)
+        {
+            int columnEnd = start + (int) (((qint64) (column + 1) * length) / width);
+            int iMin = columnStart;
+            int iMax = columnStart;
+
+            for (int i = columnStart + 1; i < columnEnd; i++)
+            {
+                if (trace[2*i+1] < trace[2*iMin+1]) {
+                    iMin = i;
+                } else if (trace[2*i+1] > trace[2*iMax+1]) {
+                    iMax = i;
+                }
+            }
+
+            int first = std::min(iMin, iMax);
+            int second = std::max(iMin, iMax);
+            vertices[4*column]     = trace[2*first];
+            vertices[4*column + 1] = trace[2*first + 1];
+            vertices[4*column + 2] = trace[2*second];
+            vertices[4*column + 3] = trace[2*second + 1];
+            columnStart = columnEnd;
+        }
+
+        itLOD->m_nbVertices = 2*width;
+    }
+}
+
 void ScopeVisNG::initTraceBuffers()
 {
     int shift = (m_timeOfsProMill / 1000.0) * m_traceSize;
@@ -152,6 +152,21 @@ public:
         }
     };
 
+    /**
+     * Trace reduced to the resolution of the screen. Each pixel column of the display window
+     * is represented by the minimum and maximum of the samples it covers, in time order, so
+     * the polyline looks the same as the full trace with at most two vertices per column.
+     */
+    struct TraceLOD
+    {
+        std::vector<float> m_vertices; //!< display x, y pairs like the full trace
+        int m_nbVertices;              //!< 0 if the window has not enough samples to be reduced
+        int m_start;                   //!< first trace sample of the window it was computed for
+        int m_end;                     //!< end of that window (excluded)
+
+        TraceLOD() : m_nbVertices(0), m_start(0), m_end(0) {}
+    };
+
     static const uint32_t m_traceChunkSize;
     static const uint32_t m_maxNbTriggers = 10;
     static const uint32_t m_maxNbTraces = 10;
@@ -818,6 +833,7 @@ private:
         std::vector<TraceControl> m_tracesControl;    //!< Corresponding traces control data
         std::vector<TraceData> m_tracesData;          //!< Corresponding traces data
         std::vector<float *> m_traces[2];             //!< Double buffer of traces processed by glScope
+        std::vector<TraceLOD> m_tracesLOD[2];         //!< Traces reduced to screen resolution for each buffer
         int m_traceSize;                              //!< Current size of a trace in buffer
         int m_maxTraceSize;                           //!< Maximum Size of a trace in buffer
         bool evenOddIndex;                            //!< Even (true) or odd (false) index
@@ -852,6 +868,8 @@ private:
             {
                 m_traces[0].push_back(0);
                 m_traces[1].push_back(0);
+                m_tracesLOD[0].push_back(TraceLOD());
+                m_tracesLOD[1].push_back(TraceLOD());
                 m_tracesData.push_back(traceData);
                 m_tracesControl.push_back(TraceControl());
                 m_tracesControl.back().initProjector(traceData.m_projectionType);
@@ -875,6 +893,8 @@ private:
             {
                 m_traces[0].erase(m_traces[0].begin() + traceIndex);
                 m_traces[1].erase(m_traces[1].begin() + traceIndex);
+                m_tracesLOD[0].erase(m_tracesLOD[0].begin() + traceIndex);
+                m_tracesLOD[1].erase(m_tracesLOD[1].begin() + traceIndex);
             	m_tracesControl[traceIndex].releaseProjector();
                 m_tracesControl.erase(m_tracesControl.begin() + traceIndex);
                 m_tracesData.erase(m_tracesData.begin() + traceIndex);
@@ -928,6 +948,8 @@ private:
             {
                 (m_traces[0])[i] = &m_x0[2*m_traceSize*i];
                 (m_traces[1])[i] = &m_x1[2*m_traceSize*i];
+                (m_tracesLOD[0])[i].m_nbVertices = 0;
+                (m_tracesLOD[1])[i].m_nbVertices = 0;
             }
         }
 
@@ -1071,6 +1093,11 @@ private:
      */
     int processTraces(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool traceBack = false);
 
+    /**
+     * Reduce the traces of the current buffer to the pixel width of the display (see TraceLOD)
+     */
+    void computeTracesLOD();
+
     /**
      * Get maximum trace delay
      */
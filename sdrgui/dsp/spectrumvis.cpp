@@ -1,3 +1,9 @@
+#ifdef USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include <string.h>
+
 #include "dsp/spectrumvis.h"
 #include "gui/glspectrum.h"
 #include "dsp/dspcommands.h"
@@ -5,28 +11,25 @@
 
 #define MAX_FFT_SIZE 4096
 
-#ifndef LINUX
-inline double log2f(double n)
-{
-	return log(n) / log(2.0);
-}
-#endif
-
 MESSAGE_CLASS_DEFINITION(SpectrumVis::MsgConfigureSpectrumVis, Message)
 
 SpectrumVis::SpectrumVis(Real scalef, GLSpectrum* glSpectrum) :
 	BasebandSampleSink(),
 	m_fft(FFTEngine::create()),
-	m_fftBuffer(MAX_FFT_SIZE),
+	m_frontEnd(FrontEndWindow),
+	m_historyPtr(0),
 	m_logPowerSpectrum(MAX_FFT_SIZE),
-	m_fftBufferFill(0),
-	m_needMoreSamples(false),
+	m_refillCount(0),
+	m_averaging(1),
+	m_averagingCount(0),
+	m_zoomLog2(0),
+	m_zoomPos(0.0f),
 	m_scalef(scalef),
 	m_glSpectrum(glSpectrum),
 	m_mutex(QMutex::Recursive)
 {
 	setObjectName("SpectrumVis");
-	handleConfigure(1024, 0, FFTWindow::BlackmanHarris);
+	handleConfigure(1024, 0, FFTWindow::BlackmanHarris, 0, 0.0f, FrontEndWindow, 1);
 }
 
 SpectrumVis::~SpectrumVis()
@@ -34,9 +37,10 @@ SpectrumVis::~SpectrumVis()
 	delete m_fft;
 }
 
-void SpectrumVis::configure(MessageQueue* msgQueue, int fftSize, int overlapPercent, FFTWindow::Function window)
+void SpectrumVis::configure(MessageQueue* msgQueue, int fftSize, int overlapPercent, FFTWindow::Function window, int zoomLog2, Real zoomPos,
+		FrontEnd frontEnd, int averaging)
 {
-	MsgConfigureSpectrumVis* cmd = new MsgConfigureSpectrumVis(fftSize, overlapPercent, window);
+	MsgConfigureSpectrumVis* cmd = new MsgConfigureSpectrumVis(fftSize, overlapPercent, window, zoomLog2, zoomPos, frontEnd, averaging);
 	msgQueue->push(cmd);
 }
 
@@ -61,7 +65,18 @@ void SpectrumVis::feedTriggered(const SampleVector::const_iterator& triggerPoint
 	}*/
 }
 
-void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleVector::const_iterator& end, bool positiveOnly)
+void SpectrumVis::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+	feedSamples(begin, end, positiveOnly, m_scalef);
+}
+
+void SpectrumVis::feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly)
+{
+	feedSamples(begin, end, positiveOnly, 1.0f); // already normalized
+}
+
+template<typename Iterator>
+void SpectrumVis::feedSamples(Iterator begin, const Iterator& end, bool positiveOnly, Real scalef)
 {
 	// if no visualisation is set, send the samples to /dev/null
 
@@ -70,88 +85,213 @@ void SpectrumVis::feed(const SampleVector::const_iterator& cbegin, const SampleV
 		return;
 	}
 
-	SampleVector::const_iterator begin(cbegin);
-
-	while (begin < end)
+	if ((m_zoomLog2 > 0) && !positiveOnly)
 	{
-		std::size_t todo = end - begin;
-		std::size_t samplesNeeded = m_refillSize - m_fftBufferFill;
+		feedZoomed(begin, end, scalef);
+		return;
+	}
 
-		if (todo >= samplesNeeded)
-		{
-			QMutexLocker mutexLocker(&m_mutex);
+	QMutexLocker mutexLocker(&m_mutex);
+	Real scale = 1.0f / scalef;
 
-			// fill up the buffer
-			std::vector<Complex>::iterator it = m_fftBuffer.begin() + m_fftBufferFill;
+	for (; begin < end; ++begin) {
+		pushSample(Complex(begin->real() * scale, begin->imag() * scale), positiveOnly);
+	}
+}
 
-			for (std::size_t i = 0; i < samplesNeeded; ++i, ++begin)
-			{
-				*it++ = Complex(begin->real() / m_scalef, begin->imag() / m_scalef);
-			}
+template<typename Iterator>
+void SpectrumVis::feedZoomed(Iterator begin, const Iterator& end, Real scalef)
+{
+	QMutexLocker mutexLocker(&m_mutex);
 
-			// apply fft window (and copy from m_fftBuffer to m_fftIn)
-			m_window.apply(&m_fftBuffer[0], m_fft->in());
-
-			// calculate FFT
-			m_fft->transform();
-
-			// extract power spectrum and reorder buckets
-			Real ofs = 20.0f * log10f(1.0f / m_fftSize);
-			Real mult = (10.0f / log2f(10.0f));
-			const Complex* fftOut = m_fft->out();
-			Complex c;
-			Real v;
-			std::size_t halfSize = m_fftSize / 2;
-
-			if ( positiveOnly )
-			{
-				for (std::size_t i = 0; i < halfSize; i++)
-				{
-					c = fftOut[i];
-					v = c.real() * c.real() + c.imag() * c.imag();
-					v = mult * log2f(v) + ofs;
-					m_logPowerSpectrum[i * 2] = v;
-					m_logPowerSpectrum[i * 2 + 1] = v;
-				}
-			}
-			else
-			{
-				for (std::size_t i = 0; i < halfSize; i++)
-				{
-					c = fftOut[i + halfSize];
-					v = c.real() * c.real() + c.imag() * c.imag();
-					v = mult * log2f(v) + ofs;
-					m_logPowerSpectrum[i] = v;
-
-					c = fftOut[i];
-					v = c.real() * c.real() + c.imag() * c.imag();
-					v = mult * log2f(v) + ofs;
-					m_logPowerSpectrum[i + halfSize] = v;
-				}
-			}
+	for (; begin < end; ++begin)
+	{
+		// bring the zoom center to zero frequency
+		Complex c = Complex(begin->real() / scalef, begin->imag() / scalef) * m_zoomNCO.nextIQ();
+		FSample s(c.real(), c.imag());
+		int stage = 0;
 
-			// send new data to visualisation
-			m_glSpectrum->newSpectrum(m_logPowerSpectrum, m_fftSize);
+		// each stage outputs one sample every two samples
+		while ((stage < m_zoomLog2) && m_zoomFilters[stage].workDecimateCenter(&s)) {
+			stage++;
+		}
 
-			// advance buffer respecting the fft overlap factor
-			std::copy(m_fftBuffer.begin() + m_refillSize, m_fftBuffer.end(), m_fftBuffer.begin());
+		if (stage < m_zoomLog2) {
+			continue;
+		}
+
+		pushSample(Complex(s.real(), s.imag()), false);
+	}
+}
 
-			// start over
-			m_fftBufferFill = m_overlapSize;
-			m_needMoreSamples = false;
+void SpectrumVis::processFFT(bool positiveOnly)
+{
+	const Complex *frame = &m_history[m_historyPtr]; // oldest sample first
+	Complex *fftIn = m_fft->in();
+
+	if (m_frontEnd == FrontEndWOLA)
+	{
+		// weight with the prototype filter and fold the frame into the FFT size
+		const Real *coeffs = &m_wolaCoeffs[0];
+
+		for (std::size_t k = 0; k < m_fftSize; k++) {
+			fftIn[k] = frame[k] * coeffs[k];
 		}
-		else
+
+		for (std::size_t t = m_fftSize; t < m_frameSize; t += m_fftSize)
 		{
-			// not enough samples for FFT - just fill in new data and return
-			for(std::vector<Complex>::iterator it = m_fftBuffer.begin() + m_fftBufferFill; begin < end; ++begin)
-			{
-				*it++ = Complex(begin->real() / m_scalef, begin->imag() / m_scalef);
+			for (std::size_t k = 0; k < m_fftSize; k++) {
+				fftIn[k] += frame[t + k] * coeffs[t + k];
 			}
+		}
+	}
+	else
+	{
+		m_window.apply(frame, fftIn);
+	}
+
+	m_fft->transform();
+	accumulatePower(m_fft->out(), &m_powerSpectrum[0], m_fftSize, m_averagingCount == 0);
+
+	if (++m_averagingCount < m_averaging) {
+		return;
+	}
+
+	m_averagingCount = 0;
+
+	// averaged power in dB
+	Real ofs = 20.0f * log10f(1.0f / m_fftSize) - 10.0f * log10f(m_averaging);
+	powerToDB(&m_powerSpectrum[0], &m_dbSpectrum[0], m_fftSize, ofs);
 
-			m_fftBufferFill += todo;
-			m_needMoreSamples = true;
+	// reorder buckets
+	std::size_t halfSize = m_fftSize / 2;
+
+	if ( positiveOnly )
+	{
+		for (std::size_t i = 0; i < halfSize; i++)
+		{
+			m_logPowerSpectrum[i * 2] = m_dbSpectrum[i];
+			m_logPowerSpectrum[i * 2 + 1] = m_dbSpectrum[i];
 		}
 	}
+	else
+	{
+		std::copy(m_dbSpectrum.begin() + halfSize, m_dbSpectrum.begin() + m_fftSize, m_logPowerSpectrum.begin());
+		std::copy(m_dbSpectrum.begin(), m_dbSpectrum.begin() + halfSize, m_logPowerSpectrum.begin() + halfSize);
+	}
+
+	// send new data to visualisation
+	m_glSpectrum->newSpectrum(m_logPowerSpectrum, m_fftSize);
+}
+
+void SpectrumVis::accumulatePower(const Complex *in, Real *acc, int n, bool first)
+{
+	const float *iq = (const float *) in;
+	int i = 0;
+
+#ifdef USE_SSE2
+	for (; i + 4 <= n; i += 4)
+	{
+		__m128 a = _mm_loadu_ps(iq + 2*i);     // re0 im0 re1 im1
+		__m128 b = _mm_loadu_ps(iq + 2*i + 4); // re2 im2 re3 im3
+		a = _mm_mul_ps(a, a);
+		b = _mm_mul_ps(b, b);
+		__m128 p = _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+
+		if (!first) {
+			p = _mm_add_ps(p, _mm_loadu_ps(acc + i));
+		}
+
+		_mm_storeu_ps(acc + i, p);
+	}
+#endif
+
+	for (; i < n; i++)
+	{
+		Real p = iq[2*i] * iq[2*i] + iq[2*i + 1] * iq[2*i + 1];
+		acc[i] = first ? p : acc[i] + p;
+	}
+}
+
+/**
+ * 10*log10(in) + ofs. The logarithm is computed from the float exponent and a series of the
+ * mantissa m: log2(m) = 2/ln(2) * (t + t^3/3 + t^5/5 + t^7/7) with t = (m-1)/(m+1). The error is
+ * below 1e-4 dB. A null power gives about -382 dB instead of -infinity.
+ */
+void SpectrumVis::powerToDB(const Real *in, Real *out, int n, Real ofs)
+{
+	const float c1 = 2.0f / M_LN2, c3 = c1 / 3.0f, c5 = c1 / 5.0f, c7 = c1 / 7.0f;
+	const float mult = 10.0f * M_LN2 / M_LN10; // dB per octave
+	int i = 0;
+
+#ifdef USE_SSE2
+	const __m128i mantissaMask = _mm_set1_epi32(0x007fffff);
+	const __m128i one = _mm_set1_epi32(0x3f800000);
+	const __m128i bias = _mm_set1_epi32(127);
+
+	for (; i + 4 <= n; i += 4)
+	{
+		__m128i bits = _mm_castps_si128(_mm_loadu_ps(in + i));
+		__m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), bias)); // powers are positive
+		__m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, mantissaMask), one));
+		__m128 t = _mm_div_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_add_ps(m, _mm_set1_ps(1.0f)));
+		__m128 t2 = _mm_mul_ps(t, t);
+		__m128 p = _mm_add_ps(_mm_set1_ps(c5), _mm_mul_ps(t2, _mm_set1_ps(c7)));
+		p = _mm_add_ps(_mm_set1_ps(c3), _mm_mul_ps(t2, p));
+		p = _mm_add_ps(_mm_set1_ps(c1), _mm_mul_ps(t2, p));
+		__m128 log2x = _mm_add_ps(e, _mm_mul_ps(t, p));
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(log2x, _mm_set1_ps(mult)), _mm_set1_ps(ofs)));
+	}
+#endif
+
+	for (; i < n; i++)
+	{
+		quint32 bits;
+		memcpy(&bits, &in[i], sizeof(bits));
+		float e = (int) (bits >> 23) - 127;
+		quint32 mBits = (bits & 0x007fffff) | 0x3f800000;
+		float m;
+		memcpy(&m, &mBits, sizeof(m));
+		float t = (m - 1.0f) / (m + 1.0f);
+		float t2 = t * t;
+		float log2x = e + t * (c1 + t2 * (c3 + t2 * (c5 + t2 * c7)));
+		out[i] = log2x * mult + ofs;
+	}
+}
+
+void SpectrumVis::makeWOLACoefficients(FFTWindow::Function window)
+{
+	std::vector<Real> sinc(m_frameSize);
+	Real center = (m_frameSize - 1) / 2.0f;
+
+	// sinc of one FFT bin width
+	for (std::size_t i = 0; i < m_frameSize; i++)
+	{
+		double x = M_PI * (i - center) / m_fftSize;
+		sinc[i] = x == 0.0 ? 1.0f : sin(x) / x;
+	}
+
+	FFTWindow prototypeWindow;
+	prototypeWindow.create(window, m_frameSize);
+	m_wolaCoeffs.resize(m_frameSize);
+	prototypeWindow.apply(sinc, &m_wolaCoeffs);
+
+	// same gain as the FFT window so that the levels do not depend on the front end
+	std::vector<Real> ones(m_fftSize, 1.0f), fftWindow(m_fftSize);
+	m_window.apply(ones, &fftWindow);
+	Real windowSum = 0.0f, coeffsSum = 0.0f;
+
+	for (std::size_t i = 0; i < m_fftSize; i++) {
+		windowSum += fftWindow[i];
+	}
+
+	for (std::size_t i = 0; i < m_frameSize; i++) {
+		coeffsSum += m_wolaCoeffs[i];
+	}
+
+	for (std::size_t i = 0; i < m_frameSize; i++) {
+		m_wolaCoeffs[i] *= windowSum / coeffsSum;
+	}
 }
 
 void SpectrumVis::start()
@@ -167,7 +307,8 @@ bool SpectrumVis::handleMessage(const Message& message)
 	if (MsgConfigureSpectrumVis::match(message))
 	{
 		MsgConfigureSpectrumVis& conf = (MsgConfigureSpectrumVis&) message;
-		handleConfigure(conf.getFFTSize(), conf.getOverlapPercent(), conf.getWindow());
+		handleConfigure(conf.getFFTSize(), conf.getOverlapPercent(), conf.getWindow(), conf.getZoomLog2(), conf.getZoomPos(),
+				conf.getFrontEnd(), conf.getAveraging());
 		return true;
 	}
 	else
@@ -176,7 +317,8 @@ bool SpectrumVis::handleMessage(const Message& message)
 	}
 }
 
-void SpectrumVis::handleConfigure(int fftSize, int overlapPercent, FFTWindow::Function window)
+void SpectrumVis::handleConfigure(int fftSize, int overlapPercent, FFTWindow::Function window, int zoomLog2, Real zoomPos,
+		FrontEnd frontEnd, int averaging)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
@@ -205,7 +347,42 @@ void SpectrumVis::handleConfigure(int fftSize, int overlapPercent, FFTWindow::Fu
 	m_fftSize = fftSize;
 	m_fft->configure(m_fftSize, false);
 	m_window.create(window, m_fftSize);
+	m_frontEnd = frontEnd;
+	m_frameSize = m_frontEnd == FrontEndWOLA ? m_wolaTaps * m_fftSize : m_fftSize;
+
+	if (m_frontEnd == FrontEndWOLA) {
+		makeWOLACoefficients(window);
+	}
+
 	m_overlapSize = (m_fftSize * m_overlapPercent) / 100;
-	m_refillSize = m_fftSize - m_overlapSize;
-	m_fftBufferFill = m_overlapSize;
+	m_refillSize = m_overlapSize < m_fftSize ? m_fftSize - m_overlapSize : 1;
+	m_refillCount = 0;
+	m_history.assign(2 * m_frameSize, Complex(0.0f, 0.0f));
+	m_historyPtr = 0;
+
+	m_averaging = averaging < 1 ? 1 : averaging > m_maxAveraging ? (int) m_maxAveraging : averaging;
+	m_averagingCount = 0;
+	m_powerSpectrum.assign(m_fftSize, 0.0f);
+	m_dbSpectrum.resize(m_fftSize);
+
+	if (zoomLog2 > m_maxZoomLog2)
+	{
+		zoomLog2 = m_maxZoomLog2;
+	}
+	else if (zoomLog2 < 0)
+	{
+		zoomLog2 = 0;
+	}
+
+	// the zoomed span stays inside the baseband
+	Real maxPos = 0.5f - 0.5f / (1 << zoomLog2);
+	zoomPos = zoomPos < -maxPos ? -maxPos : zoomPos > maxPos ? maxPos : zoomPos;
+
+	if ((zoomLog2 != m_zoomLog2) || (zoomPos != m_zoomPos))
+	{
+		m_zoomNCO.setFreq(-zoomPos, 1.0f);
+		m_zoomNCO.setPhase(0.0f);
+		m_zoomLog2 = zoomLog2;
+		m_zoomPos = zoomPos;
+	}
 }
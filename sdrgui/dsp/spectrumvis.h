@@ -5,42 +5,83 @@
 #include <QMutex>
 #include "dsp/fftengine.h"
 #include "dsp/fftwindow.h"
+#include "dsp/ncof.h"
+#include "dsp/inthalfbandfilterdbf.h"
 #include "util/export.h"
 #include "util/message.h"
 
+#define SPECTRUMVIS_ZOOM_HB_FILTER_ORDER 64
+
 class GLSpectrum;
 class MessageQueue;
 
+/**
+ * Spectrum of the baseband for GLSpectrum. In zoom mode the sub-band of 1/2^zoomLog2 of the
+ * sample rate centered at zoomPos times the sample rate is mixed down to zero with a NCO and
+ * decimated by a chain of half-band filters before the FFT. The resolution is multiplied by the
+ * zoom factor for the same FFT size. Zoom does not apply to positive only (SSB) spectra.
+ *
+ * The last samples are kept in a mirrored history (each sample is written twice) so that a
+ * frame is taken every FFT size minus overlap samples without moving the buffer. The front end
+ * is either the FFT window or a weighted overlap-add (WOLA) polyphase filter bank: a frame of
+ * m_wolaTaps FFT sizes is weighted by a windowed sinc prototype and folded into the FFT input
+ * which gives much lower leakage for the same FFT size. Power spectra of consecutive frames
+ * can be averaged (Welch) before they are converted to dB and displayed.
+ */
 class SDRANGEL_API SpectrumVis : public BasebandSampleSink {
 
 public:
+	enum FrontEnd
+	{
+		FrontEndWindow, //!< FFT window
+		FrontEndWOLA    //!< weighted overlap-add polyphase filter bank
+	};
+
 	class SDRANGEL_API MsgConfigureSpectrumVis : public Message {
 		MESSAGE_CLASS_DECLARATION
 
 	public:
-		MsgConfigureSpectrumVis(int fftSize, int overlapPercent, FFTWindow::Function window) :
+		MsgConfigureSpectrumVis(int fftSize, int overlapPercent, FFTWindow::Function window, int zoomLog2, Real zoomPos, FrontEnd frontEnd, int averaging) :
 			Message(),
 			m_fftSize(fftSize),
 			m_overlapPercent(overlapPercent),
-			m_window(window)
+			m_window(window),
+			m_zoomLog2(zoomLog2),
+			m_zoomPos(zoomPos),
+			m_frontEnd(frontEnd),
+			m_averaging(averaging)
 		{ }
 
 		int getFFTSize() const { return m_fftSize; }
 		int getOverlapPercent() const { return m_overlapPercent; }
 		FFTWindow::Function getWindow() const { return m_window; }
+		int getZoomLog2() const { return m_zoomLog2; }
+		Real getZoomPos() const { return m_zoomPos; }
+		FrontEnd getFrontEnd() const { return m_frontEnd; }
+		int getAveraging() const { return m_averaging; }
 
 	private:
 		int m_fftSize;
 		int m_overlapPercent;
 		FFTWindow::Function m_window;
+		int m_zoomLog2;
+		Real m_zoomPos;
+		FrontEnd m_frontEnd;
+		int m_averaging;
 	};
 
+	static const int m_maxZoomLog2 = 10;
+	static const int m_wolaTaps = 4;       //!< WOLA prototype filter length in FFT sizes
+	static const int m_maxAveraging = 256; //!< Welch averaging
+
 	SpectrumVis(Real scalef, GLSpectrum* glSpectrum = 0);
 	virtual ~SpectrumVis();
 
-	void configure(MessageQueue* msgQueue, int fftSize, int overlapPercent, FFTWindow::Function window);
+	void configure(MessageQueue* msgQueue, int fftSize, int overlapPercent, FFTWindow::Function window, int zoomLog2 = 0, Real zoomPos = 0.0f,
+			FrontEnd frontEnd = FrontEndWindow, int averaging = 1);
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+	virtual void feedFloat(const FSampleVector::const_iterator& begin, const FSampleVector::const_iterator& end, bool positiveOnly);
 	void feedTriggered(const SampleVector::const_iterator& triggerPoint, const SampleVector::const_iterator& end, bool positiveOnly);
 	virtual void start();
 	virtual void stop();
@@ -49,23 +90,58 @@ public:
 private:
 	FFTEngine* m_fft;
 	FFTWindow m_window;
+	FrontEnd m_frontEnd;
+	std::vector<Real> m_wolaCoeffs;  //!< WOLA prototype filter, m_wolaTaps times the FFT size
 
-	std::vector<Complex> m_fftBuffer;
+	std::vector<Complex> m_history; //!< last m_frameSize samples stored twice
+	std::size_t m_historyPtr;       //!< oldest sample of the frame
+	std::vector<Real> m_powerSpectrum; //!< sum of the power spectra being averaged
+	std::vector<Real> m_dbSpectrum;    //!< averaged power in dB in FFT order
 	std::vector<Real> m_logPowerSpectrum;
 
 	std::size_t m_fftSize;
+	std::size_t m_frameSize;        //!< samples used for one FFT: FFT size or WOLA length
 	std::size_t m_overlapPercent;
 	std::size_t m_overlapSize;
 	std::size_t m_refillSize;
-	std::size_t m_fftBufferFill;
-	bool m_needMoreSamples;
+	std::size_t m_refillCount;      //!< new samples since the last frame
+	int m_averaging;
+	int m_averagingCount;           //!< frames in m_powerSpectrum
+
+	typedef IntHalfbandFilterDBF<double, float, SPECTRUMVIS_ZOOM_HB_FILTER_ORDER> ZoomFilter;
+	int m_zoomLog2;
+	Real m_zoomPos;
+	NCOF m_zoomNCO;
+	ZoomFilter m_zoomFilters[m_maxZoomLog2];
 
 	Real m_scalef;
 	GLSpectrum* m_glSpectrum;
 
 	QMutex m_mutex;
 
-	void handleConfigure(int fftSize, int overlapPercent, FFTWindow::Function window);
+	void handleConfigure(int fftSize, int overlapPercent, FFTWindow::Function window, int zoomLog2, Real zoomPos, FrontEnd frontEnd, int averaging);
+	template<typename Iterator> void feedSamples(Iterator begin, const Iterator& end, bool positiveOnly, Real scalef);
+	template<typename Iterator> void feedZoomed(Iterator begin, const Iterator& end, Real scalef);
+	void pushSample(const Complex& c, bool positiveOnly)
+	{
+		m_history[m_historyPtr] = c;
+		m_history[m_historyPtr + m_frameSize] = c;
+
+		if (++m_historyPtr == m_frameSize) {
+			m_historyPtr = 0;
+		}
+
+		if (++m_refillCount == m_refillSize)
+		{
+			processFFT(positiveOnly);
+			m_refillCount = 0;
+		}
+	}
+	void processFFT(bool positiveOnly);
+	void makeWOLACoefficients(FFTWindow::Function window);
+
+	static void accumulatePower(const Complex *in, Real *acc, int n, bool first);
+	static void powerToDB(const Real *in, Real *out, int n, Real ofs);
 };
 
 #endif // INCLUDE_SPECTRUMVIS_H
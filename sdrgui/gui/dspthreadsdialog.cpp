@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "dspthreadsdialog.h"
+#include "ui_dspthreadsdialog.h"
+
+DSPThreadsDialog::DSPThreadsDialog(MainSettings& mainSettings, int activeThreads, QWidget* parent) :
+    QDialog(parent),
+    ui(new Ui::DSPThreadsDialog),
+    m_mainSettings(mainSettings)
+{
+    ui->setupUi(this);
+    ui->useThreadPool->setChecked(m_mainSettings.getUseDSPThreadPool());
+    ui->nbThreads->setValue(m_mainSettings.getDSPThreadPoolSize());
+    ui->nbThreads->setEnabled(m_mainSettings.getUseDSPThreadPool());
+
+    if (activeThreads > 0) {
+        ui->status->setText(tr("Running with %1 threads. Changes take effect at the next start.").arg(activeThreads));
+    } else {
+        ui->status->setText(tr("Not running. Channels added from now on use the pool when enabled."));
+    }
+}
+
+DSPThreadsDialog::~DSPThreadsDialog()
+{
+    delete ui;
+}
+
+void DSPThreadsDialog::accept()
+{
+    m_mainSettings.setUseDSPThreadPool(ui->useThreadPool->isChecked());
+    m_mainSettings.setDSPThreadPoolSize(ui->nbThreads->value());
+    QDialog::accept();
+}
+
+void DSPThreadsDialog::on_useThreadPool_toggled(bool checked)
+{
+    ui->nbThreads->setEnabled(checked);
+}
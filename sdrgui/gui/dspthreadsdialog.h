@@ -0,0 +1,44 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRGUI_GUI_DSPTHREADSDIALOG_H_
+#define SDRGUI_GUI_DSPTHREADSDIALOG_H_
+
+#include <QDialog>
+#include "settings/mainsettings.h"
+
+namespace Ui {
+    class DSPThreadsDialog;
+}
+
+class DSPThreadsDialog : public QDialog {
+    Q_OBJECT
+public:
+    /** activeThreads is the number of threads of the running pool, 0 if none */
+    explicit DSPThreadsDialog(MainSettings& mainSettings, int activeThreads, QWidget* parent = 0);
+    ~DSPThreadsDialog();
+
+private:
+    Ui::DSPThreadsDialog* ui;
+    MainSettings& m_mainSettings;
+
+private slots:
+    void accept();
+    void on_useThreadPool_toggled(bool checked);
+};
+
+#endif /* SDRGUI_GUI_DSPTHREADSDIALOG_H_ */
@@ -30,6 +30,9 @@ GLScopeNG::GLScopeNG(QWidget* parent) :
     QGLWidget(parent),
     m_tracesData(0),
     m_traces(0),
+    m_tracesLOD(0),
+    m_traceBuffersValid(false),
+    m_traceLODWidth(0),
     m_bufferIndex(0),
     m_displayMode(DisplayX),
     m_dataChanged(false),
@@ -91,13 +94,15 @@ void GLScopeNG::setDisplayTraceIntensity(int intensity)
     update();
 }
 
-void GLScopeNG::setTraces(std::vector<ScopeVisNG::TraceData>* tracesData, std::vector<float *>* traces)
+void GLScopeNG::setTraces(std::vector<ScopeVisNG::TraceData>* tracesData, std::vector<float *>* traces, std::vector<ScopeVisNG::TraceLOD>* tracesLOD)
 {
     m_tracesData = tracesData;
     m_traces = traces;
+    m_tracesLOD = tracesLOD;
+    m_traceBuffersValid = false;
 }
 
-void GLScopeNG::newTraces(std::vector<float *>* traces)
+void GLScopeNG::newTraces(std::vector<float *>* traces, std::vector<ScopeVisNG::TraceLOD>* tracesLOD)
 {
     if (traces->size() > 0)
     {
@@ -105,6 +110,7 @@ void GLScopeNG::newTraces(std::vector<float *>* traces)
             return;
 
         m_traces = traces;
+        m_tracesLOD = tracesLOD;
         m_dataChanged = true;
 
         m_mutex.unlock();
@@ -184,6 +190,10 @@ void GLScopeNG::paintGL()
 //    qDebug("GLScopeNG::paintGL: m_traceCounter: %d", m_traceCounter);
 //    m_traceCounter = 0;
 
+    if (m_dataChanged || !m_traceBuffersValid || (m_traceBuffers.size() < m_traces->size())) {
+        uploadTraces(); // other repaints reuse the vertices already in GPU memory
+    }
+
     m_dataChanged = false;
 
     QOpenGLFunctions *glFunctions = QOpenGLContext::currentContext()->functions();
@@ -300,17 +310,10 @@ void GLScopeNG::paintGL()
         // paint trace #1
         if (m_traceSize > 0)
         {
-            const float *trace = (*m_traces)[0];
             const ScopeVisNG::TraceData& traceData = (*m_tracesData)[0];
 
             if (traceData.m_viewTrace)
             {
-                int start = (m_timeOfsProMill/1000.0) * m_traceSize;
-                int end = std::min(start + m_traceSize/m_timeBase, m_traceSize);
-
-                if(end - start < 2)
-                    start--;
-
                 float rectX = m_glScopeRect1.x();
                 float rectY = m_glScopeRect1.y() + m_glScopeRect1.height() / 2.0f;
                 float rectW = m_glScopeRect1.width() * (float)m_timeBase / (float)(m_traceSize - 1);
@@ -323,7 +326,7 @@ void GLScopeNG::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) &trace[2*start], end - start);
+                drawTrace(mat, color, 0);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -473,15 +476,8 @@ void GLScopeNG::paintGL()
         // paint traces #1..n
         if (m_traceSize > 0)
         {
-            int start = (m_timeOfsProMill/1000.0) * m_traceSize;
-            int end = std::min(start + m_traceSize/m_timeBase, m_traceSize);
-
-            if(end - start < 2)
-                start--;
-
             for (unsigned int i = 1; i < m_traces->size(); i++)
             {
-                const float *trace = (*m_traces)[i];
                 const ScopeVisNG::TraceData& traceData = (*m_tracesData)[i];
 
                 if (!traceData.m_viewTrace) {
@@ -500,7 +496,7 @@ void GLScopeNG::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) &trace[2*start], end - start);
+                drawTrace(mat, color, i);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -696,15 +692,8 @@ void GLScopeNG::paintGL()
         // paint all traces
         if (m_traceSize > 0)
         {
-            int start = (m_timeOfsProMill/1000.0) * m_traceSize;
-            int end = std::min(start + m_traceSize/m_timeBase, m_traceSize);
-
-            if(end - start < 2)
-                start--;
-
             for (unsigned int i = 0; i < m_traces->size(); i++)
             {
-                const float *trace = (*m_traces)[i];
                 const ScopeVisNG::TraceData& traceData = (*m_tracesData)[i];
 
                 if (!traceData.m_viewTrace) {
@@ -723,7 +712,7 @@ void GLScopeNG::paintGL()
                 mat.setToIdentity();
                 mat.translate(-1.0f + 2.0f * rectX, 1.0f - 2.0f * rectY);
                 mat.scale(2.0f * rectW, -2.0f * rectH);
-                m_glShaderSimple.drawPolyline(mat, color, (GLfloat *) &trace[2*start], end - start);
+                drawTrace(mat, color, i);
 
                 // Paint trigger level if any
                 if ((traceData.m_triggerDisplayLevel > -1.0f) && (traceData.m_triggerDisplayLevel < 1.0f))
@@ -1018,6 +1007,77 @@ void GLScopeNG::applyConfig()
     {
         setPolarDisplays();
     }
+
+    // traces are reduced to the width in pixels of the largest time display
+    float timeDisplayWidth = m_displayMode == DisplayPol ? m_glScopeRect1.width() : std::max(m_glScopeRect1.width(), m_glScopeRect2.width());
+    m_traceLODWidth = timeDisplayWidth * width() * devicePixelRatio();
+    m_traceBuffersValid = false;
+}
+
+void GLScopeNG::uploadTraces()
+{
+    m_traceBuffersValid = true;
+
+    while (m_traceBuffers.size() < m_traces->size())
+    {
+        TraceBuffer traceBuffer;
+        traceBuffer.m_buffer = new QOpenGLBuffer(QOpenGLBuffer::VertexBuffer);
+        traceBuffer.m_buffer->setUsagePattern(QOpenGLBuffer::DynamicDraw);
+        traceBuffer.m_buffer->create();
+        m_traceBuffers.push_back(traceBuffer);
+    }
+
+    if (m_traceSize <= 0) {
+        return;
+    }
+
+    int start = (m_timeOfsProMill/1000.0) * m_traceSize;
+    int end = std::min(start + m_traceSize/m_timeBase, m_traceSize);
+
+    if ((end - start < 2) && (start > 0))
+        start--;
+
+    for (unsigned int i = 0; i < m_traces->size(); i++)
+    {
+        const float *vertices = &((*m_traces)[i])[2*start];
+        int nbVertices = end - start;
+
+        if (m_tracesLOD && (i < m_tracesLOD->size()))
+        {
+            const ScopeVisNG::TraceLOD& traceLOD = (*m_tracesLOD)[i];
+
+            // the reduction is only valid for the window it was computed for
+            if ((traceLOD.m_nbVertices > 0) && (traceLOD.m_start == start) && (traceLOD.m_end == end))
+            {
+                vertices = &traceLOD.m_vertices[0];
+                nbVertices = traceLOD.m_nbVertices;
+            }
+        }
+
+        TraceBuffer& traceBuffer = m_traceBuffers[i];
+        int size = 2 * nbVertices * sizeof(GLfloat);
+        traceBuffer.m_buffer->bind();
+
+        if (size > traceBuffer.m_capacity)
+        {
+            traceBuffer.m_buffer->allocate(vertices, size);
+            traceBuffer.m_capacity = size;
+        }
+        else
+        {
+            traceBuffer.m_buffer->write(0, vertices, size);
+        }
+
+        traceBuffer.m_buffer->release();
+        traceBuffer.m_nbVertices = nbVertices;
+    }
+}
+
+void GLScopeNG::drawTrace(const QMatrix4x4& transformMatrix, const QVector4D& color, unsigned int traceIndex)
+{
+    if ((traceIndex < m_traceBuffers.size()) && (m_traceBuffers[traceIndex].m_nbVertices > 0)) {
+        m_glShaderSimple.drawPolyline(transformMatrix, color, *m_traceBuffers[traceIndex].m_buffer, m_traceBuffers[traceIndex].m_nbVertices);
+    }
 }
 
 void GLScopeNG::setUniqueDisplays()
@@ -1948,6 +2008,13 @@ void GLScopeNG::cleanup()
     m_glShaderBottom2Scale.cleanup();
     m_glShaderLeft1Scale.cleanup();
     m_glShaderPowerOverlay.cleanup();
+
+    for (std::vector<TraceBuffer>::iterator it = m_traceBuffers.begin(); it != m_traceBuffers.end(); ++it) {
+        delete it->m_buffer;
+    }
+
+    m_traceBuffers.clear();
+    m_traceBuffersValid = false;
     //doneCurrent();
 }
 
@@ -24,6 +24,7 @@
 #include <QMutex>
 #include <QFont>
 #include <QMatrix4x4>
+#include <QOpenGLBuffer>
 #include "dsp/dsptypes.h"
 #include "dsp/scopevisng.h"
 #include "gui/scaleengine.h"
@@ -33,6 +34,7 @@
 #include "util/bitfieldindex.h"
 
 class QPainter;
+class QVector4D;
 
 class SDRANGEL_API GLScopeNG: public QGLWidget {
     Q_OBJECT
@@ -51,11 +53,12 @@ public:
 
     void connectTimer(const QTimer& timer);
 
-    void setTraces(std::vector<ScopeVisNG::TraceData>* tracesData, std::vector<float *>* traces);
-    void newTraces(std::vector<float *>* traces);
+    void setTraces(std::vector<ScopeVisNG::TraceData>* tracesData, std::vector<float *>* traces, std::vector<ScopeVisNG::TraceLOD>* tracesLOD);
+    void newTraces(std::vector<float *>* traces, std::vector<ScopeVisNG::TraceLOD>* tracesLOD);
 
     int getSampleRate() const { return m_sampleRate; }
     int getTraceSize() const { return m_traceSize; }
+    int getTraceLODWidth() const { return m_traceLODWidth; } //!< pixel width the traces are reduced to (0 if not known yet)
 
     void setTriggerPre(uint32_t triggerPre); //!< number of samples
     void setTimeOfsProMill(int timeOfsProMill);
@@ -78,8 +81,21 @@ signals:
     void sampleRateChanged(int);
 
 private:
+    struct TraceBuffer
+    {
+        QOpenGLBuffer *m_buffer; //!< persistent vertex buffer
+        int m_capacity;          //!< allocated size in bytes
+        int m_nbVertices;        //!< number of vertices uploaded
+
+        TraceBuffer() : m_buffer(0), m_capacity(0), m_nbVertices(0) {}
+    };
+
     std::vector<ScopeVisNG::TraceData> *m_tracesData;
     std::vector<float *> *m_traces;
+    std::vector<ScopeVisNG::TraceLOD> *m_tracesLOD;
+    std::vector<TraceBuffer> m_traceBuffers; //!< GPU copy of the displayed part of the time traces
+    bool m_traceBuffersValid;                //!< false when the traces must be uploaded again
+    int m_traceLODWidth;
     ScopeVisNG::TriggerData m_focusedTriggerData;
     //int m_traceCounter;
     uint32_t m_bufferIndex;
@@ -141,6 +157,8 @@ private:
     void paintGL();
 
     void applyConfig();
+    void uploadTraces(); //!< copy the displayed window of the traces (or their reduction to screen resolution) to the GPU
+    void drawTrace(const QMatrix4x4& transformMatrix, const QVector4D& color, unsigned int traceIndex);
     void setYScale(ScaleEngine& scale, uint32_t highlightedTraceIndex);
     void setUniqueDisplays();     //!< Arrange displays when X and Y are unique on screen
     void setVerticalDisplays();   //!< Arrange displays when X and Y are stacked vertically
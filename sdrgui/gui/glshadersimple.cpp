@@ -16,6 +16,7 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <QOpenGLShaderProgram>
+#include <QOpenGLBuffer>
 #include <QOpenGLFunctions>
 #include <QOpenGLContext>
 #include <QMatrix4x4>
@@ -64,6 +65,11 @@ void GLShaderSimple::drawPolyline(const QMatrix4x4& transformMatrix, const QVect
 	draw(GL_LINE_STRIP, transformMatrix, color, vertices, nbVertices);
 }
 
+void GLShaderSimple::drawPolyline(const QMatrix4x4& transformMatrix, const QVector4D& color, QOpenGLBuffer& vertexBuffer, int nbVertices)
+{
+	draw(GL_LINE_STRIP, transformMatrix, color, vertexBuffer, nbVertices);
+}
+
 void GLShaderSimple::drawSegments(const QMatrix4x4& transformMatrix, const QVector4D& color, GLfloat *vertices, int nbVertices)
 {
 	draw(GL_LINES, transformMatrix, color, vertices, nbVertices);
@@ -95,6 +101,24 @@ void GLShaderSimple::draw(unsigned int mode, const QMatrix4x4& transformMatrix,
 	m_program->release();
 }
 
+void GLShaderSimple::draw(unsigned int mode, const QMatrix4x4& transformMatrix, const QVector4D& color, QOpenGLBuffer& vertexBuffer, int nbVertices)
+{
+	QOpenGLFunctions *f = QOpenGLContext::currentContext()->functions();
+	m_program->bind();
+	m_program->setUniformValue(m_matrixLoc, transformMatrix);
+	m_program->setUniformValue(m_colorLoc, color);
+	f->glEnable(GL_BLEND);
+	f->glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	f->glLineWidth(1.0f);
+	vertexBuffer.bind();
+	f->glEnableVertexAttribArray(0); // vertex
+	f->glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0); // offset in the bound buffer
+	f->glDrawArrays(mode, 0, nbVertices);
+	f->glDisableVertexAttribArray(0);
+	vertexBuffer.release();
+	m_program->release();
+}
+
 void GLShaderSimple::cleanup()
 {
 	if (m_program)
@@ -22,6 +22,7 @@
 #include <QOpenGLFunctions>
 
 class QOpenGLShaderProgram;
+class QOpenGLBuffer;
 class QMatrix4x4;
 class QVector4D;
 
@@ -33,6 +34,7 @@ public:
 
 	void initializeGL();
 	void drawPolyline(const QMatrix4x4& transformMatrix, const QVector4D& color, GLfloat *vertices, int nbVertices);
+	void drawPolyline(const QMatrix4x4& transformMatrix, const QVector4D& color, QOpenGLBuffer& vertexBuffer, int nbVertices); //!< vertices already in GPU memory
 	void drawSegments(const QMatrix4x4& transformMatrix, const QVector4D& color, GLfloat *vertices, int nbVertices);
 	void drawContour(const QMatrix4x4& transformMatrix, const QVector4D& color, GLfloat *vertices, int nbVertices);
 	void drawSurface(const QMatrix4x4& transformMatrix, const QVector4D& color, GLfloat *vertices, int nbVertices);
@@ -40,6 +42,7 @@ public:
 
 private:
 	void draw(unsigned int mode, const QMatrix4x4& transformMatrix, const QVector4D& color, GLfloat *vertices, int nbVertices);
+	void draw(unsigned int mode, const QMatrix4x4& transformMatrix, const QVector4D& color, QOpenGLBuffer& vertexBuffer, int nbVertices);
 
 	QOpenGLShaderProgram *m_program;
 	int m_matrixLoc;
@@ -38,6 +38,9 @@ GLSpectrum::GLSpectrum(QWidget* parent) :
 	m_powerRange(100),
 	m_decay(0),
 	m_sampleRate(500000),
+	m_zoomLog2(0),
+	m_zoomPos(0),
+	m_linePeriod(0),
 	m_fftSize(512),
 	m_displayGrid(true),
 	m_displayGridIntensity(5),
@@ -196,6 +199,39 @@ void GLSpectrum::setSampleRate(qint32 sampleRate)
 	update();
 }
 
+void GLSpectrum::setZoom(int zoomLog2, Real zoomPos)
+{
+	m_zoomLog2 = zoomLog2;
+	m_zoomPos = zoomPos;
+	m_changesPending = true;
+	update();
+}
+
+void GLSpectrum::setLinePeriod(int linePeriod)
+{
+	m_linePeriod = linePeriod;
+	m_changesPending = true;
+	update();
+}
+
+qint64 GLSpectrum::getSpanCenterFrequency() const
+{
+	if (m_ssbSpectrum) { // not zoomed
+		return m_centerFrequency;
+	} else {
+		return m_centerFrequency + (qint64) (m_zoomPos * m_sampleRate);
+	}
+}
+
+quint32 GLSpectrum::getSpanSampleRate() const
+{
+	if (m_ssbSpectrum) {
+		return m_sampleRate;
+	} else {
+		return m_sampleRate >> m_zoomLog2;
+	}
+}
+
 void GLSpectrum::setDisplayWaterfall(bool display)
 {
 	m_displayWaterfall = display;
@@ -588,7 +624,7 @@ void GLSpectrum::paintGL()
 			for (int i = 0; i < m_channelMarkerStates.size(); ++i)
 			{
 				ChannelMarkerState* dv = m_channelMarkerStates[i];
-				if (dv->m_channelMarker->getVisible())
+				if (dv->m_channelMarker->getVisible() && dv->m_inSpan)
 				{
 					{
 						GLfloat q3[] {
@@ -676,7 +712,7 @@ void GLSpectrum::paintGL()
 			for(int i = 0; i < m_channelMarkerStates.size(); ++i)
 			{
 				ChannelMarkerState* dv = m_channelMarkerStates[i];
-				if(dv->m_channelMarker->getVisible())
+				if(dv->m_channelMarker->getVisible() && dv->m_inSpan)
 				{
 					{
 						GLfloat q3[] {
@@ -767,7 +803,7 @@ void GLSpectrum::paintGL()
 			ChannelMarkerState* dv = m_channelMarkerStates[i];
 
 			// frequency scale channel overlay
-			if(dv->m_channelMarker->getVisible())
+			if(dv->m_channelMarker->getVisible() && dv->m_inSpan)
 			{
 				{
 					GLfloat q3[] {
@@ -1037,15 +1073,15 @@ void GLSpectrum::applyChanges()
 
 		if(m_sampleRate > 0)
 		{
-			float scaleDiv = (float)m_sampleRate * (m_ssbSpectrum ? 2 : 1);
+			float scaleDiv = (float)getSpanSampleRate() * (m_ssbSpectrum ? 2 : 1);
 
 			if(!m_invertedWaterfall)
 			{
-				m_timeScale.setRange(Unit::Time, (waterfallHeight * m_fftSize) / scaleDiv, 0);
+				m_timeScale.setRange(Unit::Time, (waterfallHeight * (float) getLinePeriod()) / scaleDiv, 0);
 			}
 			else
 			{
-				m_timeScale.setRange(Unit::Time, 0, (waterfallHeight * m_fftSize) / scaleDiv);
+				m_timeScale.setRange(Unit::Time, 0, (waterfallHeight * (float) getLinePeriod()) / scaleDiv);
 			}
 		}
 		else
@@ -1065,7 +1101,7 @@ void GLSpectrum::applyChanges()
 		leftMargin += 2 * M;
 
 		m_frequencyScale.setSize(width() - leftMargin - rightMargin);
-		m_frequencyScale.setRange(Unit::Frequency, m_centerFrequency - m_sampleRate / 2, m_centerFrequency + m_sampleRate / 2);
+		m_frequencyScale.setRange(Unit::Frequency, getSpanCenterFrequency() - getSpanSampleRate() / 2, getSpanCenterFrequency() + getSpanSampleRate() / 2);
 		m_frequencyScale.setMakeOpposite(m_lsbDisplay);
 
 		m_glWaterfallBoxMatrix.setToIdentity();
@@ -1135,15 +1171,15 @@ void GLSpectrum::applyChanges()
 
 		if(m_sampleRate > 0)
 		{
-			float scaleDiv = (float)m_sampleRate * (m_ssbSpectrum ? 2 : 1);
+			float scaleDiv = (float)getSpanSampleRate() * (m_ssbSpectrum ? 2 : 1);
 
 			if(!m_invertedWaterfall)
 			{
-				m_timeScale.setRange(Unit::Time, (waterfallHeight * m_fftSize) / scaleDiv, 0);
+				m_timeScale.setRange(Unit::Time, (waterfallHeight * (float) getLinePeriod()) / scaleDiv, 0);
 			}
 			else
 			{
-				m_timeScale.setRange(Unit::Time, 0, (waterfallHeight * m_fftSize) / scaleDiv);
+				m_timeScale.setRange(Unit::Time, 0, (waterfallHeight * (float) getLinePeriod()) / scaleDiv);
 			}
 		}
 		else
@@ -1162,7 +1198,7 @@ void GLSpectrum::applyChanges()
 		leftMargin += 2 * M;
 
 		m_frequencyScale.setSize(width() - leftMargin - rightMargin);
-		m_frequencyScale.setRange(Unit::Frequency, m_centerFrequency - m_sampleRate / 2.0, m_centerFrequency + m_sampleRate / 2.0);
+		m_frequencyScale.setRange(Unit::Frequency, getSpanCenterFrequency() - getSpanSampleRate() / 2.0, getSpanCenterFrequency() + getSpanSampleRate() / 2.0);
 		m_frequencyScale.setMakeOpposite(m_lsbDisplay);
 
 		m_glWaterfallBoxMatrix.setToIdentity();
@@ -1214,7 +1250,7 @@ void GLSpectrum::applyChanges()
 		leftMargin += 2 * M;
 
 		m_frequencyScale.setSize(width() - leftMargin - rightMargin);
-		m_frequencyScale.setRange(Unit::Frequency, m_centerFrequency - m_sampleRate / 2, m_centerFrequency + m_sampleRate / 2);
+		m_frequencyScale.setRange(Unit::Frequency, getSpanCenterFrequency() - getSpanSampleRate() / 2, getSpanCenterFrequency() + getSpanSampleRate() / 2);
 		m_frequencyScale.setMakeOpposite(m_lsbDisplay);
 
 		m_glHistogramSpectrumMatrix.setToIdentity();
@@ -1268,6 +1304,9 @@ void GLSpectrum::applyChanges()
 	}
 
 	// channel overlays
+	qint64 spanCenterFrequency = getSpanCenterFrequency();
+	float spanSampleRate = getSpanSampleRate();
+
 	for(int i = 0; i < m_channelMarkerStates.size(); ++i)
 	{
 		ChannelMarkerState* dv = m_channelMarkerStates[i];
@@ -1303,7 +1342,7 @@ void GLSpectrum::applyChanges()
 			 1.0f
 		);
 		glMatrixDsb.scale(
-			2.0f * (dsbw / (float)m_sampleRate),
+			2.0f * (dsbw / spanSampleRate),
 			-2.0f
 		);
 
@@ -1346,7 +1385,7 @@ void GLSpectrum::applyChanges()
 			 1.0f
 		);
 		glMatrix.scale(
-			2.0f * ((pw-nw) / (float)m_sampleRate),
+			2.0f * ((pw-nw) / spanSampleRate),
 			-2.0f
 		);
 
@@ -1389,7 +1428,14 @@ void GLSpectrum::applyChanges()
 			1);
 		*/
 
-		if(m_displayHistogram || m_displayMaxHold || m_displayCurrent || m_displayWaterfall)
+		// when zoomed the markers outside the span are not drawn and cannot be grabbed
+		dv->m_inSpan = (xc + dsbw/2 >= spanCenterFrequency - spanSampleRate/2) && (xc - dsbw/2 <= spanCenterFrequency + spanSampleRate/2);
+
+		if (!dv->m_inSpan || (xc < spanCenterFrequency - spanSampleRate/2) || (xc > spanCenterFrequency + spanSampleRate/2))
+		{
+			dv->m_rect = QRect();
+		}
+		else if(m_displayHistogram || m_displayMaxHold || m_displayCurrent || m_displayWaterfall)
 		{
 			dv->m_rect.setRect(m_frequencyScale.getPosFromValue(xc) + leftMargin - 1,
 			topMargin,
@@ -1466,7 +1512,7 @@ void GLSpectrum::applyChanges()
 			// Frequency overlay on highlighted marker
 			for(int i = 0; i < m_channelMarkerStates.size(); ++i) {
 				ChannelMarkerState* dv = m_channelMarkerStates[i];
-				if (dv->m_channelMarker->getHighlighted())
+				if (dv->m_channelMarker->getHighlighted() && dv->m_inSpan)
 				{
 					qreal xc;
 					int shift;
@@ -1491,7 +1537,7 @@ void GLSpectrum::applyChanges()
                         ftext = QString::number((m_centerFrequency + dv->m_channelMarker->getCenterFrequency())/1e6, 'f', 6);
                         break;
 					}
-					if (dv->m_channelMarker->getCenterFrequency() < 0) { // left half of scale
+					if (xc < getSpanCenterFrequency()) { // left half of scale
 						ftext = " " + ftext;
 						shift = 0;
 					} else { // right half of scale
@@ -60,6 +60,8 @@ public:
 	void setDisplayGrid(bool display);
 	void setDisplayGridIntensity(int intensity);
 	void setDisplayTraceIntensity(int intensity);
+	void setZoom(int zoomLog2, Real zoomPos); //!< display 1/2^zoomLog2 of the sample rate centered at zoomPos times the sample rate from the center frequency
+	void setLinePeriod(int linePeriod); //!< samples at the displayed span rate between two waterfall lines, 0 for one FFT size
 
 	void addChannelMarker(ChannelMarker* channelMarker);
 	void removeChannelMarker(ChannelMarker* channelMarker);
@@ -81,9 +83,11 @@ private:
 		QMatrix4x4 m_glMatrixHistogram;
 		QMatrix4x4 m_glMatrixDsbHistogram;
 		QRect m_rect;
+		bool m_inSpan; //!< marker overlaps the displayed (possibly zoomed) span
 
 		ChannelMarkerState(ChannelMarker* channelMarker) :
-			m_channelMarker(channelMarker)
+			m_channelMarker(channelMarker),
+			m_inSpan(true)
 		{ }
 	};
 	QList<ChannelMarkerState*> m_channelMarkerStates;
@@ -109,6 +113,9 @@ private:
 	Real m_powerRange;
 	int m_decay;
 	quint32 m_sampleRate;
+	int m_zoomLog2;
+	Real m_zoomPos;
+	int m_linePeriod;
 
 	int m_fftSize;
 
@@ -174,6 +181,10 @@ private:
 	void resizeGL(int width, int height);
 	void paintGL();
 
+	qint64 getSpanCenterFrequency() const;
+	quint32 getSpanSampleRate() const;
+	int getLinePeriod() const { return m_linePeriod > 0 ? m_linePeriod : m_fftSize; }
+
 	void stopDrag();
 	void applyChanges();
 
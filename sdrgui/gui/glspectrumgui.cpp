@@ -14,6 +14,8 @@ GLSpectrumGUI::GLSpectrumGUI(QWidget* parent) :
 	m_fftSize(1024),
 	m_fftOverlap(0),
 	m_fftWindow(FFTWindow::Hamming),
+	m_frontEnd(SpectrumVis::FrontEndWindow),
+	m_averaging(1),
 	m_refLevel(0),
 	m_powerRange(100),
 	m_decay(0),
@@ -27,7 +29,9 @@ GLSpectrumGUI::GLSpectrumGUI(QWidget* parent) :
 	m_displayCurrent(false),
 	m_displayHistogram(false),
 	m_displayGrid(false),
-	m_invert(true)
+	m_invert(true),
+	m_zoomLog2(0),
+	m_zoomPos(0.0f)
 {
 	ui->setupUi(this);
 	for(int ref = 0; ref >= -110; ref -= 5)
@@ -54,6 +58,8 @@ void GLSpectrumGUI::resetToDefaults()
 	m_fftSize = 1024;
 	m_fftOverlap = 0;
 	m_fftWindow = FFTWindow::Hamming;
+	m_frontEnd = SpectrumVis::FrontEndWindow;
+	m_averaging = 1;
 	m_refLevel = 0;
 	m_powerRange = 100;
 	m_decay = 0;
@@ -66,6 +72,8 @@ void GLSpectrumGUI::resetToDefaults()
 	m_displayHistogram = false;
 	m_displayGrid = false;
 	m_invert = true;
+	m_zoomLog2 = 0;
+	m_zoomPos = 0.0f;
 	applySettings();
 }
 
@@ -90,6 +98,10 @@ QByteArray GLSpectrumGUI::serialize() const
 	s.writeBool(16, m_displayCurrent);
 	s.writeS32(17, m_displayTraceIntensity);
 	s.writeReal(18, m_glSpectrum->getWaterfallShare());
+	s.writeS32(19, m_zoomLog2);
+	s.writeReal(20, m_zoomPos);
+	s.writeS32(21, m_frontEnd);
+	s.writeS32(22, m_averaging);
 	return s.final();
 }
 
@@ -123,6 +135,10 @@ bool GLSpectrumGUI::deserialize(const QByteArray& data)
 		Real waterfallShare;
 		d.readReal(18, &waterfallShare, 0.66);
 		m_glSpectrum->setWaterfallShare(waterfallShare);
+		d.readS32(19, &m_zoomLog2, 0);
+		d.readReal(20, &m_zoomPos, 0.0f);
+		d.readS32(21, &m_frontEnd, SpectrumVis::FrontEndWindow);
+		d.readS32(22, &m_averaging, 1);
 		applySettings();
 		return true;
 	} else {
@@ -140,6 +156,20 @@ void GLSpectrumGUI::applySettings()
 			break;
 		}
 	}
+	ui->fftOverlap->blockSignals(true);
+	ui->fftOverlap->setCurrentIndex(m_fftOverlap / 25 < ui->fftOverlap->count() ? m_fftOverlap / 25 : ui->fftOverlap->count() - 1);
+	ui->fftOverlap->blockSignals(false);
+	ui->frontEnd->blockSignals(true);
+	ui->frontEnd->setCurrentIndex(m_frontEnd == SpectrumVis::FrontEndWOLA ? 1 : 0);
+	ui->frontEnd->blockSignals(false);
+	ui->averaging->blockSignals(true);
+	for (int i = 0; i < ui->averaging->count(); i++) {
+		if (m_averaging <= (1 << i)) {
+			ui->averaging->setCurrentIndex(i);
+			break;
+		}
+	}
+	ui->averaging->blockSignals(false);
 	ui->refLevel->setCurrentIndex(-m_refLevel / 5);
 	ui->levelRange->setCurrentIndex((100 - m_powerRange) / 5);
 	ui->decay->setSliderPosition(m_decay);
@@ -152,6 +182,13 @@ void GLSpectrumGUI::applySettings()
 	ui->invert->setChecked(m_invert);
 	ui->grid->setChecked(m_displayGrid);
 	ui->gridIntensity->setSliderPosition(m_displayGridIntensity);
+	ui->zoom->blockSignals(true);
+	m_zoomLog2 = m_zoomLog2 < 0 ? 0 : m_zoomLog2 >= ui->zoom->count() ? ui->zoom->count() - 1 : m_zoomLog2;
+	ui->zoom->setCurrentIndex(m_zoomLog2);
+	ui->zoom->blockSignals(false);
+	ui->zoomPos->blockSignals(true);
+	ui->zoomPos->setValue(m_zoomPos * 1000.0f);
+	ui->zoomPos->blockSignals(false);
 
 	ui->decay->setToolTip(QString("Decay: %1").arg(m_decay));
 	ui->holdoff->setToolTip(QString("Holdoff: %1").arg(m_histogramLateHoldoff));
@@ -171,7 +208,41 @@ void GLSpectrumGUI::applySettings()
 	m_glSpectrum->setDisplayGrid(m_displayGrid);
 	m_glSpectrum->setDisplayGridIntensity(m_displayGridIntensity);
 
-	m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow);
+	applyZoom();
+	applyLinePeriod();
+}
+
+void GLSpectrumGUI::applyZoom()
+{
+	m_zoomLog2 = ui->zoom->currentIndex();
+
+	// the zoomed span must stay inside the baseband
+	Real maxPos = 0.5f - 0.5f / (1 << m_zoomLog2);
+	m_zoomPos = ui->zoomPos->value() / 1000.0f;
+	m_zoomPos = m_zoomPos < -maxPos ? -maxPos : m_zoomPos > maxPos ? maxPos : m_zoomPos;
+
+	ui->zoomPos->setEnabled(m_zoomLog2 > 0);
+	ui->zoomPos->setToolTip(QString("Zoom center: %1 % of sample rate").arg(m_zoomPos * 100.0f, 0, 'f', 1));
+
+	if (m_glSpectrum != NULL) {
+		m_glSpectrum->setZoom(m_zoomLog2, m_zoomPos);
+	}
+
+	if (m_spectrumVis != NULL) {
+		m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow, m_zoomLog2, m_zoomPos,
+			(SpectrumVis::FrontEnd) m_frontEnd, m_averaging);
+	}
+}
+
+void GLSpectrumGUI::applyLinePeriod()
+{
+	// a waterfall line is one averaged spectrum made of m_averaging FFTs each refilled by the non overlapping part
+	int overlapSize = (m_fftSize * m_fftOverlap) / 100;
+	int refillSize = overlapSize < m_fftSize ? m_fftSize - overlapSize : 1;
+
+	if (m_glSpectrum != NULL) {
+		m_glSpectrum->setLinePeriod(m_averaging * refillSize);
+	}
 }
 
 void GLSpectrumGUI::on_fftWindow_currentIndexChanged(int index)
@@ -179,14 +250,43 @@ void GLSpectrumGUI::on_fftWindow_currentIndexChanged(int index)
 	m_fftWindow = index;
 	if(m_spectrumVis == NULL)
 		return;
-	m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow);
+	m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow, m_zoomLog2, m_zoomPos,
+			(SpectrumVis::FrontEnd) m_frontEnd, m_averaging);
 }
 
 void GLSpectrumGUI::on_fftSize_currentIndexChanged(int index)
 {
 	m_fftSize = 1 << (7 + index);
 	if(m_spectrumVis != NULL)
-		m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow);
+		m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow, m_zoomLog2, m_zoomPos,
+			(SpectrumVis::FrontEnd) m_frontEnd, m_averaging);
+	applyLinePeriod();
+}
+
+void GLSpectrumGUI::on_fftOverlap_currentIndexChanged(int index)
+{
+	m_fftOverlap = 25 * index;
+	if(m_spectrumVis != NULL)
+		m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow, m_zoomLog2, m_zoomPos,
+			(SpectrumVis::FrontEnd) m_frontEnd, m_averaging);
+	applyLinePeriod();
+}
+
+void GLSpectrumGUI::on_frontEnd_currentIndexChanged(int index)
+{
+	m_frontEnd = index == 1 ? SpectrumVis::FrontEndWOLA : SpectrumVis::FrontEndWindow;
+	if(m_spectrumVis != NULL)
+		m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow, m_zoomLog2, m_zoomPos,
+			(SpectrumVis::FrontEnd) m_frontEnd, m_averaging);
+}
+
+void GLSpectrumGUI::on_averaging_currentIndexChanged(int index)
+{
+	m_averaging = 1 << index;
+	if(m_spectrumVis != NULL)
+		m_spectrumVis->configure(m_messageQueue, m_fftSize, m_fftOverlap, (FFTWindow::Function)m_fftWindow, m_zoomLog2, m_zoomPos,
+			(SpectrumVis::FrontEnd) m_frontEnd, m_averaging);
+	applyLinePeriod();
 }
 
 void GLSpectrumGUI::on_refLevel_currentIndexChanged(int index)
@@ -298,3 +398,13 @@ void GLSpectrumGUI::on_clearSpectrum_clicked(bool checked __attribute__((unused)
 	if(m_glSpectrum != NULL)
 		m_glSpectrum->clearSpectrumHistogram();
 }
+
+void GLSpectrumGUI::on_zoom_currentIndexChanged(int index __attribute__((unused)))
+{
+	applyZoom();
+}
+
+void GLSpectrumGUI::on_zoomPos_valueChanged(int value __attribute__((unused)))
+{
+	applyZoom();
+}
@@ -37,6 +37,8 @@ private:
 	qint32 m_fftSize;
 	qint32 m_fftOverlap;
 	qint32 m_fftWindow;
+	qint32 m_frontEnd;
+	qint32 m_averaging;
 	Real m_refLevel;
 	Real m_powerRange;
 	int m_decay;
@@ -51,12 +53,19 @@ private:
 	bool m_displayHistogram;
 	bool m_displayGrid;
 	bool m_invert;
+	int m_zoomLog2;  //!< zoom factor is 2^m_zoomLog2
+	Real m_zoomPos;  //!< zoom center relative to the baseband center as a fraction of the sample rate
 
 	void applySettings();
+	void applyZoom();
+	void applyLinePeriod();
 
 private slots:
 	void on_fftWindow_currentIndexChanged(int index);
 	void on_fftSize_currentIndexChanged(int index);
+	void on_fftOverlap_currentIndexChanged(int index);
+	void on_frontEnd_currentIndexChanged(int index);
+	void on_averaging_currentIndexChanged(int index);
 	void on_refLevel_currentIndexChanged(int index);
 	void on_levelRange_currentIndexChanged(int index);
 	void on_decay_valueChanged(int index);
@@ -72,6 +81,8 @@ private slots:
 	void on_invert_toggled(bool checked);
 	void on_grid_toggled(bool checked);
 	void on_clearSpectrum_clicked(bool checked);
+	void on_zoom_currentIndexChanged(int index);
+	void on_zoomPos_valueChanged(int value);
 };
 
 #endif // INCLUDE_GLSPECTRUMGUI_H
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QFileDialog>
+#include <QMessageBox>
+
+#include "device/devicesourceapi.h"
+#include "dsp/pretriggerrecord.h"
+
+#include "pretriggerrecorddialog.h"
+#include "ui_pretriggerrecorddialog.h"
+
+PreTriggerRecordDialog::PreTriggerRecordDialog(DeviceSourceAPI *deviceSourceAPI, int deviceSetIndex, QWidget* parent) :
+    QDialog(parent),
+    ui(new Ui::PreTriggerRecordDialog),
+    m_deviceSourceAPI(deviceSourceAPI)
+{
+    ui->setupUi(this);
+    setWindowTitle(tr("Pre-trigger recorder R%1").arg(deviceSetIndex));
+    displaySettings();
+    refresh();
+
+    connect(&m_refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    m_refreshTimer.start(500);
+}
+
+PreTriggerRecordDialog::~PreTriggerRecordDialog()
+{
+    m_refreshTimer.stop();
+    delete ui;
+}
+
+void PreTriggerRecordDialog::displaySettings()
+{
+    const PreTriggerRecord::Settings& settings = m_deviceSourceAPI->getPreTriggerRecordSettings();
+    bool armed = m_deviceSourceAPI->isPreTriggerRecordArmed();
+
+    ui->fileBase->setText(settings.m_fileBase);
+    ui->preTriggerTime->setValue(settings.m_preTriggerTime);
+    ui->postTriggerTime->setValue(settings.m_postTriggerTime);
+    ui->hugePages->setChecked(settings.m_hugePages);
+    ui->squelchChannel->setValue(settings.m_squelchChannelIndex);
+
+    ui->arm->blockSignals(true);
+    ui->arm->setChecked(armed);
+    ui->arm->blockSignals(false);
+    ui->settings->setEnabled(!armed);
+}
+
+void PreTriggerRecordDialog::on_fileBaseSelect_clicked()
+{
+    QString fileBase = QFileDialog::getSaveFileName(this,
+        tr("Base name of the recordings"), ui->fileBase->text(), tr("SDRangel I/Q (*.sdriq)"), 0, QFileDialog::DontConfirmOverwrite);
+
+    if (fileBase.endsWith(".sdriq")) {
+        fileBase.chop(6);
+    }
+
+    if (!fileBase.isEmpty()) {
+        ui->fileBase->setText(fileBase);
+    }
+}
+
+void PreTriggerRecordDialog::on_arm_toggled(bool checked)
+{
+    if (checked)
+    {
+        PreTriggerRecord::Settings settings;
+        QString errorMessage;
+        settings.m_fileBase = ui->fileBase->text().isEmpty() ? settings.m_fileBase : ui->fileBase->text();
+        settings.m_preTriggerTime = ui->preTriggerTime->value();
+        settings.m_postTriggerTime = ui->postTriggerTime->value();
+        settings.m_hugePages = ui->hugePages->isChecked();
+        settings.m_squelchChannelIndex = ui->squelchChannel->value();
+
+        if (!m_deviceSourceAPI->armPreTriggerRecord(settings, errorMessage)) {
+            QMessageBox::warning(this, tr("Pre-trigger recorder"), tr("Cannot arm the recorder: %1").arg(errorMessage));
+        }
+    }
+    else
+    {
+        m_deviceSourceAPI->disarmPreTriggerRecord();
+    }
+
+    displaySettings();
+    refresh();
+}
+
+void PreTriggerRecordDialog::on_trigger_clicked()
+{
+    m_deviceSourceAPI->triggerPreTriggerRecord();
+    refresh();
+}
+
+void PreTriggerRecordDialog::on_stop_clicked()
+{
+    m_deviceSourceAPI->stopPreTriggerRecord();
+    refresh();
+}
+
+void PreTriggerRecordDialog::refresh()
+{
+    PreTriggerRecord::Report report;
+
+    if (!m_deviceSourceAPI->getPreTriggerRecordReport(report))
+    {
+        ui->trigger->setEnabled(false);
+        ui->stop->setEnabled(false);
+        ui->status->setText(tr("Not armed"));
+        return;
+    }
+
+    ui->trigger->setEnabled(true);
+    ui->stop->setEnabled(report.m_recording);
+
+    QString status = tr("%1  buffer %2 / %3 s  %4 MB%5\ntriggers %6  files %7  written %8 MB  dropped %9 samples")
+        .arg(report.m_recording ? tr("Recording") : tr("Waiting for trigger"))
+        .arg(report.m_bufferedTime, 0, 'f', 1)
+        .arg(report.m_bufferTime, 0, 'f', 1)
+        .arg(report.m_bufferSize >> 20)
+        .arg(report.m_hugePages ? tr(" (huge pages)") : QString(""))
+        .arg(report.m_nbTriggers)
+        .arg(report.m_nbFiles)
+        .arg(report.m_writtenBytes >> 20)
+        .arg(report.m_droppedSamples);
+
+    if (!report.m_fileName.isEmpty()) {
+        status += "\n" + report.m_fileName;
+    }
+
+    if (!report.m_errorMessage.isEmpty()) {
+        status += tr("\nError: %1").arg(report.m_errorMessage);
+    }
+
+    ui->status->setText(status);
+}
@@ -0,0 +1,57 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef SDRGUI_GUI_PRETRIGGERRECORDDIALOG_H_
+#define SDRGUI_GUI_PRETRIGGERRECORDDIALOG_H_
+
+#include <QDialog>
+#include <QTimer>
+
+class DeviceSourceAPI;
+
+namespace Ui {
+    class PreTriggerRecordDialog;
+}
+
+/**
+ * Controls the pre-trigger recorder of a receiving device set: settings, arming (allocation
+ * of the buffer), manual trigger and stop. The status is refreshed every half second.
+ * Settings can only be changed while the recorder is not armed.
+ */
+class PreTriggerRecordDialog : public QDialog {
+    Q_OBJECT
+public:
+    explicit PreTriggerRecordDialog(DeviceSourceAPI *deviceSourceAPI, int deviceSetIndex, QWidget* parent = 0);
+    ~PreTriggerRecordDialog();
+
+private:
+    Ui::PreTriggerRecordDialog* ui;
+    DeviceSourceAPI *m_deviceSourceAPI;
+    QTimer m_refreshTimer;
+
+    void displaySettings();
+
+private slots:
+    void on_fileBaseSelect_clicked();
+    void on_arm_toggled(bool checked);
+    void on_trigger_clicked();
+    void on_stop_clicked();
+    void refresh();
+};
+
+#endif /* SDRGUI_GUI_PRETRIGGERRECORDDIALOG_H_ */
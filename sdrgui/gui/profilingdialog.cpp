@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QTreeWidgetItem>
+
+#include "device/deviceuiset.h"
+#include "dsp/dspengine.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/dspdevicesinkengine.h"
+#include "util/profilehistogram.h"
+
+#include "profilingdialog.h"
+#include "ui_profilingdialog.h"
+
+ProfilingDialog::ProfilingDialog(const std::vector<DeviceUISet*>& deviceUIs, QWidget* parent) :
+    QDialog(parent),
+    ui(new Ui::ProfilingDialog),
+    m_deviceUIs(deviceUIs)
+{
+    ui->setupUi(this);
+    m_elapsedTimer.invalidate();
+    refresh();
+
+    for (int i = 0; i < ui->tree->columnCount(); i++) {
+        ui->tree->resizeColumnToContents(i);
+    }
+
+    connect(&m_refreshTimer, SIGNAL(timeout()), this, SLOT(refresh()));
+    m_refreshTimer.start(1000);
+}
+
+ProfilingDialog::~ProfilingDialog()
+{
+    m_refreshTimer.stop();
+    delete ui;
+}
+
+void ProfilingDialog::refresh()
+{
+    qint64 elapsed = m_elapsedTimer.isValid() ? m_elapsedTimer.restart() * 1000000LL : 0; // ns
+    QHash<QString, quint64> processingTimes;
+
+    if (!m_elapsedTimer.isValid()) {
+        m_elapsedTimer.start();
+    }
+
+    ui->tree->clear();
+
+    for (unsigned int i = 0; i < m_deviceUIs.size(); i++)
+    {
+        quint64 busyTime, runningTime, processedSamples;
+        QTreeWidgetItem *deviceItem = new QTreeWidgetItem(ui->tree);
+
+        if (m_deviceUIs[i]->m_deviceSourceEngine)
+        {
+            DSPDeviceSourceEngine *engine = m_deviceUIs[i]->m_deviceSourceEngine;
+            engine->getBusyCounters(busyTime, runningTime, processedSamples);
+            ProfileHistogram workTime;
+            engine->getWorkTime(workTime);
+
+            deviceItem->setText(ColName, tr("R%1 DSP engine").arg(i));
+            deviceItem->setText(ColCalls, QString::number(workTime.getCount()));
+            deviceItem->setText(ColSamplesOut, QString::number(processedSamples));
+            setDurations(deviceItem, workTime);
+
+            std::vector<ThreadedBasebandSampleSink::Report> reports;
+            std::vector<ThreadedBasebandSampleSink::Report> directReports;
+            engine->getThreadedSinksReports(reports);
+            engine->getDirectSinksReports(directReports);
+            reports.insert(reports.end(), directReports.begin(), directReports.end());
+
+            for (unsigned int j = 0; j < reports.size(); j++)
+            {
+                const ThreadedBasebandSampleSink::Report& report = reports[j];
+                QString key = QString("R%1:%2:%3").arg(i).arg(j).arg(report.m_name);
+                QTreeWidgetItem *sinkItem = new QTreeWidgetItem(deviceItem);
+
+                sinkItem->setText(ColName, report.m_direct ? tr("%1 (direct)").arg(report.m_name) : report.m_name);
+                sinkItem->setText(ColCalls, QString::number(report.m_feedTime.getCount()));
+                sinkItem->setText(ColSamplesIn, QString::number(report.m_samplesIn));
+                sinkItem->setText(ColSamplesOut, QString::number(report.m_processedSamples));
+
+                if (!report.m_direct)
+                {
+                    sinkItem->setText(ColDropped, QString::number(report.m_fifoDroppedSamples));
+                    sinkItem->setText(ColFifoMaxFill, QString("%1/%2").arg(report.m_fifoMaxFill).arg(report.m_fifoSize));
+                }
+
+                setLoad(sinkItem, key, report.m_processingTime, elapsed);
+                setDurations(sinkItem, report.m_feedTime);
+                processingTimes.insert(key, report.m_processingTime);
+            }
+        }
+        else if (m_deviceUIs[i]->m_deviceSinkEngine)
+        {
+            m_deviceUIs[i]->m_deviceSinkEngine->getBusyCounters(busyTime, runningTime, processedSamples);
+            deviceItem->setText(ColName, tr("T%1 DSP engine").arg(i));
+            deviceItem->setText(ColSamplesOut, QString::number(processedSamples));
+        }
+        else
+        {
+            continue;
+        }
+
+        // the engine load is over the running time as in the metrics
+        deviceItem->setText(ColLoad, runningTime == 0 ? QString("-") : QString::number((busyTime * 100.0) / runningTime, 'f', 1));
+    }
+
+    AudioOutput::Counters audioCounters;
+    DSPEngine::instance()->getAudioOutputCounters(audioCounters);
+    QTreeWidgetItem *audioItem = new QTreeWidgetItem(ui->tree);
+    audioItem->setText(ColName, tr("Audio output: %1 FIFOs, %2 overruns, %3 underruns")
+            .arg(audioCounters.m_nbFifos)
+            .arg(audioCounters.m_overrunCount)
+            .arg(audioCounters.m_underrunCount));
+    audioItem->setText(ColDropped, QString::number(audioCounters.m_droppedSamples));
+
+    ui->tree->expandAll();
+    m_previousProcessingTimes = processingTimes;
+}
+
+void ProfilingDialog::setDurations(QTreeWidgetItem *item, const ProfileHistogram& histogram)
+{
+    if (histogram.getCount() == 0) {
+        return;
+    }
+
+    item->setText(ColP50, QString::number(histogram.getPercentile(50.0) / 1000.0, 'f', 1));
+    item->setText(ColP99, QString::number(histogram.getPercentile(99.0) / 1000.0, 'f', 1));
+    item->setText(ColMax, QString::number(histogram.getMax() / 1000.0, 'f', 1));
+}
+
+void ProfilingDialog::setLoad(QTreeWidgetItem *item, const QString& key, quint64 processingTime, qint64 elapsed)
+{
+    QHash<QString, quint64>::const_iterator it = m_previousProcessingTimes.find(key);
+
+    if ((elapsed <= 0) || (it == m_previousProcessingTimes.end()) || (processingTime < it.value())) {
+        item->setText(ColLoad, "-");
+    } else {
+        item->setText(ColLoad, QString::number(((processingTime - it.value()) * 100.0) / elapsed, 'f', 1));
+    }
+}
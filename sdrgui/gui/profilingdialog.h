@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 F4EXB                                                      //
+// written by Edouard Griffiths                                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRGUI_GUI_PROFILINGDIALOG_H_
+#define SDRGUI_GUI_PROFILINGDIALOG_H_
+
+#include <vector>
+
+#include <QDialog>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QHash>
+
+struct DeviceUISet;
+class QTreeWidgetItem;
+class ProfileHistogram;
+
+namespace Ui {
+    class ProfilingDialog;
+}
+
+/**
+ * Shows the DSP engine and baseband sinks counters of each device set refreshed every second:
+ * feed calls, samples in and out, FIFO high water mark, load and feed durations percentiles.
+ * The load of a sink is its processing time relative to the time elapsed since the last refresh.
+ * A last row shows the audio output FIFOs overruns, dropped samples and underruns.
+ */
+class ProfilingDialog : public QDialog {
+    Q_OBJECT
+public:
+    explicit ProfilingDialog(const std::vector<DeviceUISet*>& deviceUIs, QWidget* parent = 0);
+    ~ProfilingDialog();
+
+private:
+    enum Column
+    {
+        ColName,
+        ColCalls,
+        ColSamplesIn,
+        ColSamplesOut,
+        ColDropped,
+        ColFifoMaxFill,
+        ColLoad,
+        ColP50,
+        ColP99,
+        ColMax
+    };
+
+    Ui::ProfilingDialog* ui;
+    const std::vector<DeviceUISet*>& m_deviceUIs;
+    QTimer m_refreshTimer;
+    QElapsedTimer m_elapsedTimer;
+    QHash<QString, quint64> m_previousProcessingTimes; //!< by sink key
+
+    void setDurations(QTreeWidgetItem *item, const ProfileHistogram& histogram);
+    void setLoad(QTreeWidgetItem *item, const QString& key, quint64 processingTime, qint64 elapsed);
+
+private slots:
+    void refresh();
+};
+
+#endif /* SDRGUI_GUI_PROFILINGDIALOG_H_ */
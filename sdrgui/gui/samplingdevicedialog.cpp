@@ -18,6 +18,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include "samplingdevicedialog.h"
 #include "ui_samplingdevicedialog.h"
 #include "device/deviceenumerator.h"
@@ -31,8 +33,20 @@ SamplingDeviceDialog::SamplingDeviceDialog(bool rxElseTx, int deviceTabIndex, QW
     m_selectedDeviceIndex(-1)
 {
     ui->setupUi(this);
+    ui->refreshDevices->setEnabled(!DeviceEnumerator::instance()->isRefreshing());
+    connect(DeviceEnumerator::instance(), SIGNAL(devicesChanged()), this, SLOT(devicesChanged()));
+    displayDevices();
+}
+
+SamplingDeviceDialog::~SamplingDeviceDialog()
+{
+    delete ui;
+}
 
+void SamplingDeviceDialog::displayDevices()
+{
     QList<QString> deviceDisplayNames;
+    m_deviceIndexes.clear();
 
     if (m_rxElseTx) {
         DeviceEnumerator::instance()->listRxDeviceNames(deviceDisplayNames, m_deviceIndexes);
@@ -41,16 +55,33 @@ SamplingDeviceDialog::SamplingDeviceDialog(bool rxElseTx, int deviceTabIndex, QW
     }
 
     QStringList devicesNamesList(deviceDisplayNames);
+    ui->deviceSelect->clear();
     ui->deviceSelect->addItems(devicesNamesList);
 }
 
-SamplingDeviceDialog::~SamplingDeviceDialog()
+void SamplingDeviceDialog::on_refreshDevices_clicked()
 {
-    delete ui;
+    ui->refreshDevices->setEnabled(false);
+    DeviceEnumerator::instance()->refreshDevices();
+}
+
+void SamplingDeviceDialog::devicesChanged()
+{
+    int currentIndex = ui->deviceSelect->currentIndex();
+    QString currentName = ui->deviceSelect->currentText();
+    displayDevices();
+    int index = ui->deviceSelect->findText(currentName);
+    ui->deviceSelect->setCurrentIndex(index < 0 ? std::min(currentIndex, ui->deviceSelect->count() - 1) : index);
+    ui->refreshDevices->setEnabled(true);
 }
 
 void SamplingDeviceDialog::accept()
 {
+    if (ui->deviceSelect->currentIndex() < 0) {
+        QDialog::reject();
+        return;
+    }
+
     m_selectedDeviceIndex = m_deviceIndexes[ui->deviceSelect->currentIndex()];
 
     if (m_rxElseTx) {
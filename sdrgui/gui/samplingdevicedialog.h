@@ -43,8 +43,12 @@ private:
     int m_selectedDeviceIndex;
     std::vector<int> m_deviceIndexes;
 
+    void displayDevices();
+
 private slots:
     void accept();
+    void on_refreshDevices_clicked();
+    void devicesChanged();
 };
 
 #endif /* SDRGUI_GUI_SAMPLINGDEVICEDIALOG_H_ */
@@ -42,16 +42,21 @@
 #include "gui/editcommanddialog.h"
 #include "gui/commandoutputdialog.h"
 #include "gui/pluginsdialog.h"
+#include "gui/profilingdialog.h"
+#include "gui/pretriggerrecorddialog.h"
 #include "gui/aboutdialog.h"
 #include "gui/rollupwidget.h"
 #include "gui/channelwindow.h"
 #include "gui/audiodialog.h"
 #include "gui/loggingdialog.h"
+#include "gui/dspthreadsdialog.h"
 #include "gui/samplingdevicecontrol.h"
 #include "gui/mypositiondialog.h"
 #include "dsp/dspengine.h"
+#include "dsp/dspexecutor.h"
 #include "dsp/spectrumvis.h"
 #include "dsp/dspcommands.h"
+#include "dsp/filerecord.h"
 #include "dsp/devicesamplesource.h"
 #include "dsp/devicesamplesink.h"
 #include "plugin/pluginapi.h"
@@ -238,6 +243,12 @@ void MainWindow::addSourceDevice(int deviceIndex)
     m_deviceUIs.push_back(new DeviceUISet(deviceTabIndex, true, m_masterTimer));
     m_deviceUIs.back()->m_deviceSourceEngine = dspDeviceSourceEngine;
 
+    ThreadSchedulingSettings threadScheduling = m_settings.getThreadScheduling(deviceTabIndex);
+
+    if (!threadScheduling.isDefault()) {
+        dspDeviceSourceEngine->setThreadScheduling(threadScheduling);
+    }
+
     char tabNameCStr[16];
     sprintf(tabNameCStr, "R%d", deviceTabIndex);
 
@@ -312,6 +323,12 @@ void MainWindow::addSinkDevice()
     m_deviceUIs.back()->m_deviceSourceEngine = 0;
     m_deviceUIs.back()->m_deviceSinkEngine = dspDeviceSinkEngine;
 
+    ThreadSchedulingSettings threadScheduling = m_settings.getThreadScheduling(deviceTabIndex);
+
+    if (!threadScheduling.isDefault()) {
+        dspDeviceSinkEngine->setThreadScheduling(threadScheduling);
+    }
+
     char tabNameCStr[16];
     sprintf(tabNameCStr, "T%d", deviceTabIndex);
 
@@ -376,6 +393,8 @@ void MainWindow::removeLastDevice()
 	    DSPDeviceSourceEngine *lastDeviceEngine = m_deviceUIs.back()->m_deviceSourceEngine;
 	    lastDeviceEngine->stopAcquistion();
 	    lastDeviceEngine->removeSink(m_deviceUIs.back()->m_spectrumVis);
+	    m_deviceUIs.back()->m_deviceSourceAPI->disarmPreTriggerRecord();
+	    m_deviceUIs.back()->m_deviceSourceAPI->stopSpectrumArchive();
 
 	    ui->tabSpectraGUI->removeTab(ui->tabSpectraGUI->count() - 1);
 	    ui->tabSpectra->removeTab(ui->tabSpectra->count() - 1);
@@ -533,6 +552,9 @@ void MainWindow::loadSettings()
 	qDebug() << "MainWindow::loadSettings";
 
     m_settings.load();
+    m_dspEngine->setDSPThreadPool(m_settings.getUseDSPThreadPool(), m_settings.getDSPThreadPoolSize());
+    FileRecord::setDefaultRecordFormat(m_settings.getRecordSigMF() ? FileRecord::FormatSigMF : FileRecord::FormatSDRiq);
+    ui->action_Record_SigMF->setChecked(m_settings.getRecordSigMF());
     m_settings.sortPresets();
     int middleIndex = m_settings.getPresetCount() / 2;
     QTreeWidgetItem *treeItem;
@@ -1410,6 +1432,27 @@ void MainWindow::on_action_Loaded_Plugins_triggered()
     pluginsDialog.exec();
 }
 
+void MainWindow::on_action_DSP_Profiling_triggered()
+{
+    ProfilingDialog profilingDialog(m_deviceUIs, this);
+    profilingDialog.exec();
+}
+
+void MainWindow::on_action_PreTrigger_Record_triggered()
+{
+    int currentDeviceSetIndex = ui->tabInputsSelect->currentIndex();
+
+    if ((currentDeviceSetIndex >= 0) && (currentDeviceSetIndex < (int) m_deviceUIs.size()) && m_deviceUIs[currentDeviceSetIndex]->m_deviceSourceAPI)
+    {
+        PreTriggerRecordDialog preTriggerRecordDialog(m_deviceUIs[currentDeviceSetIndex]->m_deviceSourceAPI, currentDeviceSetIndex, this);
+        preTriggerRecordDialog.exec();
+    }
+    else
+    {
+        QMessageBox::information(this, tr("Pre-trigger recorder"), tr("Select a receiving device set first"));
+    }
+}
+
 void MainWindow::on_action_Audio_triggered()
 {
 	AudioDialog audioDialog(&m_audioDeviceInfo, this);
@@ -1426,12 +1469,28 @@ void MainWindow::on_action_Logging_triggered()
     setLoggingOptions();
 }
 
+void MainWindow::on_action_DSP_Threads_triggered()
+{
+    DSPExecutor *executor = m_dspEngine->getExecutor();
+    DSPThreadsDialog dspThreadsDialog(m_settings, executor ? executor->getNbThreads() : 0, this);
+
+    if (dspThreadsDialog.exec() == QDialog::Accepted) {
+        m_dspEngine->setDSPThreadPool(m_settings.getUseDSPThreadPool(), m_settings.getDSPThreadPoolSize());
+    }
+}
+
 void MainWindow::on_action_My_Position_triggered()
 {
 	MyPositionDialog myPositionDialog(m_settings, this);
 	myPositionDialog.exec();
 }
 
+void MainWindow::on_action_Record_SigMF_triggered(bool checked)
+{
+    m_settings.setRecordSigMF(checked);
+    FileRecord::setDefaultRecordFormat(checked ? FileRecord::FormatSigMF : FileRecord::FormatSDRiq);
+}
+
 void MainWindow::on_action_DV_Serial_triggered(bool checked)
 {
     m_dspEngine->setDVSerialSupport(checked);
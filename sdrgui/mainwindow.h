@@ -381,12 +381,16 @@ private slots:
     void on_commandKeyboardConnect_toggled(bool checked);
 	void on_action_Audio_triggered();
     void on_action_Logging_triggered();
+    void on_action_DSP_Threads_triggered();
 	void on_action_DV_Serial_triggered(bool checked);
+	void on_action_Record_SigMF_triggered(bool checked);
 	void on_action_My_Position_triggered();
 	void sampleSourceChanged();
 	void sampleSinkChanged();
     void channelAddClicked(bool checked);
 	void on_action_Loaded_Plugins_triggered();
+	void on_action_DSP_Profiling_triggered();
+	void on_action_PreTrigger_Record_triggered();
 	void on_action_About_triggered();
 	void on_action_addSourceDevice_triggered();
 	void on_action_addSinkDevice_triggered();
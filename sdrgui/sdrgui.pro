@@ -68,7 +68,10 @@ SOURCES += mainwindow.cpp\
         gui/indicator.cpp\
         gui/levelmeter.cpp\
         gui/loggingdialog.cpp\
+        gui/dspthreadsdialog.cpp\
         gui/pluginsdialog.cpp\
+        gui/pretriggerrecorddialog.cpp\
+        gui/profilingdialog.cpp\
         gui/audiodialog.cpp\
         gui/presetitem.cpp\
         gui/rollupwidget.cpp\
@@ -118,8 +121,11 @@ HEADERS  += mainwindow.h\
         gui/indicator.h\
         gui/levelmeter.h\
         gui/loggingdialog.h\
+        gui/dspthreadsdialog.h\
         gui/physicalunit.h\
         gui/pluginsdialog.h\
+        gui/pretriggerrecorddialog.h\
+        gui/profilingdialog.h\
         gui/presetitem.h\
         gui/rollupwidget.h\
         gui/samplingdevicecontrol.h\
@@ -146,10 +152,13 @@ FORMS    += mainwindow.ui\
         gui/glscopenggui.ui\
         gui/aboutdialog.ui\
         gui/pluginsdialog.ui\
+        gui/pretriggerrecorddialog.ui\
+        gui/profilingdialog.ui\
         gui/samplingdevicecontrol.ui\
         gui/samplingdevicedialog.ui\
         gui/myposdialog.ui\
         gui/loggingdialog.ui\
+        gui/dspthreadsdialog.ui\
         gui/glspectrumgui.ui\
         gui/transverterdialog.ui\
         mainwindow.ui
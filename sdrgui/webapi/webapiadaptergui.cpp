@@ -32,10 +32,13 @@
 #include "dsp/devicesamplesource.h"
 #include "dsp/devicesamplesink.h"
 #include "dsp/dspengine.h"
+#include "dsp/dspexecutor.h"
 #include "plugin/pluginapi.h"
 #include "plugin/pluginmanager.h"
 #include "channel/channelsinkapi.h"
 #include "channel/channelsourceapi.h"
+#include "webapi/webapimetrics.h"
+#include "util/threadscheduling.h"
 
 #include "SWGInstanceSummaryResponse.h"
 #include "SWGInstanceDevicesResponse.h"
@@ -44,6 +47,7 @@
 #include "SWGAudioDevices.h"
 #include "SWGAudioDevicesSelect.h"
 #include "SWGLocationInformation.h"
+#include "SWGDSPThreadsInfo.h"
 #include "SWGDVSeralDevices.h"
 #include "SWGDVSerialDevice.h"
 #include "SWGPresets.h"
@@ -54,6 +58,13 @@
 #include "SWGDeviceSettings.h"
 #include "SWGDeviceState.h"
 #include "SWGChannelSettings.h"
+#include "SWGChannelReport.h"
+#include "SWGDeviceReport.h"
+#include "SWGDeviceScheduling.h"
+#include "SWGPreTriggerRecord.h"
+#include "SWGSpectrumArchive.h"
+#include "SWGSpectrumArchiveQuery.h"
+#include "SWGChannelRecord.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
 #include "SWGDeviceState.h"
@@ -102,6 +113,63 @@ int WebAPIAdapterGUI::instanceSummary(
     return 200;
 }
 
+int WebAPIAdapterGUI::instanceMetrics(
+        QString& response,
+        SWGSDRangel::SWGErrorResponse& error __attribute__((unused)))
+{
+    WebAPIMetrics metrics;
+
+    for (unsigned int i = 0; i < m_mainWindow.m_deviceUIs.size(); i++)
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[i];
+        SWGSDRangel::SWGDeviceReport deviceReport;
+        deviceReport.init();
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            WebAPIMetrics::formatDeviceReport(deviceReport, deviceSet->m_deviceSourceEngine, deviceSet->m_deviceSourceAPI->getSampleSource());
+            metrics.addDeviceReport(i, deviceReport);
+
+            for (int j = 0; j < deviceSet->m_deviceSourceAPI->getNbChannels(); j++)
+            {
+                ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(j);
+                SWGSDRangel::SWGChannelReport channelReport;
+                QString errorMessage;
+                channelReport.setChannelType(new QString());
+                channelAPI->getIdentifier(*channelReport.getChannelType());
+                channelReport.setTx(0);
+
+                if (channelAPI->webapiReportGet(channelReport, errorMessage) == 200) {
+                    metrics.addChannelReport(i, j, channelReport);
+                }
+            }
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            WebAPIMetrics::formatDeviceReport(deviceReport, deviceSet->m_deviceSinkEngine, deviceSet->m_deviceSinkAPI->getSampleSink());
+            metrics.addDeviceReport(i, deviceReport);
+
+            for (int j = 0; j < deviceSet->m_deviceSinkAPI->getNbChannels(); j++)
+            {
+                ChannelSourceAPI *channelAPI = deviceSet->m_deviceSinkAPI->getChanelAPIAt(j);
+                SWGSDRangel::SWGChannelReport channelReport;
+                QString errorMessage;
+                channelReport.setChannelType(new QString());
+                channelAPI->getIdentifier(*channelReport.getChannelType());
+                channelReport.setTx(1);
+
+                if (channelAPI->webapiReportGet(channelReport, errorMessage) == 200) {
+                    metrics.addChannelReport(i, j, channelReport);
+                }
+            }
+        }
+    }
+
+    metrics.addAudioOutput(m_mainWindow.m_dspEngine);
+    response = metrics.serialize();
+    return 200;
+}
+
 int WebAPIAdapterGUI::instanceDelete(
         SWGSDRangel::SWGInstanceSummaryResponse& response __attribute__((unused)),
         SWGSDRangel::SWGErrorResponse& error)
@@ -319,6 +387,39 @@ int WebAPIAdapterGUI::instanceLocationPut(
     return 200;
 }
 
+int WebAPIAdapterGUI::instanceDSPThreadsGet(
+        SWGSDRangel::SWGDSPThreadsInfo& response,
+        SWGSDRangel::SWGErrorResponse& error __attribute__((unused)))
+{
+    DSPExecutor *executor = m_mainWindow.m_dspEngine->getExecutor();
+
+    response.init();
+    response.setUseThreadPool(m_mainWindow.m_settings.getUseDSPThreadPool() ? 1 : 0);
+    response.setNbThreads(m_mainWindow.m_settings.getDSPThreadPoolSize());
+    response.setActiveThreads(executor ? executor->getNbThreads() : 0);
+
+    return 200;
+}
+
+int WebAPIAdapterGUI::instanceDSPThreadsPut(
+        SWGSDRangel::SWGDSPThreadsInfo& query,
+        SWGSDRangel::SWGDSPThreadsInfo& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if (query.getNbThreads() < 0)
+    {
+        error.init();
+        *error.getMessage() = QString("nbThreads must be positive or 0 for the number of CPU cores");
+        return 400;
+    }
+
+    m_mainWindow.m_settings.setUseDSPThreadPool(query.getUseThreadPool() != 0);
+    m_mainWindow.m_settings.setDSPThreadPoolSize(query.getNbThreads());
+    m_mainWindow.m_dspEngine->setDSPThreadPool(m_mainWindow.m_settings.getUseDSPThreadPool(), m_mainWindow.m_settings.getDSPThreadPoolSize());
+
+    return instanceDSPThreadsGet(response, error);
+}
+
 int WebAPIAdapterGUI::instanceDVSerialPatch(
             bool dvserial,
             SWGSDRangel::SWGDVSeralDevices& response,
@@ -982,6 +1083,367 @@ int WebAPIAdapterGUI::devicesetDeviceRunDelete(
     }
 }
 
+int WebAPIAdapterGUI::devicesetDeviceReportGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceReport& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            response.init();
+            WebAPIMetrics::formatDeviceReport(response, deviceSet->m_deviceSourceEngine, deviceSet->m_deviceSourceAPI->getSampleSource());
+            return 200;
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            response.init();
+            WebAPIMetrics::formatDeviceReport(response, deviceSet->m_deviceSinkEngine, deviceSet->m_deviceSinkAPI->getSampleSink());
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDeviceSchedulingGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceScheduling& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        ThreadSchedulingReport report;
+
+        if (deviceSet->m_deviceSourceEngine) { // Rx
+            deviceSet->m_deviceSourceEngine->getThreadSchedulingReport(report);
+        } else if (deviceSet->m_deviceSinkEngine) { // Tx
+            deviceSet->m_deviceSinkEngine->getThreadSchedulingReport(report);
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+
+        response.init();
+        WebAPIMetrics::formatDeviceScheduling(response, report);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDeviceSchedulingPutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& schedulingKeys,
+        SWGSDRangel::SWGDeviceScheduling& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        ThreadSchedulingSettings settings = force ? ThreadSchedulingSettings() : m_mainWindow.m_settings.getThreadScheduling(deviceSetIndex);
+        QString errorMessage;
+
+        if (!WebAPIMetrics::updateThreadScheduling(settings, schedulingKeys, response, errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        ThreadSchedulingReport report;
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            deviceSet->m_deviceSourceEngine->setThreadScheduling(settings);
+            deviceSet->m_deviceSourceEngine->getThreadSchedulingReport(report);
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            deviceSet->m_deviceSinkEngine->setThreadScheduling(settings);
+            deviceSet->m_deviceSinkEngine->getThreadSchedulingReport(report);
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+
+        m_mainWindow.m_settings.setThreadScheduling(deviceSetIndex, settings);
+        response.cleanup();
+        response.init();
+        WebAPIMetrics::formatDeviceScheduling(response, report);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDevicePreTriggerGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDevicePreTriggerPutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& preTriggerKeys,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        QString errorMessage;
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (!WebAPIMetrics::updatePreTriggerRecord(deviceSet->m_deviceSourceAPI, force, preTriggerKeys, response, errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        response.cleanup();
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDevicePreTriggerPost(
+        int deviceSetIndex,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (!deviceSet->m_deviceSourceAPI->triggerPreTriggerRecord())
+        {
+            *error.getMessage() = QString("The pre-trigger recorder of device set %1 is not armed").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDevicePreTriggerDelete(
+        int deviceSetIndex,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        deviceSet->m_deviceSourceAPI->stopPreTriggerRecord();
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDeviceSpectrumArchiveGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGSpectrumArchive& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatSpectrumArchive(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDeviceSpectrumArchivePutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& archiveKeys,
+        SWGSDRangel::SWGSpectrumArchive& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        QString errorMessage;
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (!WebAPIMetrics::updateSpectrumArchive(deviceSet->m_deviceSourceAPI, force, archiveKeys, response, errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        response.cleanup();
+        response.init();
+        WebAPIMetrics::formatSpectrumArchive(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetDeviceSpectrumArchiveQueryGet(
+        int deviceSetIndex,
+        qint64 fromMs,
+        qint64 toMs,
+        int maxSpectra,
+        SWGSDRangel::SWGSpectrumArchiveQuery& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+        QString errorMessage;
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+
+        if (!WebAPIMetrics::querySpectrumArchive(
+                deviceSet->m_deviceSourceAPI->getSpectrumArchiveSettings().m_fileBase,
+                fromMs,
+                toMs,
+                maxSpectra,
+                response,
+                errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 int WebAPIAdapterGUI::devicesetChannelPost(
             int deviceSetIndex,
             SWGSDRangel::SWGChannelSettings& query,
@@ -1283,6 +1745,161 @@ int WebAPIAdapterGUI::devicesetChannelSettingsPutPatch(
 
 }
 
+int WebAPIAdapterGUI::devicesetChannelReportGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelReport& response,
+            SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(channelIndex);
+
+            if (channelAPI == 0)
+            {
+                *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+                return 404;
+            }
+            else
+            {
+                response.setChannelType(new QString());
+                channelAPI->getIdentifier(*response.getChannelType());
+                response.setTx(0);
+                return channelAPI->webapiReportGet(response, *error.getMessage());
+            }
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            ChannelSourceAPI *channelAPI = deviceSet->m_deviceSinkAPI->getChanelAPIAt(channelIndex);
+
+            if (channelAPI == 0)
+            {
+                *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+                return 404;
+            }
+            else
+            {
+                response.setChannelType(new QString());
+                channelAPI->getIdentifier(*response.getChannelType());
+                response.setTx(1);
+                return channelAPI->webapiReportGet(response, *error.getMessage());
+            }
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetChannelRecordGet(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(channelIndex);
+
+        if (channelAPI == 0)
+        {
+            *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+            return 404;
+        }
+
+        ChannelRecord *channelRecord = channelAPI->getChannelRecord();
+
+        if (channelRecord == 0)
+        {
+            *error.getMessage() = QString("Channel %1 does not support I/Q recording").arg(channelIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatChannelRecord(response, channelRecord);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterGUI::devicesetChannelRecordPutPatch(
+        int deviceSetIndex,
+        int channelIndex,
+        bool force,
+        const QStringList& recordKeys,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainWindow.m_deviceUIs.size()))
+    {
+        DeviceUISet *deviceSet = m_mainWindow.m_deviceUIs[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(channelIndex);
+
+        if (channelAPI == 0)
+        {
+            *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+            return 404;
+        }
+
+        ChannelRecord *channelRecord = channelAPI->getChannelRecord();
+
+        if (channelRecord == 0)
+        {
+            *error.getMessage() = QString("Channel %1 does not support I/Q recording").arg(channelIndex);
+            return 400;
+        }
+
+        if (!WebAPIMetrics::updateChannelRecord(channelRecord, force, recordKeys, response, *error.getMessage())) {
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatChannelRecord(response, channelRecord);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 void WebAPIAdapterGUI::getDeviceSetList(SWGSDRangel::SWGDeviceSetList* deviceSetList)
 {
     deviceSetList->init();
@@ -34,6 +34,8 @@ DeviceSet::DeviceSet(int tabIndex)
     m_deviceSourceAPI = 0;
     m_deviceSinkEngine = 0;
     m_deviceSinkAPI = 0;
+    m_spectrumStreamSink = 0;
+    m_spectrumStreamServer = 0;
     m_deviceTabIndex = tabIndex;
 }
 
@@ -27,6 +27,8 @@ class PluginAPI;
 class ChannelSinkAPI;
 class ChannelSourceAPI;
 class Preset;
+class SpectrumStreamSink;
+class SpectrumStreamServer;
 
 struct DeviceSet
 {
@@ -34,6 +36,8 @@ struct DeviceSet
     DeviceSourceAPI *m_deviceSourceAPI;
     DSPDeviceSinkEngine *m_deviceSinkEngine;
     DeviceSinkAPI *m_deviceSinkAPI;
+    SpectrumStreamSink *m_spectrumStreamSink;     //!< headless spectrum streaming (source sets only)
+    SpectrumStreamServer *m_spectrumStreamServer;
 
     DeviceSet(int tabIndex);
     ~DeviceSet();
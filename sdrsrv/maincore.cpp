@@ -24,11 +24,13 @@
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "dsp/filerecord.h"
 #include "device/devicesourceapi.h"
 #include "device/devicesinkapi.h"
 #include "device/deviceset.h"
 #include "device/deviceenumerator.h"
 #include "plugin/pluginmanager.h"
+#include "util/spectrumstreamserver.h"
 #include "loggerwithfile.h"
 #include "webapi/webapirequestmapper.h"
 #include "webapi/webapiserver.h"
@@ -54,12 +56,18 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
     m_masterTabIndex(-1),
     m_dspEngine(DSPEngine::instance()),
     m_lastEngineState((DSPDeviceSourceEngine::State)-1),
-    m_logger(logger)
+    m_logger(logger),
+    m_spectrumStreamAddress(parser.getSpectrumAddress()),
+    m_spectrumStreamPort(parser.getSpectrumPort()),
+    m_spectrumStreamUDP(parser.getSpectrumUDP())
 {
     qDebug() << "MainCore::MainCore: start";
 
     m_instance = this;
     m_settings.setAudioDeviceInfo(&m_audioDeviceInfo);
+    m_spectrumStreamSettings.m_fftSize = parser.getSpectrumFFTSize();
+    m_spectrumStreamSettings.m_framesPerSecond = parser.getSpectrumFPS();
+    m_spectrumStreamSettings.m_binFormat = parser.getSpectrumS16() ? SpectrumStreamSink::BinFormatS16 : SpectrumStreamSink::BinFormatU8;
 
     m_pluginManager = new PluginManager(this);
     m_pluginManager->loadPlugins(QString("pluginssrv"));
@@ -205,6 +213,8 @@ void MainCore::loadSettings()
 	qDebug() << "MainCore::loadSettings";
 
     m_settings.load();
+    m_dspEngine->setDSPThreadPool(m_settings.getUseDSPThreadPool(), m_settings.getDSPThreadPoolSize());
+    FileRecord::setDefaultRecordFormat(m_settings.getRecordSigMF() ? FileRecord::FormatSigMF : FileRecord::FormatSDRiq);
     m_settings.sortPresets();
     setLoggingOptions();
 }
@@ -272,6 +282,12 @@ void MainCore::addSinkDevice()
     m_deviceSets.back()->m_deviceSourceEngine = 0;
     m_deviceSets.back()->m_deviceSinkEngine = dspDeviceSinkEngine;
 
+    ThreadSchedulingSettings threadScheduling = m_settings.getThreadScheduling(deviceTabIndex);
+
+    if (!threadScheduling.isDefault()) {
+        dspDeviceSinkEngine->setThreadScheduling(threadScheduling);
+    }
+
     char tabNameCStr[16];
     sprintf(tabNameCStr, "T%d", deviceTabIndex);
 
@@ -314,6 +330,12 @@ void MainCore::addSourceDevice()
     m_deviceSets.push_back(new DeviceSet(deviceTabIndex));
     m_deviceSets.back()->m_deviceSourceEngine = dspDeviceSourceEngine;
 
+    ThreadSchedulingSettings threadScheduling = m_settings.getThreadScheduling(deviceTabIndex);
+
+    if (!threadScheduling.isDefault()) {
+        dspDeviceSourceEngine->setThreadScheduling(threadScheduling);
+    }
+
     char tabNameCStr[16];
     sprintf(tabNameCStr, "R%d", deviceTabIndex);
 
@@ -336,6 +358,8 @@ void MainCore::addSourceDevice()
     DeviceSampleSource *source = m_deviceSets.back()->m_deviceSourceAPI->getPluginInterface()->createSampleSourcePluginInstanceInput(
             m_deviceSets.back()->m_deviceSourceAPI->getSampleSourceId(), m_deviceSets.back()->m_deviceSourceAPI);
     m_deviceSets.back()->m_deviceSourceAPI->setSampleSource(source);
+
+    addSpectrumStream(m_deviceSets.back(), deviceTabIndex);
 }
 
 void MainCore::removeLastDevice()
@@ -344,6 +368,9 @@ void MainCore::removeLastDevice()
     {
         DSPDeviceSourceEngine *lastDeviceEngine = m_deviceSets.back()->m_deviceSourceEngine;
         lastDeviceEngine->stopAcquistion();
+        removeSpectrumStream(m_deviceSets.back());
+        m_deviceSets.back()->m_deviceSourceAPI->disarmPreTriggerRecord();
+        m_deviceSets.back()->m_deviceSourceAPI->stopSpectrumArchive();
 
         // deletes old UI and input object
         m_deviceSets.back()->freeRxChannels();      // destroys the channel instances
@@ -384,6 +411,48 @@ void MainCore::removeLastDevice()
     m_deviceSets.pop_back();
 }
 
+void MainCore::addSpectrumStream(DeviceSet *deviceSet, int deviceSetIndex)
+{
+    if ((m_spectrumStreamPort == 0) || (m_spectrumStreamPort + deviceSetIndex > 65535)) {
+        return;
+    }
+
+    SpectrumStreamServer *server = new SpectrumStreamServer(
+            m_spectrumStreamAddress,
+            m_spectrumStreamPort + deviceSetIndex,
+            m_spectrumStreamUDP ? SpectrumStreamServer::ProtocolUDP : SpectrumStreamServer::ProtocolTCP,
+            this);
+
+    if (!server->start())
+    {
+        delete server;
+        return;
+    }
+
+    SpectrumStreamSink *sink = new SpectrumStreamSink(deviceSetIndex, SDR_RX_SCALEF);
+    sink->getInputMessageQueue()->push(SpectrumStreamSink::MsgConfigureSpectrumStreamSink::create(m_spectrumStreamSettings));
+    connect(sink, SIGNAL(frameReady(QByteArray)), server, SLOT(sendFrame(QByteArray)), Qt::QueuedConnection);
+    deviceSet->m_spectrumStreamSink = sink;
+    deviceSet->m_spectrumStreamServer = server;
+    deviceSet->m_deviceSourceEngine->addSink(sink);
+}
+
+void MainCore::removeSpectrumStream(DeviceSet *deviceSet)
+{
+    if (deviceSet->m_spectrumStreamSink)
+    {
+        deviceSet->m_deviceSourceEngine->removeSink(deviceSet->m_spectrumStreamSink);
+        delete deviceSet->m_spectrumStreamSink;
+        deviceSet->m_spectrumStreamSink = 0;
+    }
+
+    if (deviceSet->m_spectrumStreamServer)
+    {
+        delete deviceSet->m_spectrumStreamServer;
+        deviceSet->m_spectrumStreamServer = 0;
+    }
+}
+
 void MainCore::changeSampleSource(int deviceSetIndex, int selectedDeviceIndex)
 {
     if (deviceSetIndex >= 0)
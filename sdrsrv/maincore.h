@@ -26,6 +26,7 @@
 #include "util/message.h"
 #include "util/messagequeue.h"
 #include "util/export.h"
+#include "dsp/spectrumstreamsink.h"
 #include "mainparser.h"
 
 class AudioDeviceInfo;
@@ -288,10 +289,17 @@ private:
     WebAPIServer *m_apiServer;
     WebAPIAdapterSrv *m_apiAdapter;
 
+    QString m_spectrumStreamAddress;
+    quint16 m_spectrumStreamPort; //!< port of device set 0 or 0 if spectrum streaming is disabled
+    bool m_spectrumStreamUDP;
+    SpectrumStreamSink::Settings m_spectrumStreamSettings;
+
 	void loadSettings();
 	void loadPresetSettings(const Preset* preset, int tabIndex);
 	void savePresetSettings(Preset* preset, int tabIndex);
     void setLoggingOptions();
+    void addSpectrumStream(DeviceSet *deviceSet, int deviceSetIndex);
+    void removeSpectrumStream(DeviceSet *deviceSet);
 
     bool handleMessage(const Message& cmd);
 
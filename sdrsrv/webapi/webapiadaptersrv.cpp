@@ -30,6 +30,7 @@
 #include "SWGAudioDevices.h"
 #include "SWGAudioDevicesSelect.h"
 #include "SWGLocationInformation.h"
+#include "SWGDSPThreadsInfo.h"
 #include "SWGDVSeralDevices.h"
 #include "SWGPresetImport.h"
 #include "SWGPresetExport.h"
@@ -37,6 +38,13 @@
 #include "SWGPresetTransfer.h"
 #include "SWGDeviceSettings.h"
 #include "SWGChannelSettings.h"
+#include "SWGChannelReport.h"
+#include "SWGDeviceReport.h"
+#include "SWGDeviceScheduling.h"
+#include "SWGPreTriggerRecord.h"
+#include "SWGSpectrumArchive.h"
+#include "SWGSpectrumArchiveQuery.h"
+#include "SWGChannelRecord.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
 #include "SWGDeviceState.h"
@@ -50,10 +58,13 @@
 #include "dsp/devicesamplesink.h"
 #include "dsp/devicesamplesource.h"
 #include "dsp/dspengine.h"
+#include "dsp/dspexecutor.h"
 #include "channel/channelsourceapi.h"
 #include "channel/channelsinkapi.h"
 #include "plugin/pluginapi.h"
 #include "plugin/pluginmanager.h"
+#include "webapi/webapimetrics.h"
+#include "util/threadscheduling.h"
 #include "webapiadaptersrv.h"
 
 WebAPIAdapterSrv::WebAPIAdapterSrv(MainCore& mainCore) :
@@ -98,6 +109,63 @@ int WebAPIAdapterSrv::instanceSummary(
     return 200;
 }
 
+int WebAPIAdapterSrv::instanceMetrics(
+        QString& response,
+        SWGSDRangel::SWGErrorResponse& error __attribute__((unused)))
+{
+    WebAPIMetrics metrics;
+
+    for (unsigned int i = 0; i < m_mainCore.m_deviceSets.size(); i++)
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[i];
+        SWGSDRangel::SWGDeviceReport deviceReport;
+        deviceReport.init();
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            WebAPIMetrics::formatDeviceReport(deviceReport, deviceSet->m_deviceSourceEngine, deviceSet->m_deviceSourceAPI->getSampleSource());
+            metrics.addDeviceReport(i, deviceReport);
+
+            for (int j = 0; j < deviceSet->m_deviceSourceAPI->getNbChannels(); j++)
+            {
+                ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(j);
+                SWGSDRangel::SWGChannelReport channelReport;
+                QString errorMessage;
+                channelReport.setChannelType(new QString());
+                channelAPI->getIdentifier(*channelReport.getChannelType());
+                channelReport.setTx(0);
+
+                if (channelAPI->webapiReportGet(channelReport, errorMessage) == 200) {
+                    metrics.addChannelReport(i, j, channelReport);
+                }
+            }
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            WebAPIMetrics::formatDeviceReport(deviceReport, deviceSet->m_deviceSinkEngine, deviceSet->m_deviceSinkAPI->getSampleSink());
+            metrics.addDeviceReport(i, deviceReport);
+
+            for (int j = 0; j < deviceSet->m_deviceSinkAPI->getNbChannels(); j++)
+            {
+                ChannelSourceAPI *channelAPI = deviceSet->m_deviceSinkAPI->getChanelAPIAt(j);
+                SWGSDRangel::SWGChannelReport channelReport;
+                QString errorMessage;
+                channelReport.setChannelType(new QString());
+                channelAPI->getIdentifier(*channelReport.getChannelType());
+                channelReport.setTx(1);
+
+                if (channelAPI->webapiReportGet(channelReport, errorMessage) == 200) {
+                    metrics.addChannelReport(i, j, channelReport);
+                }
+            }
+        }
+    }
+
+    metrics.addAudioOutput(m_mainCore.m_dspEngine);
+    response = metrics.serialize();
+    return 200;
+}
+
 int WebAPIAdapterSrv::instanceDelete(
         SWGSDRangel::SWGSuccessResponse& response,
         SWGSDRangel::SWGErrorResponse& error __attribute__((unused)))
@@ -320,6 +388,39 @@ int WebAPIAdapterSrv::instanceLocationPut(
     return 200;
 }
 
+int WebAPIAdapterSrv::instanceDSPThreadsGet(
+        SWGSDRangel::SWGDSPThreadsInfo& response,
+        SWGSDRangel::SWGErrorResponse& error __attribute__((unused)))
+{
+    DSPExecutor *executor = m_mainCore.m_dspEngine->getExecutor();
+
+    response.init();
+    response.setUseThreadPool(m_mainCore.m_settings.getUseDSPThreadPool() ? 1 : 0);
+    response.setNbThreads(m_mainCore.m_settings.getDSPThreadPoolSize());
+    response.setActiveThreads(executor ? executor->getNbThreads() : 0);
+
+    return 200;
+}
+
+int WebAPIAdapterSrv::instanceDSPThreadsPut(
+        SWGSDRangel::SWGDSPThreadsInfo& query,
+        SWGSDRangel::SWGDSPThreadsInfo& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if (query.getNbThreads() < 0)
+    {
+        error.init();
+        *error.getMessage() = QString("nbThreads must be positive or 0 for the number of CPU cores");
+        return 400;
+    }
+
+    m_mainCore.m_settings.setUseDSPThreadPool(query.getUseThreadPool() != 0);
+    m_mainCore.m_settings.setDSPThreadPoolSize(query.getNbThreads());
+    m_mainCore.m_dspEngine->setDSPThreadPool(m_mainCore.m_settings.getUseDSPThreadPool(), m_mainCore.m_settings.getDSPThreadPoolSize());
+
+    return instanceDSPThreadsGet(response, error);
+}
+
 int WebAPIAdapterSrv::instanceDVSerialPatch(
             bool dvserial,
             SWGSDRangel::SWGDVSeralDevices& response,
@@ -1087,6 +1188,367 @@ int WebAPIAdapterSrv::devicesetDeviceRunDelete(
     }
 }
 
+int WebAPIAdapterSrv::devicesetDeviceReportGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceReport& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            response.init();
+            WebAPIMetrics::formatDeviceReport(response, deviceSet->m_deviceSourceEngine, deviceSet->m_deviceSourceAPI->getSampleSource());
+            return 200;
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            response.init();
+            WebAPIMetrics::formatDeviceReport(response, deviceSet->m_deviceSinkEngine, deviceSet->m_deviceSinkAPI->getSampleSink());
+            return 200;
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDeviceSchedulingGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGDeviceScheduling& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        ThreadSchedulingReport report;
+
+        if (deviceSet->m_deviceSourceEngine) { // Rx
+            deviceSet->m_deviceSourceEngine->getThreadSchedulingReport(report);
+        } else if (deviceSet->m_deviceSinkEngine) { // Tx
+            deviceSet->m_deviceSinkEngine->getThreadSchedulingReport(report);
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+
+        response.init();
+        WebAPIMetrics::formatDeviceScheduling(response, report);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDeviceSchedulingPutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& schedulingKeys,
+        SWGSDRangel::SWGDeviceScheduling& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        ThreadSchedulingSettings settings = force ? ThreadSchedulingSettings() : m_mainCore.m_settings.getThreadScheduling(deviceSetIndex);
+        QString errorMessage;
+
+        if (!WebAPIMetrics::updateThreadScheduling(settings, schedulingKeys, response, errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        ThreadSchedulingReport report;
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            deviceSet->m_deviceSourceEngine->setThreadScheduling(settings);
+            deviceSet->m_deviceSourceEngine->getThreadSchedulingReport(report);
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            deviceSet->m_deviceSinkEngine->setThreadScheduling(settings);
+            deviceSet->m_deviceSinkEngine->getThreadSchedulingReport(report);
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+
+        m_mainCore.m_settings.setThreadScheduling(deviceSetIndex, settings);
+        response.cleanup();
+        response.init();
+        WebAPIMetrics::formatDeviceScheduling(response, report);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDevicePreTriggerGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDevicePreTriggerPutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& preTriggerKeys,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        QString errorMessage;
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (!WebAPIMetrics::updatePreTriggerRecord(deviceSet->m_deviceSourceAPI, force, preTriggerKeys, response, errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        response.cleanup();
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDevicePreTriggerPost(
+        int deviceSetIndex,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (!deviceSet->m_deviceSourceAPI->triggerPreTriggerRecord())
+        {
+            *error.getMessage() = QString("The pre-trigger recorder of device set %1 is not armed").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDevicePreTriggerDelete(
+        int deviceSetIndex,
+        SWGSDRangel::SWGPreTriggerRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        deviceSet->m_deviceSourceAPI->stopPreTriggerRecord();
+        response.init();
+        WebAPIMetrics::formatPreTriggerRecord(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDeviceSpectrumArchiveGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGSpectrumArchive& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatSpectrumArchive(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDeviceSpectrumArchivePutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& archiveKeys,
+        SWGSDRangel::SWGSpectrumArchive& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        QString errorMessage;
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        if (!WebAPIMetrics::updateSpectrumArchive(deviceSet->m_deviceSourceAPI, force, archiveKeys, response, errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        response.cleanup();
+        response.init();
+        WebAPIMetrics::formatSpectrumArchive(response, deviceSet->m_deviceSourceAPI);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDeviceSpectrumArchiveQueryGet(
+        int deviceSetIndex,
+        qint64 fromMs,
+        qint64 toMs,
+        int maxSpectra,
+        SWGSDRangel::SWGSpectrumArchiveQuery& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+        QString errorMessage;
+
+        if (deviceSet->m_deviceSourceAPI == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        response.init();
+
+        if (!WebAPIMetrics::querySpectrumArchive(
+                deviceSet->m_deviceSourceAPI->getSpectrumArchiveSettings().m_fileBase,
+                fromMs,
+                toMs,
+                maxSpectra,
+                response,
+                errorMessage))
+        {
+            *error.getMessage() = errorMessage;
+            return 400;
+        }
+
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 int WebAPIAdapterSrv::devicesetChannelPost(
             int deviceSetIndex,
             SWGSDRangel::SWGChannelSettings& query,
@@ -1387,6 +1849,161 @@ int WebAPIAdapterSrv::devicesetChannelSettingsPutPatch(
     }
 }
 
+int WebAPIAdapterSrv::devicesetChannelReportGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelReport& response,
+            SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine) // Rx
+        {
+            ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(channelIndex);
+
+            if (channelAPI == 0)
+            {
+                *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+                return 404;
+            }
+            else
+            {
+                response.setChannelType(new QString());
+                channelAPI->getIdentifier(*response.getChannelType());
+                response.setTx(0);
+                return channelAPI->webapiReportGet(response, *error.getMessage());
+            }
+        }
+        else if (deviceSet->m_deviceSinkEngine) // Tx
+        {
+            ChannelSourceAPI *channelAPI = deviceSet->m_deviceSinkAPI->getChanelAPIAt(channelIndex);
+
+            if (channelAPI == 0)
+            {
+                *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+                return 404;
+            }
+            else
+            {
+                response.setChannelType(new QString());
+                channelAPI->getIdentifier(*response.getChannelType());
+                response.setTx(1);
+                return channelAPI->webapiReportGet(response, *error.getMessage());
+            }
+        }
+        else
+        {
+            *error.getMessage() = QString("DeviceSet error");
+            return 500;
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetChannelRecordGet(
+        int deviceSetIndex,
+        int channelIndex,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(channelIndex);
+
+        if (channelAPI == 0)
+        {
+            *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+            return 404;
+        }
+
+        ChannelRecord *channelRecord = channelAPI->getChannelRecord();
+
+        if (channelRecord == 0)
+        {
+            *error.getMessage() = QString("Channel %1 does not support I/Q recording").arg(channelIndex);
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatChannelRecord(response, channelRecord);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetChannelRecordPutPatch(
+        int deviceSetIndex,
+        int channelIndex,
+        bool force,
+        const QStringList& recordKeys,
+        SWGSDRangel::SWGChannelRecord& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore.m_deviceSets[deviceSetIndex];
+
+        if (deviceSet->m_deviceSourceEngine == 0)
+        {
+            *error.getMessage() = QString("Device set %1 is not a receiving device set").arg(deviceSetIndex);
+            return 400;
+        }
+
+        ChannelSinkAPI *channelAPI = deviceSet->m_deviceSourceAPI->getChanelAPIAt(channelIndex);
+
+        if (channelAPI == 0)
+        {
+            *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+            return 404;
+        }
+
+        ChannelRecord *channelRecord = channelAPI->getChannelRecord();
+
+        if (channelRecord == 0)
+        {
+            *error.getMessage() = QString("Channel %1 does not support I/Q recording").arg(channelIndex);
+            return 400;
+        }
+
+        if (!WebAPIMetrics::updateChannelRecord(channelRecord, force, recordKeys, response, *error.getMessage())) {
+            return 400;
+        }
+
+        response.init();
+        WebAPIMetrics::formatChannelRecord(response, channelRecord);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 void WebAPIAdapterSrv::getDeviceSetList(SWGSDRangel::SWGDeviceSetList* deviceSetList)
 {
     deviceSetList->init();
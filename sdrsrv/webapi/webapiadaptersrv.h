@@ -36,6 +36,10 @@ public:
             SWGSDRangel::SWGInstanceSummaryResponse& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int instanceMetrics(
+            QString& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int instanceDelete(
             SWGSDRangel::SWGSuccessResponse& response,
             SWGSDRangel::SWGErrorResponse& error);
@@ -75,6 +79,15 @@ public:
             SWGSDRangel::SWGLocationInformation& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int instanceDSPThreadsGet(
+            SWGSDRangel::SWGDSPThreadsInfo& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceDSPThreadsPut(
+            SWGSDRangel::SWGDSPThreadsInfo& query,
+            SWGSDRangel::SWGDSPThreadsInfo& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int instanceDVSerialPatch(
             bool dvserial,
             SWGSDRangel::SWGDVSeralDevices& response,
@@ -169,6 +182,65 @@ public:
             SWGSDRangel::SWGDeviceState& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetDeviceReportGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceReport& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDeviceSchedulingGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGDeviceScheduling& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDeviceSchedulingPutPatch(
+            int deviceSetIndex,
+            bool force,
+            const QStringList& schedulingKeys,
+            SWGSDRangel::SWGDeviceScheduling& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDevicePreTriggerGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGPreTriggerRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDevicePreTriggerPutPatch(
+            int deviceSetIndex,
+            bool force,
+            const QStringList& preTriggerKeys,
+            SWGSDRangel::SWGPreTriggerRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDevicePreTriggerPost(
+            int deviceSetIndex,
+            SWGSDRangel::SWGPreTriggerRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDevicePreTriggerDelete(
+            int deviceSetIndex,
+            SWGSDRangel::SWGPreTriggerRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDeviceSpectrumArchiveGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGSpectrumArchive& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDeviceSpectrumArchivePutPatch(
+            int deviceSetIndex,
+            bool force,
+            const QStringList& archiveKeys,
+            SWGSDRangel::SWGSpectrumArchive& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDeviceSpectrumArchiveQueryGet(
+            int deviceSetIndex,
+            qint64 fromMs,
+            qint64 toMs,
+            int maxSpectra,
+            SWGSDRangel::SWGSpectrumArchiveQuery& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetChannelPost(
             int deviceSetIndex,
             SWGSDRangel::SWGChannelSettings& query,
@@ -195,6 +267,26 @@ public:
             SWGSDRangel::SWGChannelSettings& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetChannelReportGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelReport& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelRecordGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelRecordPutPatch(
+            int deviceSetIndex,
+            int channelIndex,
+            bool force,
+            const QStringList& recordKeys,
+            SWGSDRangel::SWGChannelRecord& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
 private:
     MainCore& m_mainCore;
 
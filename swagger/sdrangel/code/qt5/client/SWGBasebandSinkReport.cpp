@@ -0,0 +1,320 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGBasebandSinkReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGBasebandSinkReport::SWGBasebandSinkReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGBasebandSinkReport::SWGBasebandSinkReport() {
+    name = nullptr;
+    m_name_isSet = false;
+    direct = 0;
+    m_direct_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_fill = 0;
+    m_fifo_fill_isSet = false;
+    fifo_max_fill = 0;
+    m_fifo_max_fill_isSet = false;
+    fifo_overflow_count = 0L;
+    m_fifo_overflow_count_isSet = false;
+    fifo_dropped_samples = 0L;
+    m_fifo_dropped_samples_isSet = false;
+    processing_time = 0L;
+    m_processing_time_isSet = false;
+    processed_samples = 0L;
+    m_processed_samples_isSet = false;
+    samples_in = 0L;
+    m_samples_in_isSet = false;
+    feed_time = nullptr;
+    m_feed_time_isSet = false;
+}
+
+SWGBasebandSinkReport::~SWGBasebandSinkReport() {
+    this->cleanup();
+}
+
+void
+SWGBasebandSinkReport::init() {
+    name = new QString("");
+    m_name_isSet = false;
+    direct = 0;
+    m_direct_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_fill = 0;
+    m_fifo_fill_isSet = false;
+    fifo_max_fill = 0;
+    m_fifo_max_fill_isSet = false;
+    fifo_overflow_count = 0L;
+    m_fifo_overflow_count_isSet = false;
+    fifo_dropped_samples = 0L;
+    m_fifo_dropped_samples_isSet = false;
+    processing_time = 0L;
+    m_processing_time_isSet = false;
+    processed_samples = 0L;
+    m_processed_samples_isSet = false;
+    samples_in = 0L;
+    m_samples_in_isSet = false;
+    feed_time = new SWGProfileHistogram();
+    m_feed_time_isSet = false;
+}
+
+void
+SWGBasebandSinkReport::cleanup() {
+    if(name != nullptr) { 
+        delete name;
+    }
+
+
+
+
+
+
+
+
+
+    if(feed_time != nullptr) { 
+        delete feed_time;
+    }
+}
+
+SWGBasebandSinkReport*
+SWGBasebandSinkReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGBasebandSinkReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&name, pJson["name"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&direct, pJson["direct"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_size, pJson["fifoSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_fill, pJson["fifoFill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_max_fill, pJson["fifoMaxFill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_overflow_count, pJson["fifoOverflowCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fifo_dropped_samples, pJson["fifoDroppedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&processing_time, pJson["processingTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&processed_samples, pJson["processedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&samples_in, pJson["samplesIn"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&feed_time, pJson["feedTime"], "SWGProfileHistogram", "SWGProfileHistogram");
+    
+}
+
+QString
+SWGBasebandSinkReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGBasebandSinkReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(name != nullptr && *name != QString("")){
+        toJsonValue(QString("name"), name, obj, QString("QString"));
+    }
+    if(m_direct_isSet){
+        obj->insert("direct", QJsonValue(direct));
+    }
+    if(m_fifo_size_isSet){
+        obj->insert("fifoSize", QJsonValue(fifo_size));
+    }
+    if(m_fifo_fill_isSet){
+        obj->insert("fifoFill", QJsonValue(fifo_fill));
+    }
+    if(m_fifo_max_fill_isSet){
+        obj->insert("fifoMaxFill", QJsonValue(fifo_max_fill));
+    }
+    if(m_fifo_overflow_count_isSet){
+        obj->insert("fifoOverflowCount", QJsonValue(fifo_overflow_count));
+    }
+    if(m_fifo_dropped_samples_isSet){
+        obj->insert("fifoDroppedSamples", QJsonValue(fifo_dropped_samples));
+    }
+    if(m_processing_time_isSet){
+        obj->insert("processingTime", QJsonValue(processing_time));
+    }
+    if(m_processed_samples_isSet){
+        obj->insert("processedSamples", QJsonValue(processed_samples));
+    }
+    if(m_samples_in_isSet){
+        obj->insert("samplesIn", QJsonValue(samples_in));
+    }
+    if((feed_time != nullptr) && (feed_time->isSet())){
+        toJsonValue(QString("feedTime"), feed_time, obj, QString("SWGProfileHistogram"));
+    }
+
+    return obj;
+}
+
+QString*
+SWGBasebandSinkReport::getName() {
+    return name;
+}
+void
+SWGBasebandSinkReport::setName(QString* name) {
+    this->name = name;
+    this->m_name_isSet = true;
+}
+
+qint32
+SWGBasebandSinkReport::getDirect() {
+    return direct;
+}
+void
+SWGBasebandSinkReport::setDirect(qint32 direct) {
+    this->direct = direct;
+    this->m_direct_isSet = true;
+}
+
+qint32
+SWGBasebandSinkReport::getFifoSize() {
+    return fifo_size;
+}
+void
+SWGBasebandSinkReport::setFifoSize(qint32 fifo_size) {
+    this->fifo_size = fifo_size;
+    this->m_fifo_size_isSet = true;
+}
+
+qint32
+SWGBasebandSinkReport::getFifoFill() {
+    return fifo_fill;
+}
+void
+SWGBasebandSinkReport::setFifoFill(qint32 fifo_fill) {
+    this->fifo_fill = fifo_fill;
+    this->m_fifo_fill_isSet = true;
+}
+
+qint32
+SWGBasebandSinkReport::getFifoMaxFill() {
+    return fifo_max_fill;
+}
+void
+SWGBasebandSinkReport::setFifoMaxFill(qint32 fifo_max_fill) {
+    this->fifo_max_fill = fifo_max_fill;
+    this->m_fifo_max_fill_isSet = true;
+}
+
+qint64
+SWGBasebandSinkReport::getFifoOverflowCount() {
+    return fifo_overflow_count;
+}
+void
+SWGBasebandSinkReport::setFifoOverflowCount(qint64 fifo_overflow_count) {
+    this->fifo_overflow_count = fifo_overflow_count;
+    this->m_fifo_overflow_count_isSet = true;
+}
+
+qint64
+SWGBasebandSinkReport::getFifoDroppedSamples() {
+    return fifo_dropped_samples;
+}
+void
+SWGBasebandSinkReport::setFifoDroppedSamples(qint64 fifo_dropped_samples) {
+    this->fifo_dropped_samples = fifo_dropped_samples;
+    this->m_fifo_dropped_samples_isSet = true;
+}
+
+qint64
+SWGBasebandSinkReport::getProcessingTime() {
+    return processing_time;
+}
+void
+SWGBasebandSinkReport::setProcessingTime(qint64 processing_time) {
+    this->processing_time = processing_time;
+    this->m_processing_time_isSet = true;
+}
+
+qint64
+SWGBasebandSinkReport::getProcessedSamples() {
+    return processed_samples;
+}
+void
+SWGBasebandSinkReport::setProcessedSamples(qint64 processed_samples) {
+    this->processed_samples = processed_samples;
+    this->m_processed_samples_isSet = true;
+}
+
+qint64
+SWGBasebandSinkReport::getSamplesIn() {
+    return samples_in;
+}
+void
+SWGBasebandSinkReport::setSamplesIn(qint64 samples_in) {
+    this->samples_in = samples_in;
+    this->m_samples_in_isSet = true;
+}
+
+SWGProfileHistogram*
+SWGBasebandSinkReport::getFeedTime() {
+    return feed_time;
+}
+void
+SWGBasebandSinkReport::setFeedTime(SWGProfileHistogram* feed_time) {
+    this->feed_time = feed_time;
+    this->m_feed_time_isSet = true;
+}
+
+
+bool
+SWGBasebandSinkReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(name != nullptr && *name != QString("")){ isObjectUpdated = true; break;}
+        if(m_direct_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_size_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_fill_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_max_fill_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_overflow_count_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_dropped_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_processing_time_isSet){ isObjectUpdated = true; break;}
+        if(m_processed_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_samples_in_isSet){ isObjectUpdated = true; break;}
+        if(feed_time != nullptr && feed_time->isSet()){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
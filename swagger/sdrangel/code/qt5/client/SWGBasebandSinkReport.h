@@ -0,0 +1,119 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGBasebandSinkReport.h
+ *
+ * Runtime counters of a baseband sink running on its own thread
+ */
+
+#ifndef SWGBasebandSinkReport_H_
+#define SWGBasebandSinkReport_H_
+
+#include <QJsonObject>
+
+
+#include "SWGProfileHistogram.h"
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGBasebandSinkReport: public SWGObject {
+public:
+    SWGBasebandSinkReport();
+    SWGBasebandSinkReport(QString* json);
+    virtual ~SWGBasebandSinkReport();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGBasebandSinkReport* fromJson(QString &jsonString);
+
+    QString* getName();
+    void setName(QString* name);
+
+    qint32 getDirect();
+    void setDirect(qint32 direct);
+
+    qint32 getFifoSize();
+    void setFifoSize(qint32 fifo_size);
+
+    qint32 getFifoFill();
+    void setFifoFill(qint32 fifo_fill);
+
+    qint32 getFifoMaxFill();
+    void setFifoMaxFill(qint32 fifo_max_fill);
+
+    qint64 getFifoOverflowCount();
+    void setFifoOverflowCount(qint64 fifo_overflow_count);
+
+    qint64 getFifoDroppedSamples();
+    void setFifoDroppedSamples(qint64 fifo_dropped_samples);
+
+    qint64 getProcessingTime();
+    void setProcessingTime(qint64 processing_time);
+
+    qint64 getProcessedSamples();
+    void setProcessedSamples(qint64 processed_samples);
+
+    qint64 getSamplesIn();
+    void setSamplesIn(qint64 samples_in);
+
+    SWGProfileHistogram* getFeedTime();
+    void setFeedTime(SWGProfileHistogram* feed_time);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* name;
+    bool m_name_isSet;
+
+    qint32 direct;
+    bool m_direct_isSet;
+
+    qint32 fifo_size;
+    bool m_fifo_size_isSet;
+
+    qint32 fifo_fill;
+    bool m_fifo_fill_isSet;
+
+    qint32 fifo_max_fill;
+    bool m_fifo_max_fill_isSet;
+
+    qint64 fifo_overflow_count;
+    bool m_fifo_overflow_count_isSet;
+
+    qint64 fifo_dropped_samples;
+    bool m_fifo_dropped_samples_isSet;
+
+    qint64 processing_time;
+    bool m_processing_time_isSet;
+
+    qint64 processed_samples;
+    bool m_processed_samples_isSet;
+
+    qint64 samples_in;
+    bool m_samples_in_isSet;
+
+    SWGProfileHistogram* feed_time;
+    bool m_feed_time_isSet;
+
+};
+
+}
+
+#endif /* SWGBasebandSinkReport_H_ */
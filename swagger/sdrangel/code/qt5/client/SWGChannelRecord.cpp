@@ -0,0 +1,152 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGChannelRecord.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGChannelRecord::SWGChannelRecord(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGChannelRecord::SWGChannelRecord() {
+    recording = 0;
+    m_recording_isSet = false;
+    file_base = nullptr;
+    m_file_base_isSet = false;
+    status = nullptr;
+    m_status_isSet = false;
+}
+
+SWGChannelRecord::~SWGChannelRecord() {
+    this->cleanup();
+}
+
+void
+SWGChannelRecord::init() {
+    recording = 0;
+    m_recording_isSet = false;
+    file_base = new QString("");
+    m_file_base_isSet = false;
+    status = new SWGChannelRecordStatus();
+    m_status_isSet = false;
+}
+
+void
+SWGChannelRecord::cleanup() {
+
+    if(file_base != nullptr) { 
+        delete file_base;
+    }
+    if(status != nullptr) { 
+        delete status;
+    }
+}
+
+SWGChannelRecord*
+SWGChannelRecord::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGChannelRecord::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&recording, pJson["recording"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&file_base, pJson["fileBase"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&status, pJson["status"], "SWGChannelRecordStatus", "SWGChannelRecordStatus");
+    
+}
+
+QString
+SWGChannelRecord::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGChannelRecord::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_recording_isSet){
+        obj->insert("recording", QJsonValue(recording));
+    }
+    if(file_base != nullptr && *file_base != QString("")){
+        toJsonValue(QString("fileBase"), file_base, obj, QString("QString"));
+    }
+    if((status != nullptr) && (status->isSet())){
+        toJsonValue(QString("status"), status, obj, QString("SWGChannelRecordStatus"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGChannelRecord::getRecording() {
+    return recording;
+}
+void
+SWGChannelRecord::setRecording(qint32 recording) {
+    this->recording = recording;
+    this->m_recording_isSet = true;
+}
+
+QString*
+SWGChannelRecord::getFileBase() {
+    return file_base;
+}
+void
+SWGChannelRecord::setFileBase(QString* file_base) {
+    this->file_base = file_base;
+    this->m_file_base_isSet = true;
+}
+
+SWGChannelRecordStatus*
+SWGChannelRecord::getStatus() {
+    return status;
+}
+void
+SWGChannelRecord::setStatus(SWGChannelRecordStatus* status) {
+    this->status = status;
+    this->m_status_isSet = true;
+}
+
+
+bool
+SWGChannelRecord::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_recording_isSet){ isObjectUpdated = true; break;}
+        if(file_base != nullptr && *file_base != QString("")){ isObjectUpdated = true; break;}
+        if(status != nullptr && status->isSet()){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
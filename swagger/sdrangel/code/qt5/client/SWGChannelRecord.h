@@ -0,0 +1,71 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGChannelRecord.h
+ *
+ * I/Q recording of a receiving channel. The stream at the channelizer output is written to .sdriq files with its sample rate and center frequency. A new file is started when either changes.
+ */
+
+#ifndef SWGChannelRecord_H_
+#define SWGChannelRecord_H_
+
+#include <QJsonObject>
+
+
+#include "SWGChannelRecordStatus.h"
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGChannelRecord: public SWGObject {
+public:
+    SWGChannelRecord();
+    SWGChannelRecord(QString* json);
+    virtual ~SWGChannelRecord();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGChannelRecord* fromJson(QString &jsonString);
+
+    qint32 getRecording();
+    void setRecording(qint32 recording);
+
+    QString* getFileBase();
+    void setFileBase(QString* file_base);
+
+    SWGChannelRecordStatus* getStatus();
+    void setStatus(SWGChannelRecordStatus* status);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 recording;
+    bool m_recording_isSet;
+
+    QString* file_base;
+    bool m_file_base_isSet;
+
+    SWGChannelRecordStatus* status;
+    bool m_status_isSet;
+
+};
+
+}
+
+#endif /* SWGChannelRecord_H_ */
@@ -0,0 +1,236 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGChannelRecordStatus.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGChannelRecordStatus::SWGChannelRecordStatus(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGChannelRecordStatus::SWGChannelRecordStatus() {
+    file_name = nullptr;
+    m_file_name_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    nb_files = 0;
+    m_nb_files_isSet = false;
+    written_bytes = 0L;
+    m_written_bytes_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+    error_message = nullptr;
+    m_error_message_isSet = false;
+}
+
+SWGChannelRecordStatus::~SWGChannelRecordStatus() {
+    this->cleanup();
+}
+
+void
+SWGChannelRecordStatus::init() {
+    file_name = new QString("");
+    m_file_name_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    nb_files = 0;
+    m_nb_files_isSet = false;
+    written_bytes = 0L;
+    m_written_bytes_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+    error_message = new QString("");
+    m_error_message_isSet = false;
+}
+
+void
+SWGChannelRecordStatus::cleanup() {
+    if(file_name != nullptr) { 
+        delete file_name;
+    }
+
+
+
+
+
+    if(error_message != nullptr) { 
+        delete error_message;
+    }
+}
+
+SWGChannelRecordStatus*
+SWGChannelRecordStatus::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGChannelRecordStatus::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&file_name, pJson["fileName"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_files, pJson["nbFiles"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&written_bytes, pJson["writtenBytes"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dropped_samples, pJson["droppedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&error_message, pJson["errorMessage"], "QString", "QString");
+    
+}
+
+QString
+SWGChannelRecordStatus::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGChannelRecordStatus::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(file_name != nullptr && *file_name != QString("")){
+        toJsonValue(QString("fileName"), file_name, obj, QString("QString"));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_nb_files_isSet){
+        obj->insert("nbFiles", QJsonValue(nb_files));
+    }
+    if(m_written_bytes_isSet){
+        obj->insert("writtenBytes", QJsonValue(written_bytes));
+    }
+    if(m_dropped_samples_isSet){
+        obj->insert("droppedSamples", QJsonValue(dropped_samples));
+    }
+    if(error_message != nullptr && *error_message != QString("")){
+        toJsonValue(QString("errorMessage"), error_message, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+QString*
+SWGChannelRecordStatus::getFileName() {
+    return file_name;
+}
+void
+SWGChannelRecordStatus::setFileName(QString* file_name) {
+    this->file_name = file_name;
+    this->m_file_name_isSet = true;
+}
+
+qint32
+SWGChannelRecordStatus::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGChannelRecordStatus::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+qint64
+SWGChannelRecordStatus::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGChannelRecordStatus::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint32
+SWGChannelRecordStatus::getNbFiles() {
+    return nb_files;
+}
+void
+SWGChannelRecordStatus::setNbFiles(qint32 nb_files) {
+    this->nb_files = nb_files;
+    this->m_nb_files_isSet = true;
+}
+
+qint64
+SWGChannelRecordStatus::getWrittenBytes() {
+    return written_bytes;
+}
+void
+SWGChannelRecordStatus::setWrittenBytes(qint64 written_bytes) {
+    this->written_bytes = written_bytes;
+    this->m_written_bytes_isSet = true;
+}
+
+qint64
+SWGChannelRecordStatus::getDroppedSamples() {
+    return dropped_samples;
+}
+void
+SWGChannelRecordStatus::setDroppedSamples(qint64 dropped_samples) {
+    this->dropped_samples = dropped_samples;
+    this->m_dropped_samples_isSet = true;
+}
+
+QString*
+SWGChannelRecordStatus::getErrorMessage() {
+    return error_message;
+}
+void
+SWGChannelRecordStatus::setErrorMessage(QString* error_message) {
+    this->error_message = error_message;
+    this->m_error_message_isSet = true;
+}
+
+
+bool
+SWGChannelRecordStatus::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(file_name != nullptr && *file_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_sample_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_center_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_files_isSet){ isObjectUpdated = true; break;}
+        if(m_written_bytes_isSet){ isObjectUpdated = true; break;}
+        if(m_dropped_samples_isSet){ isObjectUpdated = true; break;}
+        if(error_message != nullptr && *error_message != QString("")){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
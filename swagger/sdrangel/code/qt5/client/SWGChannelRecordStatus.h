@@ -0,0 +1,94 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGChannelRecordStatus.h
+ *
+ * Channel I/Q recording status (read only)
+ */
+
+#ifndef SWGChannelRecordStatus_H_
+#define SWGChannelRecordStatus_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGChannelRecordStatus: public SWGObject {
+public:
+    SWGChannelRecordStatus();
+    SWGChannelRecordStatus(QString* json);
+    virtual ~SWGChannelRecordStatus();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGChannelRecordStatus* fromJson(QString &jsonString);
+
+    QString* getFileName();
+    void setFileName(QString* file_name);
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    qint64 getCenterFrequency();
+    void setCenterFrequency(qint64 center_frequency);
+
+    qint32 getNbFiles();
+    void setNbFiles(qint32 nb_files);
+
+    qint64 getWrittenBytes();
+    void setWrittenBytes(qint64 written_bytes);
+
+    qint64 getDroppedSamples();
+    void setDroppedSamples(qint64 dropped_samples);
+
+    QString* getErrorMessage();
+    void setErrorMessage(QString* error_message);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* file_name;
+    bool m_file_name_isSet;
+
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    qint64 center_frequency;
+    bool m_center_frequency_isSet;
+
+    qint32 nb_files;
+    bool m_nb_files_isSet;
+
+    qint64 written_bytes;
+    bool m_written_bytes_isSet;
+
+    qint64 dropped_samples;
+    bool m_dropped_samples_isSet;
+
+    QString* error_message;
+    bool m_error_message_isSet;
+
+};
+
+}
+
+#endif /* SWGChannelRecordStatus_H_ */
@@ -0,0 +1,148 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGDSPThreadsInfo.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGDSPThreadsInfo::SWGDSPThreadsInfo(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGDSPThreadsInfo::SWGDSPThreadsInfo() {
+    use_thread_pool = 0;
+    m_use_thread_pool_isSet = false;
+    nb_threads = 0;
+    m_nb_threads_isSet = false;
+    active_threads = 0;
+    m_active_threads_isSet = false;
+}
+
+SWGDSPThreadsInfo::~SWGDSPThreadsInfo() {
+    this->cleanup();
+}
+
+void
+SWGDSPThreadsInfo::init() {
+    use_thread_pool = 0;
+    m_use_thread_pool_isSet = false;
+    nb_threads = 0;
+    m_nb_threads_isSet = false;
+    active_threads = 0;
+    m_active_threads_isSet = false;
+}
+
+void
+SWGDSPThreadsInfo::cleanup() {
+
+
+
+}
+
+SWGDSPThreadsInfo*
+SWGDSPThreadsInfo::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGDSPThreadsInfo::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&use_thread_pool, pJson["useThreadPool"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_threads, pJson["nbThreads"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&active_threads, pJson["activeThreads"], "qint32", "");
+    
+}
+
+QString
+SWGDSPThreadsInfo::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGDSPThreadsInfo::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_use_thread_pool_isSet){
+        obj->insert("useThreadPool", QJsonValue(use_thread_pool));
+    }
+    if(m_nb_threads_isSet){
+        obj->insert("nbThreads", QJsonValue(nb_threads));
+    }
+    if(m_active_threads_isSet){
+        obj->insert("activeThreads", QJsonValue(active_threads));
+    }
+
+    return obj;
+}
+
+qint32
+SWGDSPThreadsInfo::getUseThreadPool() {
+    return use_thread_pool;
+}
+void
+SWGDSPThreadsInfo::setUseThreadPool(qint32 use_thread_pool) {
+    this->use_thread_pool = use_thread_pool;
+    this->m_use_thread_pool_isSet = true;
+}
+
+qint32
+SWGDSPThreadsInfo::getNbThreads() {
+    return nb_threads;
+}
+void
+SWGDSPThreadsInfo::setNbThreads(qint32 nb_threads) {
+    this->nb_threads = nb_threads;
+    this->m_nb_threads_isSet = true;
+}
+
+qint32
+SWGDSPThreadsInfo::getActiveThreads() {
+    return active_threads;
+}
+void
+SWGDSPThreadsInfo::setActiveThreads(qint32 active_threads) {
+    this->active_threads = active_threads;
+    this->m_active_threads_isSet = true;
+}
+
+
+bool
+SWGDSPThreadsInfo::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_use_thread_pool_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_threads_isSet){ isObjectUpdated = true; break;}
+        if(m_active_threads_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,69 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGDSPThreadsInfo.h
+ *
+ * DSP thread pool preference
+ */
+
+#ifndef SWGDSPThreadsInfo_H_
+#define SWGDSPThreadsInfo_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGDSPThreadsInfo: public SWGObject {
+public:
+    SWGDSPThreadsInfo();
+    SWGDSPThreadsInfo(QString* json);
+    virtual ~SWGDSPThreadsInfo();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGDSPThreadsInfo* fromJson(QString &jsonString);
+
+    qint32 getUseThreadPool();
+    void setUseThreadPool(qint32 use_thread_pool);
+
+    qint32 getNbThreads();
+    void setNbThreads(qint32 nb_threads);
+
+    qint32 getActiveThreads();
+    void setActiveThreads(qint32 active_threads);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 use_thread_pool;
+    bool m_use_thread_pool_isSet;
+
+    qint32 nb_threads;
+    bool m_nb_threads_isSet;
+
+    qint32 active_threads;
+    bool m_active_threads_isSet;
+
+};
+
+}
+
+#endif /* SWGDSPThreadsInfo_H_ */
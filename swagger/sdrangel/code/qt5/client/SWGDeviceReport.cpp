@@ -0,0 +1,429 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGDeviceReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGDeviceReport::SWGDeviceReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGDeviceReport::SWGDeviceReport() {
+    tx = 0;
+    m_tx_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_fill = 0;
+    m_fifo_fill_isSet = false;
+    fifo_max_fill = 0;
+    m_fifo_max_fill_isSet = false;
+    fifo_overflow_count = 0L;
+    m_fifo_overflow_count_isSet = false;
+    fifo_dropped_samples = 0L;
+    m_fifo_dropped_samples_isSet = false;
+    fifo_underrun_count = 0L;
+    m_fifo_underrun_count_isSet = false;
+    fifo_underrun_samples = 0L;
+    m_fifo_underrun_samples_isSet = false;
+    dsp_busy_time = 0L;
+    m_dsp_busy_time_isSet = false;
+    dsp_running_time = 0L;
+    m_dsp_running_time_isSet = false;
+    dsp_load = 0.0f;
+    m_dsp_load_isSet = false;
+    processed_samples = 0L;
+    m_processed_samples_isSet = false;
+    dsp_work_time = nullptr;
+    m_dsp_work_time_isSet = false;
+    baseband_sinks = nullptr;
+    m_baseband_sinks_isSet = false;
+}
+
+SWGDeviceReport::~SWGDeviceReport() {
+    this->cleanup();
+}
+
+void
+SWGDeviceReport::init() {
+    tx = 0;
+    m_tx_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_fill = 0;
+    m_fifo_fill_isSet = false;
+    fifo_max_fill = 0;
+    m_fifo_max_fill_isSet = false;
+    fifo_overflow_count = 0L;
+    m_fifo_overflow_count_isSet = false;
+    fifo_dropped_samples = 0L;
+    m_fifo_dropped_samples_isSet = false;
+    fifo_underrun_count = 0L;
+    m_fifo_underrun_count_isSet = false;
+    fifo_underrun_samples = 0L;
+    m_fifo_underrun_samples_isSet = false;
+    dsp_busy_time = 0L;
+    m_dsp_busy_time_isSet = false;
+    dsp_running_time = 0L;
+    m_dsp_running_time_isSet = false;
+    dsp_load = 0.0f;
+    m_dsp_load_isSet = false;
+    processed_samples = 0L;
+    m_processed_samples_isSet = false;
+    dsp_work_time = new SWGProfileHistogram();
+    m_dsp_work_time_isSet = false;
+    baseband_sinks = new QList<SWGBasebandSinkReport*>();
+    m_baseband_sinks_isSet = false;
+}
+
+void
+SWGDeviceReport::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+    if(dsp_work_time != nullptr) { 
+        delete dsp_work_time;
+    }
+    if(baseband_sinks != nullptr) { 
+        auto arr = baseband_sinks;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete baseband_sinks;
+    }
+}
+
+SWGDeviceReport*
+SWGDeviceReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGDeviceReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&tx, pJson["tx"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fifo_size, pJson["fifoSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_fill, pJson["fifoFill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_max_fill, pJson["fifoMaxFill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_overflow_count, pJson["fifoOverflowCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fifo_dropped_samples, pJson["fifoDroppedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fifo_underrun_count, pJson["fifoUnderrunCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fifo_underrun_samples, pJson["fifoUnderrunSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dsp_busy_time, pJson["dspBusyTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dsp_running_time, pJson["dspRunningTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dsp_load, pJson["dspLoad"], "float", "");
+    
+    ::SWGSDRangel::setValue(&processed_samples, pJson["processedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dsp_work_time, pJson["dspWorkTime"], "SWGProfileHistogram", "SWGProfileHistogram");
+    
+    
+    ::SWGSDRangel::setValue(&baseband_sinks, pJson["basebandSinks"], "QList", "SWGBasebandSinkReport");
+}
+
+QString
+SWGDeviceReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGDeviceReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_tx_isSet){
+        obj->insert("tx", QJsonValue(tx));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_fifo_size_isSet){
+        obj->insert("fifoSize", QJsonValue(fifo_size));
+    }
+    if(m_fifo_fill_isSet){
+        obj->insert("fifoFill", QJsonValue(fifo_fill));
+    }
+    if(m_fifo_max_fill_isSet){
+        obj->insert("fifoMaxFill", QJsonValue(fifo_max_fill));
+    }
+    if(m_fifo_overflow_count_isSet){
+        obj->insert("fifoOverflowCount", QJsonValue(fifo_overflow_count));
+    }
+    if(m_fifo_dropped_samples_isSet){
+        obj->insert("fifoDroppedSamples", QJsonValue(fifo_dropped_samples));
+    }
+    if(m_fifo_underrun_count_isSet){
+        obj->insert("fifoUnderrunCount", QJsonValue(fifo_underrun_count));
+    }
+    if(m_fifo_underrun_samples_isSet){
+        obj->insert("fifoUnderrunSamples", QJsonValue(fifo_underrun_samples));
+    }
+    if(m_dsp_busy_time_isSet){
+        obj->insert("dspBusyTime", QJsonValue(dsp_busy_time));
+    }
+    if(m_dsp_running_time_isSet){
+        obj->insert("dspRunningTime", QJsonValue(dsp_running_time));
+    }
+    if(m_dsp_load_isSet){
+        obj->insert("dspLoad", QJsonValue(dsp_load));
+    }
+    if(m_processed_samples_isSet){
+        obj->insert("processedSamples", QJsonValue(processed_samples));
+    }
+    if((dsp_work_time != nullptr) && (dsp_work_time->isSet())){
+        toJsonValue(QString("dspWorkTime"), dsp_work_time, obj, QString("SWGProfileHistogram"));
+    }
+    if(baseband_sinks->size() > 0){
+        toJsonArray((QList<void*>*)baseband_sinks, obj, "basebandSinks", "SWGBasebandSinkReport");
+    }
+
+    return obj;
+}
+
+qint32
+SWGDeviceReport::getTx() {
+    return tx;
+}
+void
+SWGDeviceReport::setTx(qint32 tx) {
+    this->tx = tx;
+    this->m_tx_isSet = true;
+}
+
+qint32
+SWGDeviceReport::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGDeviceReport::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGDeviceReport::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint32
+SWGDeviceReport::getFifoSize() {
+    return fifo_size;
+}
+void
+SWGDeviceReport::setFifoSize(qint32 fifo_size) {
+    this->fifo_size = fifo_size;
+    this->m_fifo_size_isSet = true;
+}
+
+qint32
+SWGDeviceReport::getFifoFill() {
+    return fifo_fill;
+}
+void
+SWGDeviceReport::setFifoFill(qint32 fifo_fill) {
+    this->fifo_fill = fifo_fill;
+    this->m_fifo_fill_isSet = true;
+}
+
+qint32
+SWGDeviceReport::getFifoMaxFill() {
+    return fifo_max_fill;
+}
+void
+SWGDeviceReport::setFifoMaxFill(qint32 fifo_max_fill) {
+    this->fifo_max_fill = fifo_max_fill;
+    this->m_fifo_max_fill_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getFifoOverflowCount() {
+    return fifo_overflow_count;
+}
+void
+SWGDeviceReport::setFifoOverflowCount(qint64 fifo_overflow_count) {
+    this->fifo_overflow_count = fifo_overflow_count;
+    this->m_fifo_overflow_count_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getFifoDroppedSamples() {
+    return fifo_dropped_samples;
+}
+void
+SWGDeviceReport::setFifoDroppedSamples(qint64 fifo_dropped_samples) {
+    this->fifo_dropped_samples = fifo_dropped_samples;
+    this->m_fifo_dropped_samples_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getFifoUnderrunCount() {
+    return fifo_underrun_count;
+}
+void
+SWGDeviceReport::setFifoUnderrunCount(qint64 fifo_underrun_count) {
+    this->fifo_underrun_count = fifo_underrun_count;
+    this->m_fifo_underrun_count_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getFifoUnderrunSamples() {
+    return fifo_underrun_samples;
+}
+void
+SWGDeviceReport::setFifoUnderrunSamples(qint64 fifo_underrun_samples) {
+    this->fifo_underrun_samples = fifo_underrun_samples;
+    this->m_fifo_underrun_samples_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getDspBusyTime() {
+    return dsp_busy_time;
+}
+void
+SWGDeviceReport::setDspBusyTime(qint64 dsp_busy_time) {
+    this->dsp_busy_time = dsp_busy_time;
+    this->m_dsp_busy_time_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getDspRunningTime() {
+    return dsp_running_time;
+}
+void
+SWGDeviceReport::setDspRunningTime(qint64 dsp_running_time) {
+    this->dsp_running_time = dsp_running_time;
+    this->m_dsp_running_time_isSet = true;
+}
+
+float
+SWGDeviceReport::getDspLoad() {
+    return dsp_load;
+}
+void
+SWGDeviceReport::setDspLoad(float dsp_load) {
+    this->dsp_load = dsp_load;
+    this->m_dsp_load_isSet = true;
+}
+
+qint64
+SWGDeviceReport::getProcessedSamples() {
+    return processed_samples;
+}
+void
+SWGDeviceReport::setProcessedSamples(qint64 processed_samples) {
+    this->processed_samples = processed_samples;
+    this->m_processed_samples_isSet = true;
+}
+
+SWGProfileHistogram*
+SWGDeviceReport::getDspWorkTime() {
+    return dsp_work_time;
+}
+void
+SWGDeviceReport::setDspWorkTime(SWGProfileHistogram* dsp_work_time) {
+    this->dsp_work_time = dsp_work_time;
+    this->m_dsp_work_time_isSet = true;
+}
+
+QList<SWGBasebandSinkReport*>*
+SWGDeviceReport::getBasebandSinks() {
+    return baseband_sinks;
+}
+void
+SWGDeviceReport::setBasebandSinks(QList<SWGBasebandSinkReport*>* baseband_sinks) {
+    this->baseband_sinks = baseband_sinks;
+    this->m_baseband_sinks_isSet = true;
+}
+
+
+bool
+SWGDeviceReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_tx_isSet){ isObjectUpdated = true; break;}
+        if(m_sample_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_center_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_size_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_fill_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_max_fill_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_overflow_count_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_dropped_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_underrun_count_isSet){ isObjectUpdated = true; break;}
+        if(m_fifo_underrun_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_dsp_busy_time_isSet){ isObjectUpdated = true; break;}
+        if(m_dsp_running_time_isSet){ isObjectUpdated = true; break;}
+        if(m_dsp_load_isSet){ isObjectUpdated = true; break;}
+        if(m_processed_samples_isSet){ isObjectUpdated = true; break;}
+        if(dsp_work_time != nullptr && dsp_work_time->isSet()){ isObjectUpdated = true; break;}
+        if(baseband_sinks->size() > 0){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
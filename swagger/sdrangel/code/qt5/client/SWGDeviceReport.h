@@ -0,0 +1,150 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGDeviceReport.h
+ *
+ * Device runtime counters. Times are in nanoseconds and counters are reset each time the device is started.
+ */
+
+#ifndef SWGDeviceReport_H_
+#define SWGDeviceReport_H_
+
+#include <QJsonObject>
+
+
+#include "SWGBasebandSinkReport.h"
+#include "SWGProfileHistogram.h"
+#include <QList>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGDeviceReport: public SWGObject {
+public:
+    SWGDeviceReport();
+    SWGDeviceReport(QString* json);
+    virtual ~SWGDeviceReport();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGDeviceReport* fromJson(QString &jsonString);
+
+    qint32 getTx();
+    void setTx(qint32 tx);
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    qint64 getCenterFrequency();
+    void setCenterFrequency(qint64 center_frequency);
+
+    qint32 getFifoSize();
+    void setFifoSize(qint32 fifo_size);
+
+    qint32 getFifoFill();
+    void setFifoFill(qint32 fifo_fill);
+
+    qint32 getFifoMaxFill();
+    void setFifoMaxFill(qint32 fifo_max_fill);
+
+    qint64 getFifoOverflowCount();
+    void setFifoOverflowCount(qint64 fifo_overflow_count);
+
+    qint64 getFifoDroppedSamples();
+    void setFifoDroppedSamples(qint64 fifo_dropped_samples);
+
+    qint64 getFifoUnderrunCount();
+    void setFifoUnderrunCount(qint64 fifo_underrun_count);
+
+    qint64 getFifoUnderrunSamples();
+    void setFifoUnderrunSamples(qint64 fifo_underrun_samples);
+
+    qint64 getDspBusyTime();
+    void setDspBusyTime(qint64 dsp_busy_time);
+
+    qint64 getDspRunningTime();
+    void setDspRunningTime(qint64 dsp_running_time);
+
+    float getDspLoad();
+    void setDspLoad(float dsp_load);
+
+    qint64 getProcessedSamples();
+    void setProcessedSamples(qint64 processed_samples);
+
+    SWGProfileHistogram* getDspWorkTime();
+    void setDspWorkTime(SWGProfileHistogram* dsp_work_time);
+
+    QList<SWGBasebandSinkReport*>* getBasebandSinks();
+    void setBasebandSinks(QList<SWGBasebandSinkReport*>* baseband_sinks);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 tx;
+    bool m_tx_isSet;
+
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    qint64 center_frequency;
+    bool m_center_frequency_isSet;
+
+    qint32 fifo_size;
+    bool m_fifo_size_isSet;
+
+    qint32 fifo_fill;
+    bool m_fifo_fill_isSet;
+
+    qint32 fifo_max_fill;
+    bool m_fifo_max_fill_isSet;
+
+    qint64 fifo_overflow_count;
+    bool m_fifo_overflow_count_isSet;
+
+    qint64 fifo_dropped_samples;
+    bool m_fifo_dropped_samples_isSet;
+
+    qint64 fifo_underrun_count;
+    bool m_fifo_underrun_count_isSet;
+
+    qint64 fifo_underrun_samples;
+    bool m_fifo_underrun_samples_isSet;
+
+    qint64 dsp_busy_time;
+    bool m_dsp_busy_time_isSet;
+
+    qint64 dsp_running_time;
+    bool m_dsp_running_time_isSet;
+
+    float dsp_load;
+    bool m_dsp_load_isSet;
+
+    qint64 processed_samples;
+    bool m_processed_samples_isSet;
+
+    SWGProfileHistogram* dsp_work_time;
+    bool m_dsp_work_time_isSet;
+
+    QList<SWGBasebandSinkReport*>* baseband_sinks;
+    bool m_baseband_sinks_isSet;
+
+};
+
+}
+
+#endif /* SWGDeviceReport_H_ */
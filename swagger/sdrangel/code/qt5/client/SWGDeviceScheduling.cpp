@@ -0,0 +1,452 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGDeviceScheduling.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGDeviceScheduling::SWGDeviceScheduling(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGDeviceScheduling::SWGDeviceScheduling() {
+    policy = nullptr;
+    m_policy_isSet = false;
+    rt_priority = 0;
+    m_rt_priority_isSet = false;
+    nice = 0;
+    m_nice_isSet = false;
+    cpu_affinity = nullptr;
+    m_cpu_affinity_isSet = false;
+    dsp_applied_policy = nullptr;
+    m_dsp_applied_policy_isSet = false;
+    device_applied_policy = nullptr;
+    m_device_applied_policy_isSet = false;
+    error = nullptr;
+    m_error_isSet = false;
+    latency_avg = 0L;
+    m_latency_avg_isSet = false;
+    latency_max = 0L;
+    m_latency_max_isSet = false;
+    overflow_count = 0L;
+    m_overflow_count_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+    running_time = 0L;
+    m_running_time_isSet = false;
+    previous_latency_avg = 0L;
+    m_previous_latency_avg_isSet = false;
+    previous_latency_max = 0L;
+    m_previous_latency_max_isSet = false;
+    previous_overflow_count = 0L;
+    m_previous_overflow_count_isSet = false;
+    previous_dropped_samples = 0L;
+    m_previous_dropped_samples_isSet = false;
+    previous_running_time = 0L;
+    m_previous_running_time_isSet = false;
+}
+
+SWGDeviceScheduling::~SWGDeviceScheduling() {
+    this->cleanup();
+}
+
+void
+SWGDeviceScheduling::init() {
+    policy = new QString("");
+    m_policy_isSet = false;
+    rt_priority = 0;
+    m_rt_priority_isSet = false;
+    nice = 0;
+    m_nice_isSet = false;
+    cpu_affinity = new QString("");
+    m_cpu_affinity_isSet = false;
+    dsp_applied_policy = new QString("");
+    m_dsp_applied_policy_isSet = false;
+    device_applied_policy = new QString("");
+    m_device_applied_policy_isSet = false;
+    error = new QString("");
+    m_error_isSet = false;
+    latency_avg = 0L;
+    m_latency_avg_isSet = false;
+    latency_max = 0L;
+    m_latency_max_isSet = false;
+    overflow_count = 0L;
+    m_overflow_count_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+    running_time = 0L;
+    m_running_time_isSet = false;
+    previous_latency_avg = 0L;
+    m_previous_latency_avg_isSet = false;
+    previous_latency_max = 0L;
+    m_previous_latency_max_isSet = false;
+    previous_overflow_count = 0L;
+    m_previous_overflow_count_isSet = false;
+    previous_dropped_samples = 0L;
+    m_previous_dropped_samples_isSet = false;
+    previous_running_time = 0L;
+    m_previous_running_time_isSet = false;
+}
+
+void
+SWGDeviceScheduling::cleanup() {
+    if(policy != nullptr) { 
+        delete policy;
+    }
+
+
+    if(cpu_affinity != nullptr) { 
+        delete cpu_affinity;
+    }
+    if(dsp_applied_policy != nullptr) { 
+        delete dsp_applied_policy;
+    }
+    if(device_applied_policy != nullptr) { 
+        delete device_applied_policy;
+    }
+    if(error != nullptr) { 
+        delete error;
+    }
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGDeviceScheduling*
+SWGDeviceScheduling::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGDeviceScheduling::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&policy, pJson["policy"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&rt_priority, pJson["rtPriority"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nice, pJson["nice"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&cpu_affinity, pJson["cpuAffinity"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&dsp_applied_policy, pJson["dspAppliedPolicy"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&device_applied_policy, pJson["deviceAppliedPolicy"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&error, pJson["error"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&latency_avg, pJson["latencyAvg"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&latency_max, pJson["latencyMax"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&overflow_count, pJson["overflowCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dropped_samples, pJson["droppedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&running_time, pJson["runningTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&previous_latency_avg, pJson["previousLatencyAvg"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&previous_latency_max, pJson["previousLatencyMax"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&previous_overflow_count, pJson["previousOverflowCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&previous_dropped_samples, pJson["previousDroppedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&previous_running_time, pJson["previousRunningTime"], "qint64", "");
+    
+}
+
+QString
+SWGDeviceScheduling::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGDeviceScheduling::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(policy != nullptr && *policy != QString("")){
+        toJsonValue(QString("policy"), policy, obj, QString("QString"));
+    }
+    if(m_rt_priority_isSet){
+        obj->insert("rtPriority", QJsonValue(rt_priority));
+    }
+    if(m_nice_isSet){
+        obj->insert("nice", QJsonValue(nice));
+    }
+    if(cpu_affinity != nullptr && *cpu_affinity != QString("")){
+        toJsonValue(QString("cpuAffinity"), cpu_affinity, obj, QString("QString"));
+    }
+    if(dsp_applied_policy != nullptr && *dsp_applied_policy != QString("")){
+        toJsonValue(QString("dspAppliedPolicy"), dsp_applied_policy, obj, QString("QString"));
+    }
+    if(device_applied_policy != nullptr && *device_applied_policy != QString("")){
+        toJsonValue(QString("deviceAppliedPolicy"), device_applied_policy, obj, QString("QString"));
+    }
+    if(error != nullptr && *error != QString("")){
+        toJsonValue(QString("error"), error, obj, QString("QString"));
+    }
+    if(m_latency_avg_isSet){
+        obj->insert("latencyAvg", QJsonValue(latency_avg));
+    }
+    if(m_latency_max_isSet){
+        obj->insert("latencyMax", QJsonValue(latency_max));
+    }
+    if(m_overflow_count_isSet){
+        obj->insert("overflowCount", QJsonValue(overflow_count));
+    }
+    if(m_dropped_samples_isSet){
+        obj->insert("droppedSamples", QJsonValue(dropped_samples));
+    }
+    if(m_running_time_isSet){
+        obj->insert("runningTime", QJsonValue(running_time));
+    }
+    if(m_previous_latency_avg_isSet){
+        obj->insert("previousLatencyAvg", QJsonValue(previous_latency_avg));
+    }
+    if(m_previous_latency_max_isSet){
+        obj->insert("previousLatencyMax", QJsonValue(previous_latency_max));
+    }
+    if(m_previous_overflow_count_isSet){
+        obj->insert("previousOverflowCount", QJsonValue(previous_overflow_count));
+    }
+    if(m_previous_dropped_samples_isSet){
+        obj->insert("previousDroppedSamples", QJsonValue(previous_dropped_samples));
+    }
+    if(m_previous_running_time_isSet){
+        obj->insert("previousRunningTime", QJsonValue(previous_running_time));
+    }
+
+    return obj;
+}
+
+QString*
+SWGDeviceScheduling::getPolicy() {
+    return policy;
+}
+void
+SWGDeviceScheduling::setPolicy(QString* policy) {
+    this->policy = policy;
+    this->m_policy_isSet = true;
+}
+
+qint32
+SWGDeviceScheduling::getRtPriority() {
+    return rt_priority;
+}
+void
+SWGDeviceScheduling::setRtPriority(qint32 rt_priority) {
+    this->rt_priority = rt_priority;
+    this->m_rt_priority_isSet = true;
+}
+
+qint32
+SWGDeviceScheduling::getNice() {
+    return nice;
+}
+void
+SWGDeviceScheduling::setNice(qint32 nice) {
+    this->nice = nice;
+    this->m_nice_isSet = true;
+}
+
+QString*
+SWGDeviceScheduling::getCpuAffinity() {
+    return cpu_affinity;
+}
+void
+SWGDeviceScheduling::setCpuAffinity(QString* cpu_affinity) {
+    this->cpu_affinity = cpu_affinity;
+    this->m_cpu_affinity_isSet = true;
+}
+
+QString*
+SWGDeviceScheduling::getDspAppliedPolicy() {
+    return dsp_applied_policy;
+}
+void
+SWGDeviceScheduling::setDspAppliedPolicy(QString* dsp_applied_policy) {
+    this->dsp_applied_policy = dsp_applied_policy;
+    this->m_dsp_applied_policy_isSet = true;
+}
+
+QString*
+SWGDeviceScheduling::getDeviceAppliedPolicy() {
+    return device_applied_policy;
+}
+void
+SWGDeviceScheduling::setDeviceAppliedPolicy(QString* device_applied_policy) {
+    this->device_applied_policy = device_applied_policy;
+    this->m_device_applied_policy_isSet = true;
+}
+
+QString*
+SWGDeviceScheduling::getError() {
+    return error;
+}
+void
+SWGDeviceScheduling::setError(QString* error) {
+    this->error = error;
+    this->m_error_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getLatencyAvg() {
+    return latency_avg;
+}
+void
+SWGDeviceScheduling::setLatencyAvg(qint64 latency_avg) {
+    this->latency_avg = latency_avg;
+    this->m_latency_avg_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getLatencyMax() {
+    return latency_max;
+}
+void
+SWGDeviceScheduling::setLatencyMax(qint64 latency_max) {
+    this->latency_max = latency_max;
+    this->m_latency_max_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getOverflowCount() {
+    return overflow_count;
+}
+void
+SWGDeviceScheduling::setOverflowCount(qint64 overflow_count) {
+    this->overflow_count = overflow_count;
+    this->m_overflow_count_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getDroppedSamples() {
+    return dropped_samples;
+}
+void
+SWGDeviceScheduling::setDroppedSamples(qint64 dropped_samples) {
+    this->dropped_samples = dropped_samples;
+    this->m_dropped_samples_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getRunningTime() {
+    return running_time;
+}
+void
+SWGDeviceScheduling::setRunningTime(qint64 running_time) {
+    this->running_time = running_time;
+    this->m_running_time_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getPreviousLatencyAvg() {
+    return previous_latency_avg;
+}
+void
+SWGDeviceScheduling::setPreviousLatencyAvg(qint64 previous_latency_avg) {
+    this->previous_latency_avg = previous_latency_avg;
+    this->m_previous_latency_avg_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getPreviousLatencyMax() {
+    return previous_latency_max;
+}
+void
+SWGDeviceScheduling::setPreviousLatencyMax(qint64 previous_latency_max) {
+    this->previous_latency_max = previous_latency_max;
+    this->m_previous_latency_max_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getPreviousOverflowCount() {
+    return previous_overflow_count;
+}
+void
+SWGDeviceScheduling::setPreviousOverflowCount(qint64 previous_overflow_count) {
+    this->previous_overflow_count = previous_overflow_count;
+    this->m_previous_overflow_count_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getPreviousDroppedSamples() {
+    return previous_dropped_samples;
+}
+void
+SWGDeviceScheduling::setPreviousDroppedSamples(qint64 previous_dropped_samples) {
+    this->previous_dropped_samples = previous_dropped_samples;
+    this->m_previous_dropped_samples_isSet = true;
+}
+
+qint64
+SWGDeviceScheduling::getPreviousRunningTime() {
+    return previous_running_time;
+}
+void
+SWGDeviceScheduling::setPreviousRunningTime(qint64 previous_running_time) {
+    this->previous_running_time = previous_running_time;
+    this->m_previous_running_time_isSet = true;
+}
+
+
+bool
+SWGDeviceScheduling::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(policy != nullptr && *policy != QString("")){ isObjectUpdated = true; break;}
+        if(m_rt_priority_isSet){ isObjectUpdated = true; break;}
+        if(m_nice_isSet){ isObjectUpdated = true; break;}
+        if(cpu_affinity != nullptr && *cpu_affinity != QString("")){ isObjectUpdated = true; break;}
+        if(dsp_applied_policy != nullptr && *dsp_applied_policy != QString("")){ isObjectUpdated = true; break;}
+        if(device_applied_policy != nullptr && *device_applied_policy != QString("")){ isObjectUpdated = true; break;}
+        if(error != nullptr && *error != QString("")){ isObjectUpdated = true; break;}
+        if(m_latency_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_latency_max_isSet){ isObjectUpdated = true; break;}
+        if(m_overflow_count_isSet){ isObjectUpdated = true; break;}
+        if(m_dropped_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_running_time_isSet){ isObjectUpdated = true; break;}
+        if(m_previous_latency_avg_isSet){ isObjectUpdated = true; break;}
+        if(m_previous_latency_max_isSet){ isObjectUpdated = true; break;}
+        if(m_previous_overflow_count_isSet){ isObjectUpdated = true; break;}
+        if(m_previous_dropped_samples_isSet){ isObjectUpdated = true; break;}
+        if(m_previous_running_time_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
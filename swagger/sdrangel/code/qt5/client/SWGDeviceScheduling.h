@@ -0,0 +1,154 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGDeviceScheduling.h
+ *
+ * Scheduling of the DSP engine thread and of the device threads of a device set with counters to compare the effect of the settings
+ */
+
+#ifndef SWGDeviceScheduling_H_
+#define SWGDeviceScheduling_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGDeviceScheduling: public SWGObject {
+public:
+    SWGDeviceScheduling();
+    SWGDeviceScheduling(QString* json);
+    virtual ~SWGDeviceScheduling();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGDeviceScheduling* fromJson(QString &jsonString);
+
+    QString* getPolicy();
+    void setPolicy(QString* policy);
+
+    qint32 getRtPriority();
+    void setRtPriority(qint32 rt_priority);
+
+    qint32 getNice();
+    void setNice(qint32 nice);
+
+    QString* getCpuAffinity();
+    void setCpuAffinity(QString* cpu_affinity);
+
+    QString* getDspAppliedPolicy();
+    void setDspAppliedPolicy(QString* dsp_applied_policy);
+
+    QString* getDeviceAppliedPolicy();
+    void setDeviceAppliedPolicy(QString* device_applied_policy);
+
+    QString* getError();
+    void setError(QString* error);
+
+    qint64 getLatencyAvg();
+    void setLatencyAvg(qint64 latency_avg);
+
+    qint64 getLatencyMax();
+    void setLatencyMax(qint64 latency_max);
+
+    qint64 getOverflowCount();
+    void setOverflowCount(qint64 overflow_count);
+
+    qint64 getDroppedSamples();
+    void setDroppedSamples(qint64 dropped_samples);
+
+    qint64 getRunningTime();
+    void setRunningTime(qint64 running_time);
+
+    qint64 getPreviousLatencyAvg();
+    void setPreviousLatencyAvg(qint64 previous_latency_avg);
+
+    qint64 getPreviousLatencyMax();
+    void setPreviousLatencyMax(qint64 previous_latency_max);
+
+    qint64 getPreviousOverflowCount();
+    void setPreviousOverflowCount(qint64 previous_overflow_count);
+
+    qint64 getPreviousDroppedSamples();
+    void setPreviousDroppedSamples(qint64 previous_dropped_samples);
+
+    qint64 getPreviousRunningTime();
+    void setPreviousRunningTime(qint64 previous_running_time);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* policy;
+    bool m_policy_isSet;
+
+    qint32 rt_priority;
+    bool m_rt_priority_isSet;
+
+    qint32 nice;
+    bool m_nice_isSet;
+
+    QString* cpu_affinity;
+    bool m_cpu_affinity_isSet;
+
+    QString* dsp_applied_policy;
+    bool m_dsp_applied_policy_isSet;
+
+    QString* device_applied_policy;
+    bool m_device_applied_policy_isSet;
+
+    QString* error;
+    bool m_error_isSet;
+
+    qint64 latency_avg;
+    bool m_latency_avg_isSet;
+
+    qint64 latency_max;
+    bool m_latency_max_isSet;
+
+    qint64 overflow_count;
+    bool m_overflow_count_isSet;
+
+    qint64 dropped_samples;
+    bool m_dropped_samples_isSet;
+
+    qint64 running_time;
+    bool m_running_time_isSet;
+
+    qint64 previous_latency_avg;
+    bool m_previous_latency_avg_isSet;
+
+    qint64 previous_latency_max;
+    bool m_previous_latency_max_isSet;
+
+    qint64 previous_overflow_count;
+    bool m_previous_overflow_count_isSet;
+
+    qint64 previous_dropped_samples;
+    bool m_previous_dropped_samples_isSet;
+
+    qint64 previous_running_time;
+    bool m_previous_running_time_isSet;
+
+};
+
+}
+
+#endif /* SWGDeviceScheduling_H_ */
@@ -30,6 +30,8 @@ SWGFileSourceSettings::SWGFileSourceSettings(QString* json) {
 SWGFileSourceSettings::SWGFileSourceSettings() {
     file_name = nullptr;
     m_file_name_isSet = false;
+    seek_ms = 0L;
+    m_seek_ms_isSet = false;
 }
 
 SWGFileSourceSettings::~SWGFileSourceSettings() {
@@ -40,6 +42,8 @@ void
 SWGFileSourceSettings::init() {
     file_name = new QString("");
     m_file_name_isSet = false;
+    seek_ms = 0L;
+    m_seek_ms_isSet = false;
 }
 
 void
@@ -47,6 +51,7 @@ SWGFileSourceSettings::cleanup() {
     if(file_name != nullptr) { 
         delete file_name;
     }
+
 }
 
 SWGFileSourceSettings*
@@ -62,6 +67,8 @@ void
 SWGFileSourceSettings::fromJsonObject(QJsonObject &pJson) {
     ::SWGSDRangel::setValue(&file_name, pJson["fileName"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&seek_ms, pJson["seekMs"], "qint64", "");
+    
 }
 
 QString
@@ -81,6 +88,9 @@ SWGFileSourceSettings::asJsonObject() {
     if(file_name != nullptr && *file_name != QString("")){
         toJsonValue(QString("fileName"), file_name, obj, QString("QString"));
     }
+    if(m_seek_ms_isSet){
+        obj->insert("seekMs", QJsonValue(seek_ms));
+    }
 
     return obj;
 }
@@ -95,12 +105,23 @@ SWGFileSourceSettings::setFileName(QString* file_name) {
     this->m_file_name_isSet = true;
 }
 
+qint64
+SWGFileSourceSettings::getSeekMs() {
+    return seek_ms;
+}
+void
+SWGFileSourceSettings::setSeekMs(qint64 seek_ms) {
+    this->seek_ms = seek_ms;
+    this->m_seek_ms_isSet = true;
+}
+
 
 bool
 SWGFileSourceSettings::isSet(){
     bool isObjectUpdated = false;
     do{
         if(file_name != nullptr && *file_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_seek_ms_isSet){ isObjectUpdated = true; break;}
     }while(false);
     return isObjectUpdated;
 }
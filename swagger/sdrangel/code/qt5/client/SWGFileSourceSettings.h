@@ -44,6 +44,9 @@ public:
     QString* getFileName();
     void setFileName(QString* file_name);
 
+    qint64 getSeekMs();
+    void setSeekMs(qint64 seek_ms);
+
 
     virtual bool isSet() override;
 
@@ -51,6 +54,9 @@ private:
     QString* file_name;
     bool m_file_name_isSet;
 
+    qint64 seek_ms;
+    bool m_seek_ms_isSet;
+
 };
 
 }
@@ -17,13 +17,20 @@
 #include "SWGAudioDevice.h"
 #include "SWGAudioDevices.h"
 #include "SWGAudioDevicesSelect.h"
+#include "SWGBasebandSinkReport.h"
 #include "SWGCWKeyerSettings.h"
 #include "SWGChannel.h"
 #include "SWGChannelListItem.h"
+#include "SWGChannelRecord.h"
+#include "SWGChannelRecordStatus.h"
+#include "SWGChannelReport.h"
 #include "SWGChannelSettings.h"
+#include "SWGDSPThreadsInfo.h"
 #include "SWGDVSeralDevices.h"
 #include "SWGDVSerialDevice.h"
 #include "SWGDeviceListItem.h"
+#include "SWGDeviceReport.h"
+#include "SWGDeviceScheduling.h"
 #include "SWGDeviceSet.h"
 #include "SWGDeviceSetList.h"
 #include "SWGDeviceSettings.h"
@@ -39,8 +46,12 @@
 #include "SWGLimeSdrOutputSettings.h"
 #include "SWGLocationInformation.h"
 #include "SWGLoggingInfo.h"
+#include "SWGNFMDemodReport.h"
 #include "SWGNFMDemodSettings.h"
+#include "SWGNFMModReport.h"
 #include "SWGNFMModSettings.h"
+#include "SWGPreTriggerRecord.h"
+#include "SWGPreTriggerRecordStatus.h"
 #include "SWGPresetExport.h"
 #include "SWGPresetGroup.h"
 #include "SWGPresetIdentifier.h"
@@ -48,8 +59,14 @@
 #include "SWGPresetItem.h"
 #include "SWGPresetTransfer.h"
 #include "SWGPresets.h"
+#include "SWGProfileBucket.h"
+#include "SWGProfileHistogram.h"
 #include "SWGRtlSdrSettings.h"
 #include "SWGSamplingDevice.h"
+#include "SWGSpectrumArchive.h"
+#include "SWGSpectrumArchiveQuery.h"
+#include "SWGSpectrumArchiveSpectrum.h"
+#include "SWGSpectrumArchiveStatus.h"
 #include "SWGSuccessResponse.h"
 
 namespace SWGSDRangel {
@@ -64,6 +81,9 @@ namespace SWGSDRangel {
     if(QString("SWGAudioDevicesSelect").compare(type) == 0) {
       return new SWGAudioDevicesSelect();
     }
+    if(QString("SWGBasebandSinkReport").compare(type) == 0) {
+      return new SWGBasebandSinkReport();
+    }
     if(QString("SWGCWKeyerSettings").compare(type) == 0) {
       return new SWGCWKeyerSettings();
     }
@@ -73,9 +93,21 @@ namespace SWGSDRangel {
     if(QString("SWGChannelListItem").compare(type) == 0) {
       return new SWGChannelListItem();
     }
+    if(QString("SWGChannelRecord").compare(type) == 0) {
+      return new SWGChannelRecord();
+    }
+    if(QString("SWGChannelRecordStatus").compare(type) == 0) {
+      return new SWGChannelRecordStatus();
+    }
+    if(QString("SWGChannelReport").compare(type) == 0) {
+      return new SWGChannelReport();
+    }
     if(QString("SWGChannelSettings").compare(type) == 0) {
       return new SWGChannelSettings();
     }
+    if(QString("SWGDSPThreadsInfo").compare(type) == 0) {
+      return new SWGDSPThreadsInfo();
+    }
     if(QString("SWGDVSeralDevices").compare(type) == 0) {
       return new SWGDVSeralDevices();
     }
@@ -85,6 +117,12 @@ namespace SWGSDRangel {
     if(QString("SWGDeviceListItem").compare(type) == 0) {
       return new SWGDeviceListItem();
     }
+    if(QString("SWGDeviceReport").compare(type) == 0) {
+      return new SWGDeviceReport();
+    }
+    if(QString("SWGDeviceScheduling").compare(type) == 0) {
+      return new SWGDeviceScheduling();
+    }
     if(QString("SWGDeviceSet").compare(type) == 0) {
       return new SWGDeviceSet();
     }
@@ -130,12 +168,24 @@ namespace SWGSDRangel {
     if(QString("SWGLoggingInfo").compare(type) == 0) {
       return new SWGLoggingInfo();
     }
+    if(QString("SWGNFMDemodReport").compare(type) == 0) {
+      return new SWGNFMDemodReport();
+    }
     if(QString("SWGNFMDemodSettings").compare(type) == 0) {
       return new SWGNFMDemodSettings();
     }
+    if(QString("SWGNFMModReport").compare(type) == 0) {
+      return new SWGNFMModReport();
+    }
     if(QString("SWGNFMModSettings").compare(type) == 0) {
       return new SWGNFMModSettings();
     }
+    if(QString("SWGPreTriggerRecord").compare(type) == 0) {
+      return new SWGPreTriggerRecord();
+    }
+    if(QString("SWGPreTriggerRecordStatus").compare(type) == 0) {
+      return new SWGPreTriggerRecordStatus();
+    }
     if(QString("SWGPresetExport").compare(type) == 0) {
       return new SWGPresetExport();
     }
@@ -157,12 +207,30 @@ namespace SWGSDRangel {
     if(QString("SWGPresets").compare(type) == 0) {
       return new SWGPresets();
     }
+    if(QString("SWGProfileBucket").compare(type) == 0) {
+      return new SWGProfileBucket();
+    }
+    if(QString("SWGProfileHistogram").compare(type) == 0) {
+      return new SWGProfileHistogram();
+    }
     if(QString("SWGRtlSdrSettings").compare(type) == 0) {
       return new SWGRtlSdrSettings();
     }
     if(QString("SWGSamplingDevice").compare(type) == 0) {
       return new SWGSamplingDevice();
     }
+    if(QString("SWGSpectrumArchive").compare(type) == 0) {
+      return new SWGSpectrumArchive();
+    }
+    if(QString("SWGSpectrumArchiveQuery").compare(type) == 0) {
+      return new SWGSpectrumArchiveQuery();
+    }
+    if(QString("SWGSpectrumArchiveSpectrum").compare(type) == 0) {
+      return new SWGSpectrumArchiveSpectrum();
+    }
+    if(QString("SWGSpectrumArchiveStatus").compare(type) == 0) {
+      return new SWGSpectrumArchiveStatus();
+    }
     if(QString("SWGSuccessResponse").compare(type) == 0) {
       return new SWGSuccessResponse();
     }
@@ -0,0 +1,236 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGPreTriggerRecord.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGPreTriggerRecord::SWGPreTriggerRecord(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGPreTriggerRecord::SWGPreTriggerRecord() {
+    armed = 0;
+    m_armed_isSet = false;
+    file_base = nullptr;
+    m_file_base_isSet = false;
+    pre_trigger_time = 0.0f;
+    m_pre_trigger_time_isSet = false;
+    post_trigger_time = 0.0f;
+    m_post_trigger_time_isSet = false;
+    huge_pages = 0;
+    m_huge_pages_isSet = false;
+    squelch_channel_index = 0;
+    m_squelch_channel_index_isSet = false;
+    status = nullptr;
+    m_status_isSet = false;
+}
+
+SWGPreTriggerRecord::~SWGPreTriggerRecord() {
+    this->cleanup();
+}
+
+void
+SWGPreTriggerRecord::init() {
+    armed = 0;
+    m_armed_isSet = false;
+    file_base = new QString("");
+    m_file_base_isSet = false;
+    pre_trigger_time = 0.0f;
+    m_pre_trigger_time_isSet = false;
+    post_trigger_time = 0.0f;
+    m_post_trigger_time_isSet = false;
+    huge_pages = 0;
+    m_huge_pages_isSet = false;
+    squelch_channel_index = 0;
+    m_squelch_channel_index_isSet = false;
+    status = new SWGPreTriggerRecordStatus();
+    m_status_isSet = false;
+}
+
+void
+SWGPreTriggerRecord::cleanup() {
+
+    if(file_base != nullptr) { 
+        delete file_base;
+    }
+
+
+
+
+    if(status != nullptr) { 
+        delete status;
+    }
+}
+
+SWGPreTriggerRecord*
+SWGPreTriggerRecord::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGPreTriggerRecord::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&armed, pJson["armed"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&file_base, pJson["fileBase"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&pre_trigger_time, pJson["preTriggerTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&post_trigger_time, pJson["postTriggerTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&huge_pages, pJson["hugePages"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&squelch_channel_index, pJson["squelchChannelIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&status, pJson["status"], "SWGPreTriggerRecordStatus", "SWGPreTriggerRecordStatus");
+    
+}
+
+QString
+SWGPreTriggerRecord::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGPreTriggerRecord::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_armed_isSet){
+        obj->insert("armed", QJsonValue(armed));
+    }
+    if(file_base != nullptr && *file_base != QString("")){
+        toJsonValue(QString("fileBase"), file_base, obj, QString("QString"));
+    }
+    if(m_pre_trigger_time_isSet){
+        obj->insert("preTriggerTime", QJsonValue(pre_trigger_time));
+    }
+    if(m_post_trigger_time_isSet){
+        obj->insert("postTriggerTime", QJsonValue(post_trigger_time));
+    }
+    if(m_huge_pages_isSet){
+        obj->insert("hugePages", QJsonValue(huge_pages));
+    }
+    if(m_squelch_channel_index_isSet){
+        obj->insert("squelchChannelIndex", QJsonValue(squelch_channel_index));
+    }
+    if((status != nullptr) && (status->isSet())){
+        toJsonValue(QString("status"), status, obj, QString("SWGPreTriggerRecordStatus"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGPreTriggerRecord::getArmed() {
+    return armed;
+}
+void
+SWGPreTriggerRecord::setArmed(qint32 armed) {
+    this->armed = armed;
+    this->m_armed_isSet = true;
+}
+
+QString*
+SWGPreTriggerRecord::getFileBase() {
+    return file_base;
+}
+void
+SWGPreTriggerRecord::setFileBase(QString* file_base) {
+    this->file_base = file_base;
+    this->m_file_base_isSet = true;
+}
+
+float
+SWGPreTriggerRecord::getPreTriggerTime() {
+    return pre_trigger_time;
+}
+void
+SWGPreTriggerRecord::setPreTriggerTime(float pre_trigger_time) {
+    this->pre_trigger_time = pre_trigger_time;
+    this->m_pre_trigger_time_isSet = true;
+}
+
+float
+SWGPreTriggerRecord::getPostTriggerTime() {
+    return post_trigger_time;
+}
+void
+SWGPreTriggerRecord::setPostTriggerTime(float post_trigger_time) {
+    this->post_trigger_time = post_trigger_time;
+    this->m_post_trigger_time_isSet = true;
+}
+
+qint32
+SWGPreTriggerRecord::getHugePages() {
+    return huge_pages;
+}
+void
+SWGPreTriggerRecord::setHugePages(qint32 huge_pages) {
+    this->huge_pages = huge_pages;
+    this->m_huge_pages_isSet = true;
+}
+
+qint32
+SWGPreTriggerRecord::getSquelchChannelIndex() {
+    return squelch_channel_index;
+}
+void
+SWGPreTriggerRecord::setSquelchChannelIndex(qint32 squelch_channel_index) {
+    this->squelch_channel_index = squelch_channel_index;
+    this->m_squelch_channel_index_isSet = true;
+}
+
+SWGPreTriggerRecordStatus*
+SWGPreTriggerRecord::getStatus() {
+    return status;
+}
+void
+SWGPreTriggerRecord::setStatus(SWGPreTriggerRecordStatus* status) {
+    this->status = status;
+    this->m_status_isSet = true;
+}
+
+
+bool
+SWGPreTriggerRecord::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_armed_isSet){ isObjectUpdated = true; break;}
+        if(file_base != nullptr && *file_base != QString("")){ isObjectUpdated = true; break;}
+        if(m_pre_trigger_time_isSet){ isObjectUpdated = true; break;}
+        if(m_post_trigger_time_isSet){ isObjectUpdated = true; break;}
+        if(m_huge_pages_isSet){ isObjectUpdated = true; break;}
+        if(m_squelch_channel_index_isSet){ isObjectUpdated = true; break;}
+        if(status != nullptr && status->isSet()){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
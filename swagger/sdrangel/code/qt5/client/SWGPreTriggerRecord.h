@@ -0,0 +1,95 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGPreTriggerRecord.h
+ *
+ * Pre-trigger I/Q recorder of a receiving device set. When armed the baseband is kept in a memory ring buffer of the pre-trigger time. A trigger writes the buffered samples to a new .sdriq file followed by the incoming samples until the post-trigger time after the last trigger.
+ */
+
+#ifndef SWGPreTriggerRecord_H_
+#define SWGPreTriggerRecord_H_
+
+#include <QJsonObject>
+
+
+#include "SWGPreTriggerRecordStatus.h"
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGPreTriggerRecord: public SWGObject {
+public:
+    SWGPreTriggerRecord();
+    SWGPreTriggerRecord(QString* json);
+    virtual ~SWGPreTriggerRecord();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGPreTriggerRecord* fromJson(QString &jsonString);
+
+    qint32 getArmed();
+    void setArmed(qint32 armed);
+
+    QString* getFileBase();
+    void setFileBase(QString* file_base);
+
+    float getPreTriggerTime();
+    void setPreTriggerTime(float pre_trigger_time);
+
+    float getPostTriggerTime();
+    void setPostTriggerTime(float post_trigger_time);
+
+    qint32 getHugePages();
+    void setHugePages(qint32 huge_pages);
+
+    qint32 getSquelchChannelIndex();
+    void setSquelchChannelIndex(qint32 squelch_channel_index);
+
+    SWGPreTriggerRecordStatus* getStatus();
+    void setStatus(SWGPreTriggerRecordStatus* status);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 armed;
+    bool m_armed_isSet;
+
+    QString* file_base;
+    bool m_file_base_isSet;
+
+    float pre_trigger_time;
+    bool m_pre_trigger_time_isSet;
+
+    float post_trigger_time;
+    bool m_post_trigger_time_isSet;
+
+    qint32 huge_pages;
+    bool m_huge_pages_isSet;
+
+    qint32 squelch_channel_index;
+    bool m_squelch_channel_index_isSet;
+
+    SWGPreTriggerRecordStatus* status;
+    bool m_status_isSet;
+
+};
+
+}
+
+#endif /* SWGPreTriggerRecord_H_ */
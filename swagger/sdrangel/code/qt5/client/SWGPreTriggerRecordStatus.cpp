@@ -0,0 +1,320 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGPreTriggerRecordStatus.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGPreTriggerRecordStatus::SWGPreTriggerRecordStatus(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGPreTriggerRecordStatus::SWGPreTriggerRecordStatus() {
+    recording = 0;
+    m_recording_isSet = false;
+    buffer_time = 0.0f;
+    m_buffer_time_isSet = false;
+    buffered_time = 0.0f;
+    m_buffered_time_isSet = false;
+    buffer_size = 0L;
+    m_buffer_size_isSet = false;
+    huge_pages = 0;
+    m_huge_pages_isSet = false;
+    nb_triggers = 0;
+    m_nb_triggers_isSet = false;
+    nb_files = 0;
+    m_nb_files_isSet = false;
+    written_bytes = 0L;
+    m_written_bytes_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+    file_name = nullptr;
+    m_file_name_isSet = false;
+    error_message = nullptr;
+    m_error_message_isSet = false;
+}
+
+SWGPreTriggerRecordStatus::~SWGPreTriggerRecordStatus() {
+    this->cleanup();
+}
+
+void
+SWGPreTriggerRecordStatus::init() {
+    recording = 0;
+    m_recording_isSet = false;
+    buffer_time = 0.0f;
+    m_buffer_time_isSet = false;
+    buffered_time = 0.0f;
+    m_buffered_time_isSet = false;
+    buffer_size = 0L;
+    m_buffer_size_isSet = false;
+    huge_pages = 0;
+    m_huge_pages_isSet = false;
+    nb_triggers = 0;
+    m_nb_triggers_isSet = false;
+    nb_files = 0;
+    m_nb_files_isSet = false;
+    written_bytes = 0L;
+    m_written_bytes_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+    file_name = new QString("");
+    m_file_name_isSet = false;
+    error_message = new QString("");
+    m_error_message_isSet = false;
+}
+
+void
+SWGPreTriggerRecordStatus::cleanup() {
+
+
+
+
+
+
+
+
+
+    if(file_name != nullptr) { 
+        delete file_name;
+    }
+    if(error_message != nullptr) { 
+        delete error_message;
+    }
+}
+
+SWGPreTriggerRecordStatus*
+SWGPreTriggerRecordStatus::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGPreTriggerRecordStatus::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&recording, pJson["recording"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&buffer_time, pJson["bufferTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&buffered_time, pJson["bufferedTime"], "float", "");
+    
+    ::SWGSDRangel::setValue(&buffer_size, pJson["bufferSize"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&huge_pages, pJson["hugePages"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_triggers, pJson["nbTriggers"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_files, pJson["nbFiles"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&written_bytes, pJson["writtenBytes"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dropped_samples, pJson["droppedSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&file_name, pJson["fileName"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&error_message, pJson["errorMessage"], "QString", "QString");
+    
+}
+
+QString
+SWGPreTriggerRecordStatus::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGPreTriggerRecordStatus::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_recording_isSet){
+        obj->insert("recording", QJsonValue(recording));
+    }
+    if(m_buffer_time_isSet){
+        obj->insert("bufferTime", QJsonValue(buffer_time));
+    }
+    if(m_buffered_time_isSet){
+        obj->insert("bufferedTime", QJsonValue(buffered_time));
+    }
+    if(m_buffer_size_isSet){
+        obj->insert("bufferSize", QJsonValue(buffer_size));
+    }
+    if(m_huge_pages_isSet){
+        obj->insert("hugePages", QJsonValue(huge_pages));
+    }
+    if(m_nb_triggers_isSet){
+        obj->insert("nbTriggers", QJsonValue(nb_triggers));
+    }
+    if(m_nb_files_isSet){
+        obj->insert("nbFiles", QJsonValue(nb_files));
+    }
+    if(m_written_bytes_isSet){
+        obj->insert("writtenBytes", QJsonValue(written_bytes));
+    }
+    if(m_dropped_samples_isSet){
+        obj->insert("droppedSamples", QJsonValue(dropped_samples));
+    }
+    if(file_name != nullptr && *file_name != QString("")){
+        toJsonValue(QString("fileName"), file_name, obj, QString("QString"));
+    }
+    if(error_message != nullptr && *error_message != QString("")){
+        toJsonValue(QString("errorMessage"), error_message, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGPreTriggerRecordStatus::getRecording() {
+    return recording;
+}
+void
+SWGPreTriggerRecordStatus::setRecording(qint32 recording) {
+    this->recording = recording;
+    this->m_recording_isSet = true;
+}
+
+float
+SWGPreTriggerRecordStatus::getBufferTime() {
+    return buffer_time;
+}
+void
+SWGPreTriggerRecordStatus::setBufferTime(float buffer_time) {
+    this->buffer_time = buffer_time;
+    this->m_buffer_time_isSet = true;
+}
+
+float
+SWGPreTriggerRecordStatus::getBufferedTime() {
+    return buffered_time;
+}
+void
+SWGPreTriggerRecordStatus::setBufferedTime(float buffered_time) {
+    this->buffered_time = buffered_time;
+    this->m_buffered_time_isSet = true;
+}
+
+qint64
+SWGPreTriggerRecordStatus::getBufferSize() {
+    return buffer_size;
+}
+void
+SWGPreTriggerRecordStatus::setBufferSize(qint64 buffer_size) {
+    this->buffer_size = buffer_size;
+    this->m_buffer_size_isSet = true;
+}
+
+qint32
+SWGPreTriggerRecordStatus::getHugePages() {
+    return huge_pages;
+}
+void
+SWGPreTriggerRecordStatus::setHugePages(qint32 huge_pages) {
+    this->huge_pages = huge_pages;
+    this->m_huge_pages_isSet = true;
+}
+
+qint32
+SWGPreTriggerRecordStatus::getNbTriggers() {
+    return nb_triggers;
+}
+void
+SWGPreTriggerRecordStatus::setNbTriggers(qint32 nb_triggers) {
+    this->nb_triggers = nb_triggers;
+    this->m_nb_triggers_isSet = true;
+}
+
+qint32
+SWGPreTriggerRecordStatus::getNbFiles() {
+    return nb_files;
+}
+void
+SWGPreTriggerRecordStatus::setNbFiles(qint32 nb_files) {
+    this->nb_files = nb_files;
+    this->m_nb_files_isSet = true;
+}
+
+qint64
+SWGPreTriggerRecordStatus::getWrittenBytes() {
+    return written_bytes;
+}
+void
+SWGPreTriggerRecordStatus::setWrittenBytes(qint64 written_bytes) {
+    this->written_bytes = written_bytes;
+    this->m_written_bytes_isSet = true;
+}
+
+qint64
+SWGPreTriggerRecordStatus::getDroppedSamples() {
+    return dropped_samples;
+}
+void
+SWGPreTriggerRecordStatus::setDroppedSamples(qint64 dropped_samples) {
+    this->dropped_samples = dropped_samples;
+    this->m_dropped_samples_isSet = true;
+}
+
+QString*
+SWGPreTriggerRecordStatus::getFileName() {
+    return file_name;
+}
+void
+SWGPreTriggerRecordStatus::setFileName(QString* file_name) {
+    this->file_name = file_name;
+    this->m_file_name_isSet = true;
+}
+
+QString*
+SWGPreTriggerRecordStatus::getErrorMessage() {
+    return error_message;
+}
+void
+SWGPreTriggerRecordStatus::setErrorMessage(QString* error_message) {
+    this->error_message = error_message;
+    this->m_error_message_isSet = true;
+}
+
+
+bool
+SWGPreTriggerRecordStatus::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_recording_isSet){ isObjectUpdated = true; break;}
+        if(m_buffer_time_isSet){ isObjectUpdated = true; break;}
+        if(m_buffered_time_isSet){ isObjectUpdated = true; break;}
+        if(m_buffer_size_isSet){ isObjectUpdated = true; break;}
+        if(m_huge_pages_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_triggers_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_files_isSet){ isObjectUpdated = true; break;}
+        if(m_written_bytes_isSet){ isObjectUpdated = true; break;}
+        if(m_dropped_samples_isSet){ isObjectUpdated = true; break;}
+        if(file_name != nullptr && *file_name != QString("")){ isObjectUpdated = true; break;}
+        if(error_message != nullptr && *error_message != QString("")){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
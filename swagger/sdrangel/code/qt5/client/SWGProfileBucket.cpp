@@ -0,0 +1,127 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGProfileBucket.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGProfileBucket::SWGProfileBucket(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGProfileBucket::SWGProfileBucket() {
+    upper_bound = 0L;
+    m_upper_bound_isSet = false;
+    count = 0L;
+    m_count_isSet = false;
+}
+
+SWGProfileBucket::~SWGProfileBucket() {
+    this->cleanup();
+}
+
+void
+SWGProfileBucket::init() {
+    upper_bound = 0L;
+    m_upper_bound_isSet = false;
+    count = 0L;
+    m_count_isSet = false;
+}
+
+void
+SWGProfileBucket::cleanup() {
+
+
+}
+
+SWGProfileBucket*
+SWGProfileBucket::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGProfileBucket::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&upper_bound, pJson["upperBound"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&count, pJson["count"], "qint64", "");
+    
+}
+
+QString
+SWGProfileBucket::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGProfileBucket::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_upper_bound_isSet){
+        obj->insert("upperBound", QJsonValue(upper_bound));
+    }
+    if(m_count_isSet){
+        obj->insert("count", QJsonValue(count));
+    }
+
+    return obj;
+}
+
+qint64
+SWGProfileBucket::getUpperBound() {
+    return upper_bound;
+}
+void
+SWGProfileBucket::setUpperBound(qint64 upper_bound) {
+    this->upper_bound = upper_bound;
+    this->m_upper_bound_isSet = true;
+}
+
+qint64
+SWGProfileBucket::getCount() {
+    return count;
+}
+void
+SWGProfileBucket::setCount(qint64 count) {
+    this->count = count;
+    this->m_count_isSet = true;
+}
+
+
+bool
+SWGProfileBucket::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_upper_bound_isSet){ isObjectUpdated = true; break;}
+        if(m_count_isSet){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
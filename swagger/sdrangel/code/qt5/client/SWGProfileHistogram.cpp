@@ -0,0 +1,217 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGProfileHistogram.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGProfileHistogram::SWGProfileHistogram(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGProfileHistogram::SWGProfileHistogram() {
+    count = 0L;
+    m_count_isSet = false;
+    sum = 0L;
+    m_sum_isSet = false;
+    max = 0L;
+    m_max_isSet = false;
+    p50 = 0L;
+    m_p50_isSet = false;
+    p99 = 0L;
+    m_p99_isSet = false;
+    buckets = nullptr;
+    m_buckets_isSet = false;
+}
+
+SWGProfileHistogram::~SWGProfileHistogram() {
+    this->cleanup();
+}
+
+void
+SWGProfileHistogram::init() {
+    count = 0L;
+    m_count_isSet = false;
+    sum = 0L;
+    m_sum_isSet = false;
+    max = 0L;
+    m_max_isSet = false;
+    p50 = 0L;
+    m_p50_isSet = false;
+    p99 = 0L;
+    m_p99_isSet = false;
+    buckets = new QList<SWGProfileBucket*>();
+    m_buckets_isSet = false;
+}
+
+void
+SWGProfileHistogram::cleanup() {
+
+
+
+
+
+    if(buckets != nullptr) { 
+        auto arr = buckets;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete buckets;
+    }
+}
+
+SWGProfileHistogram*
+SWGProfileHistogram::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGProfileHistogram::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&count, pJson["count"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&sum, pJson["sum"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&max, pJson["max"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&p50, pJson["p50"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&p99, pJson["p99"], "qint64", "");
+    
+    
+    ::SWGSDRangel::setValue(&buckets, pJson["buckets"], "QList", "SWGProfileBucket");
+}
+
+QString
+SWGProfileHistogram::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGProfileHistogram::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_count_isSet){
+        obj->insert("count", QJsonValue(count));
+    }
+    if(m_sum_isSet){
+        obj->insert("sum", QJsonValue(sum));
+    }
+    if(m_max_isSet){
+        obj->insert("max", QJsonValue(max));
+    }
+    if(m_p50_isSet){
+        obj->insert("p50", QJsonValue(p50));
+    }
+    if(m_p99_isSet){
+        obj->insert("p99", QJsonValue(p99));
+    }
+    if(buckets->size() > 0){
+        toJsonArray((QList<void*>*)buckets, obj, "buckets", "SWGProfileBucket");
+    }
+
+    return obj;
+}
+
+qint64
+SWGProfileHistogram::getCount() {
+    return count;
+}
+void
+SWGProfileHistogram::setCount(qint64 count) {
+    this->count = count;
+    this->m_count_isSet = true;
+}
+
+qint64
+SWGProfileHistogram::getSum() {
+    return sum;
+}
+void
+SWGProfileHistogram::setSum(qint64 sum) {
+    this->sum = sum;
+    this->m_sum_isSet = true;
+}
+
+qint64
+SWGProfileHistogram::getMax() {
+    return max;
+}
+void
+SWGProfileHistogram::setMax(qint64 max) {
+    this->max = max;
+    this->m_max_isSet = true;
+}
+
+qint64
+SWGProfileHistogram::getP50() {
+    return p50;
+}
+void
+SWGProfileHistogram::setP50(qint64 p50) {
+    this->p50 = p50;
+    this->m_p50_isSet = true;
+}
+
+qint64
+SWGProfileHistogram::getP99() {
+    return p99;
+}
+void
+SWGProfileHistogram::setP99(qint64 p99) {
+    this->p99 = p99;
+    this->m_p99_isSet = true;
+}
+
+QList<SWGProfileBucket*>*
+SWGProfileHistogram::getBuckets() {
+    return buckets;
+}
+void
+SWGProfileHistogram::setBuckets(QList<SWGProfileBucket*>* buckets) {
+    this->buckets = buckets;
+    this->m_buckets_isSet = true;
+}
+
+
+bool
+SWGProfileHistogram::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_count_isSet){ isObjectUpdated = true; break;}
+        if(m_sum_isSet){ isObjectUpdated = true; break;}
+        if(m_max_isSet){ isObjectUpdated = true; break;}
+        if(m_p50_isSet){ isObjectUpdated = true; break;}
+        if(m_p99_isSet){ isObjectUpdated = true; break;}
+        if(buckets->size() > 0){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,89 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGProfileHistogram.h
+ *
+ * Histogram of durations with power of two buckets. Durations are in nanoseconds.
+ */
+
+#ifndef SWGProfileHistogram_H_
+#define SWGProfileHistogram_H_
+
+#include <QJsonObject>
+
+
+#include "SWGProfileBucket.h"
+#include <QList>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGProfileHistogram: public SWGObject {
+public:
+    SWGProfileHistogram();
+    SWGProfileHistogram(QString* json);
+    virtual ~SWGProfileHistogram();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGProfileHistogram* fromJson(QString &jsonString);
+
+    qint64 getCount();
+    void setCount(qint64 count);
+
+    qint64 getSum();
+    void setSum(qint64 sum);
+
+    qint64 getMax();
+    void setMax(qint64 max);
+
+    qint64 getP50();
+    void setP50(qint64 p50);
+
+    qint64 getP99();
+    void setP99(qint64 p99);
+
+    QList<SWGProfileBucket*>* getBuckets();
+    void setBuckets(QList<SWGProfileBucket*>* buckets);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 count;
+    bool m_count_isSet;
+
+    qint64 sum;
+    bool m_sum_isSet;
+
+    qint64 max;
+    bool m_max_isSet;
+
+    qint64 p50;
+    bool m_p50_isSet;
+
+    qint64 p99;
+    bool m_p99_isSet;
+
+    QList<SWGProfileBucket*>* buckets;
+    bool m_buckets_isSet;
+
+};
+
+}
+
+#endif /* SWGProfileHistogram_H_ */
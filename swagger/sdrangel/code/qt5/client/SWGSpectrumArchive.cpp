@@ -0,0 +1,236 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumArchive.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumArchive::SWGSpectrumArchive(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumArchive::SWGSpectrumArchive() {
+    archiving = 0;
+    m_archiving_isSet = false;
+    file_base = nullptr;
+    m_file_base_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    period = 0.0f;
+    m_period_isSet = false;
+    db_min = 0.0f;
+    m_db_min_isSet = false;
+    block_spectra = 0;
+    m_block_spectra_isSet = false;
+    status = nullptr;
+    m_status_isSet = false;
+}
+
+SWGSpectrumArchive::~SWGSpectrumArchive() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumArchive::init() {
+    archiving = 0;
+    m_archiving_isSet = false;
+    file_base = new QString("");
+    m_file_base_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    period = 0.0f;
+    m_period_isSet = false;
+    db_min = 0.0f;
+    m_db_min_isSet = false;
+    block_spectra = 0;
+    m_block_spectra_isSet = false;
+    status = new SWGSpectrumArchiveStatus();
+    m_status_isSet = false;
+}
+
+void
+SWGSpectrumArchive::cleanup() {
+
+    if(file_base != nullptr) { 
+        delete file_base;
+    }
+
+
+
+
+    if(status != nullptr) { 
+        delete status;
+    }
+}
+
+SWGSpectrumArchive*
+SWGSpectrumArchive::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumArchive::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&archiving, pJson["archiving"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&file_base, pJson["fileBase"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&period, pJson["period"], "float", "");
+    
+    ::SWGSDRangel::setValue(&db_min, pJson["dbMin"], "float", "");
+    
+    ::SWGSDRangel::setValue(&block_spectra, pJson["blockSpectra"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&status, pJson["status"], "SWGSpectrumArchiveStatus", "SWGSpectrumArchiveStatus");
+    
+}
+
+QString
+SWGSpectrumArchive::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumArchive::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_archiving_isSet){
+        obj->insert("archiving", QJsonValue(archiving));
+    }
+    if(file_base != nullptr && *file_base != QString("")){
+        toJsonValue(QString("fileBase"), file_base, obj, QString("QString"));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(m_period_isSet){
+        obj->insert("period", QJsonValue(period));
+    }
+    if(m_db_min_isSet){
+        obj->insert("dbMin", QJsonValue(db_min));
+    }
+    if(m_block_spectra_isSet){
+        obj->insert("blockSpectra", QJsonValue(block_spectra));
+    }
+    if((status != nullptr) && (status->isSet())){
+        toJsonValue(QString("status"), status, obj, QString("SWGSpectrumArchiveStatus"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGSpectrumArchive::getArchiving() {
+    return archiving;
+}
+void
+SWGSpectrumArchive::setArchiving(qint32 archiving) {
+    this->archiving = archiving;
+    this->m_archiving_isSet = true;
+}
+
+QString*
+SWGSpectrumArchive::getFileBase() {
+    return file_base;
+}
+void
+SWGSpectrumArchive::setFileBase(QString* file_base) {
+    this->file_base = file_base;
+    this->m_file_base_isSet = true;
+}
+
+qint32
+SWGSpectrumArchive::getFftSize() {
+    return fft_size;
+}
+void
+SWGSpectrumArchive::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+float
+SWGSpectrumArchive::getPeriod() {
+    return period;
+}
+void
+SWGSpectrumArchive::setPeriod(float period) {
+    this->period = period;
+    this->m_period_isSet = true;
+}
+
+float
+SWGSpectrumArchive::getDbMin() {
+    return db_min;
+}
+void
+SWGSpectrumArchive::setDbMin(float db_min) {
+    this->db_min = db_min;
+    this->m_db_min_isSet = true;
+}
+
+qint32
+SWGSpectrumArchive::getBlockSpectra() {
+    return block_spectra;
+}
+void
+SWGSpectrumArchive::setBlockSpectra(qint32 block_spectra) {
+    this->block_spectra = block_spectra;
+    this->m_block_spectra_isSet = true;
+}
+
+SWGSpectrumArchiveStatus*
+SWGSpectrumArchive::getStatus() {
+    return status;
+}
+void
+SWGSpectrumArchive::setStatus(SWGSpectrumArchiveStatus* status) {
+    this->status = status;
+    this->m_status_isSet = true;
+}
+
+
+bool
+SWGSpectrumArchive::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_archiving_isSet){ isObjectUpdated = true; break;}
+        if(file_base != nullptr && *file_base != QString("")){ isObjectUpdated = true; break;}
+        if(m_fft_size_isSet){ isObjectUpdated = true; break;}
+        if(m_period_isSet){ isObjectUpdated = true; break;}
+        if(m_db_min_isSet){ isObjectUpdated = true; break;}
+        if(m_block_spectra_isSet){ isObjectUpdated = true; break;}
+        if(status != nullptr && status->isSet()){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
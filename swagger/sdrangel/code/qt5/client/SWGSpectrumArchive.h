@@ -0,0 +1,95 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumArchive.h
+ *
+ * Long term spectrum archive of a receiving device set. Power spectra averaged over the period are stored as 0.5 dB codes in delta coded and compressed blocks in <fileBase>.sdrspec with a time index in <fileBase>.sdrspec-idx. An existing archive is appended to.
+ */
+
+#ifndef SWGSpectrumArchive_H_
+#define SWGSpectrumArchive_H_
+
+#include <QJsonObject>
+
+
+#include "SWGSpectrumArchiveStatus.h"
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGSpectrumArchive: public SWGObject {
+public:
+    SWGSpectrumArchive();
+    SWGSpectrumArchive(QString* json);
+    virtual ~SWGSpectrumArchive();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGSpectrumArchive* fromJson(QString &jsonString);
+
+    qint32 getArchiving();
+    void setArchiving(qint32 archiving);
+
+    QString* getFileBase();
+    void setFileBase(QString* file_base);
+
+    qint32 getFftSize();
+    void setFftSize(qint32 fft_size);
+
+    float getPeriod();
+    void setPeriod(float period);
+
+    float getDbMin();
+    void setDbMin(float db_min);
+
+    qint32 getBlockSpectra();
+    void setBlockSpectra(qint32 block_spectra);
+
+    SWGSpectrumArchiveStatus* getStatus();
+    void setStatus(SWGSpectrumArchiveStatus* status);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 archiving;
+    bool m_archiving_isSet;
+
+    QString* file_base;
+    bool m_file_base_isSet;
+
+    qint32 fft_size;
+    bool m_fft_size_isSet;
+
+    float period;
+    bool m_period_isSet;
+
+    float db_min;
+    bool m_db_min_isSet;
+
+    qint32 block_spectra;
+    bool m_block_spectra_isSet;
+
+    SWGSpectrumArchiveStatus* status;
+    bool m_status_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumArchive_H_ */
@@ -0,0 +1,177 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumArchiveQuery.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumArchiveQuery::SWGSpectrumArchiveQuery(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumArchiveQuery::SWGSpectrumArchiveQuery() {
+    file_base = nullptr;
+    m_file_base_isSet = false;
+    from = 0L;
+    m_from_isSet = false;
+    to = 0L;
+    m_to_isSet = false;
+    spectra = nullptr;
+    m_spectra_isSet = false;
+}
+
+SWGSpectrumArchiveQuery::~SWGSpectrumArchiveQuery() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumArchiveQuery::init() {
+    file_base = new QString("");
+    m_file_base_isSet = false;
+    from = 0L;
+    m_from_isSet = false;
+    to = 0L;
+    m_to_isSet = false;
+    spectra = new QList<SWGSpectrumArchiveSpectrum*>();
+    m_spectra_isSet = false;
+}
+
+void
+SWGSpectrumArchiveQuery::cleanup() {
+    if(file_base != nullptr) { 
+        delete file_base;
+    }
+
+
+    if(spectra != nullptr) { 
+        auto arr = spectra;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete spectra;
+    }
+}
+
+SWGSpectrumArchiveQuery*
+SWGSpectrumArchiveQuery::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumArchiveQuery::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&file_base, pJson["fileBase"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&from, pJson["from"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&to, pJson["to"], "qint64", "");
+    
+    
+    ::SWGSDRangel::setValue(&spectra, pJson["spectra"], "QList", "SWGSpectrumArchiveSpectrum");
+}
+
+QString
+SWGSpectrumArchiveQuery::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumArchiveQuery::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(file_base != nullptr && *file_base != QString("")){
+        toJsonValue(QString("fileBase"), file_base, obj, QString("QString"));
+    }
+    if(m_from_isSet){
+        obj->insert("from", QJsonValue(from));
+    }
+    if(m_to_isSet){
+        obj->insert("to", QJsonValue(to));
+    }
+    if(spectra->size() > 0){
+        toJsonArray((QList<void*>*)spectra, obj, "spectra", "SWGSpectrumArchiveSpectrum");
+    }
+
+    return obj;
+}
+
+QString*
+SWGSpectrumArchiveQuery::getFileBase() {
+    return file_base;
+}
+void
+SWGSpectrumArchiveQuery::setFileBase(QString* file_base) {
+    this->file_base = file_base;
+    this->m_file_base_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveQuery::getFrom() {
+    return from;
+}
+void
+SWGSpectrumArchiveQuery::setFrom(qint64 from) {
+    this->from = from;
+    this->m_from_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveQuery::getTo() {
+    return to;
+}
+void
+SWGSpectrumArchiveQuery::setTo(qint64 to) {
+    this->to = to;
+    this->m_to_isSet = true;
+}
+
+QList<SWGSpectrumArchiveSpectrum*>*
+SWGSpectrumArchiveQuery::getSpectra() {
+    return spectra;
+}
+void
+SWGSpectrumArchiveQuery::setSpectra(QList<SWGSpectrumArchiveSpectrum*>* spectra) {
+    this->spectra = spectra;
+    this->m_spectra_isSet = true;
+}
+
+
+bool
+SWGSpectrumArchiveQuery::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(file_base != nullptr && *file_base != QString("")){ isObjectUpdated = true; break;}
+        if(m_from_isSet){ isObjectUpdated = true; break;}
+        if(m_to_isSet){ isObjectUpdated = true; break;}
+        if(spectra->size() > 0){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,78 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumArchiveQuery.h
+ *
+ * Archived spectra of a time range, oldest first
+ */
+
+#ifndef SWGSpectrumArchiveQuery_H_
+#define SWGSpectrumArchiveQuery_H_
+
+#include <QJsonObject>
+
+
+#include "SWGSpectrumArchiveSpectrum.h"
+#include <QList>
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGSpectrumArchiveQuery: public SWGObject {
+public:
+    SWGSpectrumArchiveQuery();
+    SWGSpectrumArchiveQuery(QString* json);
+    virtual ~SWGSpectrumArchiveQuery();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGSpectrumArchiveQuery* fromJson(QString &jsonString);
+
+    QString* getFileBase();
+    void setFileBase(QString* file_base);
+
+    qint64 getFrom();
+    void setFrom(qint64 from);
+
+    qint64 getTo();
+    void setTo(qint64 to);
+
+    QList<SWGSpectrumArchiveSpectrum*>* getSpectra();
+    void setSpectra(QList<SWGSpectrumArchiveSpectrum*>* spectra);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* file_base;
+    bool m_file_base_isSet;
+
+    qint64 from;
+    bool m_from_isSet;
+
+    qint64 to;
+    bool m_to_isSet;
+
+    QList<SWGSpectrumArchiveSpectrum*>* spectra;
+    bool m_spectra_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumArchiveQuery_H_ */
@@ -0,0 +1,234 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumArchiveSpectrum.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumArchiveSpectrum::SWGSpectrumArchiveSpectrum(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumArchiveSpectrum::SWGSpectrumArchiveSpectrum() {
+    time = 0L;
+    m_time_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    db_offset = 0.0f;
+    m_db_offset_isSet = false;
+    db_step = 0.0f;
+    m_db_step_isSet = false;
+    nb_merged = 0;
+    m_nb_merged_isSet = false;
+    codes = nullptr;
+    m_codes_isSet = false;
+}
+
+SWGSpectrumArchiveSpectrum::~SWGSpectrumArchiveSpectrum() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumArchiveSpectrum::init() {
+    time = 0L;
+    m_time_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    db_offset = 0.0f;
+    m_db_offset_isSet = false;
+    db_step = 0.0f;
+    m_db_step_isSet = false;
+    nb_merged = 0;
+    m_nb_merged_isSet = false;
+    codes = new QString("");
+    m_codes_isSet = false;
+}
+
+void
+SWGSpectrumArchiveSpectrum::cleanup() {
+
+
+
+
+
+
+    if(codes != nullptr) { 
+        delete codes;
+    }
+}
+
+SWGSpectrumArchiveSpectrum*
+SWGSpectrumArchiveSpectrum::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumArchiveSpectrum::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&time, pJson["time"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&db_offset, pJson["dbOffset"], "float", "");
+    
+    ::SWGSDRangel::setValue(&db_step, pJson["dbStep"], "float", "");
+    
+    ::SWGSDRangel::setValue(&nb_merged, pJson["nbMerged"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&codes, pJson["codes"], "QString", "QString");
+    
+}
+
+QString
+SWGSpectrumArchiveSpectrum::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumArchiveSpectrum::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_time_isSet){
+        obj->insert("time", QJsonValue(time));
+    }
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_db_offset_isSet){
+        obj->insert("dbOffset", QJsonValue(db_offset));
+    }
+    if(m_db_step_isSet){
+        obj->insert("dbStep", QJsonValue(db_step));
+    }
+    if(m_nb_merged_isSet){
+        obj->insert("nbMerged", QJsonValue(nb_merged));
+    }
+    if(codes != nullptr && *codes != QString("")){
+        toJsonValue(QString("codes"), codes, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint64
+SWGSpectrumArchiveSpectrum::getTime() {
+    return time;
+}
+void
+SWGSpectrumArchiveSpectrum::setTime(qint64 time) {
+    this->time = time;
+    this->m_time_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveSpectrum::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGSpectrumArchiveSpectrum::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveSpectrum::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGSpectrumArchiveSpectrum::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+float
+SWGSpectrumArchiveSpectrum::getDbOffset() {
+    return db_offset;
+}
+void
+SWGSpectrumArchiveSpectrum::setDbOffset(float db_offset) {
+    this->db_offset = db_offset;
+    this->m_db_offset_isSet = true;
+}
+
+float
+SWGSpectrumArchiveSpectrum::getDbStep() {
+    return db_step;
+}
+void
+SWGSpectrumArchiveSpectrum::setDbStep(float db_step) {
+    this->db_step = db_step;
+    this->m_db_step_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveSpectrum::getNbMerged() {
+    return nb_merged;
+}
+void
+SWGSpectrumArchiveSpectrum::setNbMerged(qint32 nb_merged) {
+    this->nb_merged = nb_merged;
+    this->m_nb_merged_isSet = true;
+}
+
+QString*
+SWGSpectrumArchiveSpectrum::getCodes() {
+    return codes;
+}
+void
+SWGSpectrumArchiveSpectrum::setCodes(QString* codes) {
+    this->codes = codes;
+    this->m_codes_isSet = true;
+}
+
+
+bool
+SWGSpectrumArchiveSpectrum::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_time_isSet){ isObjectUpdated = true; break;}
+        if(m_center_frequency_isSet){ isObjectUpdated = true; break;}
+        if(m_sample_rate_isSet){ isObjectUpdated = true; break;}
+        if(m_db_offset_isSet){ isObjectUpdated = true; break;}
+        if(m_db_step_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_merged_isSet){ isObjectUpdated = true; break;}
+        if(codes != nullptr && *codes != QString("")){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
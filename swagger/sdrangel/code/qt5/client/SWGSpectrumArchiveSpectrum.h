@@ -0,0 +1,94 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumArchiveSpectrum.h
+ *
+ * One line of the waterfall. The dB value of a bin is dbOffset + code * dbStep.
+ */
+
+#ifndef SWGSpectrumArchiveSpectrum_H_
+#define SWGSpectrumArchiveSpectrum_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGSpectrumArchiveSpectrum: public SWGObject {
+public:
+    SWGSpectrumArchiveSpectrum();
+    SWGSpectrumArchiveSpectrum(QString* json);
+    virtual ~SWGSpectrumArchiveSpectrum();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGSpectrumArchiveSpectrum* fromJson(QString &jsonString);
+
+    qint64 getTime();
+    void setTime(qint64 time);
+
+    qint64 getCenterFrequency();
+    void setCenterFrequency(qint64 center_frequency);
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    float getDbOffset();
+    void setDbOffset(float db_offset);
+
+    float getDbStep();
+    void setDbStep(float db_step);
+
+    qint32 getNbMerged();
+    void setNbMerged(qint32 nb_merged);
+
+    QString* getCodes();
+    void setCodes(QString* codes);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 time;
+    bool m_time_isSet;
+
+    qint64 center_frequency;
+    bool m_center_frequency_isSet;
+
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    float db_offset;
+    bool m_db_offset_isSet;
+
+    float db_step;
+    bool m_db_step_isSet;
+
+    qint32 nb_merged;
+    bool m_nb_merged_isSet;
+
+    QString* codes;
+    bool m_codes_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumArchiveSpectrum_H_ */
@@ -0,0 +1,257 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGSpectrumArchiveStatus.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGSpectrumArchiveStatus::SWGSpectrumArchiveStatus(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGSpectrumArchiveStatus::SWGSpectrumArchiveStatus() {
+    file_name = nullptr;
+    m_file_name_isSet = false;
+    nb_spectra = 0L;
+    m_nb_spectra_isSet = false;
+    nb_blocks = 0;
+    m_nb_blocks_isSet = false;
+    written_bytes = 0L;
+    m_written_bytes_isSet = false;
+    raw_bytes = 0L;
+    m_raw_bytes_isSet = false;
+    dropped_spectra = 0L;
+    m_dropped_spectra_isSet = false;
+    last_time = 0L;
+    m_last_time_isSet = false;
+    error_message = nullptr;
+    m_error_message_isSet = false;
+}
+
+SWGSpectrumArchiveStatus::~SWGSpectrumArchiveStatus() {
+    this->cleanup();
+}
+
+void
+SWGSpectrumArchiveStatus::init() {
+    file_name = new QString("");
+    m_file_name_isSet = false;
+    nb_spectra = 0L;
+    m_nb_spectra_isSet = false;
+    nb_blocks = 0;
+    m_nb_blocks_isSet = false;
+    written_bytes = 0L;
+    m_written_bytes_isSet = false;
+    raw_bytes = 0L;
+    m_raw_bytes_isSet = false;
+    dropped_spectra = 0L;
+    m_dropped_spectra_isSet = false;
+    last_time = 0L;
+    m_last_time_isSet = false;
+    error_message = new QString("");
+    m_error_message_isSet = false;
+}
+
+void
+SWGSpectrumArchiveStatus::cleanup() {
+    if(file_name != nullptr) { 
+        delete file_name;
+    }
+
+
+
+
+
+
+    if(error_message != nullptr) { 
+        delete error_message;
+    }
+}
+
+SWGSpectrumArchiveStatus*
+SWGSpectrumArchiveStatus::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGSpectrumArchiveStatus::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&file_name, pJson["fileName"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&nb_spectra, pJson["nbSpectra"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_blocks, pJson["nbBlocks"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&written_bytes, pJson["writtenBytes"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&raw_bytes, pJson["rawBytes"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&dropped_spectra, pJson["droppedSpectra"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&last_time, pJson["lastTime"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&error_message, pJson["errorMessage"], "QString", "QString");
+    
+}
+
+QString
+SWGSpectrumArchiveStatus::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGSpectrumArchiveStatus::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(file_name != nullptr && *file_name != QString("")){
+        toJsonValue(QString("fileName"), file_name, obj, QString("QString"));
+    }
+    if(m_nb_spectra_isSet){
+        obj->insert("nbSpectra", QJsonValue(nb_spectra));
+    }
+    if(m_nb_blocks_isSet){
+        obj->insert("nbBlocks", QJsonValue(nb_blocks));
+    }
+    if(m_written_bytes_isSet){
+        obj->insert("writtenBytes", QJsonValue(written_bytes));
+    }
+    if(m_raw_bytes_isSet){
+        obj->insert("rawBytes", QJsonValue(raw_bytes));
+    }
+    if(m_dropped_spectra_isSet){
+        obj->insert("droppedSpectra", QJsonValue(dropped_spectra));
+    }
+    if(m_last_time_isSet){
+        obj->insert("lastTime", QJsonValue(last_time));
+    }
+    if(error_message != nullptr && *error_message != QString("")){
+        toJsonValue(QString("errorMessage"), error_message, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+QString*
+SWGSpectrumArchiveStatus::getFileName() {
+    return file_name;
+}
+void
+SWGSpectrumArchiveStatus::setFileName(QString* file_name) {
+    this->file_name = file_name;
+    this->m_file_name_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getNbSpectra() {
+    return nb_spectra;
+}
+void
+SWGSpectrumArchiveStatus::setNbSpectra(qint64 nb_spectra) {
+    this->nb_spectra = nb_spectra;
+    this->m_nb_spectra_isSet = true;
+}
+
+qint32
+SWGSpectrumArchiveStatus::getNbBlocks() {
+    return nb_blocks;
+}
+void
+SWGSpectrumArchiveStatus::setNbBlocks(qint32 nb_blocks) {
+    this->nb_blocks = nb_blocks;
+    this->m_nb_blocks_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getWrittenBytes() {
+    return written_bytes;
+}
+void
+SWGSpectrumArchiveStatus::setWrittenBytes(qint64 written_bytes) {
+    this->written_bytes = written_bytes;
+    this->m_written_bytes_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getRawBytes() {
+    return raw_bytes;
+}
+void
+SWGSpectrumArchiveStatus::setRawBytes(qint64 raw_bytes) {
+    this->raw_bytes = raw_bytes;
+    this->m_raw_bytes_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getDroppedSpectra() {
+    return dropped_spectra;
+}
+void
+SWGSpectrumArchiveStatus::setDroppedSpectra(qint64 dropped_spectra) {
+    this->dropped_spectra = dropped_spectra;
+    this->m_dropped_spectra_isSet = true;
+}
+
+qint64
+SWGSpectrumArchiveStatus::getLastTime() {
+    return last_time;
+}
+void
+SWGSpectrumArchiveStatus::setLastTime(qint64 last_time) {
+    this->last_time = last_time;
+    this->m_last_time_isSet = true;
+}
+
+QString*
+SWGSpectrumArchiveStatus::getErrorMessage() {
+    return error_message;
+}
+void
+SWGSpectrumArchiveStatus::setErrorMessage(QString* error_message) {
+    this->error_message = error_message;
+    this->m_error_message_isSet = true;
+}
+
+
+bool
+SWGSpectrumArchiveStatus::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(file_name != nullptr && *file_name != QString("")){ isObjectUpdated = true; break;}
+        if(m_nb_spectra_isSet){ isObjectUpdated = true; break;}
+        if(m_nb_blocks_isSet){ isObjectUpdated = true; break;}
+        if(m_written_bytes_isSet){ isObjectUpdated = true; break;}
+        if(m_raw_bytes_isSet){ isObjectUpdated = true; break;}
+        if(m_dropped_spectra_isSet){ isObjectUpdated = true; break;}
+        if(m_last_time_isSet){ isObjectUpdated = true; break;}
+        if(error_message != nullptr && *error_message != QString("")){ isObjectUpdated = true; break;}
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,100 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube     ---   Limitations and specifcities:       * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Stopping instance i.e. /sdrangel with DELETE method is a server only feature. It allows stopping the instance nicely.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV demodulator, Channel Analyzer, Channel Analyzer NG, LoRa demodulator, TCP source   * The content type returned is always application/json except in the following cases:     * An incorrect URL was specified: this document is returned as text/html with a status 400    --- 
+ *
+ * OpenAPI spec version: 4.0.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGSpectrumArchiveStatus.h
+ *
+ * Spectrum archive status (read only)
+ */
+
+#ifndef SWGSpectrumArchiveStatus_H_
+#define SWGSpectrumArchiveStatus_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+
+namespace SWGSDRangel {
+
+class SWGSpectrumArchiveStatus: public SWGObject {
+public:
+    SWGSpectrumArchiveStatus();
+    SWGSpectrumArchiveStatus(QString* json);
+    virtual ~SWGSpectrumArchiveStatus();
+    void init();
+    void cleanup();
+
+    QString asJson ();
+    QJsonObject* asJsonObject();
+    void fromJsonObject(QJsonObject &json);
+    SWGSpectrumArchiveStatus* fromJson(QString &jsonString);
+
+    QString* getFileName();
+    void setFileName(QString* file_name);
+
+    qint64 getNbSpectra();
+    void setNbSpectra(qint64 nb_spectra);
+
+    qint32 getNbBlocks();
+    void setNbBlocks(qint32 nb_blocks);
+
+    qint64 getWrittenBytes();
+    void setWrittenBytes(qint64 written_bytes);
+
+    qint64 getRawBytes();
+    void setRawBytes(qint64 raw_bytes);
+
+    qint64 getDroppedSpectra();
+    void setDroppedSpectra(qint64 dropped_spectra);
+
+    qint64 getLastTime();
+    void setLastTime(qint64 last_time);
+
+    QString* getErrorMessage();
+    void setErrorMessage(QString* error_message);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* file_name;
+    bool m_file_name_isSet;
+
+    qint64 nb_spectra;
+    bool m_nb_spectra_isSet;
+
+    qint32 nb_blocks;
+    bool m_nb_blocks_isSet;
+
+    qint64 written_bytes;
+    bool m_written_bytes_isSet;
+
+    qint64 raw_bytes;
+    bool m_raw_bytes_isSet;
+
+    qint64 dropped_spectra;
+    bool m_dropped_spectra_isSet;
+
+    qint64 last_time;
+    bool m_last_time_isSet;
+
+    QString* error_message;
+    bool m_error_message_isSet;
+
+};
+
+}
+
+#endif /* SWGSpectrumArchiveStatus_H_ */
@@ -0,0 +1,196 @@
+#!/usr/bin/env python
+
+"""
+Load test of the web API server. Several clients send GET requests on the same URIs
+as fast as possible over persistent (keep-alive) connections, optionally pipelining
+several requests before reading the responses. Reports requests per second and latency
+percentiles.
+"""
+
+import socket, threading, time, sys, traceback
+from optparse import OptionParser
+
+# ======================================================================
+def getInputOptions():
+
+    parser = OptionParser(usage="usage: %%prog [-a address] [-c clients] [-n requests] [-p pipeline] [-u uri]...\n")
+    parser.add_option("-a", "--address", dest="address", help="address and port", metavar="ADDRESS", type="string", default="127.0.0.1:8091")
+    parser.add_option("-c", "--clients", dest="clients", help="number of concurrent connections", metavar="CLIENTS", type="int", default=8)
+    parser.add_option("-n", "--requests", dest="requests", help="number of requests per connection", metavar="REQUESTS", type="int", default=1000)
+    parser.add_option("-p", "--pipeline", dest="pipeline", help="requests sent before reading responses", metavar="DEPTH", type="int", default=1)
+    parser.add_option("-u", "--uri", dest="uris", help="URI to request (repeat for several)", metavar="URI", type="string", action="append")
+    parser.add_option("-k", "--no-keep-alive", dest="no_keep_alive", help="open a new connection for each request", action="store_true", default=False)
+
+    (options, args) = parser.parse_args()
+
+    if options.uris is None:
+        options.uris = ["/sdrangel", "/sdrangel/devicesets", "/sdrangel/metrics"]
+
+    if options.clients < 1:
+        options.clients = 1
+
+    if options.pipeline < 1:
+        options.pipeline = 1
+
+    return options
+
+# ======================================================================
+class HttpClient:
+    """ Minimal HTTP/1.1 client on a raw socket so that requests can be pipelined """
+
+    def __init__(self, host, port):
+        self.host = host
+        self.port = port
+        self.sock = None
+        self.buffer = b""
+
+    def connect(self):
+        self.sock = socket.create_connection((self.host, self.port))
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.buffer = b""
+
+    def close(self):
+        if self.sock is not None:
+            self.sock.close()
+            self.sock = None
+
+    def send(self, uri, close):
+        request = "GET %s HTTP/1.1\r\nHost: %s:%d\r\n%s\r\n" % (uri, self.host, self.port, "Connection: close\r\n" if close else "")
+        self.sock.sendall(request.encode("ascii"))
+
+    def fill(self):
+        data = self.sock.recv(65536)
+        if not data:
+            raise IOError("connection closed by server")
+        self.buffer += data
+
+    def readResponse(self):
+        """ Returns (status code, keep alive) """
+        while b"\r\n\r\n" not in self.buffer:
+            self.fill()
+        head, self.buffer = self.buffer.split(b"\r\n\r\n", 1)
+        lines = head.decode("latin-1").split("\r\n")
+        status = int(lines[0].split(" ")[1])
+        headers = {}
+        for line in lines[1:]:
+            name, value = line.split(":", 1)
+            headers[name.strip().lower()] = value.strip()
+        keepAlive = headers.get("connection", "").lower() != "close"
+        if "content-length" in headers:
+            length = int(headers["content-length"])
+            while len(self.buffer) < length:
+                self.fill()
+            self.buffer = self.buffer[length:]
+        elif headers.get("transfer-encoding", "").lower() == "chunked":
+            while True:
+                while b"\r\n" not in self.buffer:
+                    self.fill()
+                sizeLine, self.buffer = self.buffer.split(b"\r\n", 1)
+                size = int(sizeLine.split(b";")[0], 16)
+                while len(self.buffer) < size + 2:
+                    self.fill()
+                self.buffer = self.buffer[size + 2:]
+                if size == 0:
+                    break
+        else:
+            keepAlive = False
+            try:
+                while True:
+                    self.fill()
+            except IOError:
+                pass
+            self.buffer = b""
+        return status, keepAlive
+
+# ======================================================================
+def runClient(options, host, port, results, lock):
+    client = HttpClient(host, port)
+    latencies = []
+    errors = 0
+    sent = 0
+    uriIndex = 0
+
+    try:
+        client.connect()
+
+        while sent < options.requests:
+            depth = min(options.pipeline, options.requests - sent)
+            startTimes = []
+
+            for i in range(depth):
+                startTimes.append(time.time())
+                client.send(options.uris[uriIndex % len(options.uris)], options.no_keep_alive)
+                uriIndex += 1
+                if options.no_keep_alive:
+                    break
+
+            for start in startTimes:
+                status, keepAlive = client.readResponse()
+                latencies.append(time.time() - start)
+                if status // 100 != 2:
+                    errors += 1
+
+            sent += len(startTimes)
+
+            if options.no_keep_alive or not keepAlive:
+                client.close()
+                client.connect()
+
+    except Exception as ex:
+        errors += 1
+        sys.stderr.write("client error: %s\n" % ex)
+
+    client.close()
+
+    with lock:
+        results["latencies"] += latencies
+        results["errors"] += errors
+
+# ======================================================================
+def percentile(sortedValues, p):
+    if len(sortedValues) == 0:
+        return 0.0
+    index = int(round(p * (len(sortedValues) - 1)))
+    return sortedValues[index]
+
+# ======================================================================
+def main():
+    try:
+        options = getInputOptions()
+        host, port = options.address.split(":")
+        port = int(port)
+        results = {"latencies": [], "errors": 0}
+        lock = threading.Lock()
+        threads = []
+
+        start = time.time()
+
+        for i in range(options.clients):
+            thread = threading.Thread(target=runClient, args=(options, host, port, results, lock))
+            thread.start()
+            threads.append(thread)
+
+        for thread in threads:
+            thread.join()
+
+        elapsed = time.time() - start
+        latencies = sorted(results["latencies"])
+        nbRequests = len(latencies)
+
+        print("clients: %d pipeline: %d keep-alive: %s" % (options.clients, options.pipeline, "no" if options.no_keep_alive else "yes"))
+        print("requests: %d errors: %d time: %.3f s" % (nbRequests, results["errors"], elapsed))
+        if elapsed > 0:
+            print("requests/s: %.1f" % (nbRequests / elapsed))
+        print("latency ms: p50 %.3f p90 %.3f p99 %.3f max %.3f" % (
+            percentile(latencies, 0.5) * 1000.0,
+            percentile(latencies, 0.9) * 1000.0,
+            percentile(latencies, 0.99) * 1000.0,
+            (latencies[-1] if nbRequests > 0 else 0.0) * 1000.0))
+
+    except Exception as ex:
+        tb = traceback.format_exc()
+        sys.stderr.write(tb)
+
+
+if __name__ == "__main__":
+    main()